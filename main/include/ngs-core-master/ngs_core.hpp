@@ -10,6 +10,7 @@
 #include <list>
 #include <tuple>
 #include <mutex>
+#include <condition_variable>
 #include <iomanip>
 #include <cstring>
 #include <climits>
@@ -32,6 +32,8 @@ namespace ngstd
   // #endif
   int TaskManager::sleep_usecs = 1000;
   bool TaskManager::sleep = false;
+  double TaskManager::spin_time = -1;
+  void (*TaskManager::thread_start_function)(int) = nullptr;
 
   const function<void(TaskInfo&)> * TaskManager::func;
   const function<void()> * TaskManager::startup_function = nullptr;
@@ -134,6 +136,7 @@ namespace ngstd
       sleep = false;
       sleep_usecs = 1000;
       active_workers = 0;
+      parked_workers = 0;
 
       //static int cnt = 0;
   //    char buf[100];
@@ -176,7 +179,11 @@ namespace ngstd
   //extern size_t dummy_thread_times[NgProfiler::SIZE];
   void TaskManager :: StopWorkers()
   {
-    done = true;
+    {
+      lock_guard<mutex> lock(park_mutex); //parked workers check done under lock
+      done = true;
+    }
+    park_condition.notify_all();
 
     // collect timings
     //for (size_t i = 0; i < num_threads; i++)
@@ -238,6 +245,7 @@ namespace ngstd
         nodedata[j]->participate |= 1;
         // nodedata[j]->participate.store (1, memory_order_release);
       }
+    WakeParkedWorkers();
     if (startup_function) (*startup_function)();
     
     int thd = 0;
@@ -330,6 +338,17 @@ namespace ngstd
     for (auto ap : sync)
       ap->load(); // memory_order_acquire);
   }
+
+  //notify parked workers after new job; jobnr and parked_workers are seq_cst:
+  //either worker sees new jobnr before parking or main thread sees parked worker
+  void TaskManager :: WakeParkedWorkers()
+  {
+    if (parked_workers.load())
+      {
+        { lock_guard<mutex> lock(park_mutex); } //worker is either not yet checking or already waiting
+        park_condition.notify_all();
+      }
+  }
     
   void TaskManager :: Loop(int thd)
   {
@@ -341,6 +360,8 @@ namespace ngstd
     //static Timer texit("exit zone");
     //static Timer tdec("decrement");
     thread_id = thd;
+    if (thread_start_function)
+      (*thread_start_function)(thd);
 
     sync[thread_id] = new atomic<int>(0);
 
@@ -365,6 +386,8 @@ namespace ngstd
     active_workers++;
     workers_on_node[mynode]++;
     int jobdone = 0;
+    bool idle = false;
+    auto idle_end = chrono::steady_clock::now();
 
 
 #ifdef USE_MKL
@@ -381,6 +404,24 @@ namespace ngstd
         if (jobnr == jobdone)
           {
             // RegionTracer t(ti.thread_nr, tCASyield, ti.task_nr);            
+            if (spin_time >= 0)
+              {
+                if (!idle)
+                  {
+                    idle = true;
+                    idle_end = chrono::steady_clock::now() + chrono::duration_cast<chrono::steady_clock::duration>(chrono::duration<double>(spin_time));
+                  }
+                else if (chrono::steady_clock::now() > idle_end)
+                  {
+                    //park thread until next job, e.g., during factorization or Python user functions
+                    unique_lock<mutex> lock(park_mutex);
+                    parked_workers++;
+                    park_condition.wait(lock, [this, jobdone]() { return jobnr.load() != jobdone || done.load(); });
+                    parked_workers--;
+                    idle = false;
+                    continue;
+                  }
+              }
             if(sleep)
               this_thread::sleep_for(chrono::microseconds(sleep_usecs));
             else
@@ -393,6 +434,7 @@ namespace ngstd
               }
             continue;
           }
+        idle = false;
         
         /*
         while (mynode_data.participate.load(memory_order_relaxed) == -1)
@@ -60,6 +60,11 @@ namespace ngstd
     Array<atomic<int>*> sync;
 	static int sleep_usecs;
 	static bool sleep;
+	static double spin_time;		//time in seconds that idle workers spin before they are parked; negative: never park
+	static void (*thread_start_function)(int);	//called by worker thread i at start with i, e.g., to pin thread to core
+	mutex park_mutex;
+	condition_variable park_condition;
+	atomic<int> parked_workers;
 
     NodeData *nodedata[4];
 
@@ -88,6 +93,17 @@ namespace ngstd
 		sleep = true;
     }
     static void ResumeWorkers() { sleep = false; }
+	//set time (seconds) that idle workers spin before they are parked (negative: never park) and function called at start of each worker
+	static void SetWaitPolicy(double aspin_time, void (*athread_start_function)(int) = nullptr)
+	{
+		if (IsRunning())
+		  {
+			cerr << "Warning: can't change wait policy while TaskManager active!" << endl;
+			return;
+		  }
+		spin_time = aspin_time;
+		thread_start_function = athread_start_function;
+	}
 
 	static bool IsRunning() { return (task_manager && task_manager->active_workers > 0); }
 	static void SetNumThreads(int amax_threads);
@@ -109,6 +125,7 @@ namespace ngstd
 
     void Done() { done = true; }
     void Loop(int thread_num);
+    void WakeParkedWorkers();
 
     static list<tuple<string,double>> Timing ();
   };
@@ -0,0 +1,83 @@
+#+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+# This is an EXUDYN example
+#
+# Details:  Benchmark for symbolic user functions: compares Python user functions,
+#           symbolic user functions evaluating expression trees and
+#           symbolic user functions compiled into flat tape of instructions
+#
+# Date:     2026-10-17
+#
+# Copyright:This file is part of Exudyn. Exudyn is free software. You can redistribute it and/or modify it under the terms of the Exudyn license. See 'LICENSE.txt' for more details.
+#
+#+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+import sys
+sys.exudynFast = True
+
+import exudyn as exu
+esym = exu.symbolic
+from exudyn.utilities import *
+import numpy as np
+import time
+
+nMasses = 200       #number of masses in chain
+endTime = 1
+stepSize = 1e-4
+
+#nonlinear spring-damper law, used as Python and as symbolic user function
+def SpringForce(mysym, deltaL, deltaL_t, stiffness, damping, force):
+    fNonlinear = stiffness*deltaL + 0.1*stiffness*mysym.sign(deltaL)*(mysym.abs(deltaL))**1.5
+    return fNonlinear*(1+0.01*mysym.tanh(10*deltaL)) + damping*deltaL_t + force
+
+def PythonUF(mbs, t, itemNumber, deltaL, deltaL_t, stiffness, damping, force):
+    return SpringForce(np, deltaL, deltaL_t, stiffness, damping, force)
+
+def SymbolicUF(mbs, t, itemNumber, deltaL, deltaL_t, stiffness, damping, force):
+    return SpringForce(esym, deltaL, deltaL_t, stiffness, damping, force)
+
+#mode: 'Python', 'Symbolic' (expression trees) or 'Compiled' (tape)
+#compiled symbolic user functions are thread safe and can be evaluated with several threads
+def RunModel(mode, numberOfThreads=1):
+    SC = exu.SystemContainer()
+    mbs = SC.AddSystem()
+
+    oGround = mbs.CreateGround()
+    bodyPrevious = oGround
+    connectors = []
+    for i in range(nMasses):
+        body = mbs.CreateMassPoint(referencePosition=[i+1,0,0], physicsMass=1, gravity=[0,-9.81,0])
+        connectors += [mbs.CreateSpringDamper(bodyList=[bodyPrevious, body], stiffness=1e4, damping=10, referenceLength=1)]
+        bodyPrevious = body
+
+    listUF = [] #keep symbolic user functions alive
+    for co in connectors:
+        if mode == 'Python':
+            mbs.SetObjectParameter(co, 'springForceUserFunction', PythonUF)
+        else:
+            symbolicFunc = CreateSymbolicUserFunction(mbs, SymbolicUF, 'springForceUserFunction', co,
+                                                      compile = (mode == 'Compiled'))
+            mbs.SetObjectParameter(co, 'springForceUserFunction', symbolicFunc)
+            listUF += [symbolicFunc]
+
+    mbs.Assemble()
+
+    simulationSettings = exu.SimulationSettings()
+    simulationSettings.solutionSettings.writeSolutionToFile = False
+    simulationSettings.timeIntegration.numberOfSteps = int(endTime/stepSize)
+    simulationSettings.timeIntegration.endTime = endTime
+    simulationSettings.timeIntegration.verboseMode = 0
+    simulationSettings.parallel.numberOfThreads = numberOfThreads
+
+    ts = time.time()
+    mbs.SolveDynamic(simulationSettings, solverType=exu.DynamicSolverType.ExplicitMidpoint)
+    tSim = time.time()-ts
+
+    n = mbs.GetObject(bodyPrevious)['nodeNumber']
+    y = mbs.GetNodeOutput(n, exu.OutputVariableType.Position)[1]
+    return tSim, y
+
+for mode in ['Python', 'Symbolic', 'Compiled']:
+    tSim, y = RunModel(mode)
+    exu.Print(mode+': computation time =', round(tSim,4), 's, y-position of last mass =', y)
+
+tSim, y = RunModel('Compiled', numberOfThreads=4)
+exu.Print('Compiled, 4 threads: computation time =', round(tSim,4), 's, y-position of last mass =', y)
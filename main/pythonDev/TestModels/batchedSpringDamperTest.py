@@ -0,0 +1,93 @@
+#+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+# This is an EXUDYN example
+#
+# Details:  Test for batched evaluation of ObjectConnectorSpringDamper between NodePoint nodes
+#           (exu.experimental.batchedObjectEvaluation): results of batched and per-object residuals
+#           must be identical for 1 and 4 threads, including springs with referenceLength=0 
+#           and inactive connectors
+#
+# Date:     2026-10-17
+#
+# Copyright:This file is part of Exudyn. Exudyn is free software. You can redistribute it and/or modify it under the terms of the Exudyn license. See 'LICENSE.txt' for more details.
+#
+#+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+import exudyn as exu
+from exudyn.utilities import *
+
+useGraphics = False #without test
+#+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+#you can erase the following lines and all exudynTestGlobals related operations if this is not intended to be used as TestModel:
+try: #only if called from test suite
+    from modelUnitTests import exudynTestGlobals #for globally storing test results
+    useGraphics = exudynTestGlobals.useGraphics
+except:
+    class ExudynTestGlobals:
+        pass
+    exudynTestGlobals = ExudynTestGlobals()
+#+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+import numpy as np
+
+nMasses = 40 #chain of mass points with nMasses spring-dampers > multithreadedLLimitResiduals
+#every node has at most 2 spring-dampers, such that summation order of forces does not affect results
+
+def Simulate(batched, numberOfThreads):
+    exu.experimental.batchedObjectEvaluation = batched #must be set before Assemble()
+    SC = exu.SystemContainer()
+    mbs = SC.AddSystem()
+
+    nGround = mbs.AddNode(NodePointGround(referenceCoordinates=[0,0,0]))
+    markers = [mbs.AddMarker(MarkerNodePosition(nodeNumber=nGround))]
+    nodes = []
+    springs = []
+    x = 0
+    for i in range(nMasses):
+        #every 5th spring has zero reference length and starts with zero length; every 7th spring is inactive
+        zeroLength = (i%5 == 2)
+        if not zeroLength:
+            x += 0.1
+        n = mbs.AddNode(NodePoint(referenceCoordinates=[x,0,0], 
+                                  initialVelocities=[0.02*np.cos(i),0.1*np.sin(i),0.05*np.cos(i)]))
+        mbs.AddObject(MassPoint(nodeNumber=n, physicsMass=0.2))
+        markers.append(mbs.AddMarker(MarkerNodePosition(nodeNumber=n)))
+        mbs.AddLoad(Force(markerNumber=markers[-1], loadVector=[0,-1,0]))
+        nodes.append(n)
+
+        springs.append(mbs.AddObject(SpringDamper(markerNumbers=[markers[i], markers[i+1]], 
+                                                  referenceLength=0 if zeroLength else 0.1, 
+                                                  stiffness=2000+10*i, damping=1, force=0.5*(i%3),
+                                                  activeConnector=(i%7 != 3))))
+
+    sensors = [mbs.AddSensor(SensorNode(nodeNumber=n, storeInternal=True, 
+                                        outputVariableType=exu.OutputVariableType.Position)) for n in nodes[::5]]
+    sensors += [mbs.AddSensor(SensorObject(objectNumber=springs[i], storeInternal=True, 
+                                           outputVariableType=exu.OutputVariableType.Force)) for i in [1, 2, 3, 7]]
+    mbs.Assemble()
+
+    simulationSettings = exu.SimulationSettings()
+    simulationSettings.timeIntegration.numberOfSteps = 200
+    simulationSettings.timeIntegration.endTime = 0.2
+    simulationSettings.timeIntegration.verboseMode = 0
+    simulationSettings.solutionSettings.writeSolutionToFile = False
+    simulationSettings.parallel.numberOfThreads = numberOfThreads
+
+    mbs.SolveDynamic(simulationSettings)
+    return [mbs.GetSensorStoredData(s) for s in sensors]
+
+batchedObjectEvaluationStored = exu.experimental.batchedObjectEvaluation
+reference = Simulate(batched=False, numberOfThreads=1)
+for (batched, numberOfThreads) in [(True, 1), (False, 4), (True, 4)]:
+    results = Simulate(batched, numberOfThreads)
+    for i in range(len(reference)):
+        if not np.array_equal(results[i], reference[i]):
+            raise ValueError('batchedSpringDamperTest: sensor '+str(i)+' differs for batched='+str(batched)+', threads='+str(numberOfThreads))
+exu.experimental.batchedObjectEvaluation = batchedObjectEvaluationStored
+
+u = 0
+for data in reference:
+    u += np.sum(abs(data[-1,1:]))
+exu.Print('solution of batchedSpringDamperTest=',u)
+
+exudynTestGlobals.testError = u - (18.02707806378563) #2026-10-17
+exudynTestGlobals.testResult = u
@@ -0,0 +1,118 @@
+#+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+# This is an EXUDYN example
+#
+# Details:  Test for MainSystem.SetBatchedUserFunction: connectors with Python user functions
+#           (CoordinateSpringDamper, SpringDamper, CartesianSpringDamper) are evaluated per item and
+#           with one batched (numpy vectorized) user function per connector type;
+#           results of implicit and explicit solvers must be identical
+#
+# Date:     2026-10-17
+#
+# Copyright:This file is part of Exudyn. Exudyn is free software. You can redistribute it and/or modify it under the terms of the Exudyn license. See 'LICENSE.txt' for more details.
+#
+#+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+import exudyn as exu
+from exudyn.utilities import *
+
+useGraphics = False #without test
+#+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+#you can erase the following lines and all exudynTestGlobals related operations if this is not intended to be used as TestModel:
+try: #only if called from test suite
+    from modelUnitTests import exudynTestGlobals #for globally storing test results
+    useGraphics = exudynTestGlobals.useGraphics
+except:
+    class ExudynTestGlobals:
+        pass
+    exudynTestGlobals = ExudynTestGlobals()
+#+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+import numpy as np
+
+n = 8 #number of mass points
+nMaxItems = 100 #item-dependent parameters are stored in arrays indexed by object number
+kItems = 1000 + 50*np.arange(nMaxItems)
+dItems = 1 + 0.1*np.arange(nMaxItems)
+
+#per-item user functions; cubic terms are written as products, because numpy may evaluate power
+#for arrays with a different round-off than for scalars
+def UFcoordinate(mbs, t, itemNumber, displacement, velocity, stiffness, damping, offset):
+    return kItems[itemNumber]*displacement + 1e4*displacement*displacement*displacement + dItems[itemNumber]*velocity
+
+def UFspring(mbs, t, itemNumber, deltaL, deltaL_t, stiffness, damping, force):
+    return kItems[itemNumber]*deltaL + 1e4*deltaL*deltaL*deltaL + dItems[itemNumber]*deltaL_t
+
+def UFcartesian(mbs, t, itemNumber, displacement, velocity, stiffness, damping, offset):
+    u = np.array(displacement)
+    return list(0.1*kItems[itemNumber]*u + 1e3*u*u*u + dItems[itemNumber]*np.array(velocity))
+
+#batched user functions: same force laws for arrays of items
+batchedCalls = [0]
+def UFcoordinateBatched(mbs, t, itemNumbers, displacements, velocities):
+    batchedCalls[0] += 1
+    return kItems[itemNumbers]*displacements + 1e4*displacements*displacements*displacements + dItems[itemNumbers]*velocities
+
+def UFcartesianBatched(mbs, t, itemNumbers, displacements, velocities):
+    return (0.1*kItems[itemNumbers][:,None]*displacements + 1e3*displacements*displacements*displacements
+            + dItems[itemNumbers][:,None]*velocities)
+
+def Compute(useBatched, solverType):
+    SC = exu.SystemContainer()
+    mbs = SC.AddSystem()
+
+    oGround = mbs.CreateGround()
+    mGround = mbs.AddMarker(MarkerBodyPosition(bodyNumber=oGround))
+    nGround = mbs.AddNode(NodePointGround())
+    mGroundCoordinate = mbs.AddMarker(MarkerNodeCoordinate(nodeNumber=nGround, coordinate=0))
+
+    coordinateList = []
+    springList = []
+    cartesianList = []
+    oPrevious = oGround
+    for i in range(n):
+        oMass = mbs.CreateMassPoint(referencePosition=[i+1,0,0], physicsMass=0.2, gravity=[0,-9.81,0],
+                                    initialVelocity=[0.1*i,0,0.2*(i%2)])
+        springList += [mbs.CreateSpringDamper(bodyList=[oPrevious, oMass], referenceLength=1,
+                                              springForceUserFunction=UFspring)]
+        cartesianList += [mbs.CreateCartesianSpringDamper(bodyList=[oPrevious, oMass], offset=[1,0,0],
+                                                          springForceUserFunction=UFcartesian)]
+        mMassCoordinate = mbs.AddMarker(MarkerNodeCoordinate(nodeNumber=mbs.GetObject(oMass)['nodeNumber'], coordinate=2))
+        coordinateList += [mbs.AddObject(CoordinateSpringDamper(markerNumbers=[mGroundCoordinate, mMassCoordinate],
+                                                                springForceUserFunction=UFcoordinate))]
+        oPrevious = oMass
+
+    if useBatched:
+        mbs.SetBatchedUserFunction(objectNumbers=coordinateList, batchedUserFunction=UFcoordinateBatched)
+        mbs.SetBatchedUserFunction(objectNumbers=springList, batchedUserFunction=UFcoordinateBatched) #same force law
+        mbs.SetBatchedUserFunction(objectNumbers=cartesianList, batchedUserFunction=UFcartesianBatched)
+
+    sPos = mbs.AddSensor(SensorBody(bodyNumber=oPrevious, storeInternal=True,
+                                    outputVariableType=exu.OutputVariableType.Position))
+    mbs.Assemble()
+
+    simulationSettings = exu.SimulationSettings()
+    simulationSettings.timeIntegration.numberOfSteps = 200
+    simulationSettings.timeIntegration.endTime = 0.2
+    simulationSettings.timeIntegration.newton.useModifiedNewton = False
+    simulationSettings.solutionSettings.writeSolutionToFile = False
+
+    mbs.SolveDynamic(simulationSettings, solverType=solverType)
+    return mbs.GetSensorStoredData(sPos)
+
+u = 0
+for solverType in [exu.DynamicSolverType.GeneralizedAlpha, exu.DynamicSolverType.RK44]:
+    resultsItems = Compute(False, solverType)
+    batchedCalls[0] = 0
+    resultsBatched = Compute(True, solverType)
+    exu.Print(str(solverType)+': calls of batched user function:', batchedCalls[0])
+    if batchedCalls[0] == 0:
+        raise ValueError('batchedUserFunctionTest: batched user function not called with '+str(solverType))
+
+    if not np.array_equal(resultsBatched, resultsItems):
+        raise ValueError('batchedUserFunctionTest: batched and per-item results differ with '+str(solverType))
+    u += np.sum(resultsItems[-1,1:])
+
+exu.Print('solution of batchedUserFunctionTest=',u)
+
+exudynTestGlobals.testError = u - (15.596643296471155) #2026-10-17
+exudynTestGlobals.testResult = u
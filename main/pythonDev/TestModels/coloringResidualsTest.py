@@ -0,0 +1,95 @@
+#+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+# This is an EXUDYN example
+#
+# Details:  Test for multithreaded residuals with graph coloring (parallel.useColoringForResiduals):
+#           results must agree with thread-local sparse vectors and with serial computation; 
+#           a hub node shared by more than 64 (maximum number of colors) connectors leads to
+#           uncolored objects, which are processed with sparse vectors
+#
+# Date:     2026-10-17
+#
+# Copyright:This file is part of Exudyn. Exudyn is free software. You can redistribute it and/or modify it under the terms of the Exudyn license. See 'LICENSE.txt' for more details.
+#
+#+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+import exudyn as exu
+from exudyn.utilities import *
+
+useGraphics = False #without test
+#+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+#you can erase the following lines and all exudynTestGlobals related operations if this is not intended to be used as TestModel:
+try: #only if called from test suite
+    from modelUnitTests import exudynTestGlobals #for globally storing test results
+    useGraphics = exudynTestGlobals.useGraphics
+except:
+    class ExudynTestGlobals:
+        pass
+    exudynTestGlobals = ExudynTestGlobals()
+#+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+import numpy as np
+
+nSpokes = 100   #connectors attached to hub; more than 64 colors
+nChain = 60     #chain of mass points, colored with 2 colors
+
+def Simulate(numberOfThreads, useColoring):
+    SC = exu.SystemContainer()
+    mbs = SC.AddSystem()
+
+    oGround = mbs.CreateGround()
+    oHub = mbs.CreateMassPoint(referencePosition=[0,0,0], physicsMass=5, initialVelocity=[0.2,0,0.1])
+    sensors = [mbs.AddSensor(SensorBody(bodyNumber=oHub, storeInternal=True, 
+                                        outputVariableType=exu.OutputVariableType.Position))]
+    for i in range(nSpokes):
+        phi = 2*np.pi*i/nSpokes
+        oMass = mbs.CreateMassPoint(referencePosition=[np.cos(phi),np.sin(phi),0.1*np.sin(3*phi)], physicsMass=0.1,
+                                    initialVelocity=[0,0,0.1*np.cos(2*phi)])
+        oSpring = mbs.CreateSpringDamper(bodyList=[oHub, oMass], stiffness=500+i, damping=0.5)
+        mbs.CreateSpringDamper(bodyList=[oGround, oMass], localPosition0=[1.2*np.cos(phi),1.2*np.sin(phi),0],
+                               stiffness=200, damping=0.5)
+        if i%25 == 0:
+            sensors += [mbs.AddSensor(SensorObject(objectNumber=oSpring, storeInternal=True, 
+                                                   outputVariableType=exu.OutputVariableType.Force))]
+
+    oPrevious = oHub
+    for i in range(nChain):
+        oMass = mbs.CreateMassPoint(referencePosition=[0,0,-0.1*(i+1)], physicsMass=0.1, gravity=[0,0,-9.81])
+        mbs.CreateSpringDamper(bodyList=[oPrevious, oMass], stiffness=1000, damping=0.2)
+        oPrevious = oMass
+    sensors += [mbs.AddSensor(SensorBody(bodyNumber=oPrevious, storeInternal=True, 
+                                         outputVariableType=exu.OutputVariableType.Position))]
+    mbs.Assemble()
+
+    simulationSettings = exu.SimulationSettings()
+    simulationSettings.timeIntegration.numberOfSteps = 100
+    simulationSettings.timeIntegration.endTime = 0.2
+    simulationSettings.timeIntegration.verboseMode = 0
+    simulationSettings.solutionSettings.writeSolutionToFile = False
+    simulationSettings.linearSolverType = exu.LinearSolverType.EigenSparse
+    simulationSettings.timeIntegration.generalizedAlpha.computeInitialAccelerations = False
+    simulationSettings.parallel.numberOfThreads = numberOfThreads
+    simulationSettings.parallel.useColoringForResiduals = useColoring
+
+    mbs.SolveDynamic(simulationSettings)
+    return [mbs.GetSensorStoredData(s) for s in sensors]
+
+#forces at hub node are summed up in different order (colors, thread-local sparse vectors), 
+#  which leads to round-off differences; thus, results are compared with tolerance
+reference = Simulate(numberOfThreads=1, useColoring=False)
+resultsSparseVector = Simulate(numberOfThreads=4, useColoring=False)
+resultsColoring = Simulate(numberOfThreads=4, useColoring=True)
+
+for i in range(len(reference)):
+    for (results, info) in [(resultsSparseVector, 'sparse vector'), (resultsColoring, 'coloring')]:
+        if results[i].shape != reference[i].shape or np.max(abs(results[i]-reference[i])) > 1e-10*(1+np.max(abs(reference[i]))):
+            raise ValueError('coloringResidualsTest: sensor '+str(i)+' of '+info+' differs from serial computation')
+    if np.max(abs(resultsColoring[i]-resultsSparseVector[i])) > 1e-10*(1+np.max(abs(reference[i]))):
+        raise ValueError('coloringResidualsTest: sensor '+str(i)+' of coloring differs from sparse vector')
+
+u = 0
+for data in resultsColoring:
+    u += np.sum(abs(data[-1,1:]))
+exu.Print('solution of coloringResidualsTest=',u)
+
+exudynTestGlobals.testError = u - (7.746920525825813) #2026-10-17
+exudynTestGlobals.testResult = u
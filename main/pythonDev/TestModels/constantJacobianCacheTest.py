@@ -0,0 +1,112 @@
+#+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+# This is an EXUDYN example
+#
+# Details:  Test for cached constant parts of the ODE2 jacobian: GenericODE2 without user function (fully cached),
+#           GenericODE2 with forceUserFunction (only constant parts cached) and CoordinateSpringDamper;
+#           the implicit solver changes the step size (adaptive step reduction after failed Newton and
+#           a second solve with different step size), such that the cached jacobian is rescaled;
+#           results must agree with numerical differentiation (forODE2) and with a recomputed cache
+#
+# Date:     2026-10-17
+#
+# Copyright:This file is part of Exudyn. Exudyn is free software. You can redistribute it and/or modify it under the terms of the Exudyn license. See 'LICENSE.txt' for more details.
+#
+#+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+import exudyn as exu
+from exudyn.utilities import *
+
+useGraphics = False #without test
+#+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+#you can erase the following lines and all exudynTestGlobals related operations if this is not intended to be used as TestModel:
+try: #only if called from test suite
+    from modelUnitTests import exudynTestGlobals #for globally storing test results
+    useGraphics = exudynTestGlobals.useGraphics
+except:
+    class ExudynTestGlobals:
+        pass
+    exudynTestGlobals = ExudynTestGlobals()
+#+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+import numpy as np
+
+M = np.diag([1.,2.])
+K = np.array([[400.,-100.],[-100.,800.]])
+D = np.diag([0.4,0.8])
+
+#strongly nonlinear force, such that Newton fails with large steps and step size is reduced
+def UFforce(mbs, t, itemIndex, q, q_t):
+    return [-1e5*q[0]**3, -2e5*q[1]**3 + 10*np.sin(20*t)]
+
+def CreateModel():
+    SC = exu.SystemContainer()
+    mbs = SC.AddSystem()
+
+    #GenericODE2 with constant jacobian
+    nA = mbs.AddNode(NodeGenericODE2(numberOfODE2Coordinates=2, referenceCoordinates=[0,0], 
+                                     initialCoordinates=[0.1,0], initialCoordinates_t=[0,0]))
+    oA = mbs.AddObject(ObjectGenericODE2(nodeNumbers=[nA], massMatrix=M, stiffnessMatrix=K, dampingMatrix=D))
+
+    #GenericODE2 with forceUserFunction: only K and D are constant
+    nB = mbs.AddNode(NodeGenericODE2(numberOfODE2Coordinates=2, referenceCoordinates=[0,0], 
+                                     initialCoordinates=[0.2,-0.1], initialCoordinates_t=[0,0]))
+    mbs.AddObject(ObjectGenericODE2(nodeNumbers=[nB], massMatrix=M, stiffnessMatrix=K, dampingMatrix=D, 
+                                    forceUserFunction=UFforce))
+
+    #CoordinateSpringDamper between ground and mass point
+    oMass = mbs.CreateMassPoint(referencePosition=[1,0,0], physicsMass=0.5, initialVelocity=[0,2,0])
+    nMass = mbs.GetObject(oMass)['nodeNumber']
+    nGround = mbs.AddNode(NodePointGround())
+    mGround = mbs.AddMarker(MarkerNodeCoordinate(nodeNumber=nGround, coordinate=0))
+    mMass = mbs.AddMarker(MarkerNodeCoordinate(nodeNumber=nMass, coordinate=1))
+    mbs.AddObject(CoordinateSpringDamper(markerNumbers=[mGround, mMass], stiffness=2000, damping=1))
+
+    sensors = [mbs.AddSensor(SensorNode(nodeNumber=nA, storeInternal=True, outputVariableType=exu.OutputVariableType.Coordinates)),
+               mbs.AddSensor(SensorNode(nodeNumber=nB, storeInternal=True, outputVariableType=exu.OutputVariableType.Coordinates)),
+               mbs.AddSensor(SensorNode(nodeNumber=nMass, storeInternal=True, outputVariableType=exu.OutputVariableType.Position))]
+    mbs.Assemble()
+    return [SC, mbs, sensors, oA]
+
+endTime = 0.5
+def SimulationSettings(stepSize, forODE2):
+    simulationSettings = exu.SimulationSettings()
+    simulationSettings.timeIntegration.endTime = endTime
+    simulationSettings.timeIntegration.numberOfSteps = int(endTime/stepSize)
+    simulationSettings.timeIntegration.adaptiveStep = True
+    simulationSettings.timeIntegration.newton.useModifiedNewton = False
+    simulationSettings.timeIntegration.newton.maxIterations = 4
+    simulationSettings.timeIntegration.newton.relativeTolerance = 1e-12
+    simulationSettings.timeIntegration.newton.numericalDifferentiation.forODE2 = forODE2
+    simulationSettings.timeIntegration.verboseMode = 0
+    simulationSettings.solutionSettings.writeSolutionToFile = False
+    return simulationSettings
+
+#first solve with different step size, such that cache has been scaled with other factors;
+#clearCache: SetObjectParameter invalidates cache before second solve
+def Simulate(forODE2=False, clearCache=False):
+    [SC, mbs, sensors, oA] = CreateModel()
+    mbs.SolveDynamic(SimulationSettings(0.05, forODE2))
+    if clearCache:
+        mbs.SetObjectParameter(oA, 'stiffnessMatrix', mbs.GetObjectParameter(oA, 'stiffnessMatrix'))
+    mbs.SolveDynamic(SimulationSettings(0.02, forODE2))
+    return [mbs.GetSensorStoredData(s) for s in sensors]
+
+resultsCached = Simulate()
+resultsNumDiff = Simulate(forODE2=True)
+resultsCleared = Simulate(clearCache=True)
+
+nominalSteps = int(endTime/0.02)
+if resultsCached[0].shape[0] <= nominalSteps+1:
+    raise ValueError('constantJacobianCacheTest: no step size reduction; rescaling of cached jacobian not tested')
+
+for i in range(len(resultsCached)):
+    if resultsNumDiff[i].shape != resultsCached[i].shape or np.max(abs(resultsNumDiff[i]-resultsCached[i])) > 1e-10:
+        raise ValueError('constantJacobianCacheTest: cached jacobian differs from numerical jacobian (forODE2), sensor '+str(i))
+    if not np.array_equal(resultsCleared[i], resultsCached[i]):
+        raise ValueError('constantJacobianCacheTest: rescaled cache differs from recomputed cache, sensor '+str(i))
+
+u = np.sum(abs(resultsCached[0][-1,1:])) + np.sum(abs(resultsCached[1][-1,1:])) + np.sum(abs(resultsCached[2][-1,1:]))
+exu.Print('solution of constantJacobianCacheTest=',u)
+
+exudynTestGlobals.testError = u - (1.2442152477541413) #2026-10-17
+exudynTestGlobals.testResult = u
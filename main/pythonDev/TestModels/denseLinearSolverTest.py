@@ -0,0 +1,105 @@
+#+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+# This is an EXUDYN example
+#
+# Details:  Test for blocked LU factorization of LinearSolverType.EXUdense: dynamic solution of a chain of
+#           mass points is compared with Eigen dense and sparse solvers, using 1 and 4 threads;
+#           for a singular system, the index of the causing system equation (coordinate) is checked
+#
+# Date:     2026-10-17
+#
+# Copyright:This file is part of Exudyn. Exudyn is free software. You can redistribute it and/or modify it under the terms of the Exudyn license. See 'LICENSE.txt' for more details.
+#
+#+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+import exudyn as exu
+from exudyn.utilities import *
+
+useGraphics = False #without test
+#+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+#you can erase the following lines and all exudynTestGlobals related operations if this is not intended to be used as TestModel:
+try: #only if called from test suite
+    from modelUnitTests import exudynTestGlobals #for globally storing test results
+    useGraphics = exudynTestGlobals.useGraphics
+except:
+    class ExudynTestGlobals:
+        pass
+    exudynTestGlobals = ExudynTestGlobals()
+#+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+import numpy as np
+
+n = 60 #180 coordinates: several panels of blocked LU and multithreaded trailing update
+
+#chain of mass points with linear springs; if singularMass >= 0, the z-coordinate of this mass has no stiffness
+def CreateChain(singularMass=-1):
+    SC = exu.SystemContainer()
+    mbs = SC.AddSystem()
+
+    oGround = mbs.CreateGround()
+    oPrevious = oGround
+    for i in range(n):
+        oMass = mbs.CreateMassPoint(referencePosition=[i+1,0,0], physicsMass=1, gravity=[0,-9.81,0],
+                                    initialVelocity=[0,0,0.01*(i%4)])
+        mbs.CreateCartesianSpringDamper(bodyList=[oPrevious, oMass], stiffness=[1000+10*i,500,0],
+                                        damping=[1,1,0], offset=[1,0,0])
+        if i != singularMass:
+            mbs.CreateCartesianSpringDamper(bodyList=[oGround, oMass], stiffness=[0,10,100+i],
+                                            offset=[i+1,0,0])
+        oPrevious = oMass
+
+    sPos = mbs.AddSensor(SensorBody(bodyNumber=oPrevious, storeInternal=True,
+                                    outputVariableType=exu.OutputVariableType.Position))
+    mbs.Assemble()
+    return [SC, mbs, sPos]
+
+def Compute(linearSolverType, numberOfThreads):
+    [SC, mbs, sPos] = CreateChain()
+
+    simulationSettings = exu.SimulationSettings()
+    simulationSettings.timeIntegration.numberOfSteps = 50
+    simulationSettings.timeIntegration.endTime = 0.5
+    simulationSettings.timeIntegration.newton.useModifiedNewton = False
+    simulationSettings.timeIntegration.generalizedAlpha.computeInitialAccelerations = False #not available for sparse solver
+    simulationSettings.solutionSettings.writeSolutionToFile = False
+    simulationSettings.linearSolverType = linearSolverType
+    simulationSettings.parallel.numberOfThreads = numberOfThreads
+
+    mbs.SolveDynamic(simulationSettings)
+    return mbs.GetSensorStoredData(sPos)
+
+resultsEXUdense = Compute(exu.LinearSolverType.EXUdense, 1)
+
+#multithreaded trailing update splits rows of the same operations, so results must be identical
+if not np.array_equal(Compute(exu.LinearSolverType.EXUdense, 4), resultsEXUdense):
+    raise ValueError('denseLinearSolverTest: EXUdense results differ with 4 threads')
+
+#other linear solvers use different factorizations, only round-off differences allowed
+for linearSolverType in [exu.LinearSolverType.EigenDense, exu.LinearSolverType.EigenSparse]:
+    difference = np.max(abs(Compute(linearSolverType, 1) - resultsEXUdense))
+    exu.Print(str(linearSolverType)+': difference to EXUdense=', difference)
+    if difference > 1e-10:
+        raise ValueError('denseLinearSolverTest: results of '+str(linearSolverType)+' differ from EXUdense')
+
+#singular system: z-coordinate of mass 45 has no stiffness, static solver must fail at coordinate 3*45+2
+causingRowList = []
+for numberOfThreads in [1, 4]:
+    [SC, mbs, sPos] = CreateChain(singularMass=45)
+    simulationSettings = exu.SimulationSettings()
+    simulationSettings.linearSolverType = exu.LinearSolverType.EXUdense
+    simulationSettings.parallel.numberOfThreads = numberOfThreads
+    solver = exu.MainSolverStatic()
+    try:
+        solver.SolveSystem(mbs, simulationSettings)
+    except:
+        pass #solver raises error for singular Jacobian
+    causingRowList += [solver.conv.linearSolverCausingRow]
+
+exu.Print('singular causing rows=', causingRowList)
+if causingRowList != [137, 137]:
+    raise ValueError('denseLinearSolverTest: singular row not detected at coordinate 137')
+
+u = np.sum(resultsEXUdense[-1,1:])
+exu.Print('solution of denseLinearSolverTest=',u)
+
+exudynTestGlobals.testError = u - (59.02452503819176) #2026-10-17
+exudynTestGlobals.testResult = u
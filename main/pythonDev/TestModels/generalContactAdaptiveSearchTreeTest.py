@@ -0,0 +1,105 @@
+#+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+# This is an EXUDYN example
+#
+# Details:  Test for GeneralContact with adaptive search tree (searchTreeAdaptive): spheres spread far beyond 
+#           the initial search tree box; contact forces and sensor values must be identical to the static search tree
+#
+# Date:     2026-10-17
+#
+# Copyright:This file is part of Exudyn. Exudyn is free software. You can redistribute it and/or modify it under the terms of the Exudyn license. See 'LICENSE.txt' for more details.
+#
+#+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+import exudyn as exu
+from exudyn.utilities import *
+
+useGraphics = False #without test
+#+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+#you can erase the following lines and all exudynTestGlobals related operations if this is not intended to be used as TestModel:
+try: #only if called from test suite
+    from modelUnitTests import exudynTestGlobals #for globally storing test results
+    useGraphics = exudynTestGlobals.useGraphics
+except:
+    class ExudynTestGlobals:
+        pass
+    exudynTestGlobals = ExudynTestGlobals()
+#+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+import numpy as np
+
+k = 2e4     #contact stiffness
+d = 20      #contact damping
+m = 0.05    #mass of spheres
+
+def Simulate(searchTreeAdaptive):
+    SC = exu.SystemContainer()
+    mbs = SC.AddSystem()
+    np.random.seed(0) #always get same results
+
+    gContact = mbs.AddGeneralContact()
+    gContact.verboseMode = 0
+    gContact.computeContactForces = True
+
+    #large ground sphere
+    nGround = mbs.AddNode(NodePointGround(referenceCoordinates=[0,-20,0]))
+    gContact.AddSphereWithMarker(mbs.AddMarker(MarkerNodePosition(nodeNumber=nGround)), radius=20, 
+                                 contactStiffness=k, contactDamping=d, frictionMaterialIndex=0)
+
+    #block of spheres, thrown outwards
+    sensors = []
+    for ix in range(4):
+        for iy in range(3):
+            for iz in range(4):
+                p = [0.22*(ix-1.5)+0.02*np.random.rand(), 0.3+0.22*iy, 0.22*(iz-1.5)+0.02*np.random.rand()]
+                r = 0.1*(0.9+0.1*np.random.rand())
+                nMass = mbs.AddNode(NodePoint(referenceCoordinates=p, initialVelocities=[2*(ix-1.5),-1,2*(iz-1.5)]))
+                mbs.AddObject(MassPoint(nodeNumber=nMass, physicsMass=m))
+                mMass = mbs.AddMarker(MarkerNodePosition(nodeNumber=nMass))
+                mbs.AddLoad(Force(markerNumber=mMass, loadVector=[0,-9.81*m,0]))
+                gContact.AddSphereWithMarker(mMass, radius=r, contactStiffness=k, contactDamping=d, frictionMaterialIndex=0)
+                if (ix+iz)%3 == 0:
+                    sensors += [mbs.AddSensor(SensorNode(nodeNumber=nMass, storeInternal=True, 
+                                                         outputVariableType=exu.OutputVariableType.Position))]
+
+    gContact.SetFrictionPairings(np.zeros((1,1)))
+    gContact.SetSearchTreeCellSize(numberOfCells=[4,4,4])
+    gContact.SetSearchTreeBox(pMin=[-0.6,0,-0.6], pMax=[0.6,1.2,0.6]) #only initial region of spheres
+    gContact.searchTreeAdaptive = searchTreeAdaptive
+
+    contactForces = []
+    def PreStepUserFunction(mbs, t):
+        contactForces.append(np.array(gContact.GetSystemODE2RhsContactForces()))
+        return True
+    mbs.SetPreStepUserFunction(PreStepUserFunction)
+    mbs.Assemble()
+
+    simulationSettings = exu.SimulationSettings()
+    simulationSettings.timeIntegration.numberOfSteps = 1000
+    simulationSettings.timeIntegration.endTime = 0.25
+    simulationSettings.timeIntegration.verboseMode = 0
+    simulationSettings.solutionSettings.writeSolutionToFile = False
+    simulationSettings.solutionSettings.sensorsWritePeriod = 0.005
+
+    mbs.SolveDynamic(simulationSettings, solverType=exu.DynamicSolverType.RK44)
+    return [[mbs.GetSensorStoredData(s) for s in sensors], np.array(contactForces)]
+
+[sensorsStatic, contactForcesStatic] = Simulate(searchTreeAdaptive=False)
+[sensorsAdaptive, contactForcesAdaptive] = Simulate(searchTreeAdaptive=True)
+
+#spheres must leave initial search tree box
+if max(np.max(abs(data[:,1])) for data in sensorsStatic) < 1:
+    raise ValueError('generalContactAdaptiveSearchTreeTest: spheres did not leave search tree box')
+
+if contactForcesAdaptive.shape != contactForcesStatic.shape or not np.array_equal(contactForcesAdaptive, contactForcesStatic):
+    raise ValueError('generalContactAdaptiveSearchTreeTest: contact forces differ for adaptive search tree')
+for i in range(len(sensorsStatic)):
+    if not np.array_equal(sensorsAdaptive[i], sensorsStatic[i]):
+        raise ValueError('generalContactAdaptiveSearchTreeTest: sensor '+str(i)+' differs for adaptive search tree')
+
+u = np.sum(abs(contactForcesStatic))*1e-3
+for data in sensorsStatic:
+    u += np.sum(abs(data[-1,1:]))
+exu.Print('solution of generalContactAdaptiveSearchTreeTest=',u)
+
+exudynTestGlobals.testError = u - (85.69076798487642) #2026-10-17
+exudynTestGlobals.testResult = u
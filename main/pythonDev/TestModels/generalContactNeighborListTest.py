@@ -0,0 +1,108 @@
+#+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+# This is an EXUDYN example
+#
+# Details:  Test for GeneralContact with sphere neighbor lists (sphereSphereNeighborListSkin): spheres move much more
+#           than half of the skin distance between rebuilds of neighbor lists; contact forces and sensor values 
+#           must be identical to the default search
+#
+# Date:     2026-10-17
+#
+# Copyright:This file is part of Exudyn. Exudyn is free software. You can redistribute it and/or modify it under the terms of the Exudyn license. See 'LICENSE.txt' for more details.
+#
+#+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+import exudyn as exu
+from exudyn.utilities import *
+
+useGraphics = False #without test
+#+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+#you can erase the following lines and all exudynTestGlobals related operations if this is not intended to be used as TestModel:
+try: #only if called from test suite
+    from modelUnitTests import exudynTestGlobals #for globally storing test results
+    useGraphics = exudynTestGlobals.useGraphics
+except:
+    class ExudynTestGlobals:
+        pass
+    exudynTestGlobals = ExudynTestGlobals()
+#+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+import numpy as np
+
+k = 2e4     #contact stiffness
+d = 20      #contact damping
+m = 0.05    #mass of spheres
+
+def Simulate(neighborListSkin):
+    SC = exu.SystemContainer()
+    mbs = SC.AddSystem()
+    np.random.seed(1) #always get same results
+
+    gContact = mbs.AddGeneralContact()
+    gContact.verboseMode = 0
+    gContact.computeContactForces = True
+
+    #large ground sphere
+    nGround = mbs.AddNode(NodePointGround(referenceCoordinates=[0,-20,0]))
+    gContact.AddSphereWithMarker(mbs.AddMarker(MarkerNodePosition(nodeNumber=nGround)), radius=20, 
+                                 contactStiffness=k, contactDamping=d, frictionMaterialIndex=0)
+
+    #dense block of spheres, thrown outwards
+    sensors = []
+    for ix in range(4):
+        for iy in range(3):
+            for iz in range(4):
+                p = [0.21*(ix-1.5)+0.01*np.random.rand(), 0.3+0.21*iy, 0.21*(iz-1.5)+0.01*np.random.rand()]
+                r = 0.1*(0.9+0.1*np.random.rand())
+                nMass = mbs.AddNode(NodePoint(referenceCoordinates=p, initialVelocities=[1.5*(ix-1.5),-1,1.5*(iz-1.5)]))
+                mbs.AddObject(MassPoint(nodeNumber=nMass, physicsMass=m))
+                mMass = mbs.AddMarker(MarkerNodePosition(nodeNumber=nMass))
+                mbs.AddLoad(Force(markerNumber=mMass, loadVector=[0,-9.81*m,0]))
+                gContact.AddSphereWithMarker(mMass, radius=r, contactStiffness=k, contactDamping=d, frictionMaterialIndex=0)
+                if (ix+iz)%3 == 0:
+                    sensors += [mbs.AddSensor(SensorNode(nodeNumber=nMass, storeInternal=True, 
+                                                         outputVariableType=exu.OutputVariableType.Position))]
+
+    gContact.SetFrictionPairings(np.zeros((1,1)))
+    gContact.SetSearchTreeCellSize(numberOfCells=[4,4,4])
+    gContact.SetSearchTreeBox(pMin=[-1.5,0,-1.5], pMax=[1.5,1.2,1.5])
+    gContact.sphereSphereNeighborListSkin = neighborListSkin
+
+    contactForces = []
+    def PreStepUserFunction(mbs, t):
+        contactForces.append(np.array(gContact.GetSystemODE2RhsContactForces()))
+        return True
+    mbs.SetPreStepUserFunction(PreStepUserFunction)
+    mbs.Assemble()
+
+    simulationSettings = exu.SimulationSettings()
+    simulationSettings.timeIntegration.numberOfSteps = 1000
+    simulationSettings.timeIntegration.endTime = 0.25
+    simulationSettings.timeIntegration.verboseMode = 0
+    simulationSettings.solutionSettings.writeSolutionToFile = False
+    simulationSettings.solutionSettings.sensorsWritePeriod = 0.005
+
+    mbs.SolveDynamic(simulationSettings, solverType=exu.DynamicSolverType.RK44)
+    return [[mbs.GetSensorStoredData(s) for s in sensors], np.array(contactForces)]
+
+[sensorsDefault, contactForcesDefault] = Simulate(neighborListSkin=0)
+
+#spheres move less than 1mm per step; small skin leads to rebuild at almost every step, large skin rarely rebuilds
+for skin in [0.002, 0.05]:
+    #spheres must move much more than skin/2 during simulation, such that neighbor lists are rebuilt
+    if max(np.max(abs(data[:,1]-data[0,1])) for data in sensorsDefault) < 10*skin:
+        raise ValueError('generalContactNeighborListTest: spheres did not move more than skin distance')
+
+    [sensors, contactForces] = Simulate(neighborListSkin=skin)
+    if contactForces.shape != contactForcesDefault.shape or not np.array_equal(contactForces, contactForcesDefault):
+        raise ValueError('generalContactNeighborListTest: contact forces differ for skin='+str(skin))
+    for i in range(len(sensorsDefault)):
+        if not np.array_equal(sensors[i], sensorsDefault[i]):
+            raise ValueError('generalContactNeighborListTest: sensor '+str(i)+' differs for skin='+str(skin))
+
+u = np.sum(abs(contactForcesDefault))*1e-3
+for data in sensorsDefault:
+    u += np.sum(abs(data[-1,1:]))
+exu.Print('solution of generalContactNeighborListTest=',u)
+
+exudynTestGlobals.testError = u - (77.94735254953898) #2026-10-17
+exudynTestGlobals.testResult = u
@@ -0,0 +1,124 @@
+#+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+# This is an EXUDYN example
+#
+# Details:  Test for GeneralContact with bounding volume hierarchies of triangles (trianglesBVH): a rotated and
+#           translated rigid body with triangle mesh falls onto fixed spheres and is hit by free spheres;
+#           contact forces and sensor values must agree with the default search
+#
+# Date:     2026-10-17
+#
+# Copyright:This file is part of Exudyn. Exudyn is free software. You can redistribute it and/or modify it under the terms of the Exudyn license. See 'LICENSE.txt' for more details.
+#
+#+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+import exudyn as exu
+from exudyn.utilities import *
+
+useGraphics = False #without test
+#+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+#you can erase the following lines and all exudynTestGlobals related operations if this is not intended to be used as TestModel:
+try: #only if called from test suite
+    from modelUnitTests import exudynTestGlobals #for globally storing test results
+    useGraphics = exudynTestGlobals.useGraphics
+except:
+    class ExudynTestGlobals:
+        pass
+    exudynTestGlobals = ExudynTestGlobals()
+#+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+import numpy as np
+
+k = 2e4     #contact stiffness
+d = 20      #contact damping
+m = 0.05    #mass of spheres
+r = 0.1     #radius of spheres
+
+#box mesh with 192 triangles
+[meshPoints, meshTrigs] = GraphicsData2PointsAndTrigs(GraphicsDataOrthoCubePoint(size=[0.6,0.4,0.3]))
+[meshPoints, meshTrigs] = RefineMesh(meshPoints, meshTrigs)
+[meshPoints, meshTrigs] = RefineMesh(meshPoints, meshTrigs)
+
+def Simulate(trianglesBVH):
+    SC = exu.SystemContainer()
+    mbs = SC.AddSystem()
+
+    gContact = mbs.AddGeneralContact()
+    gContact.verboseMode = 0
+    gContact.computeContactForces = True
+
+    #rigid body with mesh, rotated and translated
+    oBody = mbs.CreateRigidBody(inertia=InertiaCuboid(density=100, sideLengths=[0.6,0.4,0.3]),
+                                referencePosition=[0.1,0.5,0.05],
+                                referenceRotationMatrix=RotationMatrixX(0.3) @ RotationMatrixZ(0.5),
+                                initialVelocity=[0,-1,0], initialAngularVelocity=[1,2,0.5],
+                                gravity=[0,-9.81,0], nodeType=exu.NodeType.RotationRotationVector)
+    nBody = mbs.GetObject(oBody)['nodeNumber']
+    mBody = mbs.AddMarker(MarkerNodeRigid(nodeNumber=nBody))
+    gContact.AddTrianglesRigidBodyBased(rigidBodyMarkerIndex=mBody, contactStiffness=k, contactDamping=d, 
+                                        frictionMaterialIndex=0, pointList=meshPoints, triangleList=meshTrigs)
+    sensors = [mbs.AddSensor(SensorNode(nodeNumber=nBody, storeInternal=True, outputVariableType=exu.OutputVariableType.Position)),
+               mbs.AddSensor(SensorNode(nodeNumber=nBody, storeInternal=True, outputVariableType=exu.OutputVariableType.Rotation))]
+
+    #bed of fixed spheres
+    for ix in range(5):
+        for iz in range(5):
+            nGround = mbs.AddNode(NodePointGround(referenceCoordinates=[0.2*(ix-2),0,0.2*(iz-2)]))
+            gContact.AddSphereWithMarker(mbs.AddMarker(MarkerNodePosition(nodeNumber=nGround)), radius=r, 
+                                         contactStiffness=k, contactDamping=d, frictionMaterialIndex=0)
+
+    #free spheres thrown at body from sides
+    for i in range(6):
+        phi = 2*np.pi*i/6
+        nMass = mbs.AddNode(NodePoint(referenceCoordinates=[0.1+0.7*np.cos(phi),0.45,0.05+0.7*np.sin(phi)], 
+                                      initialVelocities=[-3*np.cos(phi),0,-3*np.sin(phi)]))
+        mbs.AddObject(MassPoint(nodeNumber=nMass, physicsMass=m))
+        mMass = mbs.AddMarker(MarkerNodePosition(nodeNumber=nMass))
+        gContact.AddSphereWithMarker(mMass, radius=0.5*r, contactStiffness=k, contactDamping=d, frictionMaterialIndex=0)
+        sensors += [mbs.AddSensor(SensorNode(nodeNumber=nMass, storeInternal=True, 
+                                             outputVariableType=exu.OutputVariableType.Position))]
+
+    gContact.SetFrictionPairings(np.zeros((1,1)))
+    gContact.SetSearchTreeCellSize(numberOfCells=[6,6,6])
+    gContact.trianglesBVH = trianglesBVH
+
+    contactForces = []
+    def PreStepUserFunction(mbs, t):
+        contactForces.append(np.array(gContact.GetSystemODE2RhsContactForces()))
+        return True
+    mbs.SetPreStepUserFunction(PreStepUserFunction)
+    mbs.Assemble()
+
+    simulationSettings = exu.SimulationSettings()
+    simulationSettings.timeIntegration.numberOfSteps = 1000
+    simulationSettings.timeIntegration.endTime = 0.25
+    simulationSettings.timeIntegration.verboseMode = 0
+    simulationSettings.solutionSettings.writeSolutionToFile = False
+    simulationSettings.solutionSettings.sensorsWritePeriod = 0.005
+
+    mbs.SolveDynamic(simulationSettings, solverType=exu.DynamicSolverType.RK44)
+    return [[mbs.GetSensorStoredData(s) for s in sensors], np.array(contactForces)]
+
+[sensorsDefault, contactForcesDefault] = Simulate(trianglesBVH=False)
+[sensorsBVH, contactForcesBVH] = Simulate(trianglesBVH=True)
+
+#body must be in contact with spheres
+nBodyCoordinates = 6 #position and rotation vector
+if np.max(abs(contactForcesDefault[:,0:nBodyCoordinates])) == 0:
+    raise ValueError('generalContactTrianglesBVHTest: no contact of rigid body')
+
+#triangles are found in different order (search tree cells vs. hierarchy), which changes the summation order
+#  of contact forces and leads to round-off differences; thus, results are compared with tolerance
+tol = 1e-10
+if contactForcesBVH.shape != contactForcesDefault.shape or np.max(abs(contactForcesBVH-contactForcesDefault)) > tol*np.max(abs(contactForcesDefault)):
+    raise ValueError('generalContactTrianglesBVHTest: contact forces differ for trianglesBVH')
+for i in range(len(sensorsDefault)):
+    if sensorsBVH[i].shape != sensorsDefault[i].shape or np.max(abs(sensorsBVH[i]-sensorsDefault[i])) > tol:
+        raise ValueError('generalContactTrianglesBVHTest: sensor '+str(i)+' differs for trianglesBVH')
+
+u = np.sum(abs(contactForcesDefault))*1e-3
+for data in sensorsDefault:
+    u += np.sum(abs(data[-1,1:]))
+exu.Print('solution of generalContactTrianglesBVHTest=',u)
+
+exudynTestGlobals.testError = u - (252.29074545032867) #2026-10-17
+exudynTestGlobals.testResult = u
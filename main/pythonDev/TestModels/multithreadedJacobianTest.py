@@ -0,0 +1,92 @@
+#+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+# This is an EXUDYN example
+#
+# Details:  Test for multithreaded computation of ODE2 Jacobians: chain of mass points with
+#           spring-dampers solved with implicit solver and sparse Jacobian, using 1 and 4 threads;
+#           system jacobian and solution must be identical, as thread-local triplets are merged in the same order
+#
+# Date:     2026-10-17
+#
+# Copyright:This file is part of Exudyn. Exudyn is free software. You can redistribute it and/or modify it under the terms of the Exudyn license. See 'LICENSE.txt' for more details.
+#
+#+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+import exudyn as exu
+from exudyn.utilities import *
+
+useGraphics = False #without test
+#+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+#you can erase the following lines and all exudynTestGlobals related operations if this is not intended to be used as TestModel:
+try: #only if called from test suite
+    from modelUnitTests import exudynTestGlobals #for globally storing test results
+    useGraphics = exudynTestGlobals.useGraphics
+except:
+    class ExudynTestGlobals:
+        pass
+    exudynTestGlobals = ExudynTestGlobals()
+#+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+import numpy as np
+
+#chain of n mass points; more items than parallel.multithreadedLLimitJacobians
+def CreateChain(n=40):
+    SC = exu.SystemContainer()
+    mbs = SC.AddSystem()
+
+    oPrevious = mbs.CreateGround()
+    for i in range(n):
+        oMass = mbs.CreateMassPoint(referencePosition=[i+1,0,0], physicsMass=0.5, initialDisplacement=[0,0.01*(i%4),0],
+                                    initialVelocity=[0,0,0.1*(i%3)], gravity=[0,-9.81,0])
+        mbs.CreateSpringDamper(bodyList=[oPrevious, oMass], stiffness=2000, damping=2, referenceLength=1)
+        mbs.CreateCartesianSpringDamper(bodyList=[oPrevious, oMass], stiffness=[0,50,50], damping=[0,0.5,0.5],
+                                        offset=[1,0,0])
+        oPrevious = oMass
+
+    sPos = mbs.AddSensor(SensorBody(bodyNumber=oPrevious, storeInternal=True,
+                                    outputVariableType=exu.OutputVariableType.Position))
+    mbs.Assemble()
+    return [SC, mbs, sPos]
+
+def CreateSimulationSettings(numberOfThreads):
+    simulationSettings = exu.SimulationSettings()
+    simulationSettings.timeIntegration.numberOfSteps = 200
+    simulationSettings.timeIntegration.endTime = 0.2
+    simulationSettings.timeIntegration.newton.useModifiedNewton = False
+    simulationSettings.solutionSettings.writeSolutionToFile = False
+    simulationSettings.linearSolverType = exu.LinearSolverType.EigenSparse
+    simulationSettings.parallel.numberOfThreads = numberOfThreads
+    simulationSettings.timeIntegration.generalizedAlpha.computeInitialAccelerations = False #sparse mode
+    return simulationSettings
+
+#system jacobian in initial configuration, including ODE2 and ODE2_t parts
+def ComputeJacobian(numberOfThreads):
+    [SC, mbs, sPos] = CreateChain()
+    simulationSettings = CreateSimulationSettings(numberOfThreads)
+    solver = exu.MainSolverImplicitSecondOrder()
+    solver.InitializeSolver(mbs, simulationSettings)
+    solver.ComputeJacobianODE2RHS(mbs, scalarFactor_ODE2=1., scalarFactor_ODE2_t=0.01)
+    jacobian = np.array(solver.GetSystemJacobian())
+    solver.FinalizeSolver(mbs, simulationSettings)
+    return jacobian
+
+def Simulate(numberOfThreads):
+    [SC, mbs, sPos] = CreateChain()
+    mbs.SolveDynamic(CreateSimulationSettings(numberOfThreads))
+    return mbs.GetSensorStoredData(sPos)
+
+#thread-local triplets are merged in the same order, such that jacobians and solutions are identical
+jacobian1 = ComputeJacobian(1)
+jacobian4 = ComputeJacobian(4)
+if np.max(abs(jacobian1)) == 0 or not np.array_equal(jacobian1, jacobian4):
+    raise ValueError('multithreadedJacobianTest: jacobian differs for 4 threads')
+
+results1 = Simulate(1)
+results4 = Simulate(4)
+if not np.array_equal(results1, results4):
+    raise ValueError('multithreadedJacobianTest: solution differs for 4 threads')
+
+u = np.sum(results1[-1,1:]) + 1e-4*np.sum(abs(jacobian1))
+exu.Print('solution of multithreadedJacobianTest=',u)
+
+exudynTestGlobals.testError = u - (73.5863387791717) #2026-10-17
+exudynTestGlobals.testResult = u
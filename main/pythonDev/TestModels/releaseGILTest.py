@@ -0,0 +1,106 @@
+#+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+# This is an EXUDYN example
+#
+# Details:  Test for release of the Python GIL during time integration: solver output must report releasedGIL,
+#           the GIL must not be released if Python user functions are used, and two systems solved 
+#           concurrently in Python threads must give same results as solved one after another
+#
+# Date:     2026-10-17
+#
+# Copyright:This file is part of Exudyn. Exudyn is free software. You can redistribute it and/or modify it under the terms of the Exudyn license. See 'LICENSE.txt' for more details.
+#
+#+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+import exudyn as exu
+from exudyn.utilities import *
+
+useGraphics = False #without test
+#+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+#you can erase the following lines and all exudynTestGlobals related operations if this is not intended to be used as TestModel:
+try: #only if called from test suite
+    from modelUnitTests import exudynTestGlobals #for globally storing test results
+    useGraphics = exudynTestGlobals.useGraphics
+except:
+    class ExudynTestGlobals:
+        pass
+    exudynTestGlobals = ExudynTestGlobals()
+#+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+import numpy as np
+import threading
+
+#progressive spring
+def UFspring(mbs, t, itemNumber, deltaL, deltaL_t, stiffness, damping, force):
+    return stiffness*deltaL*(1+10*deltaL**2) + damping*deltaL_t
+
+#chain of mass points; stiffness is varied to obtain different systems
+def CreateModel(stiffness, useUserFunction=False):
+    SC = exu.SystemContainer()
+    mbs = SC.AddSystem()
+    oPrevious = mbs.CreateGround()
+    for i in range(10):
+        oMass = mbs.CreateMassPoint(referencePosition=[i+1,0,0], physicsMass=1, gravity=[0,-9.81,0])
+        oSpring = mbs.CreateSpringDamper(bodyList=[oPrevious, oMass], stiffness=stiffness, damping=2)
+        if useUserFunction:
+            mbs.SetObjectParameter(oSpring, 'springForceUserFunction', UFspring)
+        oPrevious = oMass
+    sPos = mbs.AddSensor(SensorBody(bodyNumber=oPrevious, storeInternal=True,
+                                    outputVariableType=exu.OutputVariableType.Position))
+    mbs.Assemble()
+    return [SC, mbs, sPos]
+
+def CreateSimulationSettings():
+    simulationSettings = exu.SimulationSettings()
+    simulationSettings.timeIntegration.numberOfSteps = 500
+    simulationSettings.timeIntegration.endTime = 0.5
+    simulationSettings.timeIntegration.verboseMode = 0
+    simulationSettings.solutionSettings.writeSolutionToFile = False
+    simulationSettings.parallel.numberOfThreads = 1
+    return simulationSettings
+
+simulationSettings = CreateSimulationSettings()
+
+stiffnessList = [1e3, 2e3]
+
+#solve one after another
+resultsSequential = []
+for stiffness in stiffnessList:
+    [SC, mbs, sPos] = CreateModel(stiffness)
+    mbs.SolveDynamic(simulationSettings)
+    if not mbs.sys['dynamicSolver'].output.releasedGIL:
+        raise ValueError('releaseGILTest: GIL has not been released')
+    resultsSequential.append(mbs.GetSensorStoredData(sPos))
+
+#Python user function needs GIL
+[SC, mbs, sPos] = CreateModel(stiffnessList[0], useUserFunction=True)
+mbs.SolveDynamic(simulationSettings)
+if mbs.sys['dynamicSolver'].output.releasedGIL:
+    raise ValueError('releaseGILTest: GIL has been released with Python user functions')
+resultUserFunction = mbs.GetSensorStoredData(sPos)
+
+#solve concurrently in Python threads; every thread has its own system container and settings
+resultsThreads = [None]*len(stiffnessList)
+releasedGILThreads = [False]*len(stiffnessList)
+def SolveInThread(i):
+    [SC, mbs, sPos] = CreateModel(stiffnessList[i])
+    mbs.SolveDynamic(CreateSimulationSettings())
+    releasedGILThreads[i] = mbs.sys['dynamicSolver'].output.releasedGIL
+    resultsThreads[i] = mbs.GetSensorStoredData(sPos)
+
+threads = [threading.Thread(target=SolveInThread, args=(i,)) for i in range(len(stiffnessList))]
+for thread in threads: 
+    thread.start()
+for thread in threads: 
+    thread.join()
+
+for i in range(len(stiffnessList)):
+    if not releasedGILThreads[i]:
+        raise ValueError('releaseGILTest: GIL has not been released in Python thread '+str(i))
+    if resultsThreads[i] is None or not np.array_equal(resultsThreads[i], resultsSequential[i]):
+        raise ValueError('releaseGILTest: results of Python thread '+str(i)+' differ from sequential solution')
+
+u = np.sum(abs(resultsSequential[0][-1,1:])) + np.sum(abs(resultsSequential[1][-1,1:])) + np.sum(abs(resultUserFunction[-1,1:]))
+exu.Print('solution of releaseGILTest=',u)
+
+exudynTestGlobals.testError = u - (33.522771106840565) #2026-10-17
+exudynTestGlobals.testResult = u
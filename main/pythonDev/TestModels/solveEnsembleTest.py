@@ -0,0 +1,103 @@
+#+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+# This is an EXUDYN example
+#
+# Details:  Test for MainSystem.SolveEnsemble: members with parameter overrides are solved in parallel threads
+#           and must give the same sensor data as individual SolveDynamic runs; a member with a Python
+#           user function (solved serially) is included
+#
+# Date:     2026-10-17
+#
+# Copyright:This file is part of Exudyn. Exudyn is free software. You can redistribute it and/or modify it under the terms of the Exudyn license. See 'LICENSE.txt' for more details.
+#
+#+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+import exudyn as exu
+from exudyn.utilities import *
+
+useGraphics = False #without test
+#+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+#you can erase the following lines and all exudynTestGlobals related operations if this is not intended to be used as TestModel:
+try: #only if called from test suite
+    from modelUnitTests import exudynTestGlobals #for globally storing test results
+    useGraphics = exudynTestGlobals.useGraphics
+except:
+    class ExudynTestGlobals:
+        pass
+    exudynTestGlobals = ExudynTestGlobals()
+#+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+import numpy as np
+
+#mass point on spring-damper with gravity
+def CreateModel():
+    SC = exu.SystemContainer()
+    mbs = SC.AddSystem()
+    oGround = mbs.CreateGround()
+    oMass = mbs.CreateMassPoint(referencePosition=[1,0,0], physicsMass=1, gravity=[0,-9.81,0],
+                                initialVelocity=[0,0,0.5])
+    oSpring = mbs.CreateSpringDamper(bodyList=[oGround, oMass], stiffness=1000, damping=2)
+    sPos = mbs.AddSensor(SensorBody(bodyNumber=oMass, storeInternal=True,
+                                    outputVariableType=exu.OutputVariableType.Position))
+    sForce = mbs.AddSensor(SensorObject(objectNumber=oSpring, storeInternal=True,
+                                        outputVariableType=exu.OutputVariableType.Force))
+    mbs.Assemble()
+    return [SC, mbs, oMass, oSpring, sPos, sForce]
+
+#progressive spring
+def UFspring(mbs, t, itemNumber, deltaL, deltaL_t, stiffness, damping, force):
+    return stiffness*deltaL*(1+10*deltaL**2) + damping*deltaL_t
+
+simulationSettings = exu.SimulationSettings()
+simulationSettings.timeIntegration.numberOfSteps = 200
+simulationSettings.timeIntegration.endTime = 0.5
+simulationSettings.timeIntegration.verboseMode = 0
+simulationSettings.solutionSettings.writeSolutionToFile = False
+
+[SC, mbs, oMass, oSpring, sPos, sForce] = CreateModel()
+
+parameterSets = [[(oMass, 'physicsMass', 1.)],
+                 [(oMass, 'physicsMass', 2.)],
+                 [(oMass, 'physicsMass', 0.5), (oSpring, 'stiffness', 2000.)],
+                 [(oSpring, 'damping', 10.), (oSpring, 'referenceLength', 0.9)]]
+parameterSetUF = [(oSpring, 'springForceUserFunction', UFspring)]
+
+#reference: every member solved individually
+def SolveIndividually(parameterSet):
+    [SC, mbs, oMass, oSpring, sPos, sForce] = CreateModel()
+    for (item, name, value) in parameterSet:
+        mbs.SetObjectParameter(item, name, value)
+    mbs.Assemble()
+    mbs.SolveDynamic(simulationSettings)
+    return [mbs.GetSensorStoredData(sPos), mbs.GetSensorStoredData(sForce)]
+
+def CheckEnsemble(result, parameterSets, info):
+    if len(result['success']) != len(parameterSets) or not all(result['success']):
+        raise ValueError('solveEnsembleTest: solving members failed ('+info+')')
+    for i, parameterSet in enumerate(parameterSets):
+        reference = SolveIndividually(parameterSet)
+        for j in range(len(reference)):
+            if not np.array_equal(result['sensorData'][i][j], reference[j]):
+                raise ValueError('solveEnsembleTest: member '+str(i)+', sensor '+str(j)+' differs from individual solution ('+info+')')
+
+#parallel: members without Python user functions
+resultParallel = mbs.SolveEnsemble(parameterSets, sensorNumbers=[sPos, sForce], 
+                                   simulationSettings=simulationSettings, numberOfThreads=4)
+CheckEnsemble(resultParallel, parameterSets, 'parallel')
+
+#member with Python user function: all members are solved serially
+parameterSetsUF = parameterSets + [parameterSetUF]
+resultSerial = mbs.SolveEnsemble(parameterSetsUF, sensorNumbers=[sPos, sForce], 
+                                 simulationSettings=simulationSettings, numberOfThreads=4)
+CheckEnsemble(resultSerial, parameterSetsUF, 'Python user function')
+
+#original system is not changed by ensemble
+if mbs.GetObjectParameter(oMass, 'physicsMass') != 1. or mbs.GetObjectParameter(oSpring, 'springForceUserFunction') != 0:
+    raise ValueError('solveEnsembleTest: parameters of original system have been modified')
+
+u = 0
+for data in resultSerial['sensorData']:
+    u += np.sum(abs(data[0][-1,1:])) + np.sum(abs(data[1][-1,1:]))
+exu.Print('solution of solveEnsembleTest=',u)
+
+exudynTestGlobals.testError = u - (208.30808487094941) #2026-10-17
+exudynTestGlobals.testResult = u
@@ -0,0 +1,99 @@
+#+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+# This is an EXUDYN example
+#
+# Details:  Test for linearSolverSettings.reuseSparsityPattern with changing sparsity pattern:
+#           spheres with GeneralContact fall onto a ground sphere and onto each other, such that
+#           contacts add new entries to the Jacobian and the sparse matrix needs to be rebuilt;
+#           results are compared with the standard sparse matrix assembly
+#
+# Date:     2026-10-17
+#
+# Copyright:This file is part of Exudyn. Exudyn is free software. You can redistribute it and/or modify it under the terms of the Exudyn license. See 'LICENSE.txt' for more details.
+#
+#+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+import exudyn as exu
+from exudyn.utilities import *
+
+useGraphics = False #without test
+#+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+#you can erase the following lines and all exudynTestGlobals related operations if this is not intended to be used as TestModel:
+try: #only if called from test suite
+    from modelUnitTests import exudynTestGlobals #for globally storing test results
+    useGraphics = exudynTestGlobals.useGraphics
+except:
+    class ExudynTestGlobals:
+        pass
+    exudynTestGlobals = ExudynTestGlobals()
+#+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+import numpy as np
+
+def ComputeSpheres(reuseSparsityPattern, reuseAnalyzedPattern):
+    SC = exu.SystemContainer()
+    mbs = SC.AddSystem()
+
+    radius = 0.1
+    rGround = 5
+    k = 1e4
+    d = 5
+    mass = 0.1
+
+    nGround = mbs.AddNode(NodePointGround(referenceCoordinates=[0,-rGround,0]))
+    mGround = mbs.AddMarker(MarkerNodePosition(nodeNumber=nGround))
+
+    gContact = mbs.AddGeneralContact()
+    gContact.AddSphereWithMarker(mGround, radius=rGround, contactStiffness=k, contactDamping=d, frictionMaterialIndex=0)
+
+    sensorList = []
+    for i in range(6):
+        #spheres get into contact with ground or sphere below at different times
+        pRef = [0.03*(i%2), radius*(1.2+2.1*i), 0.02*(i%3)]
+        nMass = mbs.AddNode(NodePoint(referenceCoordinates=pRef))
+        mbs.AddObject(MassPoint(physicsMass=mass, nodeNumber=nMass))
+        mMass = mbs.AddMarker(MarkerNodePosition(nodeNumber=nMass))
+        mbs.AddLoad(Force(markerNumber=mMass, loadVector=[0,-mass*9.81,0]))
+        gContact.AddSphereWithMarker(mMass, radius=radius, contactStiffness=k, contactDamping=d, frictionMaterialIndex=0)
+        sensorList += [mbs.AddSensor(SensorNode(nodeNumber=nMass, storeInternal=True,
+                                                outputVariableType=exu.OutputVariableType.Position))]
+
+    gContact.SetFrictionPairings(np.zeros((1,1)))
+    gContact.SetSearchTreeCellSize(numberOfCells=[4,4,4])
+    gContact.SetSearchTreeBox(pMin=np.array([-1,-1,-1]), pMax=np.array([1,2,1]))
+
+    mbs.Assemble()
+
+    simulationSettings = exu.SimulationSettings()
+    simulationSettings.timeIntegration.numberOfSteps = 500
+    simulationSettings.timeIntegration.endTime = 0.5
+    simulationSettings.timeIntegration.newton.useModifiedNewton = False
+    simulationSettings.timeIntegration.newton.numericalDifferentiation.forODE2 = False
+    simulationSettings.solutionSettings.writeSolutionToFile = False
+    simulationSettings.linearSolverType = exu.LinearSolverType.EigenSparse
+    simulationSettings.linearSolverSettings.reuseSparsityPattern = reuseSparsityPattern
+    simulationSettings.linearSolverSettings.reuseAnalyzedPattern = reuseAnalyzedPattern
+    simulationSettings.parallel.numberOfThreads = 1
+
+    mbs.SolveDynamic(simulationSettings)
+
+    return [mbs.GetSensorStoredData(s) for s in sensorList]
+
+resultsRef = ComputeSpheres(False, False)
+resultsReuse = ComputeSpheres(True, False)
+resultsReuseAnalyzed = ComputeSpheres(True, True)
+
+#sparse matrix entries are summed in a different order if the pattern is reused, so only round-off differences are allowed
+for i in range(len(resultsRef)):
+    for (results, info) in [(resultsReuse, 'reuseSparsityPattern'), (resultsReuseAnalyzed, 'reuseAnalyzedPattern')]:
+        if np.max(abs(results[i] - resultsRef[i])) > 1e-10:
+            raise ValueError('sparsityPatternContactTest: sensor '+str(i)+' differs with '+info)
+
+    #without contact, spheres would fall more than 1.2 within 0.5 seconds and end up below the ground sphere
+    if resultsRef[i][-1,2] <= 0:
+        raise ValueError('sparsityPatternContactTest: sphere '+str(i)+' did not get into contact')
+
+u = sum(np.sum(data[-1,1:]) for data in resultsRef)
+exu.Print('solution of sparsityPatternContactTest=',u)
+
+exudynTestGlobals.testError = u - (0.8447040797576015) #2026-10-17
+exudynTestGlobals.testResult = u
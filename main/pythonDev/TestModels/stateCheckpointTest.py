@@ -0,0 +1,104 @@
+#+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+# This is an EXUDYN example
+#
+# Details:  Test for binary state checkpoints: a simulation is continued from a checkpoint in memory
+#           and from a checkpoint file, which must give identical results; sensor internal storage
+#           is restored and invalid checkpoints are rejected without changing the system
+#
+# Date:     2026-10-17
+#
+# Copyright:This file is part of Exudyn. Exudyn is free software. You can redistribute it and/or modify it under the terms of the Exudyn license. See 'LICENSE.txt' for more details.
+#
+#+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+import exudyn as exu
+from exudyn.utilities import *
+
+useGraphics = False #without test
+#+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+#you can erase the following lines and all exudynTestGlobals related operations if this is not intended to be used as TestModel:
+try: #only if called from test suite
+    from modelUnitTests import exudynTestGlobals #for globally storing test results
+    useGraphics = exudynTestGlobals.useGraphics
+except:
+    class ExudynTestGlobals:
+        pass
+    exudynTestGlobals = ExudynTestGlobals()
+#+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+import numpy as np
+
+SC = exu.SystemContainer()
+mbs = SC.AddSystem()
+
+#double pendulum made of mass points and spring-dampers
+oGround = mbs.CreateGround()
+oMass0 = mbs.CreateMassPoint(referencePosition=[1,0,0], physicsMass=1, gravity=[0,-9.81,0])
+oMass1 = mbs.CreateMassPoint(referencePosition=[2,0,0], physicsMass=0.5, gravity=[0,-9.81,0],
+                             initialVelocity=[0,0,0.5])
+mbs.CreateSpringDamper(bodyList=[oGround, oMass0], stiffness=1e4, damping=5)
+mbs.CreateSpringDamper(bodyList=[oMass0, oMass1], stiffness=1e4, damping=5)
+
+sPos = mbs.AddSensor(SensorBody(bodyNumber=oMass1, storeInternal=True,
+                                outputVariableType=exu.OutputVariableType.Position))
+mbs.Assemble()
+checkpointInitial = mbs.GetStateCheckpoint(configuration=exu.ConfigurationType.Initial)
+
+simulationSettings = exu.SimulationSettings()
+simulationSettings.timeIntegration.numberOfSteps = 500
+simulationSettings.timeIntegration.endTime = 0.5
+simulationSettings.solutionSettings.writeSolutionToFile = False
+
+#simulate first part and store checkpoint of final state
+mbs.SolveDynamic(simulationSettings)
+checkpoint = mbs.GetStateCheckpoint()
+sensorData0 = mbs.GetSensorStoredData(sPos)
+
+#continue from checkpoint: start simulation in initial configuration given by checkpoint
+def ContinueSimulation():
+    simulationSettings.timeIntegration.startTime = 0.5
+    simulationSettings.timeIntegration.endTime = 1
+    mbs.SolveDynamic(simulationSettings)
+    return mbs.GetSensorStoredData(sPos)[-1,1:]
+
+mbs.SetStateCheckpoint(checkpoint, configuration=exu.ConfigurationType.Initial)
+pMemory = ContinueSimulation()
+
+#restore sensor storage from checkpoint into current configuration
+mbs.SetStateCheckpoint(checkpoint)
+if not np.array_equal(mbs.GetSensorStoredData(sPos), sensorData0):
+    raise ValueError('stateCheckpointTest: sensor storage not restored from checkpoint')
+
+#file round trip
+fileName = 'solution/stateCheckpointTest.bin'
+mbs.WriteStateCheckpoint(fileName)
+mbs.ReadStateCheckpoint(fileName, configuration=exu.ConfigurationType.Initial)
+if not np.array_equal(ContinueSimulation(), pMemory):
+    raise ValueError('stateCheckpointTest: continuation from file checkpoint differs')
+
+#invalid (truncated) checkpoint must raise error and leave system unchanged
+invalidRejected = False
+try:
+    mbs.SetStateCheckpoint(checkpoint[:-8], configuration=exu.ConfigurationType.Initial)
+except:
+    invalidRejected = True
+if not invalidRejected:
+    raise ValueError('stateCheckpointTest: truncated checkpoint not rejected')
+if not np.array_equal(ContinueSimulation(), pMemory):
+    raise ValueError('stateCheckpointTest: system changed by truncated checkpoint')
+
+#reset to initial state and repeat first part of simulation, as in optimization loops
+mbs.SetStateCheckpoint(checkpointInitial, configuration=exu.ConfigurationType.Initial)
+simulationSettings.timeIntegration.startTime = 0
+simulationSettings.timeIntegration.endTime = 0.5
+mbs.SolveDynamic(simulationSettings)
+if not np.array_equal(mbs.GetSensorStoredData(sPos), sensorData0):
+    raise ValueError('stateCheckpointTest: simulation after reset to initial checkpoint differs')
+
+exu.Print('position continued from checkpoint=', pMemory)
+
+u = np.sum(pMemory)
+exu.Print('solution of stateCheckpointTest=',u)
+
+exudynTestGlobals.testError = u - (-2.522984484630477) #2026-10-17
+exudynTestGlobals.testResult = u
@@ -0,0 +1,99 @@
+#+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+# This is an EXUDYN example
+#
+# Details:  Test for symbolic user functions compiled into instruction tape:
+#           results with compiled functions must be identical to evaluation of expression trees;
+#           compiled functions are thread safe and are also evaluated in parallel threads
+#
+# Date:     2026-10-17
+#
+# Copyright:This file is part of Exudyn. Exudyn is free software. You can redistribute it and/or modify it under the terms of the Exudyn license. See 'LICENSE.txt' for more details.
+#
+#+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+import exudyn as exu
+from exudyn.utilities import *
+
+useGraphics = False #without test
+#+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+#you can erase the following lines and all exudynTestGlobals related operations if this is not intended to be used as TestModel:
+try: #only if called from test suite
+    from modelUnitTests import exudynTestGlobals #for globally storing test results
+    useGraphics = exudynTestGlobals.useGraphics
+except:
+    class ExudynTestGlobals:
+        pass
+    exudynTestGlobals = ExudynTestGlobals()
+#+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+esym = exu.symbolic
+import numpy as np
+
+#uses constants, common subexpressions, IfThenElse and external symbolic variable
+def UFspring(mbs, t, itemNumber, deltaL, deltaL_t, stiffness, damping, force):
+    fStiff = stiffness*deltaL*(1+10*deltaL**2)
+    return fStiff + damping*deltaL_t + esym.IfThenElse(deltaL < 0, 0.5*fStiff, esym.Real(0)) + force*esym.variables.Get('forceFactor')
+
+def UFload(mbs, t, load):
+    return load*esym.sin(2*np.pi*2*t)*esym.exp(-0.5*t)
+
+def ComputeChain(compile, numberOfThreads=1, n=20):
+    SC = exu.SystemContainer()
+    mbs = SC.AddSystem()
+    esym.variables.Set('forceFactor', 0.5)
+
+    nCompiled = 0
+    oPrevious = mbs.CreateGround()
+    for i in range(n):
+        oMass = mbs.CreateMassPoint(referencePosition=[i+1,0,0], physicsMass=0.5)
+        oSD = mbs.CreateSpringDamper(bodyList=[oPrevious, oMass], stiffness=2000, damping=2,
+                                     referenceLength=1, force=0.1*i, springForceUserFunction=UFspring)
+        symbolicFunction = CreateSymbolicUserFunction(mbs, UFspring, 'springForceUserFunction', oSD, compile=compile)
+        mbs.SetObjectParameter(oSD, 'springForceUserFunction', symbolicFunction)
+        nCompiled += symbolicFunction.IsCompiled()
+        oPrevious = oMass
+
+    mLast = mbs.AddMarker(MarkerBodyPosition(bodyNumber=oPrevious))
+    load = mbs.AddLoad(LoadForceVector(markerNumber=mLast, loadVector=[10,2,0], loadVectorUserFunction=UFload))
+    symbolicLoad = CreateSymbolicUserFunction(mbs, UFload, 'loadVectorUserFunction', load, compile=compile)
+    mbs.SetLoadParameter(load, 'loadVectorUserFunction', symbolicLoad)
+    nCompiled += symbolicLoad.IsCompiled()
+
+    sPos = mbs.AddSensor(SensorBody(bodyNumber=oPrevious, storeInternal=True,
+                                    outputVariableType=exu.OutputVariableType.Position))
+    mbs.Assemble()
+
+    simulationSettings = exu.SimulationSettings()
+    simulationSettings.timeIntegration.numberOfSteps = 2000
+    simulationSettings.timeIntegration.endTime = 1
+    simulationSettings.solutionSettings.writeSolutionToFile = False
+    simulationSettings.parallel.numberOfThreads = numberOfThreads
+    simulationSettings.parallel.multithreadedLLimitResiduals = 1 #use parallel loops for all items
+    simulationSettings.parallel.multithreadedLLimitLoads = 1
+
+    mbs.SolveDynamic(simulationSettings, solverType=exu.DynamicSolverType.RK44)
+    return [mbs.GetSensorStoredData(sPos), nCompiled]
+
+[resultsTree, nCompiledTree] = ComputeChain(compile=False)
+[resultsCompiled, nCompiled] = ComputeChain(compile=True)
+[resultsThreads, nCompiledThreads] = ComputeChain(compile=True, numberOfThreads=4)
+exu.Print('number of compiled user functions:', nCompiledTree, nCompiled)
+
+if nCompiledTree != 0:
+    raise ValueError('symbolicUserFunctionCompiledTest: user functions compiled with compile=False')
+if nCompiled != 21: #20 spring-dampers and one load
+    raise ValueError('symbolicUserFunctionCompiledTest: only '+str(nCompiled)+' of 21 user functions compiled')
+
+#only round-off differences due to constant folding allowed
+if np.max(abs(resultsCompiled - resultsTree)) > 1e-10:
+    raise ValueError('symbolicUserFunctionCompiledTest: compiled user functions differ from expression trees')
+
+#every item is evaluated by exactly one thread, so results must be identical
+if not np.array_equal(resultsThreads, resultsCompiled):
+    raise ValueError('symbolicUserFunctionCompiledTest: compiled user functions differ in parallel threads')
+
+u = np.sum(resultsTree[-1,1:])
+exu.Print('solution of symbolicUserFunctionCompiledTest=',u)
+
+exudynTestGlobals.testError = u - (20.255611176204578) #2026-10-17
+exudynTestGlobals.testResult = u
@@ -0,0 +1,94 @@
+#+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+# This is an EXUDYN example
+#
+# Details:  Test for analytic Jacobians of connectors with compiled symbolic user functions;
+#           compares the ODE2 Jacobian of ObjectConnectorSpringDamper and ObjectConnectorCartesianSpringDamper
+#           with the Jacobian computed by numerical differentiation
+#
+# Date:     2026-10-17
+#
+# Copyright:This file is part of Exudyn. Exudyn is free software. You can redistribute it and/or modify it under the terms of the Exudyn license. See 'LICENSE.txt' for more details.
+#
+#+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+import exudyn as exu
+from exudyn.utilities import *
+
+useGraphics = False #without test
+#+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+#you can erase the following lines and all exudynTestGlobals related operations if this is not intended to be used as TestModel:
+try: #only if called from test suite
+    from modelUnitTests import exudynTestGlobals #for globally storing test results
+    useGraphics = exudynTestGlobals.useGraphics
+except:
+    class ExudynTestGlobals:
+        pass
+    exudynTestGlobals = ExudynTestGlobals()
+#+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+esym = exu.symbolic
+import numpy as np
+
+SC = exu.SystemContainer()
+mbs = SC.AddSystem()
+
+#nonlinear spring with velocity-dependent damping; includes pow with non-integer exponent
+def UFspring(mbs, t, itemNumber, deltaL, deltaL_t, stiffness, damping, force):
+    return stiffness*esym.sign(deltaL)*(esym.abs(deltaL))**1.5 + damping*deltaL_t*(1+deltaL_t**2) + force
+
+def UFcartesian(mbs, t, itemNumber, displacement, velocity, stiffness, damping, offset):
+    k = stiffness
+    d = damping
+    u = displacement
+    v = velocity
+    return [k[0]*u[0] + 10*u[0]*u[1] + d[0]*v[0]*u[2],
+            k[1]*u[1] + 2*k[1]*u[1]**3 + d[1]*v[1],
+            k[2]*esym.sin(u[2]) + d[2]*v[2]*(1+u[0]**2) + offset[2]]
+
+oGround = mbs.CreateGround()
+oMass0 = mbs.CreateMassPoint(referencePosition=[1,0,0], physicsMass=1,
+                             initialDisplacement=[0.12,0.03,-0.02], initialVelocity=[0.3,-0.2,0.1])
+oMass1 = mbs.CreateMassPoint(referencePosition=[2,0,0], physicsMass=1,
+                             initialDisplacement=[-0.05,0.08,0.04], initialVelocity=[-0.1,0.4,0.25])
+
+oSD = mbs.CreateSpringDamper(bodyList=[oGround, oMass0], referenceLength=0.8,
+                             stiffness=100, damping=2, springForceUserFunction=UFspring)
+oCSD = mbs.CreateCartesianSpringDamper(bodyList=[oMass0, oMass1],
+                                       stiffness=[200,300,400], damping=[1,2,3], offset=[0,0,0.01],
+                                       springForceUserFunction=UFcartesian)
+
+symSD = CreateSymbolicUserFunction(mbs, UFspring, 'springForceUserFunction', oSD)
+mbs.SetObjectParameter(oSD, 'springForceUserFunction', symSD)
+symCSD = CreateSymbolicUserFunction(mbs, UFcartesian, 'springForceUserFunction', oCSD)
+mbs.SetObjectParameter(oCSD, 'springForceUserFunction', symCSD)
+
+mbs.Assemble()
+
+simulationSettings = exu.SimulationSettings()
+simulationSettings.solutionSettings.writeSolutionToFile = False
+
+#compute Jacobian w.r.t. positions and velocities (factor 1 for both) at initial state
+def ComputeJacobian(numericalConnectors):
+    simulationSettings.timeIntegration.newton.numericalDifferentiation.forODE2connectors = numericalConnectors
+    solver = exu.MainSolverImplicitSecondOrder()
+    solver.InitializeSolver(mbs, simulationSettings)
+    solver.ComputeJacobianODE2RHS(mbs, scalarFactor_ODE2=1., scalarFactor_ODE2_t=1.)
+    J = np.array(solver.GetSystemJacobian())
+    solver.FinalizeSolver(mbs, simulationSettings)
+    return J
+
+Janalytic = ComputeJacobian(False)
+Jnumerical = ComputeJacobian(True)
+
+relativeError = np.linalg.norm(Janalytic-Jnumerical)/np.linalg.norm(Janalytic)
+exu.Print('relative difference of analytic and numerical Jacobian=',relativeError)
+
+#difference is in the order of numerical differentiation error
+if relativeError > 1e-6:
+    raise ValueError('symbolicUserFunctionJacobianTest: analytic Jacobian differs from numerical Jacobian')
+
+u = np.sum(np.abs(Janalytic))
+exu.Print('solution of symbolicUserFunctionJacobianTest=',u)
+
+exudynTestGlobals.testError = u - (3809.3910877227636) #2026-10-17
+exudynTestGlobals.testResult = u
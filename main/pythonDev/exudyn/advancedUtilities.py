@@ -520,6 +520,7 @@ def ConvertFunctionToSymbolic(mbs, function, userFunctionName, itemIndex=None, i
 #  itemTypeName: use of type name, such as ObjectConnectorSpringDamper; in this case, itemIndex must be None
 #  userFunctionName: name of user function item, see documentation; this is required, because some items have several user functions, which need to be distinguished
 #  verbose: if > 0, according output may be printed
+#  compile: if True, expression trees are compiled into a flat tape of instructions for faster evaluation; if compilation is not possible (e.g., for matrix operations or vectors with variable size), expression trees are evaluated; compiled user functions of objects and loads are evaluated in parallel in multithreaded computation
 #**output: returns symbolic user function; this can be transfered into an item using TransferUserFunction2Item
 #**notes: keep the return value alive in a variable (or list), as it contains the expression tree which must exist for the lifetime of the user function
 #**example:
@@ -539,10 +540,14 @@ def ConvertFunctionToSymbolic(mbs, function, userFunctionName, itemIndex=None, i
 #                    springForceUserFunction=symbolicFunc))
 #
 # print(symbolicFunc.Evaluate(mbs, 0., 0, 1.1, 0.,  100., 0., 13.) )
-def CreateSymbolicUserFunction(mbs, function, userFunctionName, itemIndex=None, itemTypeName=None, verbose=0):
+def CreateSymbolicUserFunction(mbs, function, userFunctionName, itemIndex=None, itemTypeName=None, verbose=0, compile=True):
     fnDict = ConvertFunctionToSymbolic(mbs, function, userFunctionName, itemIndex, itemTypeName, verbose)
     symbolicFunc = exudyn.symbolic.UserFunction()
     symbolicFunc.SetUserFunctionFromDict(mbs, fnDict, userFunctionName, itemIndex, str(itemTypeName))
+    if compile:
+        isCompiled = symbolicFunc.Compile()
+        if verbose:
+            print('symbolic user function compiled:', isCompiled)
     return symbolicFunc
     
 
@@ -142,6 +142,47 @@ def ParseOutputFileHeader(lines):
     
     return output
 
+#**function: read header of binary sensor file, written with simulationSettings.solutionSettings.sensorsBinaryFiles=True
+#**input: fileName: string containing directory and filename of sensor file
+#**output: returns None, if file is not a binary sensor file; otherwise returns dictionary with 'headerSize' (bytes until first row), 'numberOfColumns' (time + sensor values), 'dtype' (numpy type of stored values) and 'lines' (text header as in text sensor files, in file.readlines() format)
+def ReadBinarySensorFileHeader(fileName):
+    with open(fileName, 'rb') as file:
+        preamble = file.read(24) #16 bytes EXUSNS header + int32 headerSize + int32 numberOfColumns
+        if len(preamble) < 24 or preamble[0:6] != b'EXUSNS':
+            return None
+        realSize = int(preamble[8])
+        byteOrder = '>' if preamble[10] else '<'
+        [headerSize, nColumns] = np.frombuffer(preamble[16:24], dtype=byteOrder+'i4')
+        text = file.read(int(headerSize)-24).split(b'\0')[0].decode('utf-8', errors='replace')
+
+    return {'headerSize':int(headerSize), 'numberOfColumns':int(nColumns), 
+            'dtype':np.dtype(byteOrder+'f'+str(realSize)), 
+            'lines':text.splitlines(keepends=True)}
+
+#**function: load binary sensor file, written with simulationSettings.solutionSettings.sensorsBinaryFiles=True; the file is mapped into memory (numpy.memmap) and not copied, which allows to access very large files; incomplete rows at the end of the file (during simulation) are ignored
+#**input: 
+#  fileName: string containing directory and filename of sensor file
+#  copy: if True, data is loaded into a numpy array instead of returning memmap
+#**output: returns numpy array (memmap) with rows containing time and sensor values, as in text sensor files loaded with numpy.loadtxt(...)
+#**example:
+#data = LoadBinarySensorFile('solution/sensorPos.bin')
+#print('final position=', data[-1,1:])
+def LoadBinarySensorFile(fileName, copy=False):
+    header = ReadBinarySensorFileHeader(fileName)
+    if header is None:
+        raise ValueError('LoadBinarySensorFile: no binary sensor file header found in "'+fileName+'"')
+
+    nColumns = header['numberOfColumns']
+    dataSize = os.path.getsize(fileName) - header['headerSize']
+    nRows = dataSize // (header['dtype'].itemsize*nColumns)
+    if nRows == 0:
+        return np.zeros((0, nColumns))
+
+    data = np.memmap(fileName, dtype=header['dtype'], mode='r', offset=header['headerSize'], shape=(nRows, nColumns))
+    if copy:
+        return np.array(data)
+    return data
+
 #**function: returns structure with default values for PlotSensor which can be modified once to be set for all later calls of PlotSensor
 #**example: 
 ##change one parameter:
@@ -395,8 +436,12 @@ def PlotSensor(mbs, sensorNumbers=[], components=0, xLabel='time (s)', yLabel=No
             sensorDict['outputVariableType']=''
             sensorDict['name'] = sensorNumber.split('/')[-1].split('\\')[-1].split('.')[0] #use filename without path and ending
             
-            with open(sensorDict['fileName']) as file:
-                sensorDict.update(ParseOutputFileHeader(file.readlines()) )
+            binaryHeader = ReadBinarySensorFileHeader(sensorDict['fileName'])
+            if binaryHeader is not None:
+                sensorDict.update(ParseOutputFileHeader(binaryHeader['lines']) )
+            else:
+                with open(sensorDict['fileName']) as file:
+                    sensorDict.update(ParseOutputFileHeader(file.readlines()) )
             
             if sensorDict['type'] == 'solution':
                 sensorDict['outputVariableType'] = 'Coordinates'
@@ -506,7 +551,7 @@ def PlotSensor(mbs, sensorNumbers=[], components=0, xLabel='time (s)', yLabel=No
         if ('storeInternal' in sensorDicts[i] and
             sensorDicts[i]['storeInternal']): #preferred way (higher accuracy, faster)
             sensorNumber = sensorList[i]
-            data = mbs.GetSensorStoredData(sensorNumber)
+            data = mbs.GetSensorStoredData(sensorNumber, copy=False) #read-only view, no copy needed
         elif 'numpyArray' in sensorDicts[i]:
             sensorNumber = 'data'+str(i) #this string appears in errors and possibly in legend
             data = sensorList[i]
@@ -518,7 +563,10 @@ def PlotSensor(mbs, sensorNumbers=[], components=0, xLabel='time (s)', yLabel=No
             if 'fileDelimiterChar' in kwargs:
                 fileDelimiterChar = kwargs['fileDelimiterChar']
             
-            data = np.loadtxt(sensorFileNames[i], comments=fileCommentChar, delimiter=fileDelimiterChar)
+            if ReadBinarySensorFileHeader(sensorFileNames[i]) is not None:
+                data = LoadBinarySensorFile(sensorFileNames[i])
+            else:
+                data = np.loadtxt(sensorFileNames[i], comments=fileCommentChar, delimiter=fileDelimiterChar)
 
         #select color and style for sensor
         CC = PlotLineCode(i+colorCodeOffset)
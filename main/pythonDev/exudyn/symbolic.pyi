@@ -236,6 +236,10 @@ class UserFunction:
     @overload
     def SetUserFunctionFromDict(self, mainSystem: MainSystem, fcnDict: dict, itemIndex: ItemIndex, userFunctionName: str) -> None: ...
     @overload
+    def Compile(self) -> bool: ...
+    @overload
+    def IsCompiled(self) -> bool: ...
+    @overload
     def __repr__(self) -> str: ...
     @overload
     def __str__(self) -> str: ...
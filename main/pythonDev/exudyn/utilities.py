@@ -461,187 +461,43 @@ def BinaryReadRealVector(file, intType, realType):
 
 
 #++++++++++++++++++++++++++++++++++++++++++++
-#**function: read BINARY coordinates solution file (exported during static or dynamic simulation with option exu.SimulationSettings().solutionSettings.coordinatesSolutionFileName='...') into dictionary
+#**function: read BINARY coordinates solution file (exported during static or dynamic simulation with option exu.SimulationSettings().solutionSettings.coordinatesSolutionFileName='...') into dictionary; the file is memory-mapped with exudyn.BinarySolutionReader, which does not parse the file row by row in Python
 #**input: 
 #  fileName: string containing directory and filename of stored coordinatesSolutionFile
 #  verbose: if True, some information is written when importing file (use for huge files to track progress)
 #  maxRows: maximum number of data rows loaded, if saveMode=True; use this for huge files to reduce loading time; set -1 to load all rows
+#  copy: if False, 'data' is a read-only numpy view into the memory-mapped file (no loading or copying of data, file stays mapped as long as data exists); if True, data is copied into a numpy array
 #**output: dictionary with 'data': the matrix of stored solution vectors, 'columnsExported': a list with integer values showing the exported sizes [nODE2, nVel2, nAcc2, nODE1, nVel1, nAlgebraic, nData], 'nColumns': the number of data columns and 'nRows': the number of data rows
-def LoadBinarySolutionFile(fileName, maxRows=-1, verbose=True):
-    print('verbose=',verbose)
-    with open(fileName, 'r') as file:
-        data = np.fromfile(file, dtype=np.byte, count=6)
-        s = NumpyInt8ArrayToString(data)
-        if int(verbose)>1: print(s)
-        if s!='EXUBIN':
-            raise ValueError('LoadBinarySolutionFile: no binary header found!')
-
-        if verbose: print('read binary file')
-        fileEnd = False
-#             ExuFile::BinaryWriteHeader(solFile, bfs);
-        dataHeader = np.fromfile(file, dtype=np.byte, count=10)
-        #dataHeader[0] == '\n'
-        indexSize = int(dataHeader[1])
-        realSize = int(dataHeader[2])
-        pointerSize = int(dataHeader[3])
-        bigEndian = int(dataHeader[4])
-        
-        if indexSize==4:
-            intType = np.int32
-        elif indexSize==8:
-            intType = np.int64
-        else:
-            raise ValueError('Read binary file: invalid Index type size!')
-        
-        if realSize==4:
-            realType = np.float32
-        elif realSize==8:
-            realType = np.float64
-        else:
-            raise ValueError('LoadBinarySolutionFile: invalid Real type size!')
-        
-        if verbose>1: 
-            print('  indexSize=',indexSize)
-            print('  realSize=',realSize)
-            print('  pointerSize=',pointerSize)
-            print('  bigEndian=',bigEndian)
-
-#         ExuFile::BinaryWrite(EXUstd::exudynVersion, solFile, bfs);
-        sVersion, fileEnd=BinaryReadString(file, intType)
-        if verbose: print('  version=',sVersion)
-
-#         ExuFile::BinaryWrite(STDstring("Mode0000"), solFile, bfs); //change this in future to add new features
-        sMode, fileEnd=BinaryReadString(file, intType)
-        if int(verbose)>1: print('  mode=',sMode)
-
-#             STDstring str = "Exudyn " + GetSolverName() + " ";
-#             if (isStatic) { str+="static "; }
-#             str+="solver solution file";
-#             ExuFile::BinaryWrite(str, solFile, bfs);
-        sSolver, fileEnd=BinaryReadString(file, intType)
-        if int(verbose)>1: print('  solver=',sSolver)
-
-#             //solFile << "#simulation started=" << EXUstd::GetDateTimeString() << "\n";
-#             ExuFile::BinaryWrite(EXUstd::GetDateTimeString(), solFile, bfs);
-        sTime, fileEnd=BinaryReadString(file, intType)
-        if int(verbose)>1: print('  data/time=',sTime)
-
-#             //not needed in binary format:
-#             //solFile << "#columns contain: time, ODE2 displacements";
-#             //if (solutionSettings.exportVelocities) { solFile << ", ODE2 velocities"; }
-#             //if (solutionSettings.exportAccelerations) { solFile << ", ODE2 accelerations"; }
-#             //if (nODE1) { solFile << ", ODE1 coordinates"; } //currently not available, but for future solFile structure necessary!
-#             //if (nVel1) { solFile << ", ODE1 velocities"; }
-#             //if (solutionSettings.exportAlgebraicCoordinates) { solFile << ", AE coordinates"; }
-#             //if (solutionSettings.exportDataCoordinates) { solFile << ", ODE2 velocities"; }
-#             //solFile << "\n";
-
-#             //solFile << "#number of system coordinates [nODE2, nODE1, nAlgebraic, nData] = [" <<
-#             //    nODE2 << "," << nODE1 << "," << nAE << "," << nData << "]\n"; //this will allow to know the system information, independently of coordinates written
-#             ArrayIndex sysCoords({nODE2, nODE1, nAE, nData});
-#             ExuFile::BinaryWrite(sysCoords, solFile, bfs);
-        systemSizes, fileEnd=BinaryReadArrayIndex(file, intType)
-        if verbose: print('  systemSizes=',systemSizes)
-
-
-#             //solFile << "#number of written coordinates [nODE2, nVel2, nAcc2, nODE1, nVel1, nAlgebraic, nData] = [" << //these are the exported coordinates line-by-line
-#             //    nODE2 << "," << nVel2 << "," << nAcc2 << "," << nODE1 << "," << nVel1 << "," << nAEexported << "," << nDataExported << "]\n"; //python convert line with v=eval(line.split('=')[1])
-#             ArrayIndex writtenCoords({ nODE2, nVel2, nAcc2, nODE1, nVel1, nAEexported, nDataExported });
-#             ExuFile::BinaryWrite(writtenCoords, solFile, bfs);
-        columnsExported, fileEnd=BinaryReadArrayIndex(file, intType)
-        if verbose: print('  columnsExported=',columnsExported)
-        nColumns = sum(columnsExported) #total size of data per row
-        
-#             //solFile << "#total columns exported  (excl. time) = " << totalCoordinates << "\n";
-#             ExuFile::BinaryWrite(totalCoordinates, solFile, bfs);
-        totalCoordinates, fileEnd = BinaryReadIndex(file, intType)
-
-#             Index numberOfSteps;
-#             if (!isStatic) { numberOfSteps = timeint.numberOfSteps; }
-#             else { numberOfSteps = staticSolver.numberOfLoadSteps; }
-#             ExuFile::BinaryWrite(numberOfSteps, solFile, bfs);
-        numberOfSteps, fileEnd = BinaryReadIndex(file, intType)
-        
-#             //solution information: always export string, even if has zero length:
-#             ExuFile::BinaryWrite(solutionSettings.solutionInformation, solFile, bfs);
-        solutionInformation, fileEnd=BinaryReadString(file, intType)
-        if int(verbose)>1: print('  solutionInformation="'+solutionInformation+'"')
-
-#             //add some checksum ...
-#             ExuFile::BinaryWrite(STDstring("EndOfHeader"), solFile, bfs);
-#             //next byte starts with solution
-        EndOfHeader, fileEnd=BinaryReadString(file, intType)
-        if int(verbose)>1: print('  EndOfHeader found: ',EndOfHeader)
-        if EndOfHeader!='EndOfHeader':
-            raise ValueError('LoadBinarySolutionFile: EndOfHeader not found')
-
-
-        #+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
-        #read time steps
-#         if (isBinary) //add size, only in binary mode
-#         {
-#             //including 1 real for time+1 Index for nVectors, but excluding bytes for this Index
-#             Index lineSizeBytes = nVectors * bfs.indexSize + nValues * bfs.realSize + bfs.indexSize + bfs.realSize;
-#             ExuFile::BinaryWrite(lineSizeBytes, solFile, bfs); //size of line, for fast skipping of solution line
-#             ExuFile::BinaryWrite(nVectors, solFile, bfs); //number of vectors could vary if needed
-#         }
-        if fileEnd: print('  ==> end of file found during in header')
-        fileEnd = False
-        data = np.zeros((0,nColumns+1))
-        nRows = 0
-        line = np.zeros(nColumns+1)
-        validEndFound = False
-        dataList = [] #list is much faster than hstack !
-        
-        while not fileEnd:
-            #print('read row ',nRows)
-            if maxRows != -1 and nRows >= maxRows:
-                fileEnd = True
-                break
-
-            #includes time and all values for solution according to header    
-            sizeData = np.fromfile(file, dtype=intType, count=1)
-            if sizeData.size != 1: 
-                fileEnd=True
-                break
-            dataLength = sizeData[0]
-            if dataLength  == -1:
-                if int(verbose)>1: print('end of file reached')
-                validEndFound = True
-                break
-            if int(verbose)>1: 
-                print('  dataLength=',dataLength)
-                
-            line = np.fromfile(file, dtype=realType, count=dataLength)
-            if line.size != dataLength: 
-                fileEnd=True
-                break
-            #line, fileEnd=BinaryReadRealVector(file, intType, realType)
-            if int(verbose)>1: 
-                print('  read',line.size, 'columns (',nColumns+1,'expected)')
-                print('  line=',line)
-            if fileEnd: break
-            if line.size != nColumns+1:
-                raise ValueError('LoadBinarySolutionFile: rows are inconsistent')
-            
-            nRows += 1
+def LoadBinarySolutionFile(fileName, maxRows=-1, verbose=True, copy=True):
+    if verbose: print('read binary file')
+    reader = exudyn.BinarySolutionReader(fileName)
+    header = reader.GetHeaderInfo()
+    if verbose: 
+        print('  version=',header['version'])
+        print('  systemSizes=',header['systemSizes'])
+        print('  columnsExported=',header['columnsExported'])
+    if int(verbose)>1: 
+        for key in ['indexSize','realSize','solver','dateTime','solutionInformation']:
+            print('  '+key+'=',header[key])
+
+    columnsExported = np.array(reader.GetColumnsExported())
+    nColumns = sum(columnsExported) #total size of data per row (excluding time)
+
+    nRows = reader.NumberOfRows()
+    if maxRows != -1: 
+        nRows = min(nRows, maxRows)
+
+    data = reader.GetData(rowEnd=nRows) #read-only view, no data is read here
+    if copy: 
+        data = np.array(data)
+    if verbose: print('  read '+str(nRows)+' rows from file')
+
+    if not header['validEndFound'] and nRows == reader.NumberOfRows():
+        print('LoadBinarySolutionFile: WARNING: end of file inconsistent!')
+    elif int(verbose)>1: 
+        print('LoadBinarySolutionFile finished')
 
-            dataList+=[line]
-            #data = np.vstack((data, line)) #slow!
-
-        if verbose: print('  read '+str(nRows)+' rows from file')
-        
-        data = np.array(dataList)
-        nRows = np.size(data,0)
-
-        if not validEndFound:
-            print('LoadBinarySolutionFile: WARNING: end of file inconsistent!')
-        else:
-            if int(verbose)>1: 
-                print('  valid end of data found')
-                print('LoadBinarySolutionFile finished')
-    
-        return dict({'data': data, 'columnsExported': columnsExported,'nColumns': nColumns,'nRows': nRows})
+    return dict({'data': data, 'columnsExported': columnsExported,'nColumns': nColumns,'nRows': nRows})
         
 
 
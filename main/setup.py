@@ -263,6 +263,7 @@ cppFiles = [
             'src/Graphics/GlfwClientExtended.cpp',
             'src/Graphics/OpenVRinterface.cpp',
             'src/Graphics/PostProcessData.cpp',
+            'src/Graphics/SoftwareRenderer.cpp',
             'src/Graphics/VisualizationPrimitives.cpp',
             'src/Graphics/VisualizationSystem.cpp',
             'src/Graphics/VisualizationSystemContainer.cpp',
@@ -290,6 +291,7 @@ cppFiles = [
             'src/Pymodules/PybindModule.cpp',
             'src/Pymodules/Pybind_manual_classes.cpp',
             'src/Pymodules/Pybind_modules.cpp',
+            'src/Pymodules/PyBinarySolutionReader.cpp',
             'src/Pymodules/PyMatrixContainer.cpp',
             'src/Pymodules/pythonTests.cpp',
             'src/Solver/CSolver.cpp',
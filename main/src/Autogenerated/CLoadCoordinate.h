@@ -4,7 +4,7 @@
 *
 * @author       Gerstmayr Johannes
 * @date         2019-07-01 (generated)
-* @date         2024-02-02  20:40:05 (last modified)
+* @date         2026-10-17  03:31:27 (last modified)
 *
 * @copyright    This file is part of Exudyn. Exudyn is free software: you can redistribute it and/or modify it under the terms of the Exudyn license. See "LICENSE.txt" for more details.
 * @note         Bug reports, support and further information:
@@ -113,6 +113,12 @@ public: // AUTO:
         return parameters.loadUserFunction != 0;
     }
 
+    //! AUTO:  return true, if load user function can be evaluated in multithreaded computation (compiled symbolic user function)
+    virtual bool HasThreadSafeUserFunction() const override
+    {
+        return parameters.loadUserFunction.IsThreadSafe();
+    }
+
     //! AUTO:  read access for load value (IsVector=false)
     virtual Real GetLoadValue(const MainSystemBase& mbs, Real t) const override;
 
@@ -4,7 +4,7 @@
 *
 * @author       Gerstmayr Johannes
 * @date         2019-07-01 (generated)
-* @date         2024-02-02  20:40:01 (last modified)
+* @date         2026-10-17  09:33:06 (last modified)
 *
 * @copyright    This file is part of Exudyn. Exudyn is free software: you can redistribute it and/or modify it under the terms of the Exudyn license. See "LICENSE.txt" for more details.
 * @note         Bug reports, support and further information:
@@ -89,6 +89,12 @@ public: // AUTO:
         return (parameters.springForceUserFunction!=0);
     }
 
+    //! AUTO:  return true, if computation user functions can be evaluated in multithreaded computation (compiled symbolic user functions)
+    virtual bool HasThreadSafeUserFunction() const override
+    {
+        return parameters.springForceUserFunction.IsThreadSafe();
+    }
+
     //! AUTO:  default function to return Marker numbers
     virtual const ArrayIndex& GetMarkerNumbers() const override
     {
@@ -107,6 +113,12 @@ public: // AUTO:
     //! AUTO:  return the available jacobian dependencies and the jacobians which are available as a function; if jacobian dependencies exist but are not available as a function, it is computed numerically; can be combined with 2^i enum flags
     virtual JacobianType::Type GetAvailableJacobians() const override;
 
+    //! AUTO:  return true, if ODE2 jacobian is constant, which is the case without user function (dry friction is not considered in jacobian)
+    virtual bool HasConstantJacobianODE2() const override
+    {
+        return (parameters.springForceUserFunction==0);
+    }
+
     //! AUTO:  Computational function: compute Jacobian of \hac{ODE2} \ac{LHS} equations w.r.t. ODE2 coordinates and ODE2 velocities; write either dense local jacobian into dense matrix of MatrixContainer or ADD sparse triplets INCLUDING ltg mapping to sparse matrix of MatrixContainer
     virtual void ComputeJacobianODE2_ODE2(EXUmath::MatrixContainer& jacobianODE2, JacobianTemp& temp, Real factorODE2, Real factorODE2_t, Index objectNumber, const ArrayIndex& ltg, const MarkerDataStructure& markerData) const override;
 
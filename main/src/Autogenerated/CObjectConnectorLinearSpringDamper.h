@@ -4,7 +4,7 @@
 *
 * @author       Gerstmayr Johannes
 * @date         2019-07-01 (generated)
-* @date         2024-02-02  20:40:00 (last modified)
+* @date         2026-10-17  03:31:26 (last modified)
 *
 * @copyright    This file is part of Exudyn. Exudyn is free software: you can redistribute it and/or modify it under the terms of the Exudyn license. See "LICENSE.txt" for more details.
 * @note         Bug reports, support and further information:
@@ -95,6 +95,12 @@ public: // AUTO:
         return (parameters.springForceUserFunction!=0);
     }
 
+    //! AUTO:  return true, if computation user functions can be evaluated in multithreaded computation (compiled symbolic user functions)
+    virtual bool HasThreadSafeUserFunction() const override
+    {
+        return parameters.springForceUserFunction.IsThreadSafe();
+    }
+
     //! AUTO:  default function to return Marker numbers
     virtual const ArrayIndex& GetMarkerNumbers() const override
     {
@@ -4,7 +4,7 @@
 *
 * @author       Gerstmayr Johannes
 * @date         2019-07-01 (generated)
-* @date         2024-02-02  20:40:00 (last modified)
+* @date         2026-10-17  03:45:48 (last modified)
 *
 * @copyright    This file is part of Exudyn. Exudyn is free software: you can redistribute it and/or modify it under the terms of the Exudyn license. See "LICENSE.txt" for more details.
 * @note         Bug reports, support and further information:
@@ -93,6 +93,12 @@ public: // AUTO:
         return (parameters.springForceUserFunction!=0);
     }
 
+    //! AUTO:  return true, if computation user functions can be evaluated in multithreaded computation (compiled symbolic user functions)
+    virtual bool HasThreadSafeUserFunction() const override
+    {
+        return parameters.springForceUserFunction.IsThreadSafe();
+    }
+
     //! AUTO:  default function to return Marker numbers
     virtual const ArrayIndex& GetMarkerNumbers() const override
     {
@@ -144,6 +150,9 @@ public: // AUTO:
     //! AUTO:  call to user function implemented in separate file to avoid including pybind and MainSystem.h at too many places
     void EvaluateUserFunctionForce(Real& force, const MainSystemBase& mainSystem, Real t, Index itemIndex, Real deltaL, Real deltaL_t) const;
 
+    //! AUTO:  call to Jacobian of user function w.r.t. its Real args (only available for compiled symbolic user function)
+    void EvaluateUserFunctionForceJacobian(ResizableMatrix& jacobian, const MainSystemBase& mainSystem, Real t, Index itemIndex, Real deltaL, Real deltaL_t) const;
+
     virtual OutputVariableType GetOutputVariableTypes() const override
     {
         return (OutputVariableType)(
@@ -4,7 +4,7 @@
 *
 * @author       Gerstmayr Johannes
 * @date         2019-07-01 (generated)
-* @date         2024-02-03  15:27:06 (last modified)
+* @date         2026-10-17  09:33:05 (last modified)
 *
 * @copyright    This file is part of Exudyn. Exudyn is free software: you can redistribute it and/or modify it under the terms of the Exudyn license. See "LICENSE.txt" for more details.
 * @note         Bug reports, support and further information:
@@ -131,6 +131,12 @@ public: // AUTO:
         return (parameters.forceUserFunction!=0) || (parameters.massMatrixUserFunction!=0) || (parameters.jacobianUserFunction!=0);
     }
 
+    //! AUTO:  return true, if computation user functions can be evaluated in multithreaded computation (compiled symbolic user functions)
+    virtual bool HasThreadSafeUserFunction() const override
+    {
+        return parameters.forceUserFunction.IsThreadSafe() && parameters.massMatrixUserFunction.IsThreadSafe() && parameters.jacobianUserFunction.IsThreadSafe();
+    }
+
     //! AUTO:  Computational function: compute mass matrix
     virtual void ComputeMassMatrix(EXUmath::MatrixContainer& massMatrixC, const ArrayIndex& ltg, Index objectNumber, bool computeInverse=false) const override;
 
@@ -140,6 +146,21 @@ public: // AUTO:
     //! AUTO:  Computational function: compute jacobian (dense or sparse mode, see parent CObject function)
     virtual void ComputeJacobianODE2_ODE2(EXUmath::MatrixContainer& jacobianODE2, JacobianTemp& temp, Real factorODE2, Real factorODE2_t, Index objectNumber, const ArrayIndex& ltg) const override;
 
+    //! AUTO:  return true, if ODE2 jacobian is constant (stiffness and damping matrix only); it is then computed once and cached
+    virtual bool HasConstantJacobianODE2() const override
+    {
+        return (parameters.jacobianUserFunction==0) && (parameters.forceUserFunction==0);
+    }
+
+    //! AUTO:  return true, if stiffness and damping matrix jacobian can be cached as constant part of ODE2 jacobian
+    virtual bool HasConstantJacobianODE2Part() const override
+    {
+        return (parameters.jacobianUserFunction==0);
+    }
+
+    //! AUTO:  compute constant part of jacobian due to stiffness and damping matrix (dense or sparse mode, see parent CObject function)
+    virtual void ComputeJacobianODE2_ODE2ConstantPart(EXUmath::MatrixContainer& jacobianODE2, JacobianTemp& temp, Real factorODE2, Real factorODE2_t, Index objectNumber, const ArrayIndex& ltg) const override;
+
     //! AUTO:  return the available jacobian dependencies and the jacobians which are available as a function; if jacobian dependencies exist but are not available as a function, it is computed numerically; can be combined with 2^i enum flags
     virtual JacobianType::Type GetAvailableJacobians() const override;
 
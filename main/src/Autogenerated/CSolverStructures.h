@@ -4,7 +4,7 @@
 *
 * @author       AUTO: Gerstmayr Johannes
 * @date         AUTO: 2019-07-01 (generated)
-* @date         AUTO: 2024-02-08 (last modfied)
+* @date         AUTO: 2026-10-17 (last modfied)
 *
 * @copyright    This file is part of Exudyn. Exudyn is free software: you can redistribute it and/or modify it under the terms of the Exudyn license. See "LICENSE.txt" for more details.
 * @note         Bug reports, support and further information:
@@ -139,7 +139,7 @@ public: // AUTO:
 *
 * @author       AUTO: Gerstmayr Johannes
 * @date         AUTO: 2019-07-01 (generated)
-* @date         AUTO: 2024-02-08 (last modfied)
+* @date         AUTO: 2026-10-17 (last modfied)
 *
 * @copyright    This file is part of Exudyn. Exudyn is free software: you can redistribute it and/or modify it under the terms of the Exudyn license. See "LICENSE.txt" for more details.
 * @note         Bug reports, support and further information:
@@ -214,7 +214,7 @@ public: // AUTO:
   }
 
   //! AUTO: set linear solver type and matrix version: links system matrices to according dense/sparse versions and with option for singular jacobian (redundant constraints)
-  void SetLinearSolverType(LinearSolverType linearSolverType, bool reuseAnalyzedPattern=false, bool ignoreSingularJacobian=false, Real pivotThreshold=0.);
+  void SetLinearSolverType(LinearSolverType linearSolverType, bool reuseAnalyzedPattern=false, bool ignoreSingularJacobian=false, Real pivotThreshold=0., bool reuseSparsityPattern=false);
   //! AUTO: print function used in ostream operator (print is virtual and can thus be overloaded)
   virtual void Print(std::ostream& os) const
   {
@@ -263,7 +263,7 @@ public: // AUTO:
 *
 * @author       AUTO: Gerstmayr Johannes
 * @date         AUTO: 2019-07-01 (generated)
-* @date         AUTO: 2024-02-08 (last modfied)
+* @date         AUTO: 2026-10-17 (last modfied)
 *
 * @copyright    This file is part of Exudyn. Exudyn is free software: you can redistribute it and/or modify it under the terms of the Exudyn license. See "LICENSE.txt" for more details.
 * @note         Bug reports, support and further information:
@@ -377,7 +377,7 @@ public: // AUTO:
 *
 * @author       AUTO: Gerstmayr Johannes
 * @date         AUTO: 2019-07-01 (generated)
-* @date         AUTO: 2024-02-08 (last modfied)
+* @date         AUTO: 2026-10-17 (last modfied)
 *
 * @copyright    This file is part of Exudyn. Exudyn is free software: you can redistribute it and/or modify it under the terms of the Exudyn license. See "LICENSE.txt" for more details.
 * @note         Bug reports, support and further information:
@@ -473,7 +473,7 @@ public: // AUTO:
 *
 * @author       AUTO: Gerstmayr Johannes
 * @date         AUTO: 2019-07-01 (generated)
-* @date         AUTO: 2024-02-08 (last modfied)
+* @date         AUTO: 2026-10-17 (last modfied)
 *
 * @copyright    This file is part of Exudyn. Exudyn is free software: you can redistribute it and/or modify it under the terms of the Exudyn license. See "LICENSE.txt" for more details.
 * @note         Bug reports, support and further information:
@@ -504,6 +504,7 @@ public: // AUTO:
   Index lastVerboseStepIndex;                     //!< AUTO: step index when last time written to console (or file)
   Index multiThreadingMode;                       //!< AUTO: multithreading mode that has been used: 0=None (serial), 1=NGsolve taskmanager, 2=MicroThreading (Exudyn)
   Index numberOfThreadsUsed;                      //!< AUTO: number of threads that have been used in simulation
+  bool releasedGIL;                               //!< AUTO: true, if Python GIL has been released during SolveSteps(...), such that other Python threads can run in parallel; GIL is only released for numberOfThreads=1 without renderer and without Python user functions
   Index stepInformation;                          //!< AUTO: this is a copy of the solvers stepInformation used for console output
   Index verboseMode;                              //!< AUTO: this is a copy of the solvers verboseMode used for console output
   Index verboseModeFile;                          //!< AUTO: this is a copy of the solvers verboseModeFile used for file
@@ -530,6 +531,7 @@ public: // AUTO:
     lastVerboseStepIndex = 0;
     multiThreadingMode = 0;
     numberOfThreadsUsed = 1;
+    releasedGIL = false;
     stepInformation = 0;
     verboseMode = 0;
     verboseModeFile = 0;
@@ -560,6 +562,7 @@ public: // AUTO:
     os << "  lastVerboseStepIndex = " << lastVerboseStepIndex << "\n";
     os << "  multiThreadingMode = " << multiThreadingMode << "\n";
     os << "  numberOfThreadsUsed = " << numberOfThreadsUsed << "\n";
+    os << "  releasedGIL = " << releasedGIL << "\n";
     os << "  sensorValuesTemp = " << sensorValuesTemp << "\n";
     os << "  sensorValuesTemp2 = " << sensorValuesTemp2 << "\n";
     os << "  stepInformation = " << stepInformation << "\n";
@@ -585,7 +588,7 @@ public: // AUTO:
 *
 * @author       AUTO: Gerstmayr Johannes
 * @date         AUTO: 2019-07-01 (generated)
-* @date         AUTO: 2024-02-08 (last modfied)
+* @date         AUTO: 2026-10-17 (last modfied)
 *
 * @copyright    This file is part of Exudyn. Exudyn is free software: you can redistribute it and/or modify it under the terms of the Exudyn license. See "LICENSE.txt" for more details.
 * @note         Bug reports, support and further information:
@@ -605,6 +608,8 @@ class SolverFileData // AUTO:
 public: // AUTO: 
   ExuFile::BinaryFileSettings binaryFileSettings; //!< AUTO: settings for binary file write mode
   std::vector<std::ofstream*> sensorFileList;     //!< AUTO: files for sensor output; the ofstream list corresponds exactly to the sensors in the computationalSystem (i.e., sensorFileList[0] is the ofstream for sensor 0, etc.); file lists need to be closed and deleted at end of simulation!
+  ArrayIndex sensorsBinaryColumns;                //!< AUTO: number of columns (time + sensor values) per sensor in binary sensor files, as written to file header; used to check that the number of sensor values does not change
+  ExuFile::AsyncFileWriter sensorsBinaryWriter;   //!< AUTO: background writer for binary sensor files (sensorsBinaryFiles=True); writes to the files in sensorFileList and must be finished before these files are closed
   std::ofstream solutionFile;                     //!< AUTO: solution file with coordinate data
   std::ofstream solverFile;                       //!< AUTO: file with detailed solver information
 
@@ -612,11 +617,18 @@ public: // AUTO:
 public: // AUTO: 
 
   // AUTO: access functions
+  //! AUTO: Set function (needed in pybind) for: number of columns (time + sensor values) per sensor in binary sensor files, as written to file header; used to check that the number of sensor values does not change
+  void PySetSensorsBinaryColumns(const std::vector<Index>& sensorsBinaryColumnsInit) { sensorsBinaryColumns = sensorsBinaryColumnsInit; }
+  //! AUTO: Read (Copy) access to: number of columns (time + sensor values) per sensor in binary sensor files, as written to file header; used to check that the number of sensor values does not change
+  std::vector<Index> PyGetSensorsBinaryColumns() const { return std::vector<Index>(sensorsBinaryColumns); }
+
   //! AUTO: print function used in ostream operator (print is virtual and can thus be overloaded)
   virtual void Print(std::ostream& os) const
   {
     os << "SolverFileData" << ":\n";
     os << "  binaryFileSettings = " << binaryFileSettings << "\n";
+    os << "  sensorsBinaryColumns = " << sensorsBinaryColumns << "\n";
+    os << "  sensorsBinaryWriter = " << sensorsBinaryWriter << "\n";
     os << "\n";
   }
 
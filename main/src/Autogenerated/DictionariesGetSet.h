@@ -2,7 +2,7 @@
 // AUTO:  Helper file for dictionaries get/set for system structures; generated by Johannes Gerstmayr
 // AUTO:  Generated by Johannes Gerstmayr
 // AUTO:  Used for SimulationSettings and VisualizationSettings
-// AUTO:  last modified = 2024-02-08
+// AUTO:  last modified = 2026-10-17
 // AUTO:  ++++++++++++++++++++++
 
   #ifndef DICTIONARIESGETSET__H
@@ -177,6 +177,14 @@ inline py::dict GetDictionaryWithTypeInfo(const SolutionSettings& data) {
     d["description"] = "flag (true/false); if true, sensor output is appended to existing file (otherwise created) or in case of internal storage, it is appended to existing currently stored data; this allows storing sensor values over different simulations";
     structureDict["sensorsAppendToFile"] = d;
 
+    d = py::dict(); //reset local dict
+    d["itemIdentifier"] = std::string(""); //identifier for item
+    d["value"] = data.sensorsBinaryFiles;
+    d["type"] = "bool";
+    d["size"] = std::vector<int>{1};
+    d["description"] = "if true, sensor files are written in binary format with fixed-width rows (time and sensor values), which can be loaded in Python with LoadBinarySensorFile(...) as numpy memmap; data is buffered and written to disc by a background thread, such that the solver does not wait for file output; setting outputPrecision >= 8 uses double (8 bytes), otherwise float (4 bytes) is used; sensorsAppendToFile and sensorsWriteFileFooter are ineffective for binary sensor files and files are always replaced";
+    structureDict["sensorsBinaryFiles"] = d;
+
     d = py::dict(); //reset local dict
     d["itemIdentifier"] = std::string(""); //identifier for item
     d["value"] = data.sensorsStoreAndWriteFiles;
@@ -294,6 +302,7 @@ inline py::dict GetDictionary(const SolutionSettings& data) {
     structureDict["restartFileName"] = data.restartFileName;
     structureDict["restartWritePeriod"] = data.PyGetRestartWritePeriod();
     structureDict["sensorsAppendToFile"] = data.sensorsAppendToFile;
+    structureDict["sensorsBinaryFiles"] = data.sensorsBinaryFiles;
     structureDict["sensorsStoreAndWriteFiles"] = data.sensorsStoreAndWriteFiles;
     structureDict["sensorsWriteFileFooter"] = data.sensorsWriteFileFooter;
     structureDict["sensorsWriteFileHeader"] = data.sensorsWriteFileHeader;
@@ -326,6 +335,7 @@ inline void SetDictionary(SolutionSettings& data, const py::dict& d) {
     data.restartFileName = py::cast<std::string>(d["restartFileName"]);
     data.restartWritePeriod = py::cast<Real>(d["restartWritePeriod"]);
     data.sensorsAppendToFile = py::cast<bool>(d["sensorsAppendToFile"]);
+    data.sensorsBinaryFiles = py::cast<bool>(d["sensorsBinaryFiles"]);
     data.sensorsStoreAndWriteFiles = py::cast<bool>(d["sensorsStoreAndWriteFiles"]);
     data.sensorsWriteFileFooter = py::cast<bool>(d["sensorsWriteFileFooter"]);
     data.sensorsWriteFileHeader = py::cast<bool>(d["sensorsWriteFileHeader"]);
@@ -1288,6 +1298,14 @@ inline py::dict GetDictionaryWithTypeInfo(const LinearSolverSettings& data) {
     d["description"] = "[ONLY available for sparse matrices] True: the Eigen SparseLU solver offers the possibility to reuse an analyzed pattern of a previous factorization; this may reduce total factorization time by a factor of 2 or 3, depending on the matrix type; however, if the matrix patterns heavily change between computations, this may even slow down performance; this flag is set for SparseMatrices in InitializeSolverData(...) and should be handled with care!";
     structureDict["reuseAnalyzedPattern"] = d;
 
+    d = py::dict(); //reset local dict
+    d["itemIdentifier"] = std::string(""); //identifier for item
+    d["value"] = data.reuseSparsityPattern;
+    d["type"] = "bool";
+    d["size"] = std::vector<int>{1};
+    d["description"] = "[ONLY available for sparse matrices] True: the sparsity pattern of the first built sparse matrix is stored together with a map from triplets to matrix entries; in subsequent computations, matrix values are directly added into the stored compressed matrix, avoiding the sorting of triplets; the matrix is automatically rebuilt, if the pattern changes (e.g., due to contact); in combination with reuseAnalyzedPattern, also the pattern analysis of the Eigen SparseLU solver is skipped as long as the pattern does not change";
+    structureDict["reuseSparsityPattern"] = d;
+
     d = py::dict(); //reset local dict
     d["itemIdentifier"] = std::string(""); //identifier for item
     d["value"] = data.showCausingItems;
@@ -1305,6 +1323,7 @@ inline py::dict GetDictionary(const LinearSolverSettings& data) {
     structureDict["ignoreSingularJacobian"] = data.ignoreSingularJacobian;
     structureDict["pivotThreshold"] = data.PyGetPivotThreshold();
     structureDict["reuseAnalyzedPattern"] = data.reuseAnalyzedPattern;
+    structureDict["reuseSparsityPattern"] = data.reuseSparsityPattern;
     structureDict["showCausingItems"] = data.showCausingItems;
     return structureDict;
 }
@@ -1314,6 +1333,7 @@ inline void SetDictionary(LinearSolverSettings& data, const py::dict& d) {
     data.ignoreSingularJacobian = py::cast<bool>(d["ignoreSingularJacobian"]);
     data.pivotThreshold = py::cast<Real>(d["pivotThreshold"]);
     data.reuseAnalyzedPattern = py::cast<bool>(d["reuseAnalyzedPattern"]);
+    data.reuseSparsityPattern = py::cast<bool>(d["reuseSparsityPattern"]);
     data.showCausingItems = py::cast<bool>(d["showCausingItems"]);
 }
 
@@ -1361,6 +1381,14 @@ inline py::dict GetDictionaryWithTypeInfo(const Parallel& data) {
     d["description"] = "number of threads used for parallel computation (1 == scalar processing); do not use more threads than available threads (in most cases it is good to restrict to the number of cores); currently, only one solver can be started with multithreading; if you use several mbs in parallel (co-simulation), you should use serial computing";
     structureDict["numberOfThreads"] = d;
 
+    d = py::dict(); //reset local dict
+    d["itemIdentifier"] = std::string(""); //identifier for item
+    d["value"] = data.pinThreads;
+    d["type"] = "bool";
+    d["size"] = std::vector<int>{1};
+    d["description"] = "True: worker thread i is pinned to CPU core i (Linux and Windows, ignored on MacOS), which avoids migration of threads between cores and may improve cache usage; main thread is not pinned";
+    structureDict["pinThreads"] = d;
+
     d = py::dict(); //reset local dict
     d["itemIdentifier"] = std::string(""); //identifier for item
     d["value"] = data.PyGetTaskSplitMinItems();
@@ -1377,6 +1405,30 @@ inline py::dict GetDictionaryWithTypeInfo(const Parallel& data) {
     d["description"] = "this is the number of subtasks that every thread receives; minimum is 1, the maximum should not be larger than 100; this factor is 1 as long as the taskSplitMinItems is not reached; flag is copied into MainSystem internal flag at InitializeSolverData(...)";
     structureDict["taskSplitTasksPerThread"] = d;
 
+    d = py::dict(); //reset local dict
+    d["itemIdentifier"] = std::string(""); //identifier for item
+    d["value"] = data.useColoringForResiduals;
+    d["type"] = "bool";
+    d["size"] = std::vector<int>{1};
+    d["description"] = "True: for multithreaded computation of ODE2 RHS, objects are grouped by a graph coloring computed at Assemble(), such that objects of one color do not share ODE2 coordinates and directly add their residuals into the system vector without a serial merge step; objects which cannot be colored within a limited number of colors (e.g., many connectors attached to one node) are still processed with thread-local vectors; False: all objects are processed with thread-local vectors which are merged serially";
+    structureDict["useColoringForResiduals"] = d;
+
+    d = py::dict(); //reset local dict
+    d["itemIdentifier"] = std::string(""); //identifier for item
+    d["value"] = data.useCostBalancedTasks;
+    d["type"] = "bool";
+    d["size"] = std::vector<int>{1};
+    d["description"] = "True: multithreaded computation of ODE2 RHS (of objects processed with thread-local vectors) and ODE2 jacobians of objects is split into tasks of similar computational cost, estimated with timestamps in the first and every 20th evaluation; improves load balance for models mixing cheap and expensive objects (e.g., mass points and ObjectFFRFreducedOrder); idle threads take the next remaining task; False: tasks have equal number of objects";
+    structureDict["useCostBalancedTasks"] = d;
+
+    d = py::dict(); //reset local dict
+    d["itemIdentifier"] = std::string(""); //identifier for item
+    d["value"] = data.workerSpinTime;
+    d["type"] = "Real";
+    d["size"] = std::vector<int>{1};
+    d["description"] = "time in seconds that idle worker threads spin (busy wait) for a new parallel job before they are parked (suspended) until the next job; parking reduces CPU load of workers during serial sections (e.g., factorization, Python user functions, graphics), but adds wake-up latency to the next parallel job; negative value (default): pure busy waiting with lowest latency; positive values (e.g., 1e-3) are advantageous if more threads than free cores are used";
+    structureDict["workerSpinTime"] = d;
+
     return structureDict;
 }
 
@@ -1388,8 +1440,12 @@ inline py::dict GetDictionary(const Parallel& data) {
     structureDict["multithreadedLLimitMassMatrices"] = data.PyGetMultithreadedLLimitMassMatrices();
     structureDict["multithreadedLLimitResiduals"] = data.PyGetMultithreadedLLimitResiduals();
     structureDict["numberOfThreads"] = data.PyGetNumberOfThreads();
+    structureDict["pinThreads"] = data.pinThreads;
     structureDict["taskSplitMinItems"] = data.PyGetTaskSplitMinItems();
     structureDict["taskSplitTasksPerThread"] = data.PyGetTaskSplitTasksPerThread();
+    structureDict["useColoringForResiduals"] = data.useColoringForResiduals;
+    structureDict["useCostBalancedTasks"] = data.useCostBalancedTasks;
+    structureDict["workerSpinTime"] = data.workerSpinTime;
     return structureDict;
 }
 
@@ -1400,8 +1456,12 @@ inline void SetDictionary(Parallel& data, const py::dict& d) {
     data.multithreadedLLimitMassMatrices = py::cast<Index>(d["multithreadedLLimitMassMatrices"]);
     data.multithreadedLLimitResiduals = py::cast<Index>(d["multithreadedLLimitResiduals"]);
     data.numberOfThreads = py::cast<Index>(d["numberOfThreads"]);
+    data.pinThreads = py::cast<bool>(d["pinThreads"]);
     data.taskSplitMinItems = py::cast<Index>(d["taskSplitMinItems"]);
     data.taskSplitTasksPerThread = py::cast<Index>(d["taskSplitTasksPerThread"]);
+    data.useColoringForResiduals = py::cast<bool>(d["useColoringForResiduals"]);
+    data.useCostBalancedTasks = py::cast<bool>(d["useCostBalancedTasks"]);
+    data.workerSpinTime = py::cast<Real>(d["workerSpinTime"]);
 }
 
 //! AUTO: read access to structure; converting into dictionary
@@ -1450,7 +1510,7 @@ inline py::dict GetDictionaryWithTypeInfo(const SimulationSettings& data) {
     d["value"] = data.linearSolverType;
     d["type"] = "LinearSolverType";
     d["size"] = std::vector<int>{1};
-    d["description"] = "selection of numerical linear solver: exu.LinearSolverType.EXUdense (dense matrix inverse), exu.LinearSolverType.EigenSparse (sparse matrix LU-factorization), ... (enumeration type)";
+    d["description"] = "selection of numerical linear solver: exu.LinearSolverType.EXUdense (dense LU factorization with partial pivoting), exu.LinearSolverType.EigenSparse (sparse matrix LU-factorization), ... (enumeration type)";
     structureDict["linearSolverType"] = d;
 
     d = py::dict(); //reset local dict
@@ -1590,6 +1650,14 @@ inline py::dict GetDictionaryWithTypeInfo(const VSettingsGeneral& data) {
     d["description"] = "interval of graphics update during simulation in seconds; 0.1 = 10 frames per second; low numbers might slow down computation speed";
     structureDict["graphicsUpdateInterval"] = d;
 
+    d = py::dict(); //reset local dict
+    d["itemIdentifier"] = std::string(""); //identifier for item
+    d["value"] = data.PyGetGraphicsUpdateThreads();
+    d["type"] = "PInt";
+    d["size"] = std::vector<int>{1};
+    d["description"] = "number of threads for creating the graphics data of nodes, objects, markers and sensors in every graphics update; the items are split into contiguous ranges, which are drawn in parallel into per-thread buffers and concatenated in the original order; connectors and bodies are drawn in one thread if any object has a Python user function, bodies also if bodies.cacheRigidBodyGraphics is True";
+    structureDict["graphicsUpdateThreads"] = d;
+
     d = py::dict(); //reset local dict
     d["itemIdentifier"] = std::string(""); //identifier for item
     d["value"] = data.PyGetLinuxDisplayScaleFactor();
@@ -1782,6 +1850,7 @@ inline py::dict GetDictionary(const VSettingsGeneral& data) {
     structureDict["drawCoordinateSystem"] = data.drawCoordinateSystem;
     structureDict["drawWorldBasis"] = data.drawWorldBasis;
     structureDict["graphicsUpdateInterval"] = data.graphicsUpdateInterval;
+    structureDict["graphicsUpdateThreads"] = data.PyGetGraphicsUpdateThreads();
     structureDict["linuxDisplayScaleFactor"] = data.PyGetLinuxDisplayScaleFactor();
     structureDict["minSceneSize"] = data.minSceneSize;
     structureDict["pointSize"] = data.pointSize;
@@ -1819,6 +1888,7 @@ inline void SetDictionary(VSettingsGeneral& data, const py::dict& d) {
     data.drawCoordinateSystem = py::cast<bool>(d["drawCoordinateSystem"]);
     data.drawWorldBasis = py::cast<bool>(d["drawWorldBasis"]);
     data.graphicsUpdateInterval = py::cast<float>(d["graphicsUpdateInterval"]);
+    data.graphicsUpdateThreads = py::cast<Index>(d["graphicsUpdateThreads"]);
     data.linuxDisplayScaleFactor = py::cast<float>(d["linuxDisplayScaleFactor"]);
     data.minSceneSize = py::cast<float>(d["minSceneSize"]);
     data.pointSize = py::cast<float>(d["pointSize"]);
@@ -2257,6 +2327,14 @@ inline py::dict GetDictionaryWithTypeInfo(const VSettingsBodies& data) {
     auto d = py::dict(); //local dict
     structureDict["beams"] = GetDictionaryWithTypeInfo(data.beams);
     structureDict["kinematicTree"] = GetDictionaryWithTypeInfo(data.kinematicTree);
+    d = py::dict(); //reset local dict
+    d["itemIdentifier"] = std::string(""); //identifier for item
+    d["value"] = data.cacheRigidBodyGraphics;
+    d["type"] = "bool";
+    d["size"] = std::vector<int>{1};
+    d["description"] = "if True, graphics of rigid bodies (e.g. STL meshes in graphicsData) are copied only once and afterwards only transformed with the body motion in every graphics update, which strongly reduces the update time for scenes with many triangles; changes of body graphics without changes of the system, such as with ModifyObject or SetObjectParameter, are detected; contour plots and user functions are not cached";
+    structureDict["cacheRigidBodyGraphics"] = d;
+
     d = py::dict(); //reset local dict
     d["itemIdentifier"] = std::string(""); //identifier for item
     d["value"] = data.PyGetDefaultColor();
@@ -2305,6 +2383,7 @@ inline py::dict GetDictionary(const VSettingsBodies& data) {
     auto structureDict = py::dict();
     structureDict["beams"] = GetDictionary(data.beams);
     structureDict["kinematicTree"] = GetDictionary(data.kinematicTree);
+    structureDict["cacheRigidBodyGraphics"] = data.cacheRigidBodyGraphics;
     structureDict["defaultColor"] = data.PyGetDefaultColor();
     structureDict["defaultSize"] = data.PyGetDefaultSize();
     structureDict["deformationScaleFactor"] = data.deformationScaleFactor;
@@ -2317,6 +2396,7 @@ inline py::dict GetDictionary(const VSettingsBodies& data) {
 inline void SetDictionary(VSettingsBodies& data, const py::dict& d) {
     SetDictionary(data.beams, py::cast<py::dict>(d["beams"]));
     SetDictionary(data.kinematicTree, py::cast<py::dict>(d["kinematicTree"]));
+    data.cacheRigidBodyGraphics = py::cast<bool>(d["cacheRigidBodyGraphics"]);
     data.defaultColor = py::cast<std::array<float,4>>(d["defaultColor"]);
     data.defaultSize = py::cast<std::array<float,3>>(d["defaultSize"]);
     data.deformationScaleFactor = py::cast<float>(d["deformationScaleFactor"]);
@@ -3764,6 +3844,14 @@ inline py::dict GetDictionaryWithTypeInfo(const VSettingsExportImages& data) {
     d["description"] = "timeout in milliseconds for saving a frame as image to disk; this is the amount of time waited for redrawing; increase for very complex scenes";
     structureDict["saveImageTimeOut"] = d;
 
+    d = py::dict(); //reset local dict
+    d["itemIdentifier"] = std::string(""); //identifier for item
+    d["value"] = data.useSoftwareRenderer;
+    d["type"] = "bool";
+    d["size"] = std::vector<int>{1};
+    d["description"] = "if True and no OpenGL renderer is running, images requested by RedrawAndSaveImage() or SolutionSettings.recordImagesInterval are rendered by a CPU software rasterizer in a separate thread and saved as PNG or TGA, while the simulation continues; works without window, display or graphics card, e.g., on cluster computers; image size is given by window.renderWindowSize, view by openGL.initial... settings and general.autoFitScene; texts are drawn with a simple line font, shadows and highlighting are not drawn";
+    structureDict["useSoftwareRenderer"] = d;
+
     d = py::dict(); //reset local dict
     d["itemIdentifier"] = std::string(""); //identifier for item
     d["value"] = data.PyGetWidthAlignment();
@@ -3788,6 +3876,7 @@ inline py::dict GetDictionary(const VSettingsExportImages& data) {
     structureDict["saveImageFormat"] = data.saveImageFormat;
     structureDict["saveImageSingleFile"] = data.saveImageSingleFile;
     structureDict["saveImageTimeOut"] = data.PyGetSaveImageTimeOut();
+    structureDict["useSoftwareRenderer"] = data.useSoftwareRenderer;
     structureDict["widthAlignment"] = data.PyGetWidthAlignment();
     return structureDict;
 }
@@ -3804,6 +3893,7 @@ inline void SetDictionary(VSettingsExportImages& data, const py::dict& d) {
     data.saveImageFormat = py::cast<std::string>(d["saveImageFormat"]);
     data.saveImageSingleFile = py::cast<bool>(d["saveImageSingleFile"]);
     data.saveImageTimeOut = py::cast<Index>(d["saveImageTimeOut"]);
+    data.useSoftwareRenderer = py::cast<bool>(d["useSoftwareRenderer"]);
     data.widthAlignment = py::cast<Index>(d["widthAlignment"]);
 }
 
@@ -1,6 +1,6 @@
 // AUTO:  ++++++++++++++++++++++
 // AUTO:  pybind11 module includes; generated by Johannes Gerstmayr
-// AUTO:  last modified = 2024-02-08
+// AUTO:  last modified = 2026-10-17
 // AUTO:  ++++++++++++++++++++++
 
     //++++++++++++++++++++++++++++++++
@@ -69,6 +69,7 @@
         .def_readwrite("restartFileName", &SolutionSettings::restartFileName, "filename and (relative) path of text file for storing solution after every restartWritePeriod if writeRestartFile=True; backup file is created with ending .bck, which should be used if restart file is crashed; use Python utility function InitializeFromRestartFile(...) to consistently restart")
         .def_property("restartWritePeriod", &SolutionSettings::PyGetRestartWritePeriod, &SolutionSettings::PySetRestartWritePeriod)
         .def_readwrite("sensorsAppendToFile", &SolutionSettings::sensorsAppendToFile, "flag (true/false); if true, sensor output is appended to existing file (otherwise created) or in case of internal storage, it is appended to existing currently stored data; this allows storing sensor values over different simulations")
+        .def_readwrite("sensorsBinaryFiles", &SolutionSettings::sensorsBinaryFiles, "if true, sensor files are written in binary format with fixed-width rows (time and sensor values), which can be loaded in Python with LoadBinarySensorFile(...) as numpy memmap; data is buffered and written to disc by a background thread, such that the solver does not wait for file output; setting outputPrecision >= 8 uses double (8 bytes), otherwise float (4 bytes) is used; sensorsAppendToFile and sensorsWriteFileFooter are ineffective for binary sensor files and files are always replaced")
         .def_readwrite("sensorsStoreAndWriteFiles", &SolutionSettings::sensorsStoreAndWriteFiles, "flag (true/false); if false, no sensor files will be created and no sensor data will be stored; this may be advantageous for benchmarking as well as for special solvers which should not overwrite existing results (e.g. ComputeODE2Eigenvalues); settings this value to False may cause problems if sensors are required to perform operations which are needed e.g. in UserSensors as input of loads, etc.")
         .def_readwrite("sensorsWriteFileFooter", &SolutionSettings::sensorsWriteFileFooter, "flag (true/false); if true, file footer is written for sensor output (turn off, e.g. for multiple runs of time integration)")
         .def_readwrite("sensorsWriteFileHeader", &SolutionSettings::sensorsWriteFileHeader, "flag (true/false); if true, file header is written for sensor output (turn off, e.g. for multiple runs of time integration)")
@@ -329,6 +330,7 @@
         .def_readwrite("ignoreSingularJacobian", &LinearSolverSettings::ignoreSingularJacobian, "[ONLY implemented for dense, Eigen matrix mode] False: standard way, fails if jacobian is singular; True: use Eigen's FullPivLU (thus only works with LinearSolverType.EigenDense) which handles over- and underdetermined systems; can often resolve redundant constraints, but MAY ALSO LEAD TO ERRONEOUS RESULTS!")
         .def_property("pivotThreshold", &LinearSolverSettings::PyGetPivotThreshold, &LinearSolverSettings::PySetPivotThreshold)
         .def_readwrite("reuseAnalyzedPattern", &LinearSolverSettings::reuseAnalyzedPattern, "[ONLY available for sparse matrices] True: the Eigen SparseLU solver offers the possibility to reuse an analyzed pattern of a previous factorization; this may reduce total factorization time by a factor of 2 or 3, depending on the matrix type; however, if the matrix patterns heavily change between computations, this may even slow down performance; this flag is set for SparseMatrices in InitializeSolverData(...) and should be handled with care!")
+        .def_readwrite("reuseSparsityPattern", &LinearSolverSettings::reuseSparsityPattern, "[ONLY available for sparse matrices] True: the sparsity pattern of the first built sparse matrix is stored together with a map from triplets to matrix entries; in subsequent computations, matrix values are directly added into the stored compressed matrix, avoiding the sorting of triplets; the matrix is automatically rebuilt, if the pattern changes (e.g., due to contact); in combination with reuseAnalyzedPattern, also the pattern analysis of the Eigen SparseLU solver is skipped as long as the pattern does not change")
         .def_readwrite("showCausingItems", &LinearSolverSettings::showCausingItems, "False: no output, if solver fails; True: if redundant equations appear, they are resolved such that according solution variables are set to zero; in case of redundant constraints, this may help, but it may lead to erroneous behaviour; for static problems, this may suppress static motion or resolve problems in case of instabilities, but should in general be considered with care!")
         // AUTO: access functions for LinearSolverSettings
         .def("__repr__", [](const LinearSolverSettings &item) { return "<LinearSolverSettings:\n" + EXUstd::ToString(item) + " >"; } ) //!< AUTO: add representation for object based on ostream operator
@@ -355,8 +357,12 @@
         .def_property("multithreadedLLimitMassMatrices", &Parallel::PyGetMultithreadedLLimitMassMatrices, &Parallel::PySetMultithreadedLLimitMassMatrices)
         .def_property("multithreadedLLimitResiduals", &Parallel::PyGetMultithreadedLLimitResiduals, &Parallel::PySetMultithreadedLLimitResiduals)
         .def_property("numberOfThreads", &Parallel::PyGetNumberOfThreads, &Parallel::PySetNumberOfThreads)
+        .def_readwrite("pinThreads", &Parallel::pinThreads, "True: worker thread i is pinned to CPU core i (Linux and Windows, ignored on MacOS), which avoids migration of threads between cores and may improve cache usage; main thread is not pinned")
         .def_property("taskSplitMinItems", &Parallel::PyGetTaskSplitMinItems, &Parallel::PySetTaskSplitMinItems)
         .def_property("taskSplitTasksPerThread", &Parallel::PyGetTaskSplitTasksPerThread, &Parallel::PySetTaskSplitTasksPerThread)
+        .def_readwrite("useColoringForResiduals", &Parallel::useColoringForResiduals, "True: for multithreaded computation of ODE2 RHS, objects are grouped by a graph coloring computed at Assemble(), such that objects of one color do not share ODE2 coordinates and directly add their residuals into the system vector without a serial merge step; objects which cannot be colored within a limited number of colors (e.g., many connectors attached to one node) are still processed with thread-local vectors; False: all objects are processed with thread-local vectors which are merged serially")
+        .def_readwrite("useCostBalancedTasks", &Parallel::useCostBalancedTasks, "True: multithreaded computation of ODE2 RHS (of objects processed with thread-local vectors) and ODE2 jacobians of objects is split into tasks of similar computational cost, estimated with timestamps in the first and every 20th evaluation; improves load balance for models mixing cheap and expensive objects (e.g., mass points and ObjectFFRFreducedOrder); idle threads take the next remaining task; False: tasks have equal number of objects")
+        .def_readwrite("workerSpinTime", &Parallel::workerSpinTime, "time in seconds that idle worker threads spin (busy wait) for a new parallel job before they are parked (suspended) until the next job; parking reduces CPU load of workers during serial sections (e.g., factorization, Python user functions, graphics), but adds wake-up latency to the next parallel job; negative value (default): pure busy waiting with lowest latency; positive values (e.g., 1e-3) are advantageous if more threads than free cores are used")
         // AUTO: access functions for Parallel
         .def("__repr__", [](const Parallel &item) { return "<Parallel:\n" + EXUstd::ToString(item) + " >"; } ) //!< AUTO: add representation for object based on ostream operator
         .def("GetDictionary", [](const Parallel &item) { return EPyUtils::GetDictionary(item); }) //!< AUTO: add read for dictionary access
@@ -386,7 +392,7 @@
         .def_readwrite("displayComputationTime", &SimulationSettings::displayComputationTime, "display computation time statistics at end of solving")
         .def_readwrite("displayGlobalTimers", &SimulationSettings::displayGlobalTimers, "display global timer statistics at end of solving (e.g., for contact, but also for internal timings during development)")
         .def_readwrite("displayStatistics", &SimulationSettings::displayStatistics, "display general computation information at end of time step (steps, iterations, function calls, step rejections, ...")
-        .def_readwrite("linearSolverType", &SimulationSettings::linearSolverType, "selection of numerical linear solver: exu.LinearSolverType.EXUdense (dense matrix inverse), exu.LinearSolverType.EigenSparse (sparse matrix LU-factorization), ... (enumeration type)")
+        .def_readwrite("linearSolverType", &SimulationSettings::linearSolverType, "selection of numerical linear solver: exu.LinearSolverType.EXUdense (dense LU factorization with partial pivoting), exu.LinearSolverType.EigenSparse (sparse matrix LU-factorization), ... (enumeration type)")
         .def_property("outputPrecision", &SimulationSettings::PyGetOutputPrecision, &SimulationSettings::PySetOutputPrecision)
         .def_readwrite("pauseAfterEachStep", &SimulationSettings::pauseAfterEachStep, "pause after every time step or static load step(user press SPACE)")
         // AUTO: access functions for SimulationSettings
@@ -420,6 +426,7 @@
         .def_readwrite("drawCoordinateSystem", &VSettingsGeneral::drawCoordinateSystem, "false = no coordinate system shown")
         .def_readwrite("drawWorldBasis", &VSettingsGeneral::drawWorldBasis, "true = draw world basis coordinate system at (0,0,0)")
         .def_readwrite("graphicsUpdateInterval", &VSettingsGeneral::graphicsUpdateInterval, "interval of graphics update during simulation in seconds; 0.1 = 10 frames per second; low numbers might slow down computation speed")
+        .def_property("graphicsUpdateThreads", &VSettingsGeneral::PyGetGraphicsUpdateThreads, &VSettingsGeneral::PySetGraphicsUpdateThreads)
         .def_property("linuxDisplayScaleFactor", &VSettingsGeneral::PyGetLinuxDisplayScaleFactor, &VSettingsGeneral::PySetLinuxDisplayScaleFactor)
         .def_readwrite("minSceneSize", &VSettingsGeneral::minSceneSize, "minimum scene size for initial scene size and for autoFitScene, to avoid division by zero; SET GREATER THAN ZERO")
         .def_readwrite("pointSize", &VSettingsGeneral::pointSize, "global point size (absolute)")
@@ -578,6 +585,7 @@
         .def(py::init<>())
         .def_readwrite("beams", &VSettingsBodies::beams, "visualization settings for beams (e.g. ANCFCable or other beam elements)")
         .def_readwrite("kinematicTree", &VSettingsBodies::kinematicTree, "visualization settings for kinematic tree")
+        .def_readwrite("cacheRigidBodyGraphics", &VSettingsBodies::cacheRigidBodyGraphics, "if True, graphics of rigid bodies (e.g. STL meshes in graphicsData) are copied only once and afterwards only transformed with the body motion in every graphics update, which strongly reduces the update time for scenes with many triangles; changes of body graphics without changes of the system, such as with ModifyObject or SetObjectParameter, are detected; contour plots and user functions are not cached")
         .def_property("defaultColor", &VSettingsBodies::PyGetDefaultColor, &VSettingsBodies::PySetDefaultColor)
         .def_property("defaultSize", &VSettingsBodies::PyGetDefaultSize, &VSettingsBodies::PySetDefaultSize)
         .def_readwrite("deformationScaleFactor", &VSettingsBodies::deformationScaleFactor, "global deformation scale factor; also applies to nodes, if drawn; used for scaled drawing of (linear) finite elements, beams, etc.")
@@ -916,6 +924,7 @@
         .def_readwrite("saveImageFormat", &VSettingsExportImages::saveImageFormat, "format for exporting figures: currently only PNG, TGA and TXT available; while PNG and TGA represent the according image file formats, the TXT format results in a text file containing the 3D graphics data information as lists of lines, triangles, etc; PNG is not available for Ubuntu18.04 (check  use TGA has highest compatibility with all platforms")
         .def_readwrite("saveImageSingleFile", &VSettingsExportImages::saveImageSingleFile, "True: only save single files with given filename, not adding numbering; False: add numbering to files, see saveImageFileName")
         .def_property("saveImageTimeOut", &VSettingsExportImages::PyGetSaveImageTimeOut, &VSettingsExportImages::PySetSaveImageTimeOut)
+        .def_readwrite("useSoftwareRenderer", &VSettingsExportImages::useSoftwareRenderer, "if True and no OpenGL renderer is running, images requested by RedrawAndSaveImage() or SolutionSettings.recordImagesInterval are rendered by a CPU software rasterizer in a separate thread and saved as PNG or TGA, while the simulation continues; works without window, display or graphics card, e.g., on cluster computers; image size is given by window.renderWindowSize, view by openGL.initial... settings and general.autoFitScene; texts are drawn with a simple line font, shadows and highlighting are not drawn")
         .def_property("widthAlignment", &VSettingsExportImages::PyGetWidthAlignment, &VSettingsExportImages::PySetWidthAlignment)
         // AUTO: access functions for VSettingsExportImages
         .def("__repr__", [](const VSettingsExportImages &item) { return "<VSettingsExportImages:\n" + EXUstd::ToString(item) + " >"; } ) //!< AUTO: add representation for object based on ostream operator
@@ -1166,6 +1175,7 @@
         .def_readwrite("lastVerboseStepIndex", &SolverOutputData::lastVerboseStepIndex, "step index when last time written to console (or file)")
         .def_readwrite("multiThreadingMode", &SolverOutputData::multiThreadingMode, "multithreading mode that has been used: 0=None (serial), 1=NGsolve taskmanager, 2=MicroThreading (Exudyn)")
         .def_readwrite("numberOfThreadsUsed", &SolverOutputData::numberOfThreadsUsed, "number of threads that have been used in simulation")
+        .def_readwrite("releasedGIL", &SolverOutputData::releasedGIL, "true, if Python GIL has been released during SolveSteps(...), such that other Python threads can run in parallel; GIL is only released for numberOfThreads=1 without renderer and without Python user functions")
         .def_readwrite("stepInformation", &SolverOutputData::stepInformation, "this is a copy of the solvers stepInformation used for console output")
         .def_readwrite("verboseMode", &SolverOutputData::verboseMode, "this is a copy of the solvers verboseMode used for console output")
         .def_readwrite("verboseModeFile", &SolverOutputData::verboseModeFile, "this is a copy of the solvers verboseModeFile used for file")
@@ -4,7 +4,7 @@
 *
 * @author       AUTO: Gerstmayr Johannes
 * @date         AUTO: 2019-07-01 (generated)
-* @date         AUTO: 2024-02-08 (last modfied)
+* @date         AUTO: 2026-10-17 (last modfied)
 *
 * @copyright    This file is part of Exudyn. Exudyn is free software: you can redistribute it and/or modify it under the terms of the Exudyn license. See "LICENSE.txt" for more details.
 * @note         Bug reports, support and further information:
@@ -41,6 +41,7 @@ public: // AUTO:
   std::string restartFileName;                    //!< AUTO: filename and (relative) path of text file for storing solution after every restartWritePeriod if writeRestartFile=True; backup file is created with ending .bck, which should be used if restart file is crashed; use Python utility function InitializeFromRestartFile(...) to consistently restart
   Real restartWritePeriod;                        //!< AUTO: time span (period), determines how often the restart file is updated; this should be often enough to enable restart without too much loss of data; too low values may influence performance
   bool sensorsAppendToFile;                       //!< AUTO: flag (true/false); if true, sensor output is appended to existing file (otherwise created) or in case of internal storage, it is appended to existing currently stored data; this allows storing sensor values over different simulations
+  bool sensorsBinaryFiles;                        //!< AUTO: if true, sensor files are written in binary format with fixed-width rows (time and sensor values), which can be loaded in Python with LoadBinarySensorFile(...) as numpy memmap; data is buffered and written to disc by a background thread, such that the solver does not wait for file output; setting outputPrecision >= 8 uses double (8 bytes), otherwise float (4 bytes) is used; sensorsAppendToFile and sensorsWriteFileFooter are ineffective for binary sensor files and files are always replaced
   bool sensorsStoreAndWriteFiles;                 //!< AUTO: flag (true/false); if false, no sensor files will be created and no sensor data will be stored; this may be advantageous for benchmarking as well as for special solvers which should not overwrite existing results (e.g. ComputeODE2Eigenvalues); settings this value to False may cause problems if sensors are required to perform operations which are needed e.g. in UserSensors as input of loads, etc.
   bool sensorsWriteFileFooter;                    //!< AUTO: flag (true/false); if true, file footer is written for sensor output (turn off, e.g. for multiple runs of time integration)
   bool sensorsWriteFileHeader;                    //!< AUTO: flag (true/false); if true, file header is written for sensor output (turn off, e.g. for multiple runs of time integration)
@@ -74,6 +75,7 @@ public: // AUTO:
     restartFileName = "restartFile.txt";
     restartWritePeriod = 0.01;
     sensorsAppendToFile = false;
+    sensorsBinaryFiles = false;
     sensorsStoreAndWriteFiles = true;
     sensorsWriteFileFooter = false;
     sensorsWriteFileHeader = true;
@@ -132,6 +134,7 @@ public: // AUTO:
     os << "  restartFileName = " << restartFileName << "\n";
     os << "  restartWritePeriod = " << restartWritePeriod << "\n";
     os << "  sensorsAppendToFile = " << sensorsAppendToFile << "\n";
+    os << "  sensorsBinaryFiles = " << sensorsBinaryFiles << "\n";
     os << "  sensorsStoreAndWriteFiles = " << sensorsStoreAndWriteFiles << "\n";
     os << "  sensorsWriteFileFooter = " << sensorsWriteFileFooter << "\n";
     os << "  sensorsWriteFileHeader = " << sensorsWriteFileHeader << "\n";
@@ -162,7 +165,7 @@ public: // AUTO:
 *
 * @author       AUTO: Gerstmayr Johannes
 * @date         AUTO: 2019-07-01 (generated)
-* @date         AUTO: 2024-02-08 (last modfied)
+* @date         AUTO: 2026-10-17 (last modfied)
 *
 * @copyright    This file is part of Exudyn. Exudyn is free software: you can redistribute it and/or modify it under the terms of the Exudyn license. See "LICENSE.txt" for more details.
 * @note         Bug reports, support and further information:
@@ -245,7 +248,7 @@ public: // AUTO:
 *
 * @author       AUTO: Gerstmayr Johannes
 * @date         AUTO: 2019-07-01 (generated)
-* @date         AUTO: 2024-02-08 (last modfied)
+* @date         AUTO: 2026-10-17 (last modfied)
 *
 * @copyright    This file is part of Exudyn. Exudyn is free software: you can redistribute it and/or modify it under the terms of the Exudyn license. See "LICENSE.txt" for more details.
 * @note         Bug reports, support and further information:
@@ -313,7 +316,7 @@ public: // AUTO:
 *
 * @author       AUTO: Gerstmayr Johannes
 * @date         AUTO: 2019-07-01 (generated)
-* @date         AUTO: 2024-02-08 (last modfied)
+* @date         AUTO: 2026-10-17 (last modfied)
 *
 * @copyright    This file is part of Exudyn. Exudyn is free software: you can redistribute it and/or modify it under the terms of the Exudyn license. See "LICENSE.txt" for more details.
 * @note         Bug reports, support and further information:
@@ -443,7 +446,7 @@ public: // AUTO:
 *
 * @author       AUTO: Gerstmayr Johannes
 * @date         AUTO: 2019-07-01 (generated)
-* @date         AUTO: 2024-02-08 (last modfied)
+* @date         AUTO: 2026-10-17 (last modfied)
 *
 * @copyright    This file is part of Exudyn. Exudyn is free software: you can redistribute it and/or modify it under the terms of the Exudyn license. See "LICENSE.txt" for more details.
 * @note         Bug reports, support and further information:
@@ -531,7 +534,7 @@ public: // AUTO:
 *
 * @author       AUTO: Gerstmayr Johannes
 * @date         AUTO: 2019-07-01 (generated)
-* @date         AUTO: 2024-02-08 (last modfied)
+* @date         AUTO: 2026-10-17 (last modfied)
 *
 * @copyright    This file is part of Exudyn. Exudyn is free software: you can redistribute it and/or modify it under the terms of the Exudyn license. See "LICENSE.txt" for more details.
 * @note         Bug reports, support and further information:
@@ -595,7 +598,7 @@ public: // AUTO:
 *
 * @author       AUTO: Gerstmayr Johannes
 * @date         AUTO: 2019-07-01 (generated)
-* @date         AUTO: 2024-02-08 (last modfied)
+* @date         AUTO: 2026-10-17 (last modfied)
 *
 * @copyright    This file is part of Exudyn. Exudyn is free software: you can redistribute it and/or modify it under the terms of the Exudyn license. See "LICENSE.txt" for more details.
 * @note         Bug reports, support and further information:
@@ -816,7 +819,7 @@ public: // AUTO:
 *
 * @author       AUTO: Gerstmayr Johannes
 * @date         AUTO: 2019-07-01 (generated)
-* @date         AUTO: 2024-02-08 (last modfied)
+* @date         AUTO: 2026-10-17 (last modfied)
 *
 * @copyright    This file is part of Exudyn. Exudyn is free software: you can redistribute it and/or modify it under the terms of the Exudyn license. See "LICENSE.txt" for more details.
 * @note         Bug reports, support and further information:
@@ -988,7 +991,7 @@ public: // AUTO:
 *
 * @author       AUTO: Gerstmayr Johannes
 * @date         AUTO: 2019-07-01 (generated)
-* @date         AUTO: 2024-02-08 (last modfied)
+* @date         AUTO: 2026-10-17 (last modfied)
 *
 * @copyright    This file is part of Exudyn. Exudyn is free software: you can redistribute it and/or modify it under the terms of the Exudyn license. See "LICENSE.txt" for more details.
 * @note         Bug reports, support and further information:
@@ -1009,6 +1012,7 @@ public: // AUTO:
   bool ignoreSingularJacobian;                    //!< AUTO: [ONLY implemented for dense, Eigen matrix mode] False: standard way, fails if jacobian is singular; True: use Eigen's FullPivLU (thus only works with LinearSolverType.EigenDense) which handles over- and underdetermined systems; can often resolve redundant constraints, but MAY ALSO LEAD TO ERRONEOUS RESULTS!
   Real pivotThreshold;                            //!< AUTO: [ONLY available for EXUdense and EigenDense (FullPivot) solver] threshold for dense linear solver, can be used to detect close to singular solutions, setting this to, e.g., 1e-12; solver then reports on equations that are causing close to singularity
   bool reuseAnalyzedPattern;                      //!< AUTO: [ONLY available for sparse matrices] True: the Eigen SparseLU solver offers the possibility to reuse an analyzed pattern of a previous factorization; this may reduce total factorization time by a factor of 2 or 3, depending on the matrix type; however, if the matrix patterns heavily change between computations, this may even slow down performance; this flag is set for SparseMatrices in InitializeSolverData(...) and should be handled with care!
+  bool reuseSparsityPattern;                      //!< AUTO: [ONLY available for sparse matrices] True: the sparsity pattern of the first built sparse matrix is stored together with a map from triplets to matrix entries; in subsequent computations, matrix values are directly added into the stored compressed matrix, avoiding the sorting of triplets; the matrix is automatically rebuilt, if the pattern changes (e.g., due to contact); in combination with reuseAnalyzedPattern, also the pattern analysis of the Eigen SparseLU solver is skipped as long as the pattern does not change
   bool showCausingItems;                          //!< AUTO: False: no output, if solver fails; True: if redundant equations appear, they are resolved such that according solution variables are set to zero; in case of redundant constraints, this may help, but it may lead to erroneous behaviour; for static problems, this may suppress static motion or resolve problems in case of instabilities, but should in general be considered with care!
 
 
@@ -1019,6 +1023,7 @@ public: // AUTO:
     ignoreSingularJacobian = false;
     pivotThreshold = 0;
     reuseAnalyzedPattern = false;
+    reuseSparsityPattern = false;
     showCausingItems = true;
   };
 
@@ -1035,6 +1040,7 @@ public: // AUTO:
     os << "  ignoreSingularJacobian = " << ignoreSingularJacobian << "\n";
     os << "  pivotThreshold = " << pivotThreshold << "\n";
     os << "  reuseAnalyzedPattern = " << reuseAnalyzedPattern << "\n";
+    os << "  reuseSparsityPattern = " << reuseSparsityPattern << "\n";
     os << "  showCausingItems = " << showCausingItems << "\n";
     os << "\n";
   }
@@ -1054,7 +1060,7 @@ public: // AUTO:
 *
 * @author       AUTO: Gerstmayr Johannes
 * @date         AUTO: 2019-07-01 (generated)
-* @date         AUTO: 2024-02-08 (last modfied)
+* @date         AUTO: 2026-10-17 (last modfied)
 *
 * @copyright    This file is part of Exudyn. Exudyn is free software: you can redistribute it and/or modify it under the terms of the Exudyn license. See "LICENSE.txt" for more details.
 * @note         Bug reports, support and further information:
@@ -1077,8 +1083,12 @@ public: // AUTO:
   Index multithreadedLLimitMassMatrices;          //!< AUTO: compute bodies mass matrices multi-threaded; this is the limit number of bodies from which on parallelization is used; flag is copied into MainSystem internal flag at InitializeSolverData(...)
   Index multithreadedLLimitResiduals;             //!< AUTO: compute RHS vectors, AE, and reaction forces multi-threaded; this is the limit number of objects from which on parallelization is used; flag is copied into MainSystem internal flag at InitializeSolverData(...)
   Index numberOfThreads;                          //!< AUTO: number of threads used for parallel computation (1 == scalar processing); do not use more threads than available threads (in most cases it is good to restrict to the number of cores); currently, only one solver can be started with multithreading; if you use several mbs in parallel (co-simulation), you should use serial computing
+  bool pinThreads;                                //!< AUTO: True: worker thread i is pinned to CPU core i (Linux and Windows, ignored on MacOS), which avoids migration of threads between cores and may improve cache usage; main thread is not pinned
   Index taskSplitMinItems;                        //!< AUTO: number of items from which on the tasks are split into subtasks (which slightly increases threading performance; this may be critical for smaller number of objects, should be roughly between 50 and 5000; flag is copied into MainSystem internal flag at InitializeSolverData(...)
   Index taskSplitTasksPerThread;                  //!< AUTO: this is the number of subtasks that every thread receives; minimum is 1, the maximum should not be larger than 100; this factor is 1 as long as the taskSplitMinItems is not reached; flag is copied into MainSystem internal flag at InitializeSolverData(...)
+  bool useColoringForResiduals;                   //!< AUTO: True: for multithreaded computation of ODE2 RHS, objects are grouped by a graph coloring computed at Assemble(), such that objects of one color do not share ODE2 coordinates and directly add their residuals into the system vector without a serial merge step; objects which cannot be colored within a limited number of colors (e.g., many connectors attached to one node) are still processed with thread-local vectors; False: all objects are processed with thread-local vectors which are merged serially
+  bool useCostBalancedTasks;                      //!< AUTO: True: multithreaded computation of ODE2 RHS (of objects processed with thread-local vectors) and ODE2 jacobians of objects is split into tasks of similar computational cost, estimated with timestamps in the first and every 20th evaluation; improves load balance for models mixing cheap and expensive objects (e.g., mass points and ObjectFFRFreducedOrder); idle threads take the next remaining task; False: tasks have equal number of objects
+  Real workerSpinTime;                            //!< AUTO: time in seconds that idle worker threads spin (busy wait) for a new parallel job before they are parked (suspended) until the next job; parking reduces CPU load of workers during serial sections (e.g., factorization, Python user functions, graphics), but adds wake-up latency to the next parallel job; negative value (default): pure busy waiting with lowest latency; positive values (e.g., 1e-3) are advantageous if more threads than free cores are used
 
 
 public: // AUTO: 
@@ -1090,8 +1100,12 @@ public: // AUTO:
     multithreadedLLimitMassMatrices = 20;
     multithreadedLLimitResiduals = 20;
     numberOfThreads = 1;
+    pinThreads = false;
     taskSplitMinItems = 50;
     taskSplitTasksPerThread = 16;
+    useColoringForResiduals = false;
+    useCostBalancedTasks = false;
+    workerSpinTime = -1;
   };
 
   // AUTO: access functions
@@ -1139,8 +1153,12 @@ public: // AUTO:
     os << "  multithreadedLLimitMassMatrices = " << multithreadedLLimitMassMatrices << "\n";
     os << "  multithreadedLLimitResiduals = " << multithreadedLLimitResiduals << "\n";
     os << "  numberOfThreads = " << numberOfThreads << "\n";
+    os << "  pinThreads = " << pinThreads << "\n";
     os << "  taskSplitMinItems = " << taskSplitMinItems << "\n";
     os << "  taskSplitTasksPerThread = " << taskSplitTasksPerThread << "\n";
+    os << "  useColoringForResiduals = " << useColoringForResiduals << "\n";
+    os << "  useCostBalancedTasks = " << useCostBalancedTasks << "\n";
+    os << "  workerSpinTime = " << workerSpinTime << "\n";
     os << "\n";
   }
 
@@ -1159,7 +1177,7 @@ public: // AUTO:
 *
 * @author       AUTO: Gerstmayr Johannes
 * @date         AUTO: 2019-07-01 (generated)
-* @date         AUTO: 2024-02-08 (last modfied)
+* @date         AUTO: 2026-10-17 (last modfied)
 *
 * @copyright    This file is part of Exudyn. Exudyn is free software: you can redistribute it and/or modify it under the terms of the Exudyn license. See "LICENSE.txt" for more details.
 * @note         Bug reports, support and further information:
@@ -1186,7 +1204,7 @@ public: // AUTO:
   bool displayComputationTime;                    //!< AUTO: display computation time statistics at end of solving
   bool displayGlobalTimers;                       //!< AUTO: display global timer statistics at end of solving (e.g., for contact, but also for internal timings during development)
   bool displayStatistics;                         //!< AUTO: display general computation information at end of time step (steps, iterations, function calls, step rejections, ...
-  LinearSolverType linearSolverType;              //!< AUTO: selection of numerical linear solver: exu.LinearSolverType.EXUdense (dense matrix inverse), exu.LinearSolverType.EigenSparse (sparse matrix LU-factorization), ... (enumeration type)
+  LinearSolverType linearSolverType;              //!< AUTO: selection of numerical linear solver: exu.LinearSolverType.EXUdense (dense LU factorization with partial pivoting), exu.LinearSolverType.EigenSparse (sparse matrix LU-factorization), ... (enumeration type)
   Index outputPrecision;                          //!< AUTO: precision for floating point numbers written to console; e.g. values written by solver
   bool pauseAfterEachStep;                        //!< AUTO: pause after every time step or static load step(user press SPACE)
 
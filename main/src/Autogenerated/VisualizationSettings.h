@@ -36,6 +36,7 @@ public: // AUTO:
   bool drawCoordinateSystem;                      //!< AUTO: false = no coordinate system shown
   bool drawWorldBasis;                            //!< AUTO: true = draw world basis coordinate system at (0,0,0)
   float graphicsUpdateInterval;                   //!< AUTO: interval of graphics update during simulation in seconds; 0.1 = 10 frames per second; low numbers might slow down computation speed
+  Index graphicsUpdateThreads;                    //!< AUTO: number of threads for creating the graphics data of nodes, objects, markers and sensors in every graphics update; the items are split into contiguous ranges, which are drawn in parallel into per-thread buffers and concatenated in the original order; connectors and bodies are drawn in one thread if any object has a Python user function, bodies also if bodies.cacheRigidBodyGraphics is True
   float linuxDisplayScaleFactor;                  //!< AUTO: Scaling factor for linux, which cannot determined from system by now; adjust this value to scale dialog fonts and renderer fonts
   float minSceneSize;                             //!< AUTO: minimum scene size for initial scene size and for autoFitScene, to avoid division by zero; SET GREATER THAN ZERO
   float pointSize;                                //!< AUTO: global point size (absolute)
@@ -74,6 +75,7 @@ public: // AUTO:
     drawCoordinateSystem = true;
     drawWorldBasis = false;
     graphicsUpdateInterval = 0.1f;
+    graphicsUpdateThreads = 1;
     linuxDisplayScaleFactor = 1.;
     minSceneSize = 0.1f;
     pointSize = 0.01f;
@@ -123,6 +125,11 @@ public: // AUTO:
   //! AUTO: Read (Copy) access to: global number of segments for cylinders; if smaller than 2, 2 segments are used (flat)
   Index PyGetCylinderTiling() const { return Index(cylinderTiling); }
 
+  //! AUTO: Set function (needed in pybind) for: number of threads for creating the graphics data of nodes, objects, markers and sensors in every graphics update; the items are split into contiguous ranges, which are drawn in parallel into per-thread buffers and concatenated in the original order; connectors and bodies are drawn in one thread if any object has a Python user function, bodies also if bodies.cacheRigidBodyGraphics is True
+  void PySetGraphicsUpdateThreads(const Index& graphicsUpdateThreadsInit) { graphicsUpdateThreads = EXUstd::GetSafelyPInt(graphicsUpdateThreadsInit,"graphicsUpdateThreads"); }
+  //! AUTO: Read (Copy) access to: number of threads for creating the graphics data of nodes, objects, markers and sensors in every graphics update; the items are split into contiguous ranges, which are drawn in parallel into per-thread buffers and concatenated in the original order; connectors and bodies are drawn in one thread if any object has a Python user function, bodies also if bodies.cacheRigidBodyGraphics is True
+  Index PyGetGraphicsUpdateThreads() const { return Index(graphicsUpdateThreads); }
+
   //! AUTO: Set function (needed in pybind) for: Scaling factor for linux, which cannot determined from system by now; adjust this value to scale dialog fonts and renderer fonts
   void PySetLinuxDisplayScaleFactor(const float& linuxDisplayScaleFactorInit) { linuxDisplayScaleFactor = EXUstd::GetSafelyPFloat(linuxDisplayScaleFactorInit,"linuxDisplayScaleFactor"); }
   //! AUTO: Read (Copy) access to: Scaling factor for linux, which cannot determined from system by now; adjust this value to scale dialog fonts and renderer fonts
@@ -167,6 +174,7 @@ public: // AUTO:
     os << "  drawCoordinateSystem = " << drawCoordinateSystem << "\n";
     os << "  drawWorldBasis = " << drawWorldBasis << "\n";
     os << "  graphicsUpdateInterval = " << graphicsUpdateInterval << "\n";
+    os << "  graphicsUpdateThreads = " << graphicsUpdateThreads << "\n";
     os << "  linuxDisplayScaleFactor = " << linuxDisplayScaleFactor << "\n";
     os << "  minSceneSize = " << minSceneSize << "\n";
     os << "  pointSize = " << pointSize << "\n";
@@ -565,6 +573,7 @@ class VSettingsBodies // AUTO:
 public: // AUTO: 
   VSettingsBeams beams;                           //!< AUTO: visualization settings for beams (e.g. ANCFCable or other beam elements)
   VSettingsKinematicTree kinematicTree;           //!< AUTO: visualization settings for kinematic tree
+  bool cacheRigidBodyGraphics;                    //!< AUTO: if True, graphics of rigid bodies (e.g. STL meshes in graphicsData) are copied only once and afterwards only transformed with the body motion in every graphics update, which strongly reduces the update time for scenes with many triangles; changes of body graphics without changes of the system, such as with ModifyObject or SetObjectParameter, are detected; contour plots and user functions are not cached
   Float4 defaultColor;                            //!< AUTO: default RGBA color for bodies; 4th value is 
   Float3 defaultSize;                             //!< AUTO: global body size of xyz-cube
   float deformationScaleFactor;                   //!< AUTO: global deformation scale factor; also applies to nodes, if drawn; used for scaled drawing of (linear) finite elements, beams, etc.
@@ -576,6 +585,7 @@ public: // AUTO:
   //! AUTO: default constructor with parameter initialization
   VSettingsBodies()
   {
+    cacheRigidBodyGraphics = false;
     defaultColor = Float4({0.3f,0.3f,1.f,1.f});
     defaultSize = Float3({1.f,1.f,1.f});
     deformationScaleFactor = 1;
@@ -600,6 +610,7 @@ public: // AUTO:
     os << "VSettingsBodies" << ":\n";
     os << "  beams = " << beams << "\n";
     os << "  kinematicTree = " << kinematicTree << "\n";
+    os << "  cacheRigidBodyGraphics = " << cacheRigidBodyGraphics << "\n";
     os << "  defaultColor = " << defaultColor << "\n";
     os << "  defaultSize = " << defaultSize << "\n";
     os << "  deformationScaleFactor = " << deformationScaleFactor << "\n";
@@ -1658,6 +1669,7 @@ public: // AUTO:
   std::string saveImageFormat;                    //!< AUTO: format for exporting figures: currently only PNG, TGA and TXT available; while PNG and TGA represent the according image file formats, the TXT format results in a text file containing the 3D graphics data information as lists of lines, triangles, etc; PNG is not available for Ubuntu18.04 (check  use TGA has highest compatibility with all platforms
   bool saveImageSingleFile;                       //!< AUTO: True: only save single files with given filename, not adding numbering; False: add numbering to files, see saveImageFileName
   Index saveImageTimeOut;                         //!< AUTO: timeout in milliseconds for saving a frame as image to disk; this is the amount of time waited for redrawing; increase for very complex scenes
+  bool useSoftwareRenderer;                       //!< AUTO: if True and no OpenGL renderer is running, images requested by RedrawAndSaveImage() or SolutionSettings.recordImagesInterval are rendered by a CPU software rasterizer in a separate thread and saved as PNG or TGA, while the simulation continues; works without window, display or graphics card, e.g., on cluster computers; image size is given by window.renderWindowSize, view by openGL.initial... settings and general.autoFitScene; texts are drawn with a simple line font, shadows and highlighting are not drawn
   Index widthAlignment;                           //!< AUTO: alignment of exported image width; using a value of 4 helps to reduce problems with video conversion (additional vertical lines are lost)
 
 
@@ -1675,6 +1687,7 @@ public: // AUTO:
     saveImageFormat = "PNG";
     saveImageSingleFile = false;
     saveImageTimeOut = 5000;
+    useSoftwareRenderer = false;
     widthAlignment = 4;
   };
 
@@ -1713,6 +1726,7 @@ public: // AUTO:
     os << "  saveImageFormat = " << saveImageFormat << "\n";
     os << "  saveImageSingleFile = " << saveImageSingleFile << "\n";
     os << "  saveImageTimeOut = " << saveImageTimeOut << "\n";
+    os << "  useSoftwareRenderer = " << useSoftwareRenderer << "\n";
     os << "  widthAlignment = " << widthAlignment << "\n";
     os << "\n";
   }
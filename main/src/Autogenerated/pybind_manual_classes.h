@@ -1,6 +1,6 @@
 // AUTO:  ++++++++++++++++++++++
 // AUTO:  pybind11 manual module includes; generated by Johannes Gerstmayr
-// AUTO:  last modified = 2024-03-06
+// AUTO:  last modified = 2026-10-17
 // AUTO:  ++++++++++++++++++++++
 
 //        pybinding to enum classes:
@@ -190,6 +190,11 @@
         .def("GetAvailableFactoryItems", &MainSystem::GetAvailableFactoryItems, "get all available items to be added (nodes, objects, etc.); this is useful in particular in case of additional user elements to check if they are available; the available items are returned as dictionary, containing lists of strings for Node, Object, etc.")
         .def("GetDictionary", &MainSystem::GetDictionary, "[UNDER DEVELOPMENT]: return the dictionary of the system data (todo: and state), e.g., to copy the system or for pickling")
         .def("SetDictionary", &MainSystem::SetDictionary, "[UNDER DEVELOPMENT]: set system data (todo: and state) from given dictionary; used for pickling", py::arg("systemDict"))
+        .def("GetStateCheckpoint", &MainSystem::PyGetStateCheckpoint, "return binary checkpoint of the system state in given configuration (coordinates, data coordinates and time), the internal storage of sensors and the active contact sets of GeneralContact; the checkpoint can only be restored into the same assembled system on the same platform; save and restore only copy memory and are therefore much faster than SetSystemState(...) or restart files, e.g., for repeated resets of a model in optimization or reinforcement learning", py::arg("configuration") = ConfigurationType::Current)
+        .def("SetStateCheckpoint", &MainSystem::PySetStateCheckpoint, "restore system state in given configuration, internal storage of sensors and active contact sets of GeneralContact from binary checkpoint created with GetStateCheckpoint(...); raises error if checkpoint does not fit to system", py::arg("checkpoint"), py::arg("configuration") = ConfigurationType::Current)
+        .def("WriteStateCheckpoint", &MainSystem::PyWriteStateCheckpoint, "write binary checkpoint, see GetStateCheckpoint(...), to file; directories are created if necessary", py::arg("fileName"), py::arg("configuration") = ConfigurationType::Current)
+        .def("ReadStateCheckpoint", &MainSystem::PyReadStateCheckpoint, "restore from binary checkpoint file written with WriteStateCheckpoint(...), see SetStateCheckpoint(...)", py::arg("fileName"), py::arg("configuration") = ConfigurationType::Current)
+        .def("SolveEnsemble", &MainSystem::PySolveEnsemble, "solve an ensemble (e.g. parameter variation) of copies of this assembled system in parallel C++ threads, without rebuilding the model in Python; every member is created from the dictionary of the system (like pickling), parameters are overridden with parameterSets[i], which is a list of tuples (itemIndex, parameterName, value) using typed indices (NodeIndex, ObjectIndex, MarkerIndex, LoadIndex, SensorIndex) as in SetObjectParameter(...), and then assembled; members start from initial values and do not write solution, sensor or solver information files; the internal storage of sensors in sensorNumbers is returned for every member; solverType selects the dynamic solver as in exudyn.SolveDynamic(...), useStaticSolver=True uses the static solver; numberOfThreads=0 uses all available hardware threads; members with Python user functions are solved one after another, as they need the GIL; GeneralContact is not supported; returns dictionary with list 'success' and list 'sensorData' containing a list of numpy arrays per member", py::arg("parameterSets"), py::arg("sensorNumbers"), py::arg("simulationSettings") = SimulationSettings(), py::arg("solverType") = DynamicSolverType::GeneralizedAlpha, py::arg("useStaticSolver") = false, py::arg("numberOfThreads") = 0)
         .def(py::pickle(
             [](const MainSystem& self) {
                 return py::make_tuple(self.GetDictionary());
@@ -233,6 +238,7 @@
         .def("GetObjectOutputSuperElement", &MainSystem::PyGetObjectOutputVariableSuperElement, "get output variable from mesh node number of object with type SuperElement (GenericODE2, FFRF, FFRFreduced - CMS) with specific OutputVariableType; the meshNodeNumber is the object's local node number, not the global node number!", py::arg("objectNumber"), py::arg("variableType"), py::arg("meshNodeNumber"), py::arg("configuration") = ConfigurationType::Current)
         .def("GetObjectParameter", &MainSystem::PyGetObjectParameter, "get objects's parameter from object number (type ObjectIndex) and parameterName; parameter names can be found for the specific items in the reference manual; for visualization parameters, use a 'V' as a prefix; NOTE that BodyGraphicsData cannot be get or set, use dictionary access instead", py::arg("objectNumber"), py::arg("parameterName"))
         .def("SetObjectParameter", &MainSystem::PySetObjectParameter, "set parameter 'parameterName' of object with object number (type ObjectIndex) to value;; parameter names can be found for the specific items in the reference manual; for visualization parameters, use a 'V' as a prefix; NOTE that BodyGraphicsData cannot be get or set, use dictionary access instead", py::arg("objectNumber"), py::arg("parameterName"), py::arg("value"))
+        .def("SetBatchedUserFunction", &MainSystem::PySetBatchedUserFunction, "set one Python user function for all objects in objectNumbers, which must be all of type ObjectConnectorCoordinateSpringDamper, ObjectConnectorSpringDamper or ObjectConnectorCartesianSpringDamper; instead of one Python call per item, batchedUserFunction(mbs, t, itemNumbers, displacements, velocities) is called once per evaluation of the system ODE2 right-hand-side and once per numerical ODE2 Jacobian (with all perturbed inputs) with numpy arrays of all (active) items and must return a numpy array of forces; for ObjectConnectorCartesianSpringDamper, displacements, velocities and returned forces have shape (n,3), otherwise shape (n); displacements and velocities have the same meaning as in the per-item springForceUserFunction of the object (e.g., deltaL and deltaL_t for ObjectConnectorSpringDamper); stiffness, damping or offset are not passed and must be accessed via mbs if needed; the springForceUserFunction of every object is replaced by a function calling batchedUserFunction with one item, which is used for all other evaluations such as output variables; requires Assemble() afterwards", py::arg("objectNumbers"), py::arg("batchedUserFunction"))
 
 //        MARKER:
         .def("AddMarker", &MainSystem::AddMainMarkerPyClass, "add a marker with markerDefinition from Python marker class; returns (global) marker number (type MarkerIndex) of newly added marker", py::arg("pyObject"))
@@ -261,7 +267,7 @@
         .def("ModifySensor", &MainSystem::PyModifySensor, "modify sensor's dictionary by index", py::arg("sensorNumber"), py::arg("sensorDict"))
         .def("GetSensorDefaults", &MainSystem::PyGetSensorDefaults, "get sensor's default values for a certain sensorType as (dictionary)", py::arg("typeName"))
         .def("GetSensorValues", &MainSystem::PyGetSensorValues, "get sensors's values for configuration; can be a scalar or vector-valued return value!", py::arg("sensorNumber"), py::arg("configuration") = ConfigurationType::Current)
-        .def("GetSensorStoredData", &MainSystem::PyGetSensorStoredData, "get sensors's internally stored data as matrix (all time points stored); rows are containing time and sensor values as obtained by sensor (e.g., time, and x, y, and z value of position)", py::arg("sensorNumber"))
+        .def("GetSensorStoredData", &MainSystem::PyGetSensorStoredData, "get sensors's internally stored data as matrix (all time points stored); rows are containing time and sensor values as obtained by sensor (e.g., time, and x, y, and z value of position); if copy=False, a read-only numpy view of the rows stored up to now is returned without copying data, which may also be used during simulation (e.g., in user functions); the view keeps its data valid, even if storage is extended or reset", py::arg("sensorNumber"), py::arg("copy") = true)
         .def("GetSensorParameter", &MainSystem::PyGetSensorParameter, "get sensors's parameter from sensorNumber and parameterName; parameter names can be found for the specific items in the reference manual", py::arg("sensorNumber"), py::arg("parameterName"))
         .def("SetSensorParameter", &MainSystem::PySetSensorParameter, "set parameter 'parameterName' of sensor with sensorNumber to value; parameter names can be found for the specific items in the reference manual", py::arg("sensorNumber"), py::arg("parameterName"), py::arg("value"))
         ; // end of MainSystem pybind definitions
@@ -325,8 +331,13 @@
         .def_readwrite("verboseMode", &PyGeneralContact::verboseMode, py::return_value_policy::reference)
         .def_readwrite("visualization", &PyGeneralContact::visualization, py::return_value_policy::reference)
         .def_property("resetSearchTreeInterval", &PyGeneralContact::GetResetSearchTreeInterval, &PyGeneralContact::SetResetSearchTreeInterval)
+        .def_property("searchTreeAdaptive", &PyGeneralContact::GetSearchTreeAdaptive, &PyGeneralContact::SetSearchTreeAdaptive)
+        .def_property("searchTreeAdaptiveCellSizeFactor", &PyGeneralContact::GetSearchTreeAdaptiveCellSizeFactor, &PyGeneralContact::SetSearchTreeAdaptiveCellSizeFactor)
+        .def_property("searchTreeAdaptiveMaxCells", &PyGeneralContact::GetSearchTreeAdaptiveMaxCells, &PyGeneralContact::SetSearchTreeAdaptiveMaxCells)
+        .def_property("trianglesBVH", &PyGeneralContact::GetTrianglesBVH, &PyGeneralContact::SetTrianglesBVH)
         .def_property("sphereSphereContact", &PyGeneralContact::GetSphereSphereContact, &PyGeneralContact::SetSphereSphereContact)
         .def_property("sphereSphereFrictionRecycle", &PyGeneralContact::GetSphereSphereFrictionRecycle, &PyGeneralContact::SetSphereSphereFrictionRecycle)
+        .def_property("sphereSphereNeighborListSkin", &PyGeneralContact::GetSphereSphereNeighborListSkin, &PyGeneralContact::SetSphereSphereNeighborListSkin)
         .def_property("minRelDistanceSpheresTriangles", &PyGeneralContact::GetMinRelDistanceSpheresTriangles, &PyGeneralContact::SetMinRelDistanceSpheresTriangles)
         .def_property("frictionProportionalZone", &PyGeneralContact::GetFrictionProportionalZone, &PyGeneralContact::SetFrictionProportionalZone)
         .def_property("frictionVelocityPenalty", &PyGeneralContact::GetFrictionVelocityPenalty, &PyGeneralContact::SetFrictionVelocityPenalty)
@@ -376,6 +387,26 @@
         ; // end of MatrixContainer pybind definitions
 
 
+    py::class_<PyBinarySolutionReader>(m, "BinarySolutionReader")
+        .def(py::init<>())
+        .def(py::init([](const STDstring& fileName) { PyBinarySolutionReader reader; reader.Open(fileName); return reader; }), py::arg("fileName"))
+        .def("Open", &PyBinarySolutionReader::Open, "open and memory-map binary solution file, parse header and determine number of complete rows from file size; raises exception, if file is not a valid binary solution file; an incomplete last row (e.g., simulation still running) is ignored", py::arg("fileName"))
+        .def("Close", &PyBinarySolutionReader::Close, "release reader's reference to the file mapping; existing views remain valid")
+        .def("IsOpen", &PyBinarySolutionReader::IsOpen, "return True, if a file is opened")
+        .def("NumberOfRows", &PyBinarySolutionReader::NumberOfRows, "return number of complete rows (stored time steps) in file")
+        .def("NumberOfColumns", &PyBinarySolutionReader::NumberOfColumns, "return number of columns per row, including time column")
+        .def("GetColumnsExported", &PyBinarySolutionReader::GetColumnsExported, "return list of exported sizes [nODE2, nVel2, nAcc2, nODE1, nVel1, nAlgebraic, nData], as in LoadSolutionFile")
+        .def("GetHeaderInfo", &PyBinarySolutionReader::GetHeaderInfo, "return dictionary with header information of file: version, solver, dateTime, solutionInformation, systemSizes, columnsExported, numberOfSteps, indexSize, realSize and validEndFound (False if simulation has not been finished or file is incomplete)")
+        .def("GetData", &PyBinarySolutionReader::GetData, "return read-only numpy view (matrix) of rows in range [rowStart, rowEnd) with increment rowStep and columns in range [columnStart, columnEnd); column 0 is time; rowEnd=-1 and columnEnd=-1 represent number of rows and columns; dtype is float32 or float64 according to file", py::arg("rowStart") = 0, py::arg("rowEnd") = -1, py::arg("rowStep") = 1, py::arg("columnStart") = 0, py::arg("columnEnd") = -1)
+        .def("GetRow", &PyBinarySolutionReader::GetRow, "return read-only numpy view of row, including time", py::arg("row"))
+        .def("GetTimes", &PyBinarySolutionReader::GetTimes, "return read-only numpy view of time column")
+        .def("FindRowRange", &PyBinarySolutionReader::FindRowRange, "return list [rowStart, rowEnd] with rows rowStart <= i < rowEnd having times timeStart <= t <= timeEnd; uses binary search, as times are non-decreasing", py::arg("timeStart"), py::arg("timeEnd"))
+        .def("GetDataInTimeRange", &PyBinarySolutionReader::GetDataInTimeRange, "return read-only numpy view of rows with timeStart <= t <= timeEnd and columns in range [columnStart, columnEnd)", py::arg("timeStart"), py::arg("timeEnd"), py::arg("columnStart") = 0, py::arg("columnEnd") = -1)
+        .def("__repr__", [](const PyBinarySolutionReader &item) {
+            return STDstring("BinarySolutionReader(rows=") + EXUstd::ToString(item.NumberOfRows()) + ", columns=" + EXUstd::ToString(item.NumberOfColumns()) + ")"; }, "return the string representation of the BinarySolutionReader")
+        ; // end of BinarySolutionReader pybind definitions
+
+
     py::class_<PyVector3DList>(m, "Vector3DList")
         .def(py::init<>())
         .def(py::init<const py::object&>(), py::arg("listOfArrays"))
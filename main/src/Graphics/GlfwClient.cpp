@@ -33,8 +33,7 @@
 
 //GlfwRendererUsePNG only makes sense if GLFW_GRAPHICS is available
 #ifdef GlfwRendererUsePNG
-#define STB_IMAGE_WRITE_IMPLEMENTATION
-#include "deps/stb_image_write.h" //for save image as .PNG
+#include "deps/stb_image_write.h" //for save image as .PNG; implementation in SoftwareRenderer.cpp
 #endif
 
 #ifdef __EXUDYN_USE_OPENVR 
@@ -870,10 +869,14 @@ void GlfwRenderer::ComputeMaxSceneSize(float& maxSceneSize, Float3& center)
 		maxSceneSize = (pmax - pmin).GetL2Norm();
 		if (maxSceneSize < visSettings->general.minSceneSize) { maxSceneSize = visSettings->general.minSceneSize; }
 
-		if (graphicsDataList->NumberOfItems() == 0 ||
-			((*graphicsDataList)[0]->glCirclesXY.NumberOfItems() == 0 && (*graphicsDataList)[0]->glLines.NumberOfItems() == 0
-				&& (*graphicsDataList)[0]->glSpheres.NumberOfItems() == 0 && (*graphicsDataList)[0]->glTexts.NumberOfItems() == 0
-				&& (*graphicsDataList)[0]->glTriangles.NumberOfItems() == 0))
+		bool noGraphicsData = true; //first system has graphicsData and cached rigid body graphicsData
+		for (Index i = 0; i < EXUstd::Minimum(graphicsDataList->NumberOfItems(), (Index)2); i++)
+		{
+			const GraphicsData* data = (*graphicsDataList)[i];
+			if (data->glCirclesXY.NumberOfItems() != 0 || data->glLines.NumberOfItems() != 0 || data->glSpheres.NumberOfItems() != 0
+				|| data->glTexts.NumberOfItems() != 0 || data->glTriangles.NumberOfItems() != 0) { noGraphicsData = false; }
+		}
+		if (noGraphicsData)
 		{
 			maxSceneSize = 1;
 			center = Float3({ 0,0,0 });
@@ -2201,7 +2204,7 @@ void GlfwRenderer::Render(GLFWwindow* window) //GLFWwindow* needed in argument,
 		float maxVal = 1;
 		if (graphicsDataList)
 		{
-			if (graphicsDataList->NumberOfItems() > 1) 
+			if (graphicsDataList->NumberOfItems() > 2) //graphicsData and cached rigid body graphicsData per system
 			{
 				ShowMessage("WARNING: contour plot color bar only works for one single system");
 			}
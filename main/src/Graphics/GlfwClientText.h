@@ -16,6 +16,7 @@
 
 #include "Utilities/ReleaseAssert.h"
 #include "Utilities/BasicDefinitions.h"
+#include "Linalg/ConstSizeVector.h"
 
 #ifdef USE_GLFW_GRAPHICS
 
@@ -36,6 +37,9 @@
 
 #define OPENGLTEXT_EXISTS
 
+#endif //USE_GLFW_GRAPHICS
+
+//! character lines are also used by the software renderer, which does not need GLFW
 namespace OpenGLText
 {
 	static const Index maxTextPoints = 12; //fixed maximum number of points for drawing text with lines
@@ -105,6 +109,7 @@ namespace OpenGLText
 		}
 	}
 
+#ifdef USE_GLFW_GRAPHICS
 	//! draw a 0-terminated text string with scaling (size=1: height=1; width=0.5 for one character; distance = 0.2)
 	inline void DrawString(const char* text, float scale, const Float3& p, const Float4& color)
 	{
@@ -146,8 +151,8 @@ namespace OpenGLText
 
 	}
 
+#endif //USE_GLFW_GRAPHICS
 
 }
 
-#endif //USE_GLFW_GRAPHICS
 #endif //include once
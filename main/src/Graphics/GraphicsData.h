@@ -132,6 +132,8 @@ private:
 public:
 	GraphicsData()
 	{
+		visualizationCounter = 0;
+		updateGraphicsDataNow = false;
 		contourCurrentMinValue = EXUstd::_MAXFLOAT;
 		contourCurrentMaxValue = EXUstd::_MINFLOAT;
 		ClearLock();
@@ -88,6 +88,11 @@ bool PostProcessData::VisualizationIsRunning() const
 	return visualizationSystem->GetMainSystemBacklink()->HasMainSystemContainer() && visualizationSystem->GetMainSystemBacklink()->GetMainSystemContainer().GetVisualizationSystemContainer().RendererIsRunning();
 }
 
+bool PostProcessData::UseSoftwareRenderer()
+{
+	return visualizationSystem->GetMainSystemBacklink()->HasMainSystemContainer() && visualizationSystem->GetMainSystemBacklink()->GetMainSystemContainer().GetVisualizationSystemContainer().UseSoftwareRenderer();
+}
+
 
 void PostProcessData::ProcessUserFunctionDrawing()
 {
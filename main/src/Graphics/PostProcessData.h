@@ -98,6 +98,9 @@ public:
 	//! uses some backlinks for solver to find out if visualization is running (could also be checked directly via GLFWrenderer global variable)
 	bool VisualizationIsRunning() const; 
 
+	//! return true, if images are saved by software renderer; starts software renderer if needed
+	bool UseSoftwareRenderer();
+
 	//! set a visualization message into openGL window
 	void SetSolverMessage(const std::string& solverMessageInit)
 	{
@@ -0,0 +1,725 @@
+/** ***********************************************************************************************
+* @brief		Implementation of class SoftwareRenderer
+* @details		Details:
+ 				- CPU rasterizer for triangles, lines, spheres, circles and texts of GraphicsData
+				- renderer thread for saving images without OpenGL window
+*
+* @date			2026-10-17 (created)
+*
+* @copyright    This file is part of Exudyn. Exudyn is free software: you can redistribute it and/or modify it under the terms of the Exudyn license. See 'LICENSE.txt' for more details.
+* @note			Bug reports, support and further information:
+* 				- email: johannes.gerstmayr@uibk.ac.at
+* 				- weblink: https://github.com/jgerstmayr/EXUDYN
+*
+*
+************************************************************************************************ */
+
+#include "Graphics/SoftwareRenderer.h"
+#include "Graphics/GlfwClientText.h" //line font
+#include "Linalg/BasicLinalg.h"
+
+#include <fstream>
+#include <cfloat> //FLT_MAX
+
+#ifdef USE_GLFW_GRAPHICS
+#include "Graphics/GlfwClient.h" //check if OpenGL renderer is running
+#endif
+
+//the only stb_image_write implementation, also used by GlfwRenderer; this file is built with and without GLFW
+#define STB_IMAGE_WRITE_IMPLEMENTATION
+#include "glfw/deps/stb_image_write.h" //for save image as .PNG
+
+//! true, if OpenGL renderer is running; in this case, images are saved by OpenGL renderer
+inline bool OpenGLRendererIsActive()
+{
+#ifdef USE_GLFW_GRAPHICS
+	return glfwRenderer.IsGlfwInitAndRendererActive();
+#else
+	return false;
+#endif
+}
+
+//! print message of renderer thread via output buffer (no Python calls in renderer thread)
+inline void SoftwareRendererMessage(const STDstring& str)
+{
+	outputBuffer.WriteVisualization(str + '\n');
+}
+
+bool SoftwareRenderer::Start(ResizableArray<GraphicsData*>* graphicsDataListInit, VisualizationSettings* settingsInit,
+	VisualizationSystemContainerBase* basicVisualizationSystemContainerInit, RenderState* renderStateInit)
+{
+	if (rendererActive) { return false; }
+
+	graphicsDataList = graphicsDataListInit;
+	visSettings = settingsInit;
+	basicVisualizationSystemContainer = basicVisualizationSystemContainerInit;
+	state = renderStateInit;
+
+	//same as startup of GlfwRenderer
+	basicVisualizationSystemContainer->InitializeView();
+	basicVisualizationSystemContainer->SetComputeMaxSceneRequest(true);
+	if (visSettings->general.autoFitScene)
+	{
+		basicVisualizationSystemContainer->SetZoomAllRequest(true);
+	}
+
+	stopRenderer = false;
+	rendererActive = true;
+	rendererThread = std::thread(&SoftwareRenderer::RunLoop, this);
+	return true;
+}
+
+void SoftwareRenderer::Stop()
+{
+	if (!rendererActive) { return; }
+
+	stopRenderer = true;
+	if (rendererThread.joinable()) { rendererThread.join(); }
+	rendererActive = false;
+	rendererThreadId = std::thread::id();
+}
+
+void SoftwareRenderer::RunLoop()
+{
+	rendererThreadId = std::this_thread::get_id();
+	const Index sleepMilliseconds = 2; //wait time if no image has been requested
+
+	try
+	{
+		while (!stopRenderer)
+		{
+			if (!DoRendererTasks())
+			{
+				std::this_thread::sleep_for(std::chrono::milliseconds(sleepMilliseconds));
+			}
+		}
+		DoRendererTasks(); //save image, which has been requested before stop
+	}
+	catch (const std::exception& ex)
+	{
+		SoftwareRendererMessage(STDstring("SoftwareRenderer: unexpected exception; renderer stopped: ") + ex.what());
+	}
+	catch (...)
+	{
+		SoftwareRendererMessage("SoftwareRenderer: unexpected exception; renderer stopped");
+	}
+}
+
+bool SoftwareRenderer::DoRendererTasks()
+{
+	if (!visSettings->exportImages.useSoftwareRenderer || OpenGLRendererIsActive()) { return false; }
+
+	basicVisualizationSystemContainer->UpdateGraphicsData();
+	if (!basicVisualizationSystemContainer->SaveImageRequest()) { return false; }
+
+	//scene size is only computed if graphics data is available, which is the case for requested images
+	bool maxSceneComputed = false;
+	if (basicVisualizationSystemContainer->GetComputeMaxSceneRequest())
+	{
+		ComputeMaxSceneSize(state->maxSceneSize, state->centerPoint);
+		maxSceneComputed = true;
+		basicVisualizationSystemContainer->SetComputeMaxSceneRequest(false);
+	}
+	if (basicVisualizationSystemContainer->GetAndResetZoomAllRequest())
+	{
+		if (!maxSceneComputed) { ComputeMaxSceneSize(state->maxSceneSize, state->centerPoint); }
+		state->zoom = 0.4f*state->maxSceneSize;
+	}
+
+	SaveImage();
+	return true;
+}
+
+void SoftwareRenderer::SaveImage()
+{
+	STDstring filename = visSettings->exportImages.saveImageFileName;
+
+	if (!visSettings->exportImages.saveImageSingleFile)
+	{
+		char num[100];
+		sprintf(num, "%05d", (int)visSettings->exportImages.saveImageFileCounter);
+
+		filename += num;
+		visSettings->exportImages.saveImageFileCounter++; //this changes the settings, because it should always contain the current value for consecutive simulations
+	}
+
+	const STDstring& format = visSettings->exportImages.saveImageFormat;
+	if (format == "PNG") { filename += ".png"; }
+	else if (format == "TGA") { filename += ".tga"; }
+	else
+	{
+		SoftwareRendererMessage("SoftwareRenderer: saveImageFormat '" + format + "' not supported; use PNG or TGA; no file written");
+		basicVisualizationSystemContainer->SaveImageFinished();
+		return;
+	}
+
+	Index widthAlignment = visSettings->exportImages.widthAlignment;
+	Index heightAlignment = visSettings->exportImages.heightAlignment;
+	if (widthAlignment != 1 && widthAlignment != 2 && widthAlignment != 4 && widthAlignment != 8)
+	{
+		widthAlignment = 4;
+		SoftwareRendererMessage("SaveImage ERROR: exportImages.widthAlignment illegal: must be 1, 2, 4 or 8; defaulting to 4");
+	}
+	if (heightAlignment != 1 && heightAlignment != 2 && heightAlignment != 4 && heightAlignment != 8)
+	{
+		heightAlignment = 2;
+		SoftwareRendererMessage("SaveImage ERROR: exportImages.heightAlignment illegal: must be 1, 2, 4 or 8; defaulting to 2");
+	}
+	Index imageWidthAligned = widthAlignment * (Index)(visSettings->window.renderWindowSize[0] / widthAlignment);
+	Index imageHeightAligned = heightAlignment * (Index)(visSettings->window.renderWindowSize[1] / heightAlignment);
+
+	if (imageWidthAligned < 1 || imageHeightAligned < 1)
+	{
+		SoftwareRendererMessage("SoftwareRenderer: window.renderWindowSize too small; no file written");
+	}
+	else
+	{
+		Render(imageWidthAligned, imageHeightAligned);
+		if (!SaveImageToFile(filename, format))
+		{
+			SoftwareRendererMessage("SoftwareRenderer: Failed to write image file <" + filename + ">");
+		}
+	}
+
+	basicVisualizationSystemContainer->SaveImageFinished();
+}
+
+bool SoftwareRenderer::SaveImageToFile(const STDstring& filename, const STDstring& format) const
+{
+	if (!CheckPathAndCreateDirectories(filename)) { return false; }
+
+	if (format == "PNG")
+	{
+		return stbi_write_png(filename.c_str(), (int)imageWidth, (int)imageHeight, 3, image.GetDataPointer(), (int)(3 * imageWidth)) != 0;
+	}
+	else if (format == "TGA")
+	{
+		std::ofstream imageFile;
+		imageFile.open(filename, std::ofstream::out | std::ofstream::binary);
+		if (!imageFile.is_open()) { return false; }
+
+		short header[] = { 0, 2, 0, 0, 0, 0, (short)imageWidth, (short)imageHeight, 24 }; //file header for .tga (targa) images
+		imageFile.write((const char*)header, sizeof(header));
+
+		//.tga stores rows from bottom to top in BGR format
+		ResizableArray<char> row(3 * imageWidth);
+		row.SetNumberOfItems(3 * imageWidth);
+		for (Index i = imageHeight - 1; i >= 0; i--)
+		{
+			const unsigned char* pixel = &image[3 * imageWidth * i];
+			for (Index j = 0; j < imageWidth; j++)
+			{
+				row[3 * j] = (char)pixel[3 * j + 2];
+				row[3 * j + 1] = (char)pixel[3 * j + 1];
+				row[3 * j + 2] = (char)pixel[3 * j];
+			}
+			imageFile.write(row.GetDataPointer(), 3 * imageWidth);
+		}
+		imageFile.close();
+		return true;
+	}
+	return false;
+}
+
+void SoftwareRenderer::ComputeMaxSceneSize(float& maxSceneSize, Float3& center) const
+{
+	Float3 pmax({ -1e30f,-1e30f,-1e30f });
+	Float3 pmin({ 1e30f,1e30f,1e30f });
+	bool noGraphicsData = true;
+
+	auto addPoint = [&pmin, &pmax](const Float3& p, float radius)
+	{
+		for (Index i = 0; i < 3; i++)
+		{
+			pmax[i] = EXUstd::Maximum(p[i] + radius, pmax[i]);
+			pmin[i] = EXUstd::Minimum(p[i] - radius, pmin[i]);
+		}
+	};
+
+	for (auto data : *graphicsDataList)
+	{
+		for (const GLLine& item : data->glLines) { addPoint(item.point1, 0.f); addPoint(item.point2, 0.f); }
+		for (const GLText& item : data->glTexts) { addPoint(item.point, 0.f); }
+		for (const GLSphere& item : data->glSpheres) { addPoint(item.point, 0.f); }
+		for (const GLCircleXY& item : data->glCirclesXY) { addPoint(item.point, item.radius); }
+		for (const GLTriangle& item : data->glTriangles)
+		{
+			for (const Float3& point : item.points) { addPoint(point, 0.f); }
+		}
+	}
+
+	//first system has graphicsData and cached rigid body graphicsData; world basis is added to first system
+	for (Index i = 0; i < EXUstd::Minimum(graphicsDataList->NumberOfItems(), (Index)2); i++)
+	{
+		const GraphicsData* data = (*graphicsDataList)[i];
+		if (data->glCirclesXY.NumberOfItems() != 0 || data->glLines.NumberOfItems() != 0 || data->glSpheres.NumberOfItems() != 0
+			|| data->glTexts.NumberOfItems() != 0 || data->glTriangles.NumberOfItems() != 0) { noGraphicsData = false; }
+	}
+
+	center = 0.5f*(pmin + pmax);
+	maxSceneSize = (pmax - pmin).GetL2Norm();
+	if (maxSceneSize < visSettings->general.minSceneSize) { maxSceneSize = visSettings->general.minSceneSize; }
+
+	if (noGraphicsData)
+	{
+		maxSceneSize = 1;
+		center = Float3({ 0,0,0 });
+	}
+}
+
+//! see GlfwRenderer::SetProjection and GlfwRenderer::SetModelRotationTranslation
+void SoftwareRenderer::SetView()
+{
+	float zoom = state->zoom;
+	if (visSettings->interactive.lockModelView) { zoom = visSettings->openGL.initialZoom; }
+	if (zoom <= 0.f) { zoom = 1.f; }
+	sceneSize = state->maxSceneSize;
+
+	const Matrix4DF& A = state->modelRotation;
+	Float3 translationMV;
+	if (!visSettings->interactive.lockModelView)
+	{
+		rotation = EXUmath::Matrix4DtoMatrix3D(A);
+		translationMV = state->rotationCenterPoint * rotation + state->centerPoint;
+	}
+	else
+	{
+		rotation = Matrix3DF(3, 3);
+		for (Index i = 0; i < 3; i++)
+		{
+			for (Index j = 0; j < 3; j++)
+			{
+				rotation(i, j) = visSettings->openGL.initialModelRotation[i][j];
+			}
+		}
+		translationMV = visSettings->openGL.initialCenterPoint;
+	}
+
+	//update center point if tracked by marker
+	if (visSettings->interactive.trackMarker != -1)
+	{
+		Vector3D markerPosition;
+		Matrix3D markerOrientation;
+		bool hasPosition;
+		bool hasOrientation;
+		basicVisualizationSystemContainer->GetMarkerPositionOrientation(visSettings->interactive.trackMarker,
+			visSettings->interactive.trackMarkerMbsNumber, markerPosition, markerOrientation, hasPosition, hasOrientation);
+
+		if (hasOrientation && visSettings->interactive.trackMarkerOrientation.SumAbs() == 3.f)
+		{
+			Matrix3DF markerOrientation3DF;
+			markerOrientation3DF.CopyFrom(markerOrientation);
+			rotation = markerOrientation3DF * rotation; //superimposed initial rotation
+		}
+		if (hasPosition)
+		{
+			markerPosition[0] *= (Real)visSettings->interactive.trackMarkerPosition[0];
+			markerPosition[1] *= (Real)visSettings->interactive.trackMarkerPosition[1];
+			markerPosition[2] *= (Real)visSettings->interactive.trackMarkerPosition[2];
+
+			Float3 markerPosition3DF;
+			markerPosition3DF.CopyFrom(markerPosition);
+			translationMV += markerPosition3DF * rotation;
+		}
+	}
+
+	//translation part of modelRotation (OpenGL column-major matrix) and translation of model view
+	translation = Float3({ A(3, 0) - translationMV[0], A(3, 1) - translationMV[1], A(3, 2) });
+
+	perspective = visSettings->openGL.perspective > 0;
+	if (!perspective)
+	{
+		scaleX = 0.5f * (float)height / zoom;
+		scaleY = scaleX;
+	}
+	else
+	{
+		float fact = 1.f / (float)visSettings->openGL.perspective;
+		float factZoom = 0.5f; //correction, to show same zoom level as orthographic projection
+		zNear = sceneSize * fact;
+		perspectiveDistance = 2.f * fact * sceneSize;
+		scaleX = 0.5f * (float)height * zNear / (zoom * factZoom);
+		scaleY = scaleX;
+	}
+}
+
+bool SoftwareRenderer::Project(const Float3& eye, Float3& pixel) const
+{
+	if (!perspective)
+	{
+		if (std::fabs(eye[2]) > zFactor * 2.f * sceneSize) { return false; }
+		pixel[0] = 0.5f * (float)width + scaleX * eye[0];
+		pixel[1] = 0.5f * (float)height - scaleY * eye[1];
+	}
+	else
+	{
+		float distance = perspectiveDistance - eye[2];
+		if (distance < zNear) { return false; }
+		pixel[0] = 0.5f * (float)width + scaleX * eye[0] / distance;
+		pixel[1] = 0.5f * (float)height - scaleY * eye[1] / distance;
+	}
+	pixel[2] = Depth(eye[2]);
+	return true;
+}
+
+//! OpenGL fixed function lighting with color material (ambient and diffuse), lights given in eye coordinates, see GlfwRenderer::SetGLLights
+Float4 SoftwareRenderer::ComputeLighting(const Float4& color, const Float3& eye, const Float3& normal) const
+{
+	if (!visSettings->openGL.enableLighting) { return color; }
+
+	const VSettingsOpenGL& gl = visSettings->openGL;
+	Float3 baseColor({ color[0], color[1], color[2] });
+	Float3 lightModelAmbient({ gl.lightModelAmbient[0], gl.lightModelAmbient[1], gl.lightModelAmbient[2] });
+	Float3 materialSpecular({ gl.materialSpecular[0], gl.materialSpecular[1], gl.materialSpecular[2] });
+	Float3 result({ lightModelAmbient[0] * baseColor[0], lightModelAmbient[1] * baseColor[1], lightModelAmbient[2] * baseColor[2] });
+
+	Float3 n = normal;
+	float length = n.GetL2Norm();
+	if (length != 0.f) { n *= 1.f / length; }
+
+	for (Index i = 0; i < 2; i++)
+	{
+		if ((i == 0 && !gl.enableLight0) || (i == 1 && !gl.enableLight1)) { continue; }
+
+		const Float4& position = (i == 0) ? gl.light0position : gl.light1position;
+		float ambient = (i == 0) ? gl.light0ambient : gl.light1ambient;
+		float diffuse = (i == 0) ? gl.light0diffuse : gl.light1diffuse;
+		float specular = (i == 0) ? gl.light0specular : gl.light1specular;
+
+		Float3 lightDirection({ position[0], position[1], position[2] });
+		float attenuation = 1.f;
+		if (position[3] != 0.f)
+		{
+			lightDirection -= eye;
+			float distance = lightDirection.GetL2Norm();
+			attenuation = (i == 0) ?
+				gl.light0constantAttenuation + gl.light0linearAttenuation * distance + gl.light0quadraticAttenuation * distance * distance :
+				gl.light1constantAttenuation + gl.light1linearAttenuation * distance + gl.light1quadraticAttenuation * distance * distance;
+			attenuation = (attenuation != 0.f) ? 1.f / attenuation : 1.f;
+		}
+		float lightLength = lightDirection.GetL2Norm();
+		if (lightLength != 0.f) { lightDirection *= 1.f / lightLength; }
+
+		float diffuseFactor = EXUstd::Maximum(n * lightDirection, 0.f);
+		result += (attenuation * (ambient + diffuse * diffuseFactor)) * baseColor;
+
+		if (diffuseFactor > 0.f && specular != 0.f)
+		{
+			Float3 halfVector = lightDirection + Float3({ 0.f, 0.f, 1.f }); //non-local viewer
+			float halfLength = halfVector.GetL2Norm();
+			if (halfLength != 0.f) { halfVector *= 1.f / halfLength; }
+			float specularFactor = std::pow(EXUstd::Maximum(n * halfVector, 0.f), gl.materialShininess);
+			result += (attenuation * specular * specularFactor) * materialSpecular;
+		}
+	}
+
+	return Float4({ EXUstd::Minimum(result[0], 1.f), EXUstd::Minimum(result[1], 1.f), EXUstd::Minimum(result[2], 1.f), color[3] });
+}
+
+void SoftwareRenderer::DrawTriangle(const std::array<Float3, 3>& eyePoints, const std::array<Float4, 3>& colors, const std::array<Float3, 3>& eyeNormals)
+{
+	std::array<Float3, 3> pixels;
+	for (Index i = 0; i < 3; i++)
+	{
+		if (!Project(eyePoints[i], pixels[i])) { return; }
+	}
+
+	float area = (pixels[1][0] - pixels[0][0]) * (pixels[2][1] - pixels[0][1]) - (pixels[2][0] - pixels[0][0]) * (pixels[1][1] - pixels[0][1]);
+	if (area == 0.f) { return; }
+	bool backFace = area > 0.f; //pixel y-coordinates point downwards: counter-clockwise triangles have negative area
+
+	std::array<Float4, 3> litColors;
+	for (Index i = 0; i < 3; i++)
+	{
+		Float3 n = eyeNormals[i];
+		if (backFace && visSettings->openGL.lightModelTwoSide) { n *= -1.f; }
+		litColors[i] = ComputeLighting(colors[i], eyePoints[i], n);
+	}
+	if (!visSettings->openGL.shadeModelSmooth) { litColors[0] = litColors[2]; litColors[1] = litColors[2]; } //OpenGL uses last vertex for flat shading
+
+	Index xMin = EXUstd::Maximum((Index)std::floor(EXUstd::Minimum(pixels[0][0], EXUstd::Minimum(pixels[1][0], pixels[2][0]))), (Index)0);
+	Index xMax = EXUstd::Minimum((Index)std::ceil(EXUstd::Maximum(pixels[0][0], EXUstd::Maximum(pixels[1][0], pixels[2][0]))), width - 1);
+	Index yMin = EXUstd::Maximum((Index)std::floor(EXUstd::Minimum(pixels[0][1], EXUstd::Minimum(pixels[1][1], pixels[2][1]))), (Index)0);
+	Index yMax = EXUstd::Minimum((Index)std::ceil(EXUstd::Maximum(pixels[0][1], EXUstd::Maximum(pixels[1][1], pixels[2][1]))), height - 1);
+
+	float invArea = 1.f / area;
+	for (Index y = yMin; y <= yMax; y++)
+	{
+		float py = (float)y + 0.5f;
+		for (Index x = xMin; x <= xMax; x++)
+		{
+			float px = (float)x + 0.5f;
+			//barycentric coordinates of pixel center
+			float w0 = ((pixels[1][0] - px) * (pixels[2][1] - py) - (pixels[2][0] - px) * (pixels[1][1] - py)) * invArea;
+			float w1 = ((pixels[2][0] - px) * (pixels[0][1] - py) - (pixels[0][0] - px) * (pixels[2][1] - py)) * invArea;
+			float w2 = 1.f - w0 - w1;
+			if (w0 < 0.f || w1 < 0.f || w2 < 0.f) { continue; }
+
+			float depth = w0 * pixels[0][2] + w1 * pixels[1][2] + w2 * pixels[2][2];
+			Float4 color = w0 * litColors[0] + w1 * litColors[1] + w2 * litColors[2];
+			SetPixel(y * width + x, depth, color);
+		}
+	}
+}
+
+void SoftwareRenderer::DrawLinePixels(const Float3& pixel1, const Float3& pixel2, const Float4& color1, const Float4& color2, Index lineWidth, bool depthTest)
+{
+	Float3 delta = pixel2 - pixel1;
+	Index steps = (Index)std::ceil(EXUstd::Maximum(std::fabs(delta[0]), std::fabs(delta[1])));
+	if (steps < 1) { steps = 1; }
+	Index offset = (lineWidth - 1) / 2;
+
+	for (Index k = 0; k <= steps; k++)
+	{
+		float t = (float)k / (float)steps;
+		Index x0 = (Index)std::floor(pixel1[0] + t * delta[0]) - offset;
+		Index y0 = (Index)std::floor(pixel1[1] + t * delta[1]) - offset;
+		float depth = pixel1[2] + t * delta[2];
+		Float4 color = (1.f - t) * color1 + t * color2;
+
+		for (Index y = EXUstd::Maximum(y0, (Index)0); y < EXUstd::Minimum(y0 + lineWidth, height); y++)
+		{
+			for (Index x = EXUstd::Maximum(x0, (Index)0); x < EXUstd::Minimum(x0 + lineWidth, width); x++)
+			{
+				SetPixel(y * width + x, depth, color, depthTest);
+			}
+		}
+	}
+}
+
+void SoftwareRenderer::DrawLine(const Float3& eye1, const Float3& eye2, const Float4& color1, const Float4& color2)
+{
+	//move lines towards viewer, such that they are drawn on top of faces
+	Float3 offset({ 0.f, 0.f, lineDepthOffset * sceneSize });
+	Float3 pixel1, pixel2;
+	if (!Project(eye1 + offset, pixel1) || !Project(eye2 + offset, pixel2)) { return; }
+
+	Index lineWidth = EXUstd::Maximum((Index)std::round(visSettings->openGL.lineWidth * (float)superSampling), (Index)1);
+	DrawLinePixels(pixel1, pixel2, color1, color2, lineWidth);
+}
+
+void SoftwareRenderer::DrawSphere(const Float3& eyeCenter, float radius, const Float4& color)
+{
+	Float3 center;
+	if (!Project(eyeCenter, center)) { return; }
+
+	float pixelRadius = radius * scaleY;
+	if (perspective) { pixelRadius /= (perspectiveDistance - eyeCenter[2]); }
+
+	Index xMin = EXUstd::Maximum((Index)std::floor(center[0] - pixelRadius), (Index)0);
+	Index xMax = EXUstd::Minimum((Index)std::ceil(center[0] + pixelRadius), width - 1);
+	Index yMin = EXUstd::Maximum((Index)std::floor(center[1] - pixelRadius), (Index)0);
+	Index yMax = EXUstd::Minimum((Index)std::ceil(center[1] + pixelRadius), height - 1);
+	if (pixelRadius < 0.5f) //sphere smaller than pixel
+	{
+		if (xMin <= xMax && yMin <= yMax)
+		{
+			SetPixel((Index)center[1] * width + (Index)center[0], center[2], ComputeLighting(color, eyeCenter, Float3({ 0.f, 0.f, 1.f })));
+		}
+		return;
+	}
+
+	for (Index y = yMin; y <= yMax; y++)
+	{
+		float v = -((float)y + 0.5f - center[1]) / pixelRadius;
+		for (Index x = xMin; x <= xMax; x++)
+		{
+			float u = ((float)x + 0.5f - center[0]) / pixelRadius;
+			float r2 = u * u + v * v;
+			if (r2 > 1.f) { continue; }
+
+			Float3 normal({ u, v, std::sqrt(1.f - r2) });
+			Float3 eyePoint = eyeCenter + radius * normal;
+			SetPixel(y * width + x, Depth(eyePoint[2]), ComputeLighting(color, eyePoint, normal));
+		}
+	}
+}
+
+void SoftwareRenderer::DrawText(const char* text, const Float3& pixel, float size, const Float4& color, bool depthTest)
+{
+	OpenGLText::Vec lines;
+	bool broken = false;
+	Index lineNumber = 0; //for several lines of text
+	Index columnNumber = 0;
+
+	//character lines are given in 2 x 4 box with (0,0) at left bottom, see OpenGLText::DrawString
+	auto characterPoint = [&](Index j)
+	{
+		return Float3({ pixel[0] + size * (0.25f*(float)lines[j * 2] + (float)columnNumber*0.7f),
+			pixel[1] - size * (0.25f*(float)lines[j * 2 + 1] - (float)lineNumber*1.4f), pixel[2] });
+	};
+
+	for (Index i = 0; text[i] != (char)0; i++)
+	{
+		if (text[i] == '\n') { lineNumber++; columnNumber = 0; continue; }
+
+		OpenGLText::GetCharacterLines(text[i], lines, broken);
+		Index nPoints = lines.NumberOfItems() / 2;
+		for (Index j = 0; j + 1 < nPoints; j += (broken ? 2 : 1))
+		{
+			DrawLinePixels(characterPoint(j), characterPoint(j + 1), color, color, superSampling, depthTest);
+		}
+		columnNumber++;
+	}
+}
+
+void SoftwareRenderer::DrawGraphicsData(const GraphicsData& data)
+{
+	const VSettingsOpenGL& gl = visSettings->openGL;
+	Float3 viewNormal({ 0.f, 0.f, 1.f });
+
+	//spheres, drawn as points in case of no faces
+	float d = visSettings->general.pointSize;
+	for (const GLSphere& item : data.glSpheres)
+	{
+		if (!gl.showFaces || item.resolution < 1 || item.radius <= 0.f)
+		{
+			for (Index i = 0; i < 3; i++) //plot point as 3D cross
+			{
+				Float3 direction({ 0.f, 0.f, 0.f });
+				direction[i] = d;
+				DrawLine(EyeCoordinates(item.point + direction), EyeCoordinates(item.point - direction), item.color, item.color);
+			}
+		}
+		else
+		{
+			DrawSphere(EyeCoordinates(item.point), item.radius, item.color);
+		}
+	}
+
+	//triangles
+	if (gl.showFaces || gl.showMeshFaces)
+	{
+		const float transparencyLimit = 0.4f; //use at least this transparency, see GlfwRenderer
+		std::array<Float3, 3> eyePoints;
+		std::array<Float3, 3> eyeNormals;
+		std::array<Float4, 3> colors;
+		for (const GLTriangle& trig : data.glTriangles)
+		{
+			if ((gl.showFaces && !trig.isFiniteElement) || (gl.showMeshFaces && trig.isFiniteElement))
+			{
+				Float3 faceNormal = EXUmath::ComputeTriangleNormal(trig.points[0], trig.points[1], trig.points[2]) * rotation;
+				for (Index i = 0; i < 3; i++)
+				{
+					eyePoints[i] = EyeCoordinates(trig.points[i]);
+					//unused normals are [0,0,0]: use triangle normal instead
+					eyeNormals[i] = (trig.normals[i].GetL2NormSquared() != 0.f) ? trig.normals[i] * rotation : faceNormal;
+					colors[i] = trig.colors[i];
+					if (gl.facesTransparent && colors[i][3] > transparencyLimit) { colors[i][3] = transparencyLimit; }
+				}
+				DrawTriangle(eyePoints, colors, eyeNormals);
+			}
+		}
+	}
+
+	//circles in xy-plane
+	for (const GLCircleXY& item : data.glCirclesXY)
+	{
+		const Float3& p = item.point;
+		float r = item.radius;
+		float nSeg = (float)item.numberOfSegments;
+		if (nSeg == 0.f) { nSeg = (float)visSettings->general.circleTiling; }
+
+		Float3 lastPoint;
+		bool isFirst = true;
+		for (float i = 0; i <= 2.f*EXUstd::pi_f + 1e-5; i += 2.f*EXUstd::pi_f / nSeg)
+		{
+			Float3 point = EyeCoordinates(Float3({ p[0] + r * sin(i), p[1] + r * cos(i), p[2] }));
+			if (!isFirst) { DrawLine(lastPoint, point, item.color, item.color); }
+			isFirst = false;
+			lastPoint = point;
+		}
+	}
+
+	//lines
+	if (gl.showLines)
+	{
+		for (const GLLine& item : data.glLines)
+		{
+			DrawLine(EyeCoordinates(item.point1), EyeCoordinates(item.point2), item.color1, item.color2);
+		}
+	}
+
+	//edges of triangles
+	if (gl.showFaceEdges || gl.showMeshEdges)
+	{
+		for (const GLTriangle& trig : data.glTriangles)
+		{
+			if ((gl.showFaceEdges && !trig.isFiniteElement) || (gl.showMeshEdges && trig.isFiniteElement))
+			{
+				for (Index i = 0; i < 3; i++)
+				{
+					DrawLine(EyeCoordinates(trig.points[i]), EyeCoordinates(trig.points[(i + 1) % 3]), gl.faceEdgesColor, gl.faceEdgesColor);
+				}
+			}
+		}
+	}
+
+	//texts, not rotated with model
+	for (const GLText& t : data.glTexts)
+	{
+		float textSize = (t.size != 0.f) ? t.size : visSettings->general.textSize;
+		textSize *= (float)superSampling;
+
+		Float3 pixel;
+		if (!Project(EyeCoordinates(t.point) + lineDepthOffset * sceneSize * viewNormal, pixel)) { continue; }
+		pixel[0] += t.offsetX * textSize;
+		pixel[1] -= t.offsetY * textSize;
+		DrawText(t.text, pixel, textSize, t.color, !visSettings->general.textAlwaysInFront);
+	}
+}
+
+void SoftwareRenderer::Render(Index imageWidthInit, Index imageHeightInit)
+{
+	imageWidth = imageWidthInit;
+	imageHeight = imageHeightInit;
+	superSampling = (Index)std::round(std::sqrt((float)EXUstd::Maximum(visSettings->openGL.multiSampling, (Index)1)));
+	superSampling = EXUstd::Minimum(EXUstd::Maximum(superSampling, (Index)1), maxSuperSampling);
+
+	width = imageWidth * superSampling;
+	height = imageHeight * superSampling;
+	colorBuffer.SetNumberOfItems(width * height);
+	depthBuffer.SetNumberOfItems(width * height);
+
+	//background, optionally with vertical gradient
+	Float4 top = visSettings->general.backgroundColor;
+	Float4 bottom = visSettings->general.useGradientBackground ? visSettings->general.backgroundColorBottom : top;
+	for (Index y = 0; y < height; y++)
+	{
+		float t = (height > 1) ? (float)y / (float)(height - 1) : 0.f;
+		Float3 color({ (1.f - t) * top[0] + t * bottom[0], (1.f - t) * top[1] + t * bottom[1], (1.f - t) * top[2] + t * bottom[2] });
+		for (Index x = 0; x < width; x++)
+		{
+			colorBuffer[y * width + x] = color;
+			depthBuffer[y * width + x] = FLT_MAX;
+		}
+	}
+
+	SetView();
+	for (auto data : *graphicsDataList)
+	{
+		DrawGraphicsData(*data);
+	}
+
+	//downsampling into 8-bit RGB image
+	image.SetNumberOfItems(3 * imageWidth * imageHeight);
+	float factor = 255.f / (float)(superSampling * superSampling);
+	for (Index y = 0; y < imageHeight; y++)
+	{
+		for (Index x = 0; x < imageWidth; x++)
+		{
+			Float3 sum({ 0.f, 0.f, 0.f });
+			for (Index i = 0; i < superSampling; i++)
+			{
+				for (Index j = 0; j < superSampling; j++)
+				{
+					sum += colorBuffer[(y * superSampling + i) * width + x * superSampling + j];
+				}
+			}
+			for (Index k = 0; k < 3; k++)
+			{
+				image[3 * (y * imageWidth + x) + k] = (unsigned char)EXUstd::Minimum(EXUstd::Maximum(sum[k] * factor + 0.5f, 0.f), 255.f);
+			}
+		}
+	}
+}
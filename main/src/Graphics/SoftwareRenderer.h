@@ -0,0 +1,159 @@
+/** ***********************************************************************************************
+* @class        SoftwareRenderer
+* @brief        CPU software rasterizer for saving images of graphics data without window, OpenGL or graphics card
+* @details		Details:
+*				- renders the same GraphicsData lists as GlfwRenderer (triangles, lines, spheres, circles, texts)
+*				- view (zoom, center point, model rotation, perspective) and lighting follow the OpenGL settings of GlfwRenderer
+*				- runs in a separate thread, which updates graphics data and saves frames requested by RedrawAndSaveImage() or recordImagesInterval,
+*				  while the simulation continues
+*				- texts are drawn with the line font of GlfwClientText; shadows, highlighting and renderer status texts are not drawn
+*
+* @date         2026-10-17 (created)
+*
+* @copyright    This file is part of Exudyn. Exudyn is free software: you can redistribute it and/or modify it under the terms of the Exudyn license. See "LICENSE.txt" for more details.
+* @note         Bug reports, support and further information:
+                - email: johannes.gerstmayr@uibk.ac.at
+                - weblink: https://github.com/jgerstmayr/EXUDYN
+
+************************************************************************************************ */
+#ifndef SOFTWARERENDERER__H
+#define SOFTWARERENDERER__H
+
+#include "Utilities/ReleaseAssert.h"
+#include "Utilities/BasicDefinitions.h"
+
+#include <thread>
+#include <atomic>
+
+#include "Graphics/GraphicsData.h"
+#include "Autogenerated/VisualizationSettings.h"
+#include "Graphics/VisualizationSystemContainerBase.h" //common interface to visualization system
+
+//! renders graphics data into a color and depth buffer and saves it as PNG or TGA image
+class SoftwareRenderer
+{
+public:
+	static constexpr float lineDepthOffset = 2e-3f;	//!< relative to maxSceneSize: lines are moved towards viewer to be drawn on top of faces, as with polygon offset in OpenGL
+	static constexpr float zFactor = 100.f;			//!< same as GlfwRenderer: depth range of orthographic projection in multiples of maxSceneSize
+	static constexpr Index maxSuperSampling = 4;	//!< limit for supersampling factor per direction, computed from openGL.multiSampling
+
+private:
+	ResizableArray<GraphicsData*>* graphicsDataList;		//!< link to graphics data of all visualization systems
+	VisualizationSettings* visSettings;						//!< link to visualization settings
+	VisualizationSystemContainerBase* basicVisualizationSystemContainer; //!< link to container for graphics update and image requests
+	RenderState* state;										//!< link to render state (zoom, center point, rotation, ...)
+
+	std::thread rendererThread;				//!< thread which updates graphics data and saves images
+	std::atomic<std::thread::id> rendererThreadId; //!< id of renderer thread, set by renderer thread itself
+	std::atomic<bool> stopRenderer;			//!< signal that renderer thread shall quit
+	bool rendererActive;					//!< true, if renderer thread has been started
+
+	//render buffers, size width x height (including supersampling), stored row-wise from top to bottom
+	Index width;							//!< width of color and depth buffer in pixels
+	Index height;							//!< height of color and depth buffer in pixels
+	Index superSampling;					//!< number of samples per pixel in each direction
+	ResizableArray<Float3> colorBuffer;		//!< RGB color per pixel, in range 0.f - 1.f
+	ResizableArray<float> depthBuffer;		//!< depth per pixel; smaller values are closer to viewer
+	ResizableArray<unsigned char> image;	//!< RGB image after downsampling, 3 bytes per pixel, stored row-wise from top to bottom
+	Index imageWidth;						//!< width of image in pixels
+	Index imageHeight;						//!< height of image in pixels
+
+	//view transformation and projection, computed in SetView()
+	Matrix3DF rotation;						//!< model rotation; eye coordinates are p*rotation + translation
+	Float3 translation;						//!< translation of model view
+	bool perspective;						//!< true: perspective projection, false: orthographic projection
+	float scaleX;							//!< scaling of eye x-coordinates into pixels; perspective: multiplied with zNear
+	float scaleY;							//!< scaling of eye y-coordinates into pixels; perspective: multiplied with zNear
+	float perspectiveDistance;				//!< perspective: distance of camera from origin of eye coordinates
+	float zNear;							//!< perspective: near clipping distance
+	float sceneSize;						//!< current maxSceneSize, used for depth offsets
+
+public:
+	SoftwareRenderer() : graphicsDataList(nullptr), visSettings(nullptr), basicVisualizationSystemContainer(nullptr), state(nullptr),
+		stopRenderer(false), rendererActive(false), width(0), height(0), superSampling(1), imageWidth(0), imageHeight(0),
+		perspective(false), scaleX(1.f), scaleY(1.f), perspectiveDistance(0.f), zNear(0.f), sceneSize(1.f) {}
+
+	~SoftwareRenderer() { Stop(); }
+
+	//! link graphics data and settings and start renderer thread; returns false if already running
+	bool Start(ResizableArray<GraphicsData*>* graphicsDataListInit, VisualizationSettings* settingsInit,
+		VisualizationSystemContainerBase* basicVisualizationSystemContainerInit, RenderState* renderStateInit);
+
+	//! stop renderer thread after a pending image has been saved; waits until thread has finished
+	void Stop();
+
+	//! true, if renderer thread is running
+	bool IsRunning() const { return rendererActive; }
+
+	//! true, if called from renderer thread; used to decide if Python user functions must be evaluated by main thread
+	bool InRendererThread() const { return rendererActive && std::this_thread::get_id() == rendererThreadId; }
+
+	//! render graphics data into image with given size (in pixels)
+	void Render(Index imageWidth, Index imageHeight);
+
+	//! save last rendered image to file; format is "PNG" or "TGA"; returns false if file could not be written
+	bool SaveImageToFile(const STDstring& filename, const STDstring& format) const;
+
+private:
+	//! loop of renderer thread: update graphics data and save images if requested
+	void RunLoop();
+
+	//! update graphics data, zoom and save image if requested; returns true if image has been saved
+	bool DoRendererTasks();
+
+	//! render and save image with file name and counter given in exportImages settings
+	void SaveImage();
+
+	//! compute scene size and center from graphics data, see GlfwRenderer::ComputeMaxSceneSize
+	void ComputeMaxSceneSize(float& maxSceneSize, Float3& center) const;
+
+	//! compute view transformation and projection from render state and settings
+	void SetView();
+
+	//! transform point into eye coordinates
+	Float3 EyeCoordinates(const Float3& point) const { return point * rotation + translation; }
+
+	//! depth value for z-coordinate in eye coordinates; depth is linear in pixel coordinates and smaller for points closer to viewer
+	float Depth(float zEye) const { return perspective ? 1.f / (zEye - perspectiveDistance) : -zEye; }
+
+	//! transform point from eye coordinates into pixel coordinates (x, y) and depth (z); returns false if point is outside of near or far plane
+	bool Project(const Float3& eye, Float3& pixel) const;
+
+	//! compute lit color at vertex with normal, both given in eye coordinates
+	Float4 ComputeLighting(const Float4& color, const Float3& eye, const Float3& normal) const;
+
+	//! blend color into pixel with index; performs depth test if depthTest=true
+	void SetPixel(Index index, float depth, const Float4& color, bool depthTest = true)
+	{
+		if (depthTest)
+		{
+			if (depth > depthBuffer[index]) { return; }
+			depthBuffer[index] = depth;
+		}
+		Float3& c = colorBuffer[index];
+		float a = color[3];
+		c[0] = a * color[0] + (1.f - a) * c[0];
+		c[1] = a * color[1] + (1.f - a) * c[1];
+		c[2] = a * color[2] + (1.f - a) * c[2];
+	}
+
+	//! draw triangle with points, colors and normals in eye coordinates
+	void DrawTriangle(const std::array<Float3, 3>& eyePoints, const std::array<Float4, 3>& colors, const std::array<Float3, 3>& eyeNormals);
+
+	//! draw line between points in eye coordinates with linearly interpolated color
+	void DrawLine(const Float3& eye1, const Float3& eye2, const Float4& color1, const Float4& color2);
+
+	//! draw line between points in pixel coordinates and depth with linearly interpolated color and given width in pixels
+	void DrawLinePixels(const Float3& pixel1, const Float3& pixel2, const Float4& color1, const Float4& color2, Index lineWidth, bool depthTest = true);
+
+	//! draw sphere as shaded disc, center given in eye coordinates
+	void DrawSphere(const Float3& eyeCenter, float radius, const Float4& color);
+
+	//! draw 0-terminated text with line font at pixel position and depth
+	void DrawText(const char* text, const Float3& pixel, float size, const Float4& color, bool depthTest);
+
+	//! draw all items of one GraphicsData
+	void DrawGraphicsData(const GraphicsData& data);
+};
+
+#endif //include once
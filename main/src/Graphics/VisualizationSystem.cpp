@@ -21,11 +21,13 @@
 //#include "Graphics/GraphicsData.h"				//included in VisualizationSystem.h
 //#include "Graphics/VisualizationSystem.h"
 #include "Graphics/VisualizationSystemContainer.h"  //includes everything needed
+#include "Graphics/VisualizationPrimitives.h"		//EXUvis::AddBodyGraphicsData
 
 #include "Main/MainSystemData.h"	//for backlink to main system
 #include "Main/MainSystem.h"		//for backlink to main system
 
 #include <thread>
+#include <exception>
 
 #include "Main/rendererPythonInterface.h" //in order to link to graphics engine
 
@@ -39,6 +41,9 @@ void VisualizationSystem::Reset()
 	graphicsData.GetVisualizationCounter() = 0;
 	graphicsData.FlushData();
 	graphicsData.GetUpdateGraphicsDataNow() = false;
+	cachedGraphicsData.FlushData();
+	cachedBodies.Flush();
+	cachedBodiesCounter = 0;
 
 	EXUstd::WaitAndLockSemaphore(postProcessData->requestUserFunctionDrawingAtomicFlag);
 	postProcessData->requestUserFunctionDrawing = false;
@@ -82,6 +87,82 @@ void VisualizationSystem::StopSimulation()
 
 bool visualizationSystemUpdateGraphicsDataTimeoutWarned = false;
 
+//! append all items of source to destination and leave source empty; texts are moved, not copied
+void MoveGraphicsDataItems(GraphicsData& source, GraphicsData& destination)
+{
+	destination.glLines.AppendArray(source.glLines);
+	destination.glSpheres.AppendArray(source.glSpheres);
+	destination.glCirclesXY.AppendArray(source.glCirclesXY);
+	destination.glTexts.AppendArray(source.glTexts); //text pointers are now owned by destination
+	destination.glTriangles.AppendArray(source.glTriangles);
+
+	source.glLines.SetNumberOfItems(0);
+	source.glSpheres.SetNumberOfItems(0);
+	source.glCirclesXY.SetNumberOfItems(0);
+	source.glTexts.SetNumberOfItems(0); //no FlushData(), which would delete texts
+	source.glTriangles.SetNumberOfItems(0);
+}
+
+//! call UpdateGraphics(...) of all items for which drawItem(item) returns true; for numberOfThreads > 1, contiguous ranges of items
+//! are drawn in parallel into graphicsData of threadVisualizationSystems, which is appended to graphicsData in the order of items
+template<class TItem, class TFunction>
+void VisualizationSystem::UpdateItemsGraphics(const ResizableArray<TItem*>& items, TFunction drawItem, const VisualizationSettings& visualizationSettings, Index numberOfThreads)
+{
+	Index n = items.NumberOfItems();
+	numberOfThreads = EXUstd::Minimum(numberOfThreads, n);
+
+	auto drawRange = [&items, &drawItem, &visualizationSettings](VisualizationSystem* vSystem, Index begin, Index end)
+	{
+		for (Index i = begin; i < end; i++) //i is itemNumber, synchronized with item!!!
+		{
+			if (drawItem(items[i])) { items[i]->UpdateGraphics(visualizationSettings, vSystem, i); }
+		}
+	};
+
+	if (numberOfThreads <= 1)
+	{
+		drawRange(this, 0, n);
+		return;
+	}
+
+	while (threadVisualizationSystems.NumberOfItems() < numberOfThreads - 1)
+	{
+		threadVisualizationSystems.Append(new VisualizationSystem());
+	}
+
+	//thread k draws items in range k into graphicsData of threadVisualizationSystems[k-1]; thread 0 is current thread
+	std::vector<std::thread> threads;
+	std::vector<std::exception_ptr> exceptions(numberOfThreads);
+	for (Index k = 1; k < numberOfThreads; k++)
+	{
+		VisualizationSystem* vSystem = threadVisualizationSystems[k - 1];
+		vSystem->systemData = systemData;
+		vSystem->postProcessData = postProcessData; //do not use LinkPostProcessData, which would change backlink
+		vSystem->LinkToMainSystem(mainSystemUF);
+
+		Index begin = (Index)(((int64_t)n * k) / numberOfThreads);
+		Index end = (Index)(((int64_t)n * (k + 1)) / numberOfThreads);
+		threads.emplace_back([&drawRange, &exceptions, vSystem, begin, end, k]()
+		{
+			try { drawRange(vSystem, begin, end); }
+			catch (...) { exceptions[k] = std::current_exception(); }
+		});
+	}
+	try { drawRange(this, 0, (Index)((int64_t)n / numberOfThreads)); }
+	catch (...) { exceptions[0] = std::current_exception(); }
+
+	for (std::thread& thread : threads) { thread.join(); }
+
+	for (Index k = 1; k < numberOfThreads; k++)
+	{
+		MoveGraphicsDataItems(threadVisualizationSystems[k - 1]->graphicsData, graphicsData);
+	}
+	for (const std::exception_ptr& exception : exceptions)
+	{
+		if (exception) { std::rethrow_exception(exception); }
+	}
+}
+
 //! OpenGL renderer calls UpdateGraphicsData (different thread) to update graphics data
 // ==> do not call Python functions from here!
 void VisualizationSystem::UpdateGraphicsData(VisualizationSystemContainer& visualizationSystemContainer)
@@ -102,6 +183,7 @@ void VisualizationSystem::UpdateGraphicsData(VisualizationSystemContainer& visua
 	{
 		visualizationSystemContainer.SetComputeMaxSceneRequest(true);
 		SetSystemHasChanged(false);
+		cachedBodyGraphicsInvalid = true;
 	}
 
 	EXUstd::ReleaseSemaphore(postProcessData->accessState); //now visualizationStateUpdate can be written again in main thread
@@ -127,6 +209,16 @@ void VisualizationSystem::UpdateGraphicsData(VisualizationSystemContainer& visua
 		//put this after FlushData():
 		graphicsData.LockData(); //avoid that data is cleared by computation/Python thread (should never happen, because updateGraphicsData is called usually from Render thread ...)
 
+		//rigid body graphics are kept in cachedGraphicsData and only transformed, as long as bodies and settings do not change
+		useCachedBodyGraphics = visualizationSystemContainer.GetVisualizationSettings().bodies.cacheRigidBodyGraphics;
+		cachedGraphicsData.LockData();
+		if (!useCachedBodyGraphics || cachedBodyGraphicsInvalid || visualizationSystemContainer.UpdateGraphicsDataNowInternal())
+		{
+			TruncateCachedBodies(0);
+			cachedBodyGraphicsInvalid = false;
+		}
+		cachedBodiesCounter = 0;
+
 		Index cnt;
 
 		//++++++++++++++++++++++++++++++++++++++++++++++
@@ -142,7 +234,7 @@ void VisualizationSystem::UpdateGraphicsData(VisualizationSystemContainer& visua
 		}
 		if (systemHasUserFunction)
 		{
-			if (!RendererIsSingleThreadedOrNotRunning())
+			if (!RendererIsSingleThreadedOrNotRunning() || visualizationSystemContainer.InSoftwareRendererThread())
 			{
 				EXUstd::WaitAndLockSemaphore(postProcessData->requestUserFunctionDrawingAtomicFlag);
 				postProcessData->requestUserFunctionDrawing = true;
@@ -178,6 +270,15 @@ void VisualizationSystem::UpdateGraphicsData(VisualizationSystemContainer& visua
 
 		postProcessData->visualizationTime = systemData->GetCData().GetVisualization().GetTime(); //update time, synchronized with the state shown 
 
+		//multithreaded drawing of items; objects with Python user functions (graphics or computation) must be drawn in one thread
+		Index numberOfThreads = visualizationSystemContainer.settings.general.graphicsUpdateThreads;
+		Index numberOfThreadsObjects = numberOfThreads;
+		if (systemHasUserFunction) { numberOfThreadsObjects = 1; }
+		for (const CObject* cObject : systemData->GetCObjects())
+		{
+			if (cObject->HasUserFunction() && !cObject->HasThreadSafeUserFunction()) { numberOfThreadsObjects = 1; break; }
+		}
+
 		//++++++++++++++++++++++++++++++++++++++++++++++
 		//visualize contact:
 		//if (visualizationSystemContainer.settings.contact.showSearchTree)
@@ -194,12 +295,8 @@ void VisualizationSystem::UpdateGraphicsData(VisualizationSystemContainer& visua
 		//pout << "UpdateGraphicsData nodes1\n";
 		if (visualizationSystemContainer.settings.nodes.show)
 		{
-			cnt = 0;
-			for (auto item : vSystemData.GetVisualizationNodes())
-			{
-				if (item->GetShow()) { item->UpdateGraphics(visualizationSystemContainer.GetVisualizationSettings(), this, cnt); }
-				cnt++; //synchronize itemNumber with item!!!
-			}
+			UpdateItemsGraphics(vSystemData.GetVisualizationNodes(), [](VisualizationNode* item) { return item->GetShow(); },
+				visualizationSystemContainer.GetVisualizationSettings(), numberOfThreads);
 		}
 		//pout << "UpdateGraphicsData nodes2\n";
 
@@ -207,27 +304,17 @@ void VisualizationSystem::UpdateGraphicsData(VisualizationSystemContainer& visua
 		//visualize connectors: (draw connectors before objects, to make coordinate systems visible inside of bodies
 		if (visualizationSystemContainer.settings.connectors.show)
 		{
-			cnt = 0;
-			for (auto item : vSystemData.GetVisualizationObjects())
-			{
-				if (item->GetShow() && item->IsConnector()) { item->UpdateGraphics(visualizationSystemContainer.GetVisualizationSettings(), this, cnt); }
-				cnt++; //synchronize itemNumber with item!!!
-			}
+			UpdateItemsGraphics(vSystemData.GetVisualizationObjects(), [](VisualizationObject* item) { return item->GetShow() && item->IsConnector(); },
+				visualizationSystemContainer.GetVisualizationSettings(), numberOfThreadsObjects);
 		}
 
 		//++++++++++++++++++++++++++++++++++++++++++++++
 		//visualize objects:
 		if (visualizationSystemContainer.settings.bodies.show)
 		{
-			cnt = 0;
-			for (auto item : vSystemData.GetVisualizationObjects())
-			{
-				if (item->GetShow() && !(item->IsConnector()))
-				{
-					item->UpdateGraphics(visualizationSystemContainer.GetVisualizationSettings(), this, cnt);
-				}
-				cnt++; //synchronize itemNumber with item!!!
-			}
+			//cached rigid body graphics are only processed in current thread
+			UpdateItemsGraphics(vSystemData.GetVisualizationObjects(), [](VisualizationObject* item) { return item->GetShow() && !(item->IsConnector()); },
+				visualizationSystemContainer.GetVisualizationSettings(), useCachedBodyGraphics ? 1 : numberOfThreadsObjects);
 		}
 
 		//++++++++++++++++++++++++++++++++++++++++++++++
@@ -345,12 +432,8 @@ void VisualizationSystem::UpdateGraphicsData(VisualizationSystemContainer& visua
 		//visualize markers:
 		if (visualizationSystemContainer.settings.markers.show)
 		{
-			cnt = 0;
-			for (auto item : vSystemData.GetVisualizationMarkers())
-			{
-				if (item->GetShow()) { item->UpdateGraphics(visualizationSystemContainer.GetVisualizationSettings(), this, cnt); }
-				cnt++; //synchronize itemNumber with item!!!
-			}
+			UpdateItemsGraphics(vSystemData.GetVisualizationMarkers(), [](VisualizationMarker* item) { return item->GetShow(); },
+				visualizationSystemContainer.GetVisualizationSettings(), numberOfThreads);
 		}
 
 		//++++++++++++++++++++++++++++++++++++++++++++++
@@ -380,14 +463,12 @@ void VisualizationSystem::UpdateGraphicsData(VisualizationSystemContainer& visua
 		//visualize sensors:
 		if (visualizationSystemContainer.settings.sensors.show)
 		{
-			cnt = 0;
-			for (auto item : vSystemData.GetVisualizationSensors())
-			{
-				if (item->GetShow()) { item->UpdateGraphics(visualizationSystemContainer.GetVisualizationSettings(), this, cnt); }
-				cnt++; //synchronize itemNumber with item!!!
-			}
+			UpdateItemsGraphics(vSystemData.GetVisualizationSensors(), [](VisualizationSensor* item) { return item->GetShow(); },
+				visualizationSystemContainer.GetVisualizationSettings(), numberOfThreads);
 		}
 
+		TruncateCachedBodies(cachedBodiesCounter); //bodies which have not been drawn in this update
+		cachedGraphicsData.ClearLock();
 		graphicsData.ClearLock();
 	}
 	}
@@ -398,6 +479,8 @@ void VisualizationSystem::UpdateGraphicsData(VisualizationSystemContainer& visua
 		//works from visualization thread:
 		outputBuffer.WriteVisualization(STDstring("Exception in VisualizationSystem::UpdateGraphicsData(...):\n  ") + e.what() + "\n");
 		//CHECKandTHROWstring(""); //not necessary, would lead to immediately closing of renderer
+		cachedBodyGraphicsInvalid = true;
+		cachedGraphicsData.ClearLock();
 		graphicsData.ClearLock(); //MUST BE called before FlushData!!!
 		//graphicsData.FlushData(); //otherwise is in an undefined state
 		//outputBuffer.WriteVisualization("test2");
@@ -405,11 +488,138 @@ void VisualizationSystem::UpdateGraphicsData(VisualizationSystemContainer& visua
 	catch (...)
 	{
 		outputBuffer.WriteVisualization(STDstring("********************\n")+"unknown exception in VisualizationSystem::UpdateGraphicsData(...)\n********************\n");
+		cachedGraphicsData.ClearLock();
+		cachedGraphicsData.FlushData();
+		cachedBodies.SetNumberOfItems(0);
 		graphicsData.ClearLock(); //MUST BE called before FlushData!!!
 		graphicsData.FlushData(); //otherwise is in an undefined state
 	}
 }
 
+//! rotate vector v with row-major rotation matrix A; same summation order as in Matrix3DF*Float3, but without checks
+inline void RotateFloat3(const float* A, const Float3& v, Float3& result)
+{
+	result[0] = A[0] * v[0] + A[1] * v[1] + A[2] * v[2];
+	result[1] = A[3] * v[0] + A[4] * v[1] + A[5] * v[2];
+	result[2] = A[6] * v[0] + A[7] * v[1] + A[8] * v[2];
+}
+
+//! transform local point p into global point with rotation matrix A and position; same result as EXUmath::RigidBodyTransformation
+inline void TransformFloat3(const float* A, const Float3& position, const Float3& p, Float3& result)
+{
+	RotateFloat3(A, p, result);
+	result += position;
+}
+
+//! add graphics of rigid body (given in local coordinates) with position and rotation; 
+//! if cached body graphics are used, items are copied only in the first update and afterwards only transformed
+void VisualizationSystem::AddRigidBodyGraphicsData(const BodyGraphicsData& bodyGraphicsData, const Float3& position, const Matrix3DF& rotation, Index itemID)
+{
+	//texts need to be copied in every update; bodies with texts are therefore not cached
+	if (!useCachedBodyGraphics || bodyGraphicsData.glTexts.NumberOfItems() != 0)
+	{
+		EXUvis::AddBodyGraphicsData(bodyGraphicsData, graphicsData, position, rotation, itemID);
+		return;
+	}
+
+	Index n = cachedBodiesCounter++;
+	bool isNewBody = false;
+	if (n >= cachedBodies.NumberOfItems() || cachedBodies[n].bodyGraphicsData != &bodyGraphicsData || cachedBodies[n].itemID != itemID
+		|| cachedBodies[n].numberOfLines != bodyGraphicsData.glLines.NumberOfItems()
+		|| cachedBodies[n].numberOfCircles != bodyGraphicsData.glCirclesXY.NumberOfItems()
+		|| cachedBodies[n].numberOfTriangles != bodyGraphicsData.glTriangles.NumberOfItems())
+	{
+		//new or changed body: remove this and all following bodies from cache and copy items
+		TruncateCachedBodies(n);
+		CachedBodyGraphics body;
+		body.bodyGraphicsData = &bodyGraphicsData;
+		body.itemID = itemID;
+		body.lineStart = cachedGraphicsData.glLines.NumberOfItems();
+		body.circleStart = cachedGraphicsData.glCirclesXY.NumberOfItems();
+		body.triangleStart = cachedGraphicsData.glTriangles.NumberOfItems();
+		body.numberOfLines = bodyGraphicsData.glLines.NumberOfItems();
+		body.numberOfCircles = bodyGraphicsData.glCirclesXY.NumberOfItems();
+		body.numberOfTriangles = bodyGraphicsData.glTriangles.NumberOfItems();
+		cachedBodies.Append(body);
+		isNewBody = true;
+
+		for (GLLine item : bodyGraphicsData.glLines) { item.itemID = itemID; cachedGraphicsData.glLines.Append(item); }
+		for (GLCircleXY item : bodyGraphicsData.glCirclesXY) { item.itemID = itemID; cachedGraphicsData.glCirclesXY.Append(item); }
+		for (GLTriangle item : bodyGraphicsData.glTriangles) { item.itemID = itemID; cachedGraphicsData.glTriangles.Append(item); }
+	}
+
+	//only update positions and normals; same operations as in EXUvis::AddBodyGraphicsData
+	CachedBodyGraphics& body = cachedBodies[n];
+	if (!isNewBody && body.position == position && body.rotation == rotation) { return; } //e.g. ground or bodies at rest
+	body.position = position;
+	body.rotation = rotation;
+
+	bool applyRotation = true;
+	if (rotation(0, 0) == 1.f && rotation(1, 1) == 1.f && rotation(2, 2) == 1.f) { applyRotation = false; }
+	const float* A = rotation.GetDataPointer();
+
+	for (Index j = 0; j < body.numberOfLines; j++)
+	{
+		const GLLine& local = bodyGraphicsData.glLines[j];
+		GLLine& item = cachedGraphicsData.glLines[body.lineStart + j];
+		if (applyRotation)
+		{
+			TransformFloat3(A, position, local.point1, item.point1);
+			TransformFloat3(A, position, local.point2, item.point2);
+		}
+		else
+		{
+			item.point1 = local.point1 + position;
+			item.point2 = local.point2 + position;
+		}
+	}
+
+	for (Index j = 0; j < body.numberOfCircles; j++)
+	{
+		const GLCircleXY& local = bodyGraphicsData.glCirclesXY[j];
+		GLCircleXY& item = cachedGraphicsData.glCirclesXY[body.circleStart + j];
+		if (applyRotation)
+		{
+			TransformFloat3(A, position, local.point, item.point);
+		}
+		else
+		{
+			item.point = local.point + position;
+		}
+	}
+
+	for (Index j = 0; j < body.numberOfTriangles; j++)
+	{
+		const GLTriangle& local = bodyGraphicsData.glTriangles[j];
+		GLTriangle& item = cachedGraphicsData.glTriangles[body.triangleStart + j];
+		for (Index i = 0; i < 3; i++)
+		{
+			if (applyRotation)
+			{
+				TransformFloat3(A, position, local.points[i], item.points[i]);
+				RotateFloat3(A, local.normals[i], item.normals[i]);
+			}
+			else
+			{
+				item.points[i] = local.points[i] + position;
+				item.normals[i] = local.normals[i];
+			}
+		}
+	}
+}
+
+//! remove cached rigid bodies with index >= numberOfBodies and their items in cachedGraphicsData
+void VisualizationSystem::TruncateCachedBodies(Index numberOfBodies)
+{
+	if (numberOfBodies >= cachedBodies.NumberOfItems()) { return; }
+
+	const CachedBodyGraphics& body = cachedBodies[numberOfBodies];
+	cachedGraphicsData.glLines.SetNumberOfItems(body.lineStart);
+	cachedGraphicsData.glCirclesXY.SetNumberOfItems(body.circleStart);
+	cachedGraphicsData.glTriangles.SetNumberOfItems(body.triangleStart);
+	cachedBodies.SetNumberOfItems(numberOfBodies);
+}
+
 //! any multi-line text message from computation to be shown in renderer (e.g. time, solver, ...)
 std::string VisualizationSystem::GetComputationMessage(bool solverInformation, bool solutionInformation, bool solverTime)
 {
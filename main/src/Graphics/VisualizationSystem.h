@@ -24,6 +24,23 @@
 //class CSystem;
 class VisualizationSystemContainer; //for UpdateGraphics(...) function
 class MainSystem; //for backlink
+class BodyGraphicsData; //for cached rigid body graphics
+
+//! range of items in VisualizationSystem::cachedGraphicsData belonging to one rigid body; items are copied once and afterwards only transformed
+class CachedBodyGraphics
+{
+public:
+	const BodyGraphicsData* bodyGraphicsData;	//!< body graphics in local coordinates, from which the items have been copied
+	Index itemID;								//!< itemID of body
+	Index lineStart;							//!< first line in cachedGraphicsData.glLines
+	Index circleStart;							//!< first circle in cachedGraphicsData.glCirclesXY
+	Index triangleStart;						//!< first triangle in cachedGraphicsData.glTriangles
+	Index numberOfLines;
+	Index numberOfCircles;
+	Index numberOfTriangles;
+	Float3 position;							//!< position of last update; items are only transformed if position or rotation changed
+	Matrix3DF rotation;							//!< rotation of last update
+};
 
 class VisualizationSystem //: public VisualizationSystemBase
 {
@@ -33,6 +50,12 @@ public: //declared as public for direct access via pybind
 	PostProcessData* postProcessData;	//!< link to postProcessData of CSystem ==> communication between the two threads
 	CSystemData* systemData;			//!< REMOVE: link to CSystemData; this is a temporary access, before visualization objects are introduced
 
+	GraphicsData cachedGraphicsData;	//!< graphics data of rigid bodies, which is kept between updates if visualizationSettings.bodies.cacheRigidBodyGraphics is True
+	ResizableArray<CachedBodyGraphics> cachedBodies; //!< ranges in cachedGraphicsData per rigid body, in the order of drawing
+	Index cachedBodiesCounter;			//!< number of rigid bodies drawn in current update
+	bool useCachedBodyGraphics;			//!< true, if cachedGraphicsData is used in current update
+	bool cachedBodyGraphicsInvalid;		//!< set, if body graphics may have changed (e.g. by SetObjectParameter), such that cachedGraphicsData is rebuilt in next update
+
 	const float contourPlotFlag = -2.f;	//!< this is the value of transparency used to identify contour plot values in GraphicsData items
 	//static constexpr float contourPlotFlag = -2.f;	//!< needs C++17 and is therefore avoided ...
 	Vector tempVector;					//!< temporary vector e.g. during drawing for GetOutputVariable
@@ -42,9 +65,14 @@ private:
 	MainSystem* mainSystemUF;						//!< REMOVE: this is a temporary access to mainSystem for user functions
 	bool renderingActive;				//!< flag, which indicates that this system shall be drawn (true) or hidden (false)
 	//accessible through mainSytemUF: VisualizationSettings* visualizationSettingsUF; //!< REMOVE: set when setting postProcessData->requestUserFunctionDrawing; this is a temporary access to visualizationSettings for user functions
+	ResizableArray<VisualizationSystem*> threadVisualizationSystems; //!< systems with own graphicsData for threads 1, 2, ... of multithreaded graphics update; linked to same system data
 
 public:
-	virtual ~VisualizationSystem() {}	//added for correct deletion of derived classes
+	VisualizationSystem() : cachedBodiesCounter(0), useCachedBodyGraphics(false), cachedBodyGraphicsInvalid(false) {}
+	virtual ~VisualizationSystem()	//added for correct deletion of derived classes
+	{
+		for (VisualizationSystem* item : threadVisualizationSystems) { delete item; }
+	}
 
 	//! systemHasChanged is used to signal GLFWclient to compute new maxSceneSize and center
 	void SetSystemHasChanged(bool flag) { postProcessData->systemHasChanged = flag; }
@@ -53,6 +81,12 @@ public:
 	GraphicsData& GetGraphicsData() { return graphicsData; }
 	const GraphicsData& GetGraphicsData() const { return graphicsData; }
 
+	GraphicsData& GetCachedGraphicsData() { return cachedGraphicsData; }
+	const GraphicsData& GetCachedGraphicsData() const { return cachedGraphicsData; }
+
+	//! signal that body graphics may have changed without changing the system, e.g. if graphicsData of an object is modified
+	void InvalidateCachedBodyGraphics() { cachedBodyGraphicsInvalid = true; }
+
 	VisualizationSystemData& GetVisualizationSystemData() { return vSystemData; }
 	const VisualizationSystemData& GetVisualizationSystemData() const { return vSystemData; }
 
@@ -90,6 +124,19 @@ public:
 	//! OpenGL renderer calls UpdateGraphicsData (different thread) to update graphics data; update is only done, if current state has higher counter than already existing state
 	virtual void UpdateGraphicsData(VisualizationSystemContainer& visualizationSystemContainer);
 
+	//! add graphics of rigid body (given in local coordinates) with position and rotation; 
+	//! if cached body graphics are used, items are copied only in the first update and afterwards only transformed
+	//! bodyGraphicsData must exist until the system is changed (e.g., a member of the visualization object)
+	void AddRigidBodyGraphicsData(const BodyGraphicsData& bodyGraphicsData, const Float3& position, const Matrix3DF& rotation, Index itemID);
+
+	//! remove cached rigid bodies with index >= numberOfBodies and their items in cachedGraphicsData
+	void TruncateCachedBodies(Index numberOfBodies);
+
+	//! call UpdateGraphics(...) of all items for which drawItem(item) returns true; for numberOfThreads > 1, contiguous ranges of items
+	//! are drawn in parallel into graphicsData of threadVisualizationSystems, which is appended to graphicsData in the order of items
+	template<class TItem, class TFunction>
+	void UpdateItemsGraphics(const ResizableArray<TItem*>& items, TFunction drawItem, const VisualizationSettings& visualizationSettings, Index numberOfThreads);
+
 	//! Renderer reports to CSystem that simulation shall be interrupted
 	virtual void StopSimulation();		
 
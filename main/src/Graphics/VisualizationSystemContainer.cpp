@@ -102,6 +102,7 @@ void VisualizationSystemContainer::RedrawAndSaveImage()
 	saveImage = true;			//flag initiates saveImageOpenGL at next UpdateGraphicsData() called from Renderer
 	saveImageOpenGL = false;	//after graphics update, the scene is saved and flags (saveImage, saveImageOpenGL) are set to false
 	UpdateGraphicsDataNow();	//if a current redraw is performed, it will also initiate a second redraw operation ...
+	bool useSoftwareRenderer = UseSoftwareRenderer(); //renders in separate thread, if no OpenGL renderer is running
 
 	Index timeOut = 500; //max iterations to wait, before frame is redrawn and saved
 	Index timerMilliseconds = settings.exportImages.saveImageTimeOut / timeOut;
@@ -122,8 +123,11 @@ void VisualizationSystemContainer::RedrawAndSaveImage()
 	while (i++ < timeOut && (saveImageOpenGL || saveImage)) //wait timeOut*timerMilliseconds seconds for last operation to finish
 	{
 		std::this_thread::sleep_for(std::chrono::milliseconds(timerMilliseconds));
+		bool processUserFunctions = useSoftwareRenderer; //user functions of software renderer are evaluated in this thread
 #ifdef USE_GLFW_GRAPHICS
-		if (glfwRenderer.UseMultiThreadedRendering()) //otherwise, user functions are anyway processed
+		if (glfwRenderer.UseMultiThreadedRendering()) { processUserFunctions = true; } //otherwise, user functions are anyway processed
+#endif
+		if (processUserFunctions)
 		{
 			//Needed ?: PyProcessExecuteQueue(); //use time to execute incoming python tasks
 			//process user functions
@@ -132,7 +136,6 @@ void VisualizationSystemContainer::RedrawAndSaveImage()
 				item->postProcessData->ProcessUserFunctionDrawing(); //check if user functions to be drawn and do user function evaluations
 			}
 		}
-#endif
 	}
 	if (saveImageOpenGL || saveImage)
 	{
@@ -215,6 +218,16 @@ bool VisualizationSystemContainer::RendererIsRunning() const
 #endif
 }
 
+bool VisualizationSystemContainer::UseSoftwareRenderer()
+{
+	if (!settings.exportImages.useSoftwareRenderer || RendererIsRunning()) { return false; }
+
+	if (!softwareRenderer.IsRunning())
+	{
+		softwareRenderer.Start(&graphicsDataList, &settings, this, &renderState);
+	}
+	return true;
+}
 
 //! this function does any idle operations (execute some python commands) and returns false if stop flag in the render engine, otherwise true;
 bool VisualizationSystemContainer::DoIdleOperations()
@@ -357,7 +370,7 @@ bool VisualizationSystemContainer::GetSensorsPositionsVectorsLists(Index mbsNumb
             const CSensor& sensor = *cSystem.GetSystemData().GetCSensors()[positionSensorIndex];
             if (EXUstd::IsOfType(sensor.GetOutputVariableType(), OutputVariableType::Position))
             {
-                const ResizableMatrix& data = sensor.GetInternalStorage();
+                const SensorStorageView data = sensor.GetInternalStorage(); //snapshot, as solver may append rows
                 if (data.NumberOfRows() > 0 and data.NumberOfColumns() == 4) //must be position compatible data
                 {
                     for (Index i = 0; i < data.NumberOfRows(); i++)
@@ -375,7 +388,7 @@ bool VisualizationSystemContainer::GetSensorsPositionsVectorsLists(Index mbsNumb
                 if (traces.showVectors && vectorSensorIndex >= 0 && vectorSensorIndex < cSystem.GetSystemData().GetCSensors().NumberOfItems())
                 {
                     const CSensor& vectorSensor = *cSystem.GetSystemData().GetCSensors()[vectorSensorIndex];
-                    const ResizableMatrix& data = vectorSensor.GetInternalStorage();
+                    const SensorStorageView data = vectorSensor.GetInternalStorage(); //snapshot, as solver may append rows
                     if (data.NumberOfRows() > 0 && data.NumberOfColumns() == 4) //must be Vector3D data
                     {
                         for (Index i = 0; i < data.NumberOfRows(); i++)
@@ -406,7 +419,7 @@ bool VisualizationSystemContainer::GetSensorsPositionsVectorsLists(Index mbsNumb
                 {
                     //std::cout << "A," << GetOutputVariableTypeString(triadSensor.GetOutputVariableType()) << ";\n";
                     const CSensor& triadSensor = *cSystem.GetSystemData().GetCSensors()[triadSensorIndex];
-                    const ResizableMatrix& data = triadSensor.GetInternalStorage();
+                    const SensorStorageView data = triadSensor.GetInternalStorage(); //snapshot, as solver may append rows
                     if (data.NumberOfRows() > 0 && data.NumberOfColumns() == 10 &&
                         EXUstd::IsOfType(triadSensor.GetOutputVariableType(), OutputVariableType::RotationMatrix)) //must be Matrix3D data
                     {
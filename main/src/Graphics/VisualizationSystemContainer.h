@@ -27,6 +27,7 @@
 #include "Graphics/VisualizationSystemContainerBase.h"
 #include "Graphics/VisualizationSystemData.h"
 #include "Graphics/VisualizationSystem.h"
+#include "Graphics/SoftwareRenderer.h"
 
 
 //MOVE to separate .h / .cpp file:
@@ -125,6 +126,7 @@ public: //declared as public for direct access via pybind
 private:
 	bool stopSimulationFlagSC;			//! used to wait for user to terminate simulation or render engine
 	bool updateGraphicsDataNowInternal; //! internal signal to update the graphics data; reset to false after redraw 
+	SoftwareRenderer softwareRenderer;	//!< renders and saves images in separate thread, if exportImages.useSoftwareRenderer and no OpenGL renderer is running
 
 public:
 	VisualizationSystemContainer()
@@ -152,8 +154,10 @@ public:
 	//SYSTEM FUNCTIONS
 	void Append(VisualizationSystem* vSystem) 
 	{
+		softwareRenderer.Stop(); //graphicsDataList changes; software renderer is restarted with next image request
 		visualizationSystems.Append(vSystem);
 		graphicsDataList.Append(&vSystem->GetGraphicsData());
+		graphicsDataList.Append(&vSystem->GetCachedGraphicsData());
 	}
 
 	//void LinkToSystemData(CSystemData* systemDataInit);
@@ -172,6 +176,18 @@ public:
 	//! check GLFW if renderer is running
 	bool RendererIsRunning() const;
 
+	//! return true, if images are saved by software renderer (exportImages.useSoftwareRenderer and no OpenGL renderer running); starts software renderer if needed
+	bool UseSoftwareRenderer();
+
+	//! stop software renderer thread, e.g., before systems are changed; it is restarted with next image request
+	void StopSoftwareRenderer() { softwareRenderer.Stop(); }
+
+	//! true, if software renderer thread is running
+	bool SoftwareRendererIsRunning() const { return softwareRenderer.IsRunning(); }
+
+	//! true, if called from software renderer thread
+	bool InSoftwareRendererThread() const { return softwareRenderer.InRendererThread(); }
+
 	//! reset all visualization functions for new system (but keep render engine linked)
 	void Reset()
 	{
@@ -180,6 +196,7 @@ public:
 		//after MainSystem has been deleted, this pointer is invalid and item->Reset() fails
 		//VisualizationSystem.Reset() must be done in MainSystem, because needed when calling mbs.Reset() in Python!
 
+		softwareRenderer.Stop(); //must be stopped before graphics data is deleted
 		visualizationSystems.Flush();
 		graphicsDataList.Flush();
 
@@ -0,0 +1,225 @@
+/** ***********************************************************************************************
+* @class	    BoundingVolumeHierarchy
+* @brief		Bounding volume hierarchy (binary tree of axis aligned boxes) for static sets of items
+* @details		Details:
+*               - built once for a set of bounding boxes, e.g., triangles of a mesh in body coordinates
+*               - nodes are split at the median of box centers along the longest axis, giving a balanced tree
+*               - queries return all items whose boxes intersect with a given box, with cost O(log(n)) for small boxes
+*
+* @date			2026-10-17 (created)
+* @pre			...
+*
+* @copyright    This file is part of Exudyn. Exudyn is free software: you can redistribute it and/or modify it under the terms of the Exudyn license. See 'LICENSE.txt' for more details.
+* @note			Bug reports, support and further information:
+* 				- email: johannes.gerstmayr@uibk.ac.at
+* 				- weblink: https://github.com/jgerstmayr/EXUDYN
+*
+*
+* *** Example code ***
+*
+************************************************************************************************ */
+#ifndef BOUNDINGVOLUMEHIERARCHY__H
+#define BOUNDINGVOLUMEHIERARCHY__H
+
+#include "Linalg/SearchTree.h"		//Box3D
+#include <algorithm>
+#include <vector>
+
+//! node of BoundingVolumeHierarchy; leaf nodes have numberOfItems > 0, other nodes have children leftChild and leftChild+1
+//! not trivially copyable (Box3D), therefore stored in std::vector instead of ResizableArray
+class BVHNode
+{
+public:
+	Box3D box;				//!< box containing all items of node
+	Index leftChild;		//!< index of left child node; right child is leftChild+1
+	Index firstItem;		//!< leaf: first index in items
+	Index numberOfItems;	//!< leaf: number of items; 0 for inner nodes
+};
+
+//! binary tree of boxes; items are identified by their index in the list of boxes given in Build(...)
+class BoundingVolumeHierarchy
+{
+public:
+	static constexpr Index maxDepth = 64;	//!< maximum depth of tree, sufficient for balanced trees with any Index size
+
+private:
+	std::vector<BVHNode> nodes;				//!< node 0 is root
+	ArrayIndex items;						//!< item identifiers, sorted by leaves
+	ResizableArray<Vector3D> itemCenters;	//!< temporary centers of items during Build(...)
+	Index maxItemsPerLeaf;
+
+public:
+	BoundingVolumeHierarchy() : maxItemsPerLeaf(4) {}
+
+	//! delete tree and free memory
+	void Flush()
+	{
+		nodes.clear();
+		nodes.shrink_to_fit();
+		items.Flush();
+		itemCenters.Flush();
+	}
+
+	//! number of items in tree
+	Index NumberOfItems() const { return items.NumberOfItems(); }
+
+	//! box containing all items; empty box if no items
+	Box3D GetBox() const
+	{
+		if (nodes.empty()) { return Box3D(); }
+		return nodes[0].box;
+	}
+
+	//! build tree for items with given boxes; item i has identifier i
+	void Build(const ResizableArray<Box3D>& boxes, Index maxItemsPerLeafInit = 4)
+	{
+		CHECKandTHROW(maxItemsPerLeafInit > 0, "BoundingVolumeHierarchy::Build: maxItemsPerLeaf must be > 0");
+		maxItemsPerLeaf = maxItemsPerLeafInit;
+		Index n = boxes.NumberOfItems();
+		items.SetNumberOfItems(n);
+		itemCenters.SetNumberOfItems(n);
+		for (Index i = 0; i < n; i++)
+		{
+			items[i] = i;
+			itemCenters[i] = boxes[i].Center();
+		}
+
+		nodes.clear();
+		if (n == 0) { return; }
+
+		//splits are at the median, thus every leaf has at least (maxItemsPerLeaf+1)/2 items (or all n items);
+		//a binary tree with nLeaves leaves has 2*nLeaves-1 nodes; avoids reallocation during build
+		Index minItemsPerLeaf = EXUstd::Maximum((Index)1, EXUstd::Minimum(n, (maxItemsPerLeaf + 1) / 2));
+		nodes.reserve(2 * (n / minItemsPerLeaf) - 1);
+		nodes.resize(1);
+		BuildNode(0, 0, n, boxes, 1);
+		itemCenters.Flush(); //only needed for build
+	}
+
+	//! add identifiers of all items whose boxes intersect with box b to itemsFound; does not reset itemsFound
+	void AddItemsInBox(const Box3D& b, ArrayIndex& itemsFound) const
+	{
+		if (nodes.empty()) { return; }
+
+		Index stack[maxDepth];
+		Index stackSize = 0;
+		stack[stackSize++] = 0;
+		while (stackSize)
+		{
+			const BVHNode& node = nodes[stack[--stackSize]];
+			if (!node.box.Intersect(b)) { continue; }
+
+			if (node.numberOfItems)
+			{
+				for (Index i = node.firstItem; i < node.firstItem + node.numberOfItems; i++)
+				{
+					itemsFound.AppendPure(items[i]);
+				}
+			}
+			else
+			{
+				stack[stackSize++] = node.leftChild + 1;
+				stack[stackSize++] = node.leftChild;
+			}
+		}
+	}
+
+	//! add identifiers of all items whose boxes are hit by line segment p + t*dir with t in [tMin, tMax]; boxes are treated as closed
+	void AddItemsAlongLine(const Vector3D& p, const Vector3D& dir, Real tMin, Real tMax, ArrayIndex& itemsFound) const
+	{
+		if (nodes.empty()) { return; }
+
+		Index stack[maxDepth];
+		Index stackSize = 0;
+		stack[stackSize++] = 0;
+		while (stackSize)
+		{
+			const BVHNode& node = nodes[stack[--stackSize]];
+			if (!LineIntersectsBox(node.box, p, dir, tMin, tMax)) { continue; }
+
+			if (node.numberOfItems)
+			{
+				for (Index i = node.firstItem; i < node.firstItem + node.numberOfItems; i++)
+				{
+					itemsFound.AppendPure(items[i]);
+				}
+			}
+			else
+			{
+				stack[stackSize++] = node.leftChild + 1;
+				stack[stackSize++] = node.leftChild;
+			}
+		}
+	}
+
+	//! slab test: check if line segment p + t*dir with t in [tMin, tMax] intersects closed box b
+	static bool LineIntersectsBox(const Box3D& b, const Vector3D& p, const Vector3D& dir, Real tMin, Real tMax)
+	{
+		const Real* pMin = b.PMinC();
+		const Real* pMax = b.PMaxC();
+		for (Index i = 0; i < 3; i++)
+		{
+			if (dir[i] == 0.)
+			{
+				if (p[i] < pMin[i] || p[i] > pMax[i]) { return false; }
+			}
+			else
+			{
+				Real t0 = (pMin[i] - p[i]) / dir[i];
+				Real t1 = (pMax[i] - p[i]) / dir[i];
+				if (t0 > t1) { std::swap(t0, t1); }
+				tMin = EXUstd::Maximum(tMin, t0);
+				tMax = EXUstd::Minimum(tMax, t1);
+				if (tMin > tMax) { return false; }
+			}
+		}
+		return true;
+	}
+
+private:
+	//! recursively build node with items[first ... first+count-1]
+	void BuildNode(Index nodeIndex, Index first, Index count, const ResizableArray<Box3D>& boxes, Index depth)
+	{
+		Box3D nodeBox;
+		Box3D centerBox;
+		for (Index i = first; i < first + count; i++)
+		{
+			nodeBox.Add(boxes[items[i]]);
+			centerBox.Add(itemCenters[items[i]]);
+		}
+		nodes[nodeIndex].box = nodeBox;
+
+		Real size[3] = { centerBox.SizeX(), centerBox.SizeY(), centerBox.SizeZ() };
+		Index axis = 0;
+		if (size[1] > size[axis]) { axis = 1; }
+		if (size[2] > size[axis]) { axis = 2; }
+
+		//leaf, if few items or all centers are equal (no split possible)
+		if (count <= maxItemsPerLeaf || size[axis] == 0. || depth >= maxDepth - 1)
+		{
+			nodes[nodeIndex].leftChild = -1;
+			nodes[nodeIndex].firstItem = first;
+			nodes[nodeIndex].numberOfItems = count;
+			return;
+		}
+
+		//split at median of centers
+		Index half = count / 2;
+		Index* itemsBegin = items.GetDataPointer() + first;
+		std::nth_element(itemsBegin, itemsBegin + half, itemsBegin + count, [this, axis](Index a, Index b)
+		{
+			return itemCenters[a][axis] < itemCenters[b][axis];
+		});
+
+		Index leftChild = (Index)nodes.size();
+		nodes.resize(leftChild + 2); //nodes may be reallocated: only use indices!
+		nodes[nodeIndex].leftChild = leftChild;
+		nodes[nodeIndex].firstItem = 0;
+		nodes[nodeIndex].numberOfItems = 0;
+
+		BuildNode(leftChild, first, half, boxes, depth + 1);
+		BuildNode(leftChild + 1, first + half, count - half, boxes, depth + 1);
+	}
+};
+
+#endif
@@ -21,17 +21,162 @@
 #include "Main/Experimental.h"
 extern PyExperimental pyExperimental; //!this class can be accessed from outside, but also from every other file where this is imported
 
-//! factorize matrix (invert, SparseLU, etc.); -1=success; >=0: causing row
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//blocked LU factorization for GeneralMatrixEXUdense
+static const Index denseLUblockSize = 32;           //!< number of columns per panel in blocked LU factorization
+static const Index denseLUcolumnTile = 256;         //!< number of columns per tile in trailing update; keeps panel rows of U in cache
+static const Index denseLUparallelMinRows = 128;    //!< minimum number of trailing rows to perform trailing update multithreaded
+
+//! rowI[0..n-1] -= factor*rowK[0..n-1]; contiguous loop, which is vectorized by the compiler
+inline void DenseLURowSubtract(Real* rowI, const Real* rowK, Real factor, Index n)
+{
+    for (Index c = 0; c < n; c++)
+    {
+        rowI[c] -= factor * rowK[c];
+    }
+}
+
+//! compute LU factorization with partial (row) pivoting of quadratic matrix m, P*m = L*U, using a blocked right-looking algorithm;
+//! lu: stores L (unit lower triangular, without diagonal) and U in one matrix; m stays unchanged
+//! rowSwaps: rowSwaps[i] contains the original row of m which is stored in row i of lu
+//! pivotThreshold: pivots with absolute value <= pivotThreshold are treated as singular (same as MatrixBase::InvertSpecial)
+//! return -1 if successful, otherwise the original (first) row which caused the singularity
+static Index DenseLUFactorize(const ResizableMatrix& m, ResizableMatrix& lu, ArrayIndex& rowSwaps, Real pivotThreshold)
+{
+    Index n = m.NumberOfRows();
+    rowSwaps.SetNumberOfItems(n);
+    for (Index i = 0; i < n; i++) { rowSwaps[i] = i; }
+
+    lu.CopyFrom(m);
+    if (n*m.NumberOfColumns() == 0) { return -1; } //no need to factorize; but this is no error!
+
+    CHECKandTHROW(n == m.NumberOfColumns(), "GeneralMatrixEXUdense::FactorizeNew: only valid for quadratic matrices");
+
+    Real* a = lu.GetDataPointer(); //row-major storage: a(i,j) = a[i*n+j]
+
+    for (Index kb = 0; kb < n; kb += denseLUblockSize)
+    {
+        Index ke = EXUstd::Minimum(kb + denseLUblockSize, n); //panel columns kb..ke-1
+
+        //factorize panel; row swaps are applied to full rows
+        for (Index j = kb; j < ke; j++)
+        {
+            Real pivot = a[j*n + j];
+            Index pivotPos = j;
+            for (Index k = j + 1; k < n; k++)
+            {
+                if (fabs(a[k*n + j]) > fabs(pivot))
+                {
+                    pivotPos = k;
+                    pivot = a[k*n + j];
+                }
+            }
+            if (pivotPos != j)
+            {
+                Real* rowJ = a + j * n;
+                Real* rowP = a + pivotPos * n;
+                for (Index c = 0; c < n; c++) { EXUstd::Swap(rowJ[c], rowP[c]); }
+                EXUstd::Swap(rowSwaps[pivotPos], rowSwaps[j]);
+            }
+            if (fabs(pivot) <= pivotThreshold)
+            {
+                return rowSwaps[j];
+            }
+
+            const Real* rowJ = a + j * n;
+            Real invPivot = 1. / pivot;
+            for (Index i = j + 1; i < n; i++)
+            {
+                Real* rowI = a + i * n;
+                Real lij = rowI[j] * invPivot;
+                rowI[j] = lij;
+                if (lij != 0.) { DenseLURowSubtract(rowI + j + 1, rowJ + j + 1, lij, ke - j - 1); }
+            }
+        }
+
+        if (ke < n)
+        {
+            Index nColumns = n - ke;
+            //U12 = L11^{-1}*A12
+            for (Index i = kb + 1; i < ke; i++)
+            {
+                Real* rowI = a + i * n;
+                for (Index k = kb; k < i; k++)
+                {
+                    if (rowI[k] != 0.) { DenseLURowSubtract(rowI + ke, a + k * n + ke, rowI[k], nColumns); }
+                }
+            }
+
+            //trailing update A22 -= L21*U12; rows are independent and are split into tasks
+            auto UpdateRows = [a, n, kb, ke](Index iStart, Index iEnd)
+            {
+                for (Index c0 = ke; c0 < n; c0 += denseLUcolumnTile)
+                {
+                    Index nTile = EXUstd::Minimum(denseLUcolumnTile, n - c0);
+                    for (Index i = iStart; i < iEnd; i++)
+                    {
+                        Real* rowI = a + i * n;
+                        for (Index k = kb; k < ke; k++)
+                        {
+                            if (rowI[k] != 0.) { DenseLURowSubtract(rowI + c0, a + k * n + c0, rowI[k], nTile); }
+                        }
+                    }
+                }
+            };
+
+            Index nRows = n - ke;
+            Index nThreads = exuThreading::TaskManager::GetNumThreads();
+            if (nThreads > 1 && nRows >= denseLUparallelMinRows)
+            {
+                Index nTasks = EXUstd::Minimum(4 * nThreads, nRows / 8);
+                exuThreading::ParallelFor((NGSsizeType)nTasks, [&UpdateRows, nTasks, nRows, ke](NGSsizeType t)
+                {
+                    UpdateRows(ke + (nRows*(Index)t) / nTasks, ke + (nRows*((Index)t + 1)) / nTasks);
+                });
+            }
+            else
+            {
+                UpdateRows(ke, n);
+            }
+        }
+    }
+    return -1;
+}
+
+//! solve P*A*x = L*U*x = rhs with factorization computed by DenseLUFactorize; forward and backward substitution
+static void DenseLUSolve(const ResizableMatrix& lu, const ArrayIndex& rowSwaps, const Vector& rhs, Vector& solution)
+{
+    Index n = rowSwaps.NumberOfItems();
+    solution.SetNumberOfItems(n);
+    for (Index i = 0; i < n; i++) { solution[i] = rhs[rowSwaps[i]]; }
+
+    const Real* a = lu.GetDataPointer();
+    Real* x = solution.GetDataPointer();
+    for (Index i = 1; i < n; i++) //L*y = P*rhs
+    {
+        const Real* rowI = a + i * n;
+        Real value = x[i];
+        for (Index k = 0; k < i; k++) { value -= rowI[k] * x[k]; }
+        x[i] = value;
+    }
+    for (Index i = n - 1; i >= 0; i--) //U*x = y
+    {
+        const Real* rowI = a + i * n;
+        Real value = x[i];
+        for (Index k = i + 1; k < n; k++) { value -= rowI[k] * x[k]; }
+        x[i] = value / rowI[i];
+    }
+}
+
+//! factorize matrix (LU, SparseLU, etc.); -1=success; >=0: causing row
 Index GeneralMatrixEXUdense::FactorizeNew() //bool ignoreRedundantEquation, Index redundantEquationsStart)
 {
     Index  rv;
 
     if (useEigenSolverType == 0)
     {
-        static ResizableMatrix m; //temporary matrix!
-        static ArrayIndex rows;
-        //rv = matrix.InvertSpecial(m, rows, ignoreRedundantEquation, redundantEquationsStart, pivotThreshold);
-        rv = matrix.InvertSpecial(m, rows, false, 0, PivotThreshold());
+        //blocked LU with partial pivoting; matrix is kept, factors are stored in factorizationTemp
+        rv = DenseLUFactorize(matrix, factorizationTemp, factorizationRowSwaps, PivotThreshold());
     }
     else
     {
@@ -97,7 +242,7 @@ void GeneralMatrixEXUdense::Solve(const Vector& rhs, Vector& solution)
 
     if (!useEigenSolverType)
     {
-        EXUmath::MultMatrixVector(matrix, rhs, solution);
+        DenseLUSolve(factorizationTemp, factorizationRowSwaps, rhs, solution);
     }
     else
     {
@@ -136,15 +281,19 @@ void GeneralMatrixEigenSparse::SetAllZero()
 //#else
 //	triplets.resize(0); //this removes all entries!
 //#endif
-	matrix.setZero();	//flush the Eigen sparse matrix
+	//in case of reuseSparsityPattern, the compressed matrix is kept for refilling in FinalizeMatrix()
+	if (!reuseSparsityPattern) { matrix.setZero(); }	//flush the Eigen sparse matrix
 }
 
 //! reset matrices and free memory
 void GeneralMatrixEigenSparse::Reset()
 {
 	SetAllZero();
+	matrix.setZero();
 	triplets.Flush();
 	analyzedPatternLastNNZ = 0;
+	sparsityPatternAvailable = false;
+	tripletValueSlots.Flush();
 //#ifdef useMatrixContainerTriplets
 //	SetAllZero();
 //	triplets.Flush();
@@ -453,6 +602,12 @@ void GeneralMatrixEigenSparse::FinalizeMatrix()
 {
 	SetMatrixIsFactorized(false);
 
+	if (reuseSparsityPattern && RefillMatrixFromTriplets())
+	{
+		SetMatrixBuiltFromTriplets(); //pattern unchanged; values already added into compressed matrix
+		return;
+	}
+
 	if (matrix.nonZeros() != 0) { matrix.setZero(); } //this should be already done in matrix.resize - could be omitted ...?
 	matrix.resize(NumberOfRows(), NumberOfColumns());
 	
@@ -469,9 +624,55 @@ void GeneralMatrixEigenSparse::FinalizeMatrix()
 
 	matrix.setFromTriplets(triplets.begin(), triplets.end()); //sums up duplicates by default... (@TODO: what happens in EigenSparseMatrix::setFromTriplets(...) with (+1) + (-1) ? )
 
+	if (reuseSparsityPattern)
+	{
+		//new pattern: analyzed pattern of solver is invalid, even if number of non-zeros did not change
+		sparsityPatternAvailable = true;
+		analyzedPatternLastNNZ = 0;
+	}
+
 	SetMatrixBuiltFromTriplets(); //now the sparse matrix is finally set and ready for multiplication and factorization
 }
 
+//! add triplet values into stored matrix entries, using the existing sparsity pattern; returns false, if a triplet is not contained in the pattern
+//! the slot of every triplet in matrix.valuePtr() is stored, such that only a check is needed if the order of triplets does not change
+bool GeneralMatrixEigenSparse::RefillMatrixFromTriplets()
+{
+	if (!sparsityPatternAvailable || !matrix.isCompressed() || matrix.nonZeros() == 0 ||
+		matrix.rows() != NumberOfRows() || matrix.cols() != NumberOfColumns()) 
+	{ 
+		return false; 
+	}
+
+	const StorageIndex* columnStart = matrix.outerIndexPtr(); //column-major: start of every column in innerIndexPtr() and valuePtr()
+	const StorageIndex* rowIndices = matrix.innerIndexPtr();  //row indices, sorted within every column
+	Real* values = matrix.valuePtr();
+
+	Index nTriplets = triplets.NumberOfItems();
+	Index nSlots = tripletValueSlots.NumberOfItems();
+	tripletValueSlots.SetNumberOfItems(nTriplets);
+
+	std::fill(values, values + matrix.nonZeros(), 0.);
+	for (Index i = 0; i < nTriplets; i++)
+	{
+		const SparseTriplet& item = triplets[i];
+		Index start = (Index)columnStart[item.col()];
+		Index end = (Index)columnStart[item.col() + 1];
+		Index slot = (i < nSlots) ? tripletValueSlots[i] : -1;
+
+		if (slot < start || slot >= end || (Index)rowIndices[slot] != item.row())
+		{
+			//triplet order changed: search row in column
+			const StorageIndex* pos = std::lower_bound(rowIndices + start, rowIndices + end, (StorageIndex)item.row());
+			if (pos == rowIndices + end || (Index)*pos != item.row()) { return false; } //entry not in pattern ==> rebuild matrix
+			slot = (Index)(pos - rowIndices);
+			tripletValueSlots[i] = slot;
+		}
+		values[slot] += item.value();
+	}
+	return true;
+}
+
 //Index TSeigenFactorize;
 //TimerStructureRegistrator TSReigenFactorize("eigenFactorize", TSeigenFactorize, globalTimers);
 //Index TSeigenAnalyzePattern;
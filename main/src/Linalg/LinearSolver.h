@@ -125,6 +125,8 @@ public:
 	virtual bool IsSymmetric() const { return false; }
 	virtual void SetReuseAnalyzedPattern(bool flag) { }
 	virtual bool GetReuseAnalyzedPattern() const { return false; }
+	virtual void SetReuseSparsityPattern(bool flag) { }
+	virtual bool GetReuseSparsityPattern() const { return false; }
 
 	//don't do the following; use casting!
 	////! get (read) matrix as dense exudyn Matrix; this function should be used rarly, as it disables the compatibility to other matrix formats
@@ -226,6 +228,8 @@ class GeneralMatrixEXUdense : public GeneralMatrix
 private:
     Index useEigenSolverType;                               //!< use Eigen solver
     ResizableMatrix matrix;                                 //!< internal dense matrix storage:
+    ResizableMatrix factorizationTemp;                      //!< LU factors of matrix with EXUdense; per matrix (solver), such that solvers can run in parallel threads
+    ArrayIndex factorizationRowSwaps;                       //!< row permutation of LU factorization with EXUdense: original row index of every row in factorizationTemp
 #ifdef USE_EIGEN_DENSE_SOLVER
     Eigen::FullPivLU<Eigen::MatrixXd> eigenLUfullPivot;     //!< Full Pivot LU factorization using Eigen
     Eigen::PartialPivLU<Eigen::MatrixXd> eigenLU;           //!< LU factorization using Eigen
@@ -435,6 +439,9 @@ private:
 
 	Index analyzedPatternLastNNZ;   //!< number of non-zeros of last analyzedPattern computation
 	bool reuseAnalyzedPattern;      //!< True: the Eigen SparseLU solver offers the possibility to reuse an analyzed pattern of a previous factorization; this may reduce total factorization time by a factor of 2 or 3, depending on the matrix type; 
+	bool reuseSparsityPattern;      //!< True: the compressed matrix is kept between FinalizeMatrix() calls and values of triplets are added directly into the stored entries, as long as the pattern does not change
+	bool sparsityPatternAvailable;  //!< flag is set true, if matrix contains a valid sparsity pattern (from last setFromTriplets) which can be refilled
+	ArrayIndex tripletValueSlots;   //!< for every triplet, the index into matrix.valuePtr() of the last refill; used to avoid searching of entries if triplet order does not change
 	//data for Eigen sparse matrix storage:
 #ifdef USE_EIGEN_SPARSE_SOLVER
 	EigenSparseMatrix matrix;	 //this is the sparse matrix built from triplets
@@ -461,6 +468,8 @@ public:
 		numberOfColumns = 0;
 		analyzedPatternLastNNZ = 0;
 		reuseAnalyzedPattern = false;
+		reuseSparsityPattern = false;
+		sparsityPatternAvailable = false;
 	}
 
 	//! information on storage type
@@ -488,6 +497,10 @@ public:
 	virtual void SetReuseAnalyzedPattern(bool flag) { reuseAnalyzedPattern = flag; }
 	virtual bool GetReuseAnalyzedPattern() const { return reuseAnalyzedPattern; }
 
+	//! keep sparsity pattern of matrix and refill values in FinalizeMatrix(); matrix is rebuilt if the pattern changes
+	virtual void SetReuseSparsityPattern(bool flag) { reuseSparsityPattern = flag; sparsityPatternAvailable = false; }
+	virtual bool GetReuseSparsityPattern() const { return reuseSparsityPattern; }
+
 	//! get (read) matrix as dense exudyn Matrix
 	const SparseTripletVector& GetSparseTriplets() const { return triplets; }
 
@@ -564,6 +577,9 @@ public:
     //! After filling the matrix, it is finalized for further operations (matrix*vector, factorization, ...)
 	virtual void FinalizeMatrix();
 
+	//! add triplet values into stored matrix entries, using the existing sparsity pattern; returns false, if a triplet is not contained in the pattern
+	bool RefillMatrixFromTriplets();
+
 	//! factorize matrix (invert, SparseLU, etc.);
 	//! return -1 if success, causing index otherwise
     virtual Index FactorizeNew(); // bool ignoreRedundantEquation = false, Index redundantEquationsStart = 0);
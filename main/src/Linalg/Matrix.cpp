@@ -74,7 +74,7 @@
 // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
 
 //! Compute matrix inverse (internal function, needs memory allocation and may be slower than external functions - Eigen, etc.)
-//  NOT Threadsafe!
+//  temporary matrix is thread-local
 template<typename T>
 bool MatrixBase<T>::Invert()
 {
@@ -83,7 +83,7 @@ bool MatrixBase<T>::Invert()
 	//throw EXUexception("MatrixBase::Invert(): only valid for quadratic matrices");
 	CHECKandTHROW(numberOfColumns == numberOfRows && data != NULL, "MatrixBase::Invert(): only valid for quadratic matrices");
 
-	static ResizableMatrixBase<T> m; //memory allocation only once, if size does not change; not THREAD safe!
+	static thread_local ResizableMatrixBase<T> m; //memory allocation only once per thread, if size does not change
 	//static ResizableMatrix m; //memory allocation only once, if size does not change; not THREAD safe!
 
 	//Insert identity-matrix on left-hand-side
@@ -21,6 +21,10 @@
 #define SEARCHTREE__H
 
 #include "Linalg/BasicLinalg.h"		//includes Vector.h
+#include <cmath>
+#include <vector>
+#include <atomic>
+#include <algorithm>
 
 
 //+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
@@ -235,6 +239,21 @@ private:
 
 
 
+//! atomic counters per cell, only used temporarily in SearchTree::BuildItems; counters are not copied
+class SearchTreeCellCounters : public std::vector<std::atomic<Index>>
+{
+public:
+	SearchTreeCellCounters() {}
+	SearchTreeCellCounters(const SearchTreeCellCounters&) {}
+	SearchTreeCellCounters& operator=(const SearchTreeCellCounters&) { return *this; }
+
+	//! resize without keeping values; atomics cannot be moved
+	void SetNumberOfItems(Index n)
+	{
+		if ((Index)size() != n) { std::vector<std::atomic<Index>>::operator=(std::vector<std::atomic<Index>>(n)); }
+	}
+};
+
 //++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
 //++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
 //++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
@@ -243,15 +262,24 @@ private:
 //all items must fit into this box and should be equally distributed
 //then use AddItems to add items with a bounding box and an identifier
 //GetItemsInBox() gives you all identifiers which have a bounding box within the specified box
+//items are either stored in one array per cell (AddItem) or in a flat CSR-style cell array (BuildItems)
+//ResetSearchTreeAdaptive() adapts box and cells to the current items, e.g., for spreading granular flows
 class SearchTree
 {
 private:
 	Index sx, sy, sz;
 	ArrayIndex* data;
+	Index dataSize;								//!< number of allocated cells in data; may be larger than TotalSize()
 	Box3D box;
 
+	bool useCellArrays;							//!< if true, items are stored in data (AddItem); otherwise in cellStart/cellItems (BuildItems)
+	ArrayIndex cellStart;						//!< items of cell gi are cellItems[cellStart[gi]] ... cellItems[cellStart[gi+1]-1]; size TotalSize()+1
+	ArrayIndex cellItems;						//!< items of all cells, sorted by cells
+	SearchTreeCellCounters cellCounters;		//!< temporary counters per cell for BuildItems
+	ResizableArray<Real> itemSizes;				//!< temporary item sizes for ResetSearchTreeAdaptive
+
 public:
-	SearchTree(): sx(0), sy(0), sz(0), data(nullptr) {};
+	SearchTree(): sx(0), sy(0), sz(0), data(nullptr), dataSize(0), useCellArrays(true) {};
 
 	//SearchTree& operator=(const SearchTree& tree)
 	//{
@@ -299,6 +327,7 @@ public:
 			FlushCells();
 			delete[] data;
 			data = nullptr;
+			dataSize = 0;
 		}
 	}
 
@@ -307,11 +336,14 @@ public:
 	{
 		if (data)
 		{
-			for (Index i = 0; i < TotalSize(); i++)
+			for (Index i = 0; i < dataSize; i++)
 			{
 				data[i].Flush();
 			}
 		}
+		cellStart.Flush();
+		cellItems.Flush();
+		useCellArrays = true;
 	}
 
 	const Box3D& GetBox() const { return box; }
@@ -324,34 +356,110 @@ public:
 
 	Index3 SizeCellsXYZ() const { return Index3({ sx, sy, sz }); }
 
+	//! pointer to first item of cell with global index gi; items of cell are in range [CellBegin(gi), CellEnd(gi))
+	EXUINLINE const Index* CellBegin(Index gi) const
+	{
+		if (useCellArrays) { return data[gi].GetDataPointer(); }
+		return cellItems.GetDataPointer() + cellStart[gi];
+	}
+
+	//! pointer after last item of cell with global index gi
+	EXUINLINE const Index* CellEnd(Index gi) const
+	{
+		if (useCellArrays) { return data[gi].GetDataPointer() + data[gi].NumberOfItems(); }
+		return cellItems.GetDataPointer() + cellStart[gi + 1];
+	}
+
+	//! number of items in cell with global index gi
+	Index CellSize(Index gi) const { return (Index)(CellEnd(gi) - CellBegin(gi)); }
+
+	//! set box and number of cells; cells are only re-allocated if number of cells grows
 	void ResetSearchTree(Index sizex, Index sizey, Index sizez, Box3D b)
 	{
-		ClearItems(); //empty all items
 		box = b;
 		CHECKandTHROW(box.SizeX()*box.SizeY()*box.SizeZ() > 0, "SearchTree: size of box must be not equal 0");
 
-		if (sx != sizex || sy != sizey || sz != sizez)
+		if (sizex*sizey*sizez > dataSize)
 		{
 			if (data)
 			{
-				for (Index i = 0; i < TotalSize(); i++)
+				for (Index i = 0; i < dataSize; i++)
 				{
 					data[i].Flush();
 				}
 				delete [] data;
 			}
 
-			sx = sizex;
-			sy = sizey;
-			sz = sizez;
-
-			data = new ArrayIndex[TotalSize()]();
+			dataSize = sizex * sizey*sizez;
+			data = new ArrayIndex[dataSize]();
 			//DELETE: check if this is needed in Linux?
 			//for (Index i = 0; i < TotalSize(); i++)
 			//{
 			//	data[i].SetDataUnsafe(nullptr, 0, 0);
 			//}
 		}
+
+		sx = sizex;
+		sy = sizey;
+		sz = sizez;
+		ClearItems(); //empty all items; cells beyond TotalSize() are cleared, once they are used again
+	}
+
+	//! adapt box and number of cells to bounding boxes of items, such that no items are clamped into boundary cells;
+	//! cubic cells with edge length cellSizeFactor*(median of item sizes) are used, increased if more than maxNumberOfCells
+	//! or more than 8 cells per item would be needed, such that memory and cost stay proportional to the number of items;
+	//! item size is the largest edge of the item's bounding box; items need to be added after this call
+	void ResetSearchTreeAdaptive(const ResizableArray<Box3D>& boxes, Real cellSizeFactor, Index maxNumberOfCells)
+	{
+		CHECKandTHROW(boxes.NumberOfItems() != 0, "SearchTree::ResetSearchTreeAdaptive: no items");
+		CHECKandTHROW(cellSizeFactor > 0 && maxNumberOfCells > 0, "SearchTree::ResetSearchTreeAdaptive: cellSizeFactor and maxNumberOfCells must be positive");
+		maxNumberOfCells = EXUstd::Minimum(maxNumberOfCells, 8 * boxes.NumberOfItems());
+
+		Box3D newBox;
+		itemSizes.SetNumberOfItems(0);
+		for (Index i = 0; i < boxes.NumberOfItems(); i++)
+		{
+			const Box3D& b = boxes[i];
+			if (b.Empty()) { continue; } //empty boxes are not added to tree
+			newBox.Add(b);
+			itemSizes.AppendPure(EXUstd::Maximum(b.SizeX(), EXUstd::Maximum(b.SizeY(), b.SizeZ())));
+		}
+		Real medianSize = 0.;
+		if (itemSizes.NumberOfItems())
+		{
+			Real* sizesBegin = itemSizes.GetDataPointer();
+			Real* median = sizesBegin + itemSizes.NumberOfItems() / 2;
+			std::nth_element(sizesBegin, median, sizesBegin + itemSizes.NumberOfItems());
+			medianSize = *median;
+		}
+		else
+		{
+			newBox = Box3D(Vector3D({ 0.,0.,0. }), Vector3D({ 0.,0.,0. })); //only empty boxes
+		}
+
+		Real boxSize[3] = { newBox.SizeX(), newBox.SizeY(), newBox.SizeZ() };
+		Real maxBoxSize = EXUstd::Maximum(boxSize[0], EXUstd::Maximum(boxSize[1], boxSize[2]));
+		Real cellSize = cellSizeFactor * medianSize;
+		if (cellSize <= 0.) //e.g. point-like items
+		{
+			cellSize = (maxBoxSize > 0.) ? maxBoxSize / (Real)EXUstd::Maximum(1, (Index)std::cbrt((Real)maxNumberOfCells)) : 1.;
+		}
+
+		Real n[3]; //Real to avoid overflow for very small items
+		while (true)
+		{
+			for (Index i = 0; i < 3; i++)
+			{
+				n[i] = EXUstd::Maximum(1., ceil(boxSize[i] / cellSize));
+			}
+			Real numberOfCells = n[0] * n[1] * n[2];
+			if (numberOfCells <= (Real)maxNumberOfCells) { break; }
+			cellSize *= EXUstd::Maximum(std::cbrt(numberOfCells / (Real)maxNumberOfCells), 1.01);
+		}
+
+		//cells are cubic and box is centered around items; this also gives non-zero box size for planar items
+		newBox.Increase(0.5*(n[0] * cellSize - boxSize[0]), 0.5*(n[1] * cellSize - boxSize[1]), 0.5*(n[2] * cellSize - boxSize[2]));
+		ResetSearchTree((Index)n[0], (Index)n[1], (Index)n[2], newBox);
 	}
 
 	//return 6 indices for box: minx, maxx, miny, maxy, minz, maxz
@@ -371,17 +479,16 @@ public:
 		CHECKandTHROW(data != 0, "GetItemsInBox: data=0");
 
 		items.SetNumberOfItems(0);
-		Index ld;
 		for (Index ix = ind[0]; ix <= ind[1]; ix++) //<= ind is correct, as it contains at most (sx-1)
 		{
 			for (Index iy = ind[2]; iy <= ind[3]; iy++)
 			{
 				for (Index iz = ind[4]; iz <= ind[5]; iz++)
 				{
-					ld = data[GlobalIndex(ix, iy, iz)].NumberOfItems();
-					for (Index i = 0; i < ld; i++)
+					Index gi = GlobalIndex(ix, iy, iz);
+					for (const Index* it = CellBegin(gi); it != CellEnd(gi); it++)
 					{
-						items.AppendPure((data[GlobalIndex(ix, iy, iz)])[i]);
+						items.AppendPure(*it);
 					}
 				}
 			}
@@ -394,17 +501,16 @@ public:
 	{
 		CHECKandTHROW(data != 0, "AddItemsInBox: data=0");
 
-		Index ld;
 		for (Index ix = ind[0]; ix <= ind[1]; ix++)
 		{
 			for (Index iy = ind[2]; iy <= ind[3]; iy++)
 			{
 				for (Index iz = ind[4]; iz <= ind[5]; iz++)
 				{
-					ld = data[GlobalIndex(ix, iy, iz)].NumberOfItems();
-					for (Index i = 0; i < ld; i++)
+					Index gi = GlobalIndex(ix, iy, iz);
+					for (const Index* it = CellBegin(gi); it != CellEnd(gi); it++)
 					{
-						items.AppendPure((data[GlobalIndex(ix, iy, iz)])[i]);
+						items.AppendPure(*it);
 					}
 				}
 			}
@@ -422,8 +528,7 @@ public:
 		ind[3] = IndY(b.PMaxY());
 		ind[4] = IndZ(b.PMinZ());
 		ind[5] = IndZ(b.PMaxZ());
-		Index ix, iy, iz, i;
-		ArrayIndex* id;
+		Index ix, iy, iz;
 
 		for (ix = ind[0]; ix <= ind[1]; ix++)
 		{
@@ -431,10 +536,11 @@ public:
 			{
 				for (iz = ind[4]; iz <= ind[5]; iz++)
 				{
-					id = &data[GlobalIndex(ix, iy, iz)];
-					for (i = 0; i < id->NumberOfItems(); i++)
+					Index gi = GlobalIndex(ix, iy, iz);
+					const Index* itEnd = CellEnd(gi);
+					for (const Index* it = CellBegin(gi); it != itEnd; it++)
 					{
-						items.AppendPure(id->GetItemUnsafe(i));
+						items.AppendPure(*it);
 					}
 				}
 			}
@@ -454,8 +560,7 @@ public:
 		ind[3] = IndY(b.PMaxY());
 		ind[4] = IndZ(b.PMinZ());
 		ind[5] = IndZ(b.PMaxZ());
-		Index ix, iy, iz, i;
-		ArrayIndex* id;
+		Index ix, iy, iz;
 
 		for (ix = ind[0]; ix <= ind[1]; ix++)
 		{
@@ -463,10 +568,11 @@ public:
 			{
 				for (iz = ind[4]; iz <= ind[5]; iz++)
 				{
-					id = &data[GlobalIndex(ix, iy, iz)];
-					for (i = 0; i < id->NumberOfItems(); i++)
+					Index gi = GlobalIndex(ix, iy, iz);
+					const Index* itEnd = CellEnd(gi);
+					for (const Index* it = CellBegin(gi); it != itEnd; it++)
 					{
-						Index newItem = id->GetItemUnsafe(i);
+						Index newItem = *it;
 						if (!indexFlags[newItem] && (newItem < maxIndex) && (newItem >= minIndex))
 						{
 							items.AppendPure(newItem);
@@ -500,8 +606,7 @@ public:
 		ind[3] = IndY(b.PMaxY());
 		ind[4] = IndZ(b.PMinZ());
 		ind[5] = IndZ(b.PMaxZ());
-		Index ix, iy, iz, i;
-		ArrayIndex* id;
+		Index ix, iy, iz;
 
 		for (ix = ind[0]; ix <= ind[1]; ix++)
 		{
@@ -509,10 +614,11 @@ public:
 			{
 				for (iz = ind[4]; iz <= ind[5]; iz++)
 				{
-					id = &data[GlobalIndex(ix, iy, iz)];
-					for (i = 0; i < id->NumberOfItems(); i++)
+					Index gi = GlobalIndex(ix, iy, iz);
+					const Index* itEnd = CellEnd(gi);
+					for (const Index* it = CellBegin(gi); it != itEnd; it++)
 					{
-						Index newItem = id->GetItemUnsafe(i);
+						Index newItem = *it;
 						if (!indexFlags[newItem] && 
 							(newItem < maxIndex) && (newItem >= minIndex) &&
 							b.Intersect(allBoundingBoxes[newItem]))
@@ -545,8 +651,7 @@ public:
 		ind[3] = IndY(b.PMaxY());
 		ind[4] = IndZ(b.PMinZ());
 		ind[5] = IndZ(b.PMaxZ());
-		Index ix, iy, iz, i;
-		ArrayIndex* id;
+		Index ix, iy, iz;
 
 		for (ix = ind[0]; ix <= ind[1]; ix++)
 		{
@@ -554,10 +659,11 @@ public:
 			{
 				for (iz = ind[4]; iz <= ind[5]; iz++)
 				{
-					id = &data[GlobalIndex(ix, iy, iz)];
-					for (i = 0; i < id->NumberOfItems(); i++)
+					Index gi = GlobalIndex(ix, iy, iz);
+					const Index* itEnd = CellEnd(gi);
+					for (const Index* it = CellBegin(gi); it != itEnd; it++)
 					{
-						Index newItem = id->GetItemUnsafe(i);
+						Index newItem = *it;
 						if (!indexFlags[newItem])
 						{
 							items.AppendPure(newItem);
@@ -587,8 +693,7 @@ public:
 		ind[3] = IndY(b.PMaxY());
 		ind[4] = IndZ(b.PMinZ());
 		ind[5] = IndZ(b.PMaxZ());
-		Index ix, iy, iz, i;
-		ArrayIndex* id;
+		Index ix, iy, iz;
 
 		for (ix = ind[0]; ix <= ind[1]; ix++)
 		{
@@ -596,10 +701,11 @@ public:
 			{
 				for (iz = ind[4]; iz <= ind[5]; iz++)
 				{
-					id = &data[GlobalIndex(ix, iy, iz)];
-					for (i = 0; i < id->NumberOfItems(); i++)
+					Index gi = GlobalIndex(ix, iy, iz);
+					const Index* itEnd = CellEnd(gi);
+					for (const Index* it = CellBegin(gi); it != itEnd; it++)
 					{
-						items.AppendPure(id->GetItem(i));
+						items.AppendPure(*it);
 					}
 				}
 			}
@@ -609,7 +715,8 @@ public:
 	//! get all items of the box with global index ind
 	void GetItemsOfBox(Index ind, ArrayIndex& items) const
 	{
-		items = data[ind];
+		items.SetNumberOfItems(0);
+		AddItemsOfBox(ind, items);
 	}
 
 	//! get all items of the box in which the point 'pos' lies
@@ -621,7 +728,10 @@ public:
 	//add all items of the box with index ind
 	void AddItemsOfBox(Index ind, ArrayIndex& items) const
 	{
-		items.AppendArray(data[ind]);
+		for (const Index* it = CellBegin(ind); it != CellEnd(ind); it++)
+		{
+			items.AppendPure(*it);
+		}
 	}
 
 	//! add all items of the box in which the point lies
@@ -630,9 +740,10 @@ public:
 		AddItemsOfBox(GlobalIndex(IndX(pos.X()), IndY(pos.Y()), IndZ(pos.Z())), items);
 	}
 
-	//! add item to search tree
+	//! add item to search tree; items added with BuildItems(...) must be removed with ClearItems() before
 	void AddItem(const Box3D& b, Index identifier)
 	{
+		CHECKandTHROW(useCellArrays, "SearchTree::AddItem: call ClearItems() after BuildItems(...)");
 		Index pMinX = IndX(b.PMinX());
 		Index pMaxX = IndX(b.PMaxX());
 		Index pMinY = IndY(b.PMinY());
@@ -668,6 +779,61 @@ public:
 		//}
 	}
 
+	//! build search tree from bounding boxes of all items, item i having identifier i; replaces all items of search tree;
+	//! items are stored in one flat CSR-style cell array, computed in two passes: count of items per cell, prefix sum and fill;
+	//! no memory is allocated per cell and memory is kept for next build
+	//! parallelFor(n, f) must call f(i) for all i in 0 ... n-1, possibly in parallel;
+	//! if parallelFor runs in parallel, sortCells must be true such that items in cells have same order as with AddItem(...)
+	template<class TParallelFor>
+	void BuildItems(const ResizableArray<Box3D>& boxes, TParallelFor parallelFor, bool sortCells = true)
+	{
+		CHECKandTHROW(data != 0, "SearchTree::BuildItems: search tree not initialized");
+		Index nCells = TotalSize();
+		Index nItems = boxes.NumberOfItems();
+		useCellArrays = false;
+		cellCounters.SetNumberOfItems(nCells);
+
+		//count items per cell
+		parallelFor(nCells, [this](auto gi) { cellCounters[(Index)gi].store(0, std::memory_order_relaxed); });
+		parallelFor(nItems, [this, &boxes](auto i)
+		{
+			ForEachCell(boxes[(Index)i], [this](Index gi) { cellCounters[gi].fetch_add(1, std::memory_order_relaxed); });
+		});
+
+		//prefix sum; counters are then used as fill positions
+		cellStart.SetNumberOfItems(nCells + 1);
+		Index sum = 0;
+		for (Index gi = 0; gi < nCells; gi++)
+		{
+			cellStart[gi] = sum;
+			sum += cellCounters[gi].load(std::memory_order_relaxed);
+			cellCounters[gi].store(cellStart[gi], std::memory_order_relaxed);
+		}
+		cellStart[nCells] = sum;
+		cellItems.SetNumberOfItems(sum);
+
+		//fill cells
+		parallelFor(nItems, [this, &boxes](auto i)
+		{
+			Index identifier = (Index)i;
+			ForEachCell(boxes[identifier], [this, identifier](Index gi)
+			{
+				cellItems.GetDataPointer()[cellCounters[gi].fetch_add(1, std::memory_order_relaxed)] = identifier;
+			});
+		});
+
+		//parallel fill gives arbitrary order within cells
+		if (sortCells)
+		{
+			parallelFor(nCells, [this](auto gi)
+			{
+				Index* itBegin = cellItems.GetDataPointer() + cellStart[(Index)gi];
+				Index* itEnd = cellItems.GetDataPointer() + cellStart[(Index)gi + 1];
+				if (itEnd - itBegin > 1) { std::sort(itBegin, itEnd); }
+			});
+		}
+	}
+
 	//! return x-index for a Real x-value in Box
 	Index IndX(Real x) const
 	{
@@ -719,6 +885,7 @@ public:
 	//! empty searchtree, but keep memory
 	void ClearItems()
 	{
+		useCellArrays = true;
 		for (Index i = 0; i < TotalSize(); i++)
 		{
 			data[i].SetNumberOfItems(0);
@@ -735,6 +902,34 @@ public:
 		//}
 	}
 
+private:
+	//! call function f(gi) for global index gi of every cell touched by box b
+	template<class TFunction>
+	void ForEachCell(const Box3D& b, TFunction f) const
+	{
+		if (b.Empty()) { return; } //empty boxes are not added to any cell
+		Index pMinX = IndX(b.PMinX());
+		Index pMaxX = IndX(b.PMaxX());
+		Index pMinY = IndY(b.PMinY());
+		Index pMaxY = IndY(b.PMaxY());
+		Index pMinZ = IndZ(b.PMinZ());
+		Index pMaxZ = IndZ(b.PMaxZ());
+		Index sxsy = sx * sy;
+		for (Index iz = pMinZ; iz <= pMaxZ; iz++)
+		{
+			Index gi = pMinY * sx + iz * sxsy;
+			for (Index iy = pMinY; iy <= pMaxY; iy++)
+			{
+				for (Index ix = pMinX; ix <= pMaxX; ix++)
+				{
+					f(gi + ix);
+				}
+				gi += sx;
+			}
+		}
+	}
+
+public:
 	void GetStatistics(Index& numberOfTreeItems, Real& averageFill, Index& numberOfZeros, Index& maxFill, Index& numberOf10average) const
 	{
 		numberOfTreeItems = 0;
@@ -744,7 +939,7 @@ public:
 		numberOfZeros = 0;
 		for (Index i = 0; i < TotalSize(); i++)
 		{
-			Index value = data[i].NumberOfItems();
+			Index value = CellSize(i);
 			numberOfTreeItems += value;
 			maxFill = EXUstd::Maximum(value, maxFill);
 			if (value == 0) { numberOfZeros++; }
@@ -755,7 +950,7 @@ public:
 			numberOf10average = 0;
 			for (Index i = 0; i < TotalSize(); i++)
 			{
-				if (data[i].NumberOfItems() > (Index)(10. * averageFill))
+				if (CellSize(i) > (Index)(10. * averageFill))
 				{
 					numberOf10average++;
 				}
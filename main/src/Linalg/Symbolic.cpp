@@ -91,7 +91,7 @@ PythonUserFunctionBase<UFT>::~PythonUserFunctionBase()
 }
 
 template <typename UFT>
-PythonUserFunctionBase<UFT>::PythonUserFunctionBase() : pyObject(new PyUFobject()), ufType(UserFunctionType::_None)
+PythonUserFunctionBase<UFT>::PythonUserFunctionBase() : pyObject(new PyUFobject()), ufType(UserFunctionType::_None), symbolicUserFunction(nullptr)
 {
 	*pyObject = py::cast((Index)0);
 }
@@ -99,6 +99,8 @@ PythonUserFunctionBase<UFT>::PythonUserFunctionBase() : pyObject(new PyUFobject(
 template <typename UFT>
 void PythonUserFunctionBase<UFT>::SetPythonObject(const PyUFobject& pyObjectInit)
 {
+	symbolicUserFunction = nullptr; //Python functions require GIL
+	userFunctionJacobian = nullptr;
 	if (py::isinstance<py::dict>(pyObjectInit))
 	{
 		py::dict pyDict = py::cast<py::dict>(pyObjectInit);
@@ -140,17 +142,31 @@ void PythonUserFunctionBase<UFT>::SetPythonObject(const PyUFobject& pyObjectInit
 	}
 }
 
+//! return true, if linked symbolic user function is compiled; expression trees store arguments in shared variables and may only be evaluated serially
+template <typename UFT>
+bool PythonUserFunctionBase<UFT>::IsCompiledSymbolic() const
+{
+	return ufType == UserFunctionType::Symbolic && symbolicUserFunction && symbolicUserFunction->IsCompiled();
+}
+
 //! set Python user function using PySymbolicFunction
 template <typename UFT>
 void PythonUserFunctionBase<UFT>::SetPythonUserFunction(const PyUFobject& pyObjectInit)
 {
 	if (py::isinstance<Symbolic::PySymbolicUserFunction>(pyObjectInit))
 	{
-		const auto& symUF = py::cast<Symbolic::PySymbolicUserFunction>(pyObjectInit);
+		Symbolic::PySymbolicUserFunction& symUF = py::cast<Symbolic::PySymbolicUserFunction&>(pyObjectInit); //reference: Jacobian is linked to symUF
 		userFunction = symUF.GetSTDfunction<UFT>();
 
 		*pyObject = pyObjectInit;
 		ufType = UserFunctionType::Symbolic;
+		symbolicUserFunction = &symUF; //thread safety and Jacobian depend on IsCompiled(), which is queried when used
+
+		userFunctionJacobian = nullptr;
+		if constexpr (UserFunctionJacobian<UFT>::available)
+		{
+			symUF.GetJacobianFunction(userFunctionJacobian); //only used if symUF is compiled, see HasJacobian()
+		}
 	}
 	else //all other cases
 	{
@@ -763,6 +779,12 @@ void Init_Pybind_Symbolic(py::module& m) {
 		.def("Evaluate", &Symbolic::PySymbolicUserFunction::PyEvaluateUF,
 			"for testing: evaluate user function; note: this version is much slower than the C++ version because of the overhead in the interface")
 
+		.def("Compile", &Symbolic::PySymbolicUserFunction::Compile,
+			"compile expression trees into flat tape of instructions for faster evaluation; returns False, if expressions contain operations which cannot be compiled; in this case, expression trees are evaluated")
+
+		.def("IsCompiled", &Symbolic::PySymbolicUserFunction::IsCompiled,
+			"return True, if user function is evaluated with compiled tape")
+
 		.def("__str__", [](const Symbolic::PySymbolicUserFunction& item) {
 		return item.ToString();
 			}, "return function as string")
@@ -19,9 +19,15 @@
 #ifndef SYMBOLIC__H
 #define SYMBOLIC__H
 
+#include <map>			//for ExpressionTape
+#include <array>		//for ExpressionTape
+#include <cstring>		//for std::memcpy
+#include <algorithm>	//for std::fill
+
 namespace Symbolic
 {
 class ExpressionNamedReal;
+class ExpressionTape;
 
 //! base class for expression tree
 class ExpressionBase
@@ -54,6 +60,8 @@ public:
 	virtual STDstring ToString() const = 0; // Convert the expression tree to a string
 	//virtual ExpressionBase* clone() const = 0; // Pure virtual clone method
 	virtual void Destroy() = 0; //Pure virtual destroy method, which deletes tree reversely
+	//! add operations of expression to tape and return register of result; returns -1, if expression cannot be compiled
+	virtual Index CompileToTape(ExpressionTape& tape) const { return -1; }
 
 	static bool IsRegularVariableName(const STDstring str)
 	{
@@ -98,6 +106,8 @@ public:
 	virtual void Destroy() = 0;
 	virtual ResizableConstVector Evaluate() const = 0;
 	virtual STDstring ToString() const = 0;
+	//! add operations for component of vector expression to tape and return register of result; returns -1, if expression cannot be compiled
+	virtual Index CompileComponentToTape(ExpressionTape& tape, Index component) const { return -1; }
 };
 
 
@@ -134,6 +144,343 @@ public:
 };
 
 
+//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//! flat representation of expression trees for fast evaluation (e.g. of symbolic user functions):
+//! - expressions are compiled into a list of instructions, operating on registers; every register is assigned only once
+//! - registers hold inputs (function arguments), constants and results of instructions
+//! - constant subexpressions are folded and common subexpressions are computed only once
+//! - evaluation is a single loop without virtual calls; registers are provided by caller, such that tape is read-only during evaluation
+class ExpressionTape
+{
+public:
+	//! operations of tape; arguments are registers, except for Load
+	enum class Operation : int {
+		Load,	//load value of (named) variable, which is not an input (e.g. symbolic.variables)
+		Plus, Minus, Mul, Div,
+		EQ, NEQ, GT, GE, LE, LT,
+		UnaryMinus, IsFinite, Abs, Sign, Not, Round, Ceil, Floor, Sqrt, Exp, Log,
+		Sin, Cos, Tan, ASin, ACos, ATan, Sinh, Cosh, Tanh, ASinh, ACosh, ATanh,
+		Power, Atan2, Mod, Min, Max,
+		IfThenElse //both branches are evaluated, no short-circuit
+	};
+
+	//! single instruction of tape
+	struct Instruction
+	{
+		Operation operation;
+		Index result;			//!< register of result
+		Index arg0, arg1, arg2; //!< registers of arguments (unused arguments refer to arg0); for Load, arg0 is index into loadPointers
+	};
+
+private:
+	ResizableArray<Real> initialRegisters;		//!< constants are set here, other registers are 0
+	ResizableArray<bool> isConstantRegister;	//!< true, if register holds a constant
+	ResizableArray<Index> constantRegisters;	//!< list of registers holding constants
+	ResizableArray<Instruction> instructions;	//!< instructions in order of evaluation
+	ResizableArray<const Real*> loadPointers;	//!< pointers to values of variables, which are not inputs
+	ResizableArray<Index> outputRegisters;		//!< registers of return values
+
+	//only used during compilation:
+	std::unordered_map<const Real*, Index> inputMap;		//!< value pointer of input variable -> register
+	std::unordered_map<const Real*, Index> loadMap;			//!< value pointer of other variable -> register
+	std::unordered_map<const ExpressionBase*, Index> expressionMap;	//!< already compiled (shared) subexpressions
+	std::map<std::pair<const VectorExpressionBase*, Index>, Index> vectorComponentMap; //!< already compiled vector components
+	std::map<std::array<Index, 4>, Index> operationMap;		//!< already compiled operations, for common subexpression elimination
+	std::unordered_map<std::uint64_t, Index> constantMap;	//!< constants by bit pattern (distinguishes 0. and -0.)
+
+	//! add new register and return its index
+	Index AddRegister(Real initialValue, bool isConstant)
+	{
+		isConstantRegister.Append(isConstant);
+		return initialRegisters.Append(initialValue);
+	}
+
+	//! add operation; performs constant folding and common subexpression elimination
+	Index AddOperationInternal(Operation operation, Index arg0, Index arg1, Index arg2)
+	{
+		if (arg0 < 0 || arg1 < 0 || arg2 < 0) { return -1; } //some subexpression could not be compiled
+
+		if (operation == Operation::IfThenElse && IsConstant(arg0))
+		{
+			return GetConstant(arg0) ? arg1 : arg2;
+		}
+
+		bool allConstant = IsConstant(arg0) && IsConstant(arg1) && IsConstant(arg2);
+		if (allConstant)
+		{
+			return AddConstant(EvaluateOperation(operation, GetConstant(arg0), GetConstant(arg1), GetConstant(arg2)));
+		}
+
+		std::array<Index, 4> key = { (Index)operation, arg0, arg1, arg2 };
+		auto search = operationMap.find(key);
+		if (search != operationMap.end()) { return search->second; }
+
+		Index result = AddRegister(0., false);
+		instructions.Append(Instruction({ operation, result, arg0, arg1, arg2 }));
+		operationMap[key] = result;
+		return result;
+	}
+
+public:
+	ExpressionTape() {}
+
+	//! erase tape and compilation data
+	void Reset()
+	{
+		initialRegisters.Flush();
+		isConstantRegister.Flush();
+		constantRegisters.Flush();
+		instructions.Flush();
+		loadPointers.Flush();
+		outputRegisters.Flush();
+		ClearCompilationData();
+	}
+
+	//! free data only needed during compilation
+	void ClearCompilationData()
+	{
+		inputMap.clear();
+		loadMap.clear();
+		expressionMap.clear();
+		vectorComponentMap.clear();
+		operationMap.clear();
+		constantMap.clear();
+	}
+
+	bool IsEmpty() const { return outputRegisters.NumberOfItems() == 0; }
+	Index NumberOfRegisters() const { return initialRegisters.NumberOfItems(); }
+	Index NumberOfInstructions() const { return instructions.NumberOfItems(); }
+	Index NumberOfOutputs() const { return outputRegisters.NumberOfItems(); }
+	Index GetOutputRegister(Index i) const { return outputRegisters[i]; }
+
+	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+	//compilation
+
+	//! add input variable (function argument), identified by pointer to its value; value is set in registers before evaluation
+	Index AddInput(const Real* valuePointer)
+	{
+		Index result = AddRegister(0., false);
+		inputMap[valuePointer] = result;
+		return result;
+	}
+
+	//! get register of input variable; returns -1, if variable is not an input
+	Index GetInputRegister(const Real* valuePointer) const
+	{
+		auto search = inputMap.find(valuePointer);
+		return (search != inputMap.end()) ? search->second : -1;
+	}
+
+	//! add (named) variable: returns input register or adds Load instruction, such that value is read at every evaluation
+	Index AddVariable(const Real* valuePointer)
+	{
+		Index result = GetInputRegister(valuePointer);
+		if (result != -1) { return result; }
+
+		auto search = loadMap.find(valuePointer);
+		if (search != loadMap.end()) { return search->second; }
+
+		result = AddRegister(0., false);
+		instructions.Append(Instruction({ Operation::Load, result, loadPointers.Append(valuePointer), 0, 0 }));
+		loadMap[valuePointer] = result;
+		return result;
+	}
+
+	//! add constant (only once per value)
+	Index AddConstant(Real value)
+	{
+		std::uint64_t key = 0;
+		std::memcpy(&key, &value, sizeof(Real));
+		auto search = constantMap.find(key);
+		if (search != constantMap.end()) { return search->second; }
+
+		Index result = AddRegister(value, true);
+		constantRegisters.Append(result);
+		constantMap[key] = result;
+		return result;
+	}
+
+	bool IsConstant(Index reg) const { return isConstantRegister[reg]; }
+	Real GetConstant(Index reg) const { return initialRegisters[reg]; }
+
+	//! add unary operation; returns -1, if argument could not be compiled
+	Index AddOperation(Operation operation, Index arg0) { return AddOperationInternal(operation, arg0, arg0, arg0); }
+	//! add binary operation; returns -1, if arguments could not be compiled
+	Index AddOperation(Operation operation, Index arg0, Index arg1) { return AddOperationInternal(operation, arg0, arg1, arg0); }
+	//! add operation with 3 arguments; returns -1, if arguments could not be compiled
+	Index AddOperation(Operation operation, Index arg0, Index arg1, Index arg2) { return AddOperationInternal(operation, arg0, arg1, arg2); }
+
+	//! compile expression (only once per expression) and return register of result
+	Index Compile(const ExpressionBase* expression)
+	{
+		auto search = expressionMap.find(expression);
+		if (search != expressionMap.end()) { return search->second; }
+
+		Index result = expression->CompileToTape(*this);
+		if (result != -1) { expressionMap[expression] = result; }
+		return result;
+	}
+
+	//! compile component of vector expression (only once per expression and component) and return register of result
+	Index CompileComponent(const VectorExpressionBase* expression, Index component)
+	{
+		std::pair<const VectorExpressionBase*, Index> key(expression, component);
+		auto search = vectorComponentMap.find(key);
+		if (search != vectorComponentMap.end()) { return search->second; }
+
+		Index result = expression->CompileComponentToTape(*this, component);
+		if (result != -1) { vectorComponentMap[key] = result; }
+		return result;
+	}
+
+	//! add register holding a return value
+	void AddOutput(Index reg) { outputRegisters.Append(reg); }
+
+	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+	//evaluation
+
+	//! set constants in registers (size >= NumberOfRegisters()); inputs need to be set before every evaluation,
+	//! all other registers are written by instructions before they are read
+	void InitializeConstants(Real* registers) const
+	{
+		for (Index reg : constantRegisters)
+		{
+			registers[reg] = initialRegisters[reg];
+		}
+	}
+
+	//! evaluate single operation
+	static inline Real EvaluateOperation(Operation operation, Real a, Real b, Real c)
+	{
+		switch (operation)
+		{
+		case Operation::Plus: return a + b;
+		case Operation::Minus: return a - b;
+		case Operation::Mul: return a * b;
+		case Operation::Div: return a / b;
+		case Operation::EQ: return Real(a == b);
+		case Operation::NEQ: return Real(a != b);
+		case Operation::GT: return Real(a > b);
+		case Operation::GE: return Real(a >= b);
+		case Operation::LE: return Real(a <= b);
+		case Operation::LT: return Real(a < b);
+		case Operation::UnaryMinus: return -a;
+		case Operation::IsFinite: return std::isfinite(a);
+		case Operation::Abs: return std::fabs(a);
+		case Operation::Sign: return EXUstd::SignReal(a);
+		case Operation::Not: return !a;
+		case Operation::Round: return std::round(a);
+		case Operation::Ceil: return std::ceil(a);
+		case Operation::Floor: return std::floor(a);
+		case Operation::Sqrt: return std::sqrt(a);
+		case Operation::Exp: return std::exp(a);
+		case Operation::Log: return std::log(a);
+		case Operation::Sin: return std::sin(a);
+		case Operation::Cos: return std::cos(a);
+		case Operation::Tan: return std::tan(a);
+		case Operation::ASin: return std::asin(a);
+		case Operation::ACos: return std::acos(a);
+		case Operation::ATan: return std::atan(a);
+		case Operation::Sinh: return std::sinh(a);
+		case Operation::Cosh: return std::cosh(a);
+		case Operation::Tanh: return std::tanh(a);
+		case Operation::ASinh: return std::asinh(a);
+		case Operation::ACosh: return std::acosh(a);
+		case Operation::ATanh: return std::atanh(a);
+		case Operation::Power: return std::pow(a, b);
+		case Operation::Atan2: return std::atan2(a, b);
+		case Operation::Mod: return std::fmod(a, b);
+		case Operation::Min: return std::min(a, b);
+		case Operation::Max: return std::max(a, b);
+		case Operation::IfThenElse: return a ? b : c;
+		default: return std::numeric_limits<Real>::quiet_NaN(); //Load is treated in Evaluate
+		}
+	}
+
+	//! evaluate all instructions; registers must be initialized with InitializeConstants and inputs must be set
+	void Evaluate(Real* registers) const
+	{
+		for (const Instruction& item : instructions)
+		{
+			if (item.operation == Operation::Load)
+			{
+				registers[item.result] = *loadPointers[item.arg0];
+			}
+			else
+			{
+				registers[item.result] = EvaluateOperation(item.operation, registers[item.arg0], registers[item.arg1], registers[item.arg2]);
+			}
+		}
+	}
+
+	//! reverse sweep (adjoint mode of automatic differentiation): compute derivatives of outputRegister w.r.t. all registers into adjoints;
+	//! registers must contain values of previous call to Evaluate(...); adjoints of input registers give the gradient w.r.t. inputs;
+	//! non-differentiable operations (comparison, sign, round, ...) have zero derivatives; abs, min, max and IfThenElse use the active branch
+	void EvaluateAdjoints(const Real* registers, Real* adjoints, Index outputRegister) const
+	{
+		std::fill(adjoints, adjoints + NumberOfRegisters(), 0.);
+		adjoints[outputRegister] = 1.;
+
+		for (Index i = instructions.NumberOfItems() - 1; i >= 0; i--)
+		{
+			const Instruction& item = instructions[i];
+			Real adjoint = adjoints[item.result];
+			if (adjoint == 0.) { continue; } //no contribution to arguments
+
+			Real a = registers[item.arg0];
+			Real b = registers[item.arg1];
+			Real value = registers[item.result];
+			switch (item.operation)
+			{
+			case Operation::Plus: adjoints[item.arg0] += adjoint; adjoints[item.arg1] += adjoint; break;
+			case Operation::Minus: adjoints[item.arg0] += adjoint; adjoints[item.arg1] -= adjoint; break;
+			case Operation::Mul: adjoints[item.arg0] += adjoint * b; adjoints[item.arg1] += adjoint * a; break;
+			case Operation::Div: adjoints[item.arg0] += adjoint / b; adjoints[item.arg1] -= adjoint * value / b; break;
+			case Operation::UnaryMinus: adjoints[item.arg0] -= adjoint; break;
+			case Operation::Abs: adjoints[item.arg0] += adjoint * EXUstd::SignReal(a); break;
+			case Operation::Sqrt: if (value != 0.) { adjoints[item.arg0] += adjoint * 0.5 / value; } break; //infinite derivative at 0 treated as for Power
+			case Operation::Exp: adjoints[item.arg0] += adjoint * value; break;
+			case Operation::Log: adjoints[item.arg0] += adjoint / a; break;
+			case Operation::Sin: adjoints[item.arg0] += adjoint * std::cos(a); break;
+			case Operation::Cos: adjoints[item.arg0] -= adjoint * std::sin(a); break;
+			case Operation::Tan: adjoints[item.arg0] += adjoint * (1. + value * value); break;
+			case Operation::ASin: adjoints[item.arg0] += adjoint / std::sqrt(1. - a * a); break;
+			case Operation::ACos: adjoints[item.arg0] -= adjoint / std::sqrt(1. - a * a); break;
+			case Operation::ATan: adjoints[item.arg0] += adjoint / (1. + a * a); break;
+			case Operation::Sinh: adjoints[item.arg0] += adjoint * std::cosh(a); break;
+			case Operation::Cosh: adjoints[item.arg0] += adjoint * std::sinh(a); break;
+			case Operation::Tanh: adjoints[item.arg0] += adjoint * (1. - value * value); break;
+			case Operation::ASinh: adjoints[item.arg0] += adjoint / std::sqrt(a * a + 1.); break;
+			case Operation::ACosh: adjoints[item.arg0] += adjoint / std::sqrt(a * a - 1.); break;
+			case Operation::ATanh: adjoints[item.arg0] += adjoint / (1. - a * a); break;
+			case Operation::Power:
+				//d/da is also valid for negative base and integer exponent; d/db only exists for positive base
+				//at a==0, d/da is 1 for b==1, 0 for b>1 and infinite for b<1; the latter is treated as non-differentiable (zero)
+				if (a != 0.) { if (b != 0.) { adjoints[item.arg0] += adjoint * b * std::pow(a, b - 1.); } }
+				else if (b == 1.) { adjoints[item.arg0] += adjoint; }
+				if (a > 0.) { adjoints[item.arg1] += adjoint * value * std::log(a); }
+				break;
+			case Operation::Atan2:
+			{
+				Real denominator = a * a + b * b;
+				if (denominator != 0.)
+				{
+					adjoints[item.arg0] += adjoint * b / denominator;
+					adjoints[item.arg1] -= adjoint * a / denominator;
+				}
+				break;
+			}
+			case Operation::Mod: adjoints[item.arg0] += adjoint; adjoints[item.arg1] -= adjoint * std::trunc(a / b); break;
+			case Operation::Min: adjoints[(b < a) ? item.arg1 : item.arg0] += adjoint; break;
+			case Operation::Max: adjoints[(a < b) ? item.arg1 : item.arg0] += adjoint; break;
+			case Operation::IfThenElse: adjoints[a ? item.arg1 : item.arg2] += adjoint; break;
+			default: break; //Load, comparison, IsFinite, Sign, Not, Round, Ceil, Floor: no derivative
+			}
+		}
+	}
+};
+
 //+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
 //+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
 class ExpressionOperatorPlus: public ExpressionBase
@@ -159,6 +506,7 @@ public:
 	{
 		return "(" + left->ToString() + " + " + right->ToString() + ")";
 	}
+	virtual Index CompileToTape(ExpressionTape& tape) const override { return tape.AddOperation(ExpressionTape::Operation::Plus, tape.Compile(left), tape.Compile(right)); }
 };
 
 class ExpressionOperatorMinus: public ExpressionBase {
@@ -181,6 +529,7 @@ public:
 	virtual STDstring ToString() const override {
 		return "(" + left->ToString() + " - " + right->ToString() + ")";
 	}
+	virtual Index CompileToTape(ExpressionTape& tape) const override { return tape.AddOperation(ExpressionTape::Operation::Minus, tape.Compile(left), tape.Compile(right)); }
 };
 
 class ExpressionOperatorMul: public ExpressionBase
@@ -207,6 +556,7 @@ public:
 	{
 		return "(" + left->ToString() + " * " + right->ToString() + ")";
 	}
+	virtual Index CompileToTape(ExpressionTape& tape) const override { return tape.AddOperation(ExpressionTape::Operation::Mul, tape.Compile(left), tape.Compile(right)); }
 };
 
 class ExpressionOperatorDiv: public ExpressionBase {
@@ -238,6 +588,7 @@ public:
 	virtual STDstring ToString() const override {
 		return "(" + left->ToString() + " / " + right->ToString() + ")";
 	}
+	virtual Index CompileToTape(ExpressionTape& tape) const override { return tape.AddOperation(ExpressionTape::Operation::Div, tape.Compile(left), tape.Compile(right)); }
 };
 
 //+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
@@ -261,6 +612,7 @@ public:
 	virtual STDstring ToString() const override {
 		return "(" + left->ToString() + " == " + right->ToString() + ")";
 	}
+	virtual Index CompileToTape(ExpressionTape& tape) const override { return tape.AddOperation(ExpressionTape::Operation::EQ, tape.Compile(left), tape.Compile(right)); }
 };
 
 class ExpressionOperatorNEQ: public ExpressionBase {
@@ -281,6 +633,7 @@ public:
 	virtual STDstring ToString() const override {
 		return "(" + left->ToString() + " != " + right->ToString() + ")";
 	}
+	virtual Index CompileToTape(ExpressionTape& tape) const override { return tape.AddOperation(ExpressionTape::Operation::NEQ, tape.Compile(left), tape.Compile(right)); }
 };
 
 class ExpressionOperatorGT: public ExpressionBase {
@@ -301,6 +654,7 @@ public:
 	virtual STDstring ToString() const override {
 		return "(" + left->ToString() + " > " + right->ToString() + ")";
 	}
+	virtual Index CompileToTape(ExpressionTape& tape) const override { return tape.AddOperation(ExpressionTape::Operation::GT, tape.Compile(left), tape.Compile(right)); }
 };
 
 class ExpressionOperatorGE: public ExpressionBase {
@@ -321,6 +675,7 @@ public:
 	virtual STDstring ToString() const override {
 		return "(" + left->ToString() + " >= " + right->ToString() + ")";
 	}
+	virtual Index CompileToTape(ExpressionTape& tape) const override { return tape.AddOperation(ExpressionTape::Operation::GE, tape.Compile(left), tape.Compile(right)); }
 };
 
 class ExpressionOperatorLE: public ExpressionBase {
@@ -341,6 +696,7 @@ public:
 	virtual STDstring ToString() const override {
 		return "(" + left->ToString() + " <= " + right->ToString() + ")";
 	}
+	virtual Index CompileToTape(ExpressionTape& tape) const override { return tape.AddOperation(ExpressionTape::Operation::LE, tape.Compile(left), tape.Compile(right)); }
 };
 
 class ExpressionOperatorLT: public ExpressionBase {
@@ -361,6 +717,7 @@ public:
 	virtual STDstring ToString() const override {
 		return "(" + left->ToString() + " < " + right->ToString() + ")";
 	}
+	virtual Index CompileToTape(ExpressionTape& tape) const override { return tape.AddOperation(ExpressionTape::Operation::LT, tape.Compile(left), tape.Compile(right)); }
 };
 
 //+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
@@ -383,6 +740,7 @@ public:
 		return operand->ToString();
 		//return "(+" + operand->ToString() + ")";
 	}
+	virtual Index CompileToTape(ExpressionTape& tape) const override { return tape.Compile(operand); }
 };
 
 class ExpressionUnaryMinus: public ExpressionBase {
@@ -402,6 +760,7 @@ public:
 	virtual STDstring ToString() const override {
 		return "(-" + operand->ToString() + ")";
 	}
+	virtual Index CompileToTape(ExpressionTape& tape) const override { return tape.AddOperation(ExpressionTape::Operation::UnaryMinus, tape.Compile(operand)); }
 };
 
 //+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
@@ -420,6 +779,7 @@ public:
 	virtual Real Evaluate() const override { return std::isfinite(operand->Evaluate()); }
 	virtual Real Diff(ExpressionNamedReal* var) const override { CHECKandTHROWstring("Symbolic::isfinite::Diff(...): not possible"); return 0.; }
 	virtual STDstring ToString() const override { return "isfinite(" + operand->ToString() + ")"; }
+	virtual Index CompileToTape(ExpressionTape& tape) const override { return tape.AddOperation(ExpressionTape::Operation::IsFinite, tape.Compile(operand)); }
 };
 
 class ExpressionAbs: public ExpressionBase
@@ -437,6 +797,7 @@ public:
 			return std::numeric_limits<Real>::quiet_NaN();
 		return (val > 0. ? 1 : -1) * operand->Diff(var);
 	}	virtual STDstring ToString() const override { return "abs(" + operand->ToString() + ")"; }
+	virtual Index CompileToTape(ExpressionTape& tape) const override { return tape.AddOperation(ExpressionTape::Operation::Abs, tape.Compile(operand)); }
 };
 
 class ExpressionSign: public ExpressionBase
@@ -450,6 +811,7 @@ public:
 	virtual Real Evaluate() const override { return EXUstd::SignReal(operand->Evaluate()); }
 	virtual Real Diff(ExpressionNamedReal* var) const override { return 0.; }
 	virtual STDstring ToString() const override { return "sign(" + operand->ToString() + ")"; }
+	virtual Index CompileToTape(ExpressionTape& tape) const override { return tape.AddOperation(ExpressionTape::Operation::Sign, tape.Compile(operand)); }
 };
 
 
@@ -464,6 +826,7 @@ public:
 	virtual Real Evaluate() const override { return !(operand->Evaluate()); }
 	virtual Real Diff(ExpressionNamedReal* var) const override { CHECKandTHROWstring("Symbolic::not::Diff(...): not possible"); return 0.; }
 	virtual STDstring ToString() const override { return "Not(" + operand->ToString() + ")"; } //"not" is reserved in C++ and Python
+	virtual Index CompileToTape(ExpressionTape& tape) const override { return tape.AddOperation(ExpressionTape::Operation::Not, tape.Compile(operand)); }
 };
 
 class ExpressionRound: public ExpressionBase
@@ -477,6 +840,7 @@ public:
 	virtual Real Evaluate() const override { return std::round(operand->Evaluate()); }
 	virtual Real Diff(ExpressionNamedReal* var) const override { CHECKandTHROWstring("Symbolic::round::Diff(...): not possible"); return 0.; }
 	virtual STDstring ToString() const override { return "round(" + operand->ToString() + ")"; }
+	virtual Index CompileToTape(ExpressionTape& tape) const override { return tape.AddOperation(ExpressionTape::Operation::Round, tape.Compile(operand)); }
 };
 
 class ExpressionCeil: public ExpressionBase
@@ -490,6 +854,7 @@ public:
 	virtual Real Evaluate() const override { return std::ceil(operand->Evaluate()); }
 	virtual Real Diff(ExpressionNamedReal* var) const override { CHECKandTHROWstring("Symbolic::ceil::Diff(...): not possible"); return 0.; }
 	virtual STDstring ToString() const override { return "ceil(" + operand->ToString() + ")"; }
+	virtual Index CompileToTape(ExpressionTape& tape) const override { return tape.AddOperation(ExpressionTape::Operation::Ceil, tape.Compile(operand)); }
 };
 
 class ExpressionFloor: public ExpressionBase
@@ -503,6 +868,7 @@ public:
 	virtual Real Evaluate() const override { return std::floor(operand->Evaluate()); }
 	virtual Real Diff(ExpressionNamedReal* var) const override { CHECKandTHROWstring("Symbolic::floor::Diff(...): not possible"); return 0.; }
 	virtual STDstring ToString() const override { return "floor(" + operand->ToString() + ")"; }
+	virtual Index CompileToTape(ExpressionTape& tape) const override { return tape.AddOperation(ExpressionTape::Operation::Floor, tape.Compile(operand)); }
 };
 
 
@@ -523,6 +889,7 @@ public:
 		return 0.5 / std::sqrt(val) * operand->Diff(var);
 	}
 	virtual STDstring ToString() const override { return "sqrt(" + operand->ToString() + ")"; }
+	virtual Index CompileToTape(ExpressionTape& tape) const override { return tape.AddOperation(ExpressionTape::Operation::Sqrt, tape.Compile(operand)); }
 };
 
 class ExpressionExp: public ExpressionBase
@@ -536,6 +903,7 @@ public:
 	virtual Real Evaluate() const override { return std::exp(operand->Evaluate()); }
 	virtual double Diff(ExpressionNamedReal* var) const override { return std::exp(operand->Evaluate()) * operand->Diff(var); }
 	virtual STDstring ToString() const override { return "exp(" + operand->ToString() + ")"; }
+	virtual Index CompileToTape(ExpressionTape& tape) const override { return tape.AddOperation(ExpressionTape::Operation::Exp, tape.Compile(operand)); }
 };
 
 class ExpressionLog: public ExpressionBase
@@ -549,6 +917,7 @@ public:
 	virtual Real Evaluate() const override { return std::log(operand->Evaluate()); }
 	virtual double Diff(ExpressionNamedReal* var) const override { return (1 / operand->Evaluate()) * operand->Diff(var); }
 	virtual STDstring ToString() const override { return "log(" + operand->ToString() + ")"; }
+	virtual Index CompileToTape(ExpressionTape& tape) const override { return tape.AddOperation(ExpressionTape::Operation::Log, tape.Compile(operand)); }
 };
 
 //+++++++++++++++++++++++++++++++++++++++++++++
@@ -563,6 +932,7 @@ public:
 	virtual Real Evaluate() const override { return std::sin(operand->Evaluate()); }
 	virtual double Diff(ExpressionNamedReal* var) const override { return std::cos(operand->Evaluate()) * operand->Diff(var); }	
 	virtual STDstring ToString() const override { return "sin(" + operand->ToString() + ")"; }
+	virtual Index CompileToTape(ExpressionTape& tape) const override { return tape.AddOperation(ExpressionTape::Operation::Sin, tape.Compile(operand)); }
 };
 
 class ExpressionCos: public ExpressionBase
@@ -576,6 +946,7 @@ public:
 	virtual Real Evaluate() const override { return std::cos(operand->Evaluate()); }
 	virtual double Diff(ExpressionNamedReal* var) const override { return -std::sin(operand->Evaluate()) * operand->Diff(var); }
 	virtual STDstring ToString() const override { return "cos(" + operand->ToString() + ")"; }
+	virtual Index CompileToTape(ExpressionTape& tape) const override { return tape.AddOperation(ExpressionTape::Operation::Cos, tape.Compile(operand)); }
 };
 
 class ExpressionTan: public ExpressionBase
@@ -592,6 +963,7 @@ public:
 		return (1 + EXUstd::Square(std::tan(operand->Evaluate())) ) * operand->Diff(var);
 	}
 	virtual STDstring ToString() const override { return "tan(" + operand->ToString() + ")"; }
+	virtual Index CompileToTape(ExpressionTape& tape) const override { return tape.AddOperation(ExpressionTape::Operation::Tan, tape.Compile(operand)); }
 };
 
 class ExpressionASin: public ExpressionBase
@@ -612,6 +984,7 @@ public:
 		return operand->Diff(var) / std::sqrt(1 - val * val);
 	}
 	virtual STDstring ToString() const override { return "asin(" + operand->ToString() + ")"; }
+	virtual Index CompileToTape(ExpressionTape& tape) const override { return tape.AddOperation(ExpressionTape::Operation::ASin, tape.Compile(operand)); }
 };
 
 class ExpressionACos: public ExpressionBase
@@ -632,6 +1005,7 @@ public:
 		return -operand->Diff(var) / std::sqrt(1 - val * val);
 	}
 	virtual STDstring ToString() const override { return "acos(" + operand->ToString() + ")"; }
+	virtual Index CompileToTape(ExpressionTape& tape) const override { return tape.AddOperation(ExpressionTape::Operation::ACos, tape.Compile(operand)); }
 };
 
 class ExpressionATan: public ExpressionBase
@@ -648,6 +1022,7 @@ public:
 		return operand->Diff(var) / (1 + EXUstd::Square(operand->Evaluate()));
 	}
 	virtual STDstring ToString() const override { return "atan(" + operand->ToString() + ")"; }
+	virtual Index CompileToTape(ExpressionTape& tape) const override { return tape.AddOperation(ExpressionTape::Operation::ATan, tape.Compile(operand)); }
 };
 
 
@@ -663,6 +1038,7 @@ public:
 	virtual Real Evaluate() const override { return std::sinh(operand->Evaluate()); }
 	virtual double Diff(ExpressionNamedReal* var) const override { return std::cosh(operand->Evaluate()) * operand->Diff(var); }
 	virtual STDstring ToString() const override { return "sinh(" + operand->ToString() + ")"; }
+	virtual Index CompileToTape(ExpressionTape& tape) const override { return tape.AddOperation(ExpressionTape::Operation::Sinh, tape.Compile(operand)); }
 };
 
 class ExpressionCosh: public ExpressionBase
@@ -676,6 +1052,7 @@ public:
 	virtual Real Evaluate() const override { return std::cosh(operand->Evaluate()); }
 	virtual double Diff(ExpressionNamedReal* var) const override { return std::sinh(operand->Evaluate()) * operand->Diff(var); }
 	virtual STDstring ToString() const override { return "cosh(" + operand->ToString() + ")"; }
+	virtual Index CompileToTape(ExpressionTape& tape) const override { return tape.AddOperation(ExpressionTape::Operation::Cosh, tape.Compile(operand)); }
 };
 
 class ExpressionTanh: public ExpressionBase
@@ -689,6 +1066,7 @@ public:
 	virtual Real Evaluate() const override { return std::tanh(operand->Evaluate()); }
 	virtual double Diff(ExpressionNamedReal* var) const override { return (1 - EXUstd::Square(std::tanh(operand->Evaluate()))) * operand->Diff(var); }
 	virtual STDstring ToString() const override { return "tanh(" + operand->ToString() + ")"; }
+	virtual Index CompileToTape(ExpressionTape& tape) const override { return tape.AddOperation(ExpressionTape::Operation::Tanh, tape.Compile(operand)); }
 };
 
 class ExpressionASinh: public ExpressionBase
@@ -705,6 +1083,7 @@ public:
 		return operand->Diff(var) / std::sqrt(EXUstd::Square(operand->Evaluate()) + 1);
 	}
 	virtual STDstring ToString() const override { return "asinh(" + operand->ToString() + ")"; }
+	virtual Index CompileToTape(ExpressionTape& tape) const override { return tape.AddOperation(ExpressionTape::Operation::ASinh, tape.Compile(operand)); }
 };
 
 class ExpressionACosh: public ExpressionBase
@@ -723,6 +1102,7 @@ public:
 		return operand->Diff(var) / std::sqrt(val * val - 1);
 	}
 	virtual STDstring ToString() const override { return "acosh(" + operand->ToString() + ")"; }
+	virtual Index CompileToTape(ExpressionTape& tape) const override { return tape.AddOperation(ExpressionTape::Operation::ACosh, tape.Compile(operand)); }
 };
 
 class ExpressionATanh: public ExpressionBase
@@ -741,6 +1121,7 @@ public:
 		return operand->Diff(var) / (1 - val * val);
 	}
 	virtual STDstring ToString() const override { return "atanh(" + operand->ToString() + ")"; }
+	virtual Index CompileToTape(ExpressionTape& tape) const override { return tape.AddOperation(ExpressionTape::Operation::ATanh, tape.Compile(operand)); }
 };
 
 
@@ -775,6 +1156,7 @@ public:
 	}
 
 	virtual STDstring ToString() const override { return "pow(" + base->ToString() + ", " + exponent->ToString() + ")"; }
+	virtual Index CompileToTape(ExpressionTape& tape) const override { return tape.AddOperation(ExpressionTape::Operation::Power, tape.Compile(base), tape.Compile(exponent)); }
 };
 
 class ExpressionAtan2: public ExpressionBase {
@@ -800,6 +1182,7 @@ public:
 		return (arg1Val * arg2->Diff(var) - arg2Val * arg1->Diff(var)) / denominator;
 	}
 	virtual STDstring ToString() const override { return "atan2(" + arg1->ToString() + ", " + arg2->ToString() + ")"; } //use Python name ...
+	virtual Index CompileToTape(ExpressionTape& tape) const override { return tape.AddOperation(ExpressionTape::Operation::Atan2, tape.Compile(arg1), tape.Compile(arg2)); }
 };
 
 class ExpressionMod: public ExpressionBase {
@@ -817,6 +1200,7 @@ public:
 	virtual Real Evaluate() const override { return std::fmod(arg1->Evaluate(), arg2->Evaluate()); }
 	virtual Real Diff(ExpressionNamedReal* var) const override { CHECKandTHROWstring("Symbolic::mod::Diff(...): not possible"); return 0.; }
 	virtual STDstring ToString() const override { return "mod(" + arg1->ToString() + ", " + arg2->ToString() + ")"; } //use Python name ...
+	virtual Index CompileToTape(ExpressionTape& tape) const override { return tape.AddOperation(ExpressionTape::Operation::Mod, tape.Compile(arg1), tape.Compile(arg2)); }
 };
 
 class ExpressionMin: public ExpressionBase {
@@ -834,6 +1218,7 @@ public:
 	virtual Real Evaluate() const override { return std::min(arg1->Evaluate(), arg2->Evaluate()); }
 	virtual Real Diff(ExpressionNamedReal* var) const override { CHECKandTHROWstring("Symbolic::min::Diff(...): not possible"); return 0.; }
 	virtual STDstring ToString() const override { return "min(" + arg1->ToString() + ", " + arg2->ToString() + ")"; } //use Python name ...
+	virtual Index CompileToTape(ExpressionTape& tape) const override { return tape.AddOperation(ExpressionTape::Operation::Min, tape.Compile(arg1), tape.Compile(arg2)); }
 };
 
 class ExpressionMax: public ExpressionBase {
@@ -851,6 +1236,7 @@ public:
 	virtual Real Evaluate() const override { return std::max(arg1->Evaluate(), arg2->Evaluate()); }
 	virtual Real Diff(ExpressionNamedReal* var) const override { CHECKandTHROWstring("Symbolic::max::Diff(...): not possible"); return 0.; }
 	virtual STDstring ToString() const override { return "max(" + arg1->ToString() + ", " + arg2->ToString() + ")"; } //use Python name ...
+	virtual Index CompileToTape(ExpressionTape& tape) const override { return tape.AddOperation(ExpressionTape::Operation::Max, tape.Compile(arg1), tape.Compile(arg2)); }
 };
 
 
@@ -904,6 +1290,7 @@ public:
 	{
 		return "IfThenElse(" + condition->ToString() +"," + ifTrue->ToString() +"," + ifFalse->ToString() + ")";
 	}
+	virtual Index CompileToTape(ExpressionTape& tape) const override { return tape.AddOperation(ExpressionTape::Operation::IfThenElse, tape.Compile(condition), tape.Compile(ifTrue), tape.Compile(ifFalse)); }
 };
 
 
@@ -937,8 +1324,11 @@ public:
 		return EXUstd::ToString(value);
 	}
 
+	virtual Index CompileToTape(ExpressionTape& tape) const override { return tape.AddConstant(value); }
+
 	virtual void SetValue(Real valueInit) { value = valueInit; }
 	virtual Real GetValue() const { return value; }
+	const Real* GetValuePointer() const { return &value; }
 
 };
 
@@ -957,6 +1347,8 @@ public:
 	{
 		return name; //returns name of variable ...
 	}
+	//! function arguments are inputs of tape, other variables are loaded at every evaluation
+	virtual Index CompileToTape(ExpressionTape& tape) const override { return tape.AddVariable(GetValuePointer()); }
 
 	virtual void SetName(const STDstring& nameInit) { name = nameInit; }
 	virtual const STDstring& GetName() const { return name; }
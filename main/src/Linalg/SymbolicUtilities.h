@@ -195,6 +195,10 @@ class PySymbolicUserFunction : public SymbolicFunction
 {
 	py::dict functionDict; //!< store a copy of the dictionary, to keep the expression trees alive
 
+	ExpressionTape tape;						//!< compiled expression trees; if empty, expression trees are evaluated
+	ResizableArray<Index> argTapeRegisters;		//!< first input register of every argument (-1 if argument is not used in tape)
+	ResizableArray<Index> argTapeSizes;			//!< number of input registers of every argument
+
 	//! list here different kinds of user functions:
 	//std::function<Real(const MainSystem&, Real, Index, Real, Real, Real, Real, Real)> mbsScalarIndexScalar5;
 public:
@@ -243,6 +247,7 @@ public:
 		py::object pyReturnValue = functionDict[keyReturnValue.c_str()];
 
 		Delete(); //delete argRealList, if an earlier list exists
+		tape.Reset(); //earlier compiled function is invalid
 
 		//py::print("argList=", argList);
 		std::vector<py::object> stdArgList = py::cast<std::vector<py::object>>(argList);
@@ -310,6 +315,122 @@ public:
 
 	}
 
+	//! compile expression trees of return value into tape (ExpressionTape) for faster evaluation;
+	//! arguments are inputs of tape; returns false (and keeps evaluating expression trees), if operations cannot be compiled
+	bool Compile()
+	{
+		tape.Reset();
+		argTapeRegisters.SetNumberOfItems(0);
+		argTapeSizes.SetNumberOfItems(0);
+
+		for (SymbolicGeneric& arg : argRealList)
+		{
+			Index firstRegister = -1;
+			Index size = 0;
+			if (arg.IsReal() && arg.GetReal()->IsExpressionNamedReal())
+			{
+				firstRegister = tape.AddInput(arg.GetReal()->GetExpressionNamedReal().GetValuePointer());
+				size = 1;
+			}
+			else if (arg.IsVector() && arg.GetVector()->IsExpressionNamedReal())
+			{
+				//vectors with variable size (StdVector) have size 0 here and thus cannot be accessed in tape
+				const ResizableConstVector& vector = arg.GetVector()->GetExpressionNamedReal().GetVector();
+				size = vector.NumberOfItems();
+				for (Index i = 0; i < size; i++)
+				{
+					Index reg = tape.AddInput(&vector[i]);
+					if (i == 0) { firstRegister = reg; }
+				}
+			}
+			argTapeRegisters.Append(firstRegister);
+			argTapeSizes.Append(size);
+		}
+
+		bool success = true;
+		try
+		{
+			if (returnValue.IsReal())
+			{
+				const SReal& value = *returnValue.GetReal();
+				Index reg = value.GetExpression() ? tape.Compile(value.GetExpression()) : tape.AddConstant(value.GetValue());
+				tape.AddOutput(reg);
+				success = (reg != -1);
+			}
+			else if (returnValue.IsVector() && returnValue.GetVector()->GetExpression())
+			{
+				const VectorExpressionBase* expression = returnValue.GetVector()->GetExpression();
+				Index size = expression->Evaluate().NumberOfItems();
+				success = (size != 0);
+				for (Index i = 0; i < size; i++)
+				{
+					Index reg = tape.CompileComponent(expression, i);
+					tape.AddOutput(reg);
+					success = success && (reg != -1);
+				}
+			}
+			else
+			{
+				success = false; //constant vector or matrix
+			}
+		}
+		catch (const std::exception&) //e.g. inconsistent vector sizes in expression
+		{
+			success = false;
+		}
+
+		tape.ClearCompilationData();
+		if (!success)
+		{
+			tape.Reset();
+		}
+		return success;
+	}
+
+	//! return true, if function is evaluated with compiled tape
+	bool IsCompiled() const { return !tape.IsEmpty(); }
+
+	//! evaluate compiled function and its Jacobian by reverse sweeps of tape (one per return value); jacobian has one row per return value
+	//! and one column per component of Real and vector arguments, in order of arguments; matrix arguments are skipped
+	template<typename... Args>
+	void EvaluateJacobian(ResizableMatrix& jacobian, Args... args)
+	{
+		CHECKandTHROW(IsCompiled(), "PySymbolicUserFunction::EvaluateJacobian: only available for compiled functions");
+		const Real* registers = EvaluateTape(args...);
+
+		Index nColumns = 0;
+		for (Index size : argTapeSizes) { nColumns += size; }
+		jacobian.SetNumberOfRowsAndColumns(tape.NumberOfOutputs(), nColumns);
+
+		static thread_local ResizableArray<Real> adjoints; //no allocation after first call, if size does not increase
+		adjoints.SetNumberOfItems(tape.NumberOfRegisters());
+		for (Index i = 0; i < tape.NumberOfOutputs(); i++)
+		{
+			tape.EvaluateAdjoints(registers, adjoints.GetDataPointer(), tape.GetOutputRegister(i));
+			Index column = 0;
+			for (Index j = 0; j < argTapeRegisters.NumberOfItems(); j++)
+			{
+				for (Index k = 0; k < argTapeSizes[j]; k++)
+				{
+					jacobian(i, column++) = adjoints[argTapeRegisters[j] + k];
+				}
+			}
+		}
+	}
+
+	//! set function, which computes Jacobian of user function with EvaluateJacobian(...); used in PythonUserFunctionBase
+	template<typename... Args>
+	void GetJacobianFunction(std::function<void(ResizableMatrix&, const MainSystem&, Args...)>& function)
+	{
+		function = [this](ResizableMatrix& jacobian, const MainSystem& mainSystem, Args... args)
+		{
+			this->EvaluateJacobian(jacobian, args...);
+		};
+	}
+
+	//! return number of instructions of compiled tape
+	Index NumberOfTapeInstructions() const { return tape.NumberOfInstructions(); }
+
 	virtual bool ArgTypeIsVector(const STDstring& argType) const
 	{
 		return (argType == "StdVector" || argType == "StdVector3D" || argType == "StdVector6D");
@@ -324,6 +445,11 @@ public:
 	template<typename... Args>
 	Real EvaluateReal(const MainSystem& mainSystem, Args... args)
 	{
+		if (IsCompiled())
+		{
+			const Real* registers = EvaluateTape(args...);
+			return registers[tape.GetOutputRegister(0)];
+		}
 		// Process the rest of the arguments
 		Index argIndex = 0;
 		(..., processArgument(args, argRealList, argIndex));
@@ -338,6 +464,11 @@ public:
 	template<typename... Args>
 	bool EvaluateBool(const MainSystem& mainSystem, Args... args)
 	{
+		if (IsCompiled())
+		{
+			const Real* registers = EvaluateTape(args...);
+			return bool(registers[tape.GetOutputRegister(0)]);
+		}
 		// Process the rest of the arguments
 		Index argIndex = 0;
 		(..., processArgument(args, argRealList, argIndex));
@@ -349,6 +480,13 @@ public:
 	template<typename... Args>
 	StdVector2D EvaluateStdVector2D(const MainSystem& mainSystem, Args... args)
 	{
+		if (IsCompiled())
+		{
+			const Real* registers = EvaluateTape(args...);
+			StdVector2D result;
+			GetTapeOutput(registers, result);
+			return result;
+		}
 		// Process the rest of the arguments
 		Index argIndex = 0;
 		(..., processArgument(args, argRealList, argIndex));
@@ -360,6 +498,13 @@ public:
 	template<typename... Args>
 	StdVector3D EvaluateStdVector3D(const MainSystem& mainSystem, Args... args)
 	{
+		if (IsCompiled())
+		{
+			const Real* registers = EvaluateTape(args...);
+			StdVector3D result;
+			GetTapeOutput(registers, result);
+			return result;
+		}
 		// Process the rest of the arguments
 		Index argIndex = 0;
 		(..., processArgument(args, argRealList, argIndex));
@@ -371,6 +516,13 @@ public:
 	template<typename... Args>
 	StdVector6D EvaluateStdVector6D(const MainSystem& mainSystem, Args... args)
 	{
+		if (IsCompiled())
+		{
+			const Real* registers = EvaluateTape(args...);
+			StdVector6D result;
+			GetTapeOutput(registers, result);
+			return result;
+		}
 		// Process the rest of the arguments
 		Index argIndex = 0;
 		(..., processArgument(args, argRealList, argIndex));
@@ -382,6 +534,13 @@ public:
 	template<typename... Args>
 	std::vector<Real> EvaluateStdVector(const MainSystem& mainSystem, Args... args)
 	{
+		if (IsCompiled())
+		{
+			const Real* registers = EvaluateTape(args...);
+			std::vector<Real> result(tape.NumberOfOutputs());
+			GetTapeOutput(registers, result);
+			return result;
+		}
 		// Process the rest of the arguments
 		Index argIndex = 0;
 		(..., processArgument(args, argRealList, argIndex));
@@ -551,6 +710,73 @@ public:
 
 
 protected:
+	//! return registers of tape for current thread; registers are thread-local (shared by all functions evaluated in this thread),
+	//! such that a compiled function can be evaluated concurrently in solver worker threads as well as in other threads (e.g. SolveEnsemble);
+	//! only constants are set here, inputs and results of instructions are written during evaluation
+	Real* GetTapeRegisters() const
+	{
+		static thread_local ResizableArray<Real> threadTapeRegisters;
+		if (threadTapeRegisters.NumberOfItems() < tape.NumberOfRegisters())
+		{
+			threadTapeRegisters.SetNumberOfItems(tape.NumberOfRegisters()); //no allocation after first call, if size does not increase
+		}
+		tape.InitializeConstants(threadTapeRegisters.GetDataPointer());
+		return threadTapeRegisters.GetDataPointer();
+	}
+
+	//! set inputs of compiled tape with given arguments and evaluate tape; returns registers containing the outputs
+	template<typename... Args>
+	const Real* EvaluateTape(Args... args)
+	{
+		Real* registers = GetTapeRegisters();
+		Index argIndex = 0;
+		(..., processArgumentTape(args, registers, argIndex));
+		tape.Evaluate(registers);
+		return registers;
+	}
+
+	//! copy outputs of tape into vector
+	template<typename TVector>
+	void GetTapeOutput(const Real* registers, TVector& result) const
+	{
+		CHECKandTHROW(tape.NumberOfOutputs() == (Index)result.size(), "PySymbolicUserFunction: size of return value of compiled user function does not match");
+		for (Index i = 0; i < tape.NumberOfOutputs(); i++)
+		{
+			result[i] = registers[tape.GetOutputRegister(i)];
+		}
+	}
+
+	//! copy argument into input registers of tape; arguments without input registers (matrices, not used arguments) are skipped
+	void processArgumentTape(Real arg, Real* registers, Index& argIndex) const
+	{
+		Index reg = argTapeRegisters[argIndex++];
+		if (reg != -1) { registers[reg] = arg; }
+	}
+	void processArgumentTape(const ResizableConstVector& arg, Real* registers, Index& argIndex) const
+	{
+		Index reg = argTapeRegisters[argIndex];
+		Index size = argTapeSizes[argIndex++];
+		if (reg != -1)
+		{
+			CHECKandTHROW(arg.NumberOfItems() == size, "PySymbolicUserFunction: size of vector argument of compiled user function does not match");
+			for (Index i = 0; i < size; i++) { registers[reg + i] = arg[i]; }
+		}
+	}
+	template<std::size_t size>
+	void processArgumentTape(const std::array<Real, size>& arg, Real* registers, Index& argIndex) const
+	{
+		Index reg = argTapeRegisters[argIndex];
+		Index sizeTape = argTapeSizes[argIndex++];
+		if (reg != -1)
+		{
+			CHECKandTHROW((Index)size == sizeTape, "PySymbolicUserFunction: size of vector argument of compiled user function does not match");
+			for (Index i = 0; i < sizeTape; i++) { registers[reg + i] = arg[i]; }
+		}
+	}
+	void processArgumentTape(const ResizableConstMatrix& arg, Real* registers, Index& argIndex) const { argIndex++; }
+	void processArgumentTape(const StdMatrix3D& arg, Real* registers, Index& argIndex) const { argIndex++; }
+	void processArgumentTape(const StdMatrix6D& arg, Real* registers, Index& argIndex) const { argIndex++; }
+
 	// Function to process Real arguments
 	void processArgument(Real arg, ResizableArray<SymbolicGeneric>& argRealList, Index& argIndex)
 	{
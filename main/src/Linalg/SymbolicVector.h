@@ -53,6 +53,10 @@ public:
 	virtual void SetComponent(Index i, Real value) { vector[i] = value; }
 	virtual const ResizableConstVector& GetVector() const { return vector; }
 	virtual ResizableConstVector& GetVector() { return vector; }
+	virtual Index CompileComponentToTape(ExpressionTape& tape, Index component) const override
+	{
+		return (component < vector.NumberOfItems()) ? tape.AddConstant(vector[component]) : -1;
+	}
 };
 
 class VectorExpressionNamedReal: public VectorExpressionReal
@@ -71,6 +75,11 @@ public:
 
 	virtual void SetName(const STDstring& nameInit) { name = nameInit; }
 	virtual const STDstring& GetName() const { return name; }
+	//! only function arguments with fixed size can be compiled
+	virtual Index CompileComponentToTape(ExpressionTape& tape, Index component) const override
+	{
+		return (component < vector.NumberOfItems()) ? tape.GetInputRegister(&vector[component]) : -1;
+	}
 };
 
 
@@ -171,6 +180,10 @@ public:
 	//	virtual Real Evaluate() const { return 0; };
 	//	virtual STDstring ToString() const { return ""; }; 
 	//	virtual void Destroy() {}; 
+	virtual Index CompileComponentToTape(ExpressionTape& tape, Index component) const override
+	{
+		return (component < exprList.NumberOfItems()) ? tape.Compile(exprList.GetItem(component)) : -1;
+	}
 };
 
 //+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
@@ -201,6 +214,7 @@ public:
 	{
 		return "(" + left->ToString() + " + " + right->ToString() + ")";
 	}
+	virtual Index CompileComponentToTape(ExpressionTape& tape, Index component) const override { return tape.AddOperation(ExpressionTape::Operation::Plus, tape.CompileComponent(left, component), tape.CompileComponent(right, component)); }
 };
 
 class VectorExpressionOperatorMinus: public VectorExpressionBase
@@ -229,6 +243,7 @@ public:
 	{
 		return "(" + left->ToString() + " - " + right->ToString() + ")";
 	}
+	virtual Index CompileComponentToTape(ExpressionTape& tape, Index component) const override { return tape.AddOperation(ExpressionTape::Operation::Minus, tape.CompileComponent(left, component), tape.CompileComponent(right, component)); }
 };
 
 class VectorExpressionOperatorMultScalarVector: public VectorExpressionBase
@@ -253,6 +268,7 @@ public:
 	{
 		return "(" + left->ToString() + " * " + right->ToString() + ")";
 	}
+	virtual Index CompileComponentToTape(ExpressionTape& tape, Index component) const override { return tape.AddOperation(ExpressionTape::Operation::Mul, tape.Compile(left), tape.CompileComponent(right, component)); }
 };
 
 
@@ -332,6 +348,7 @@ public:
 		return operand->ToString();
 		//return "(+" + operand->ToString() + ")";
 	}
+	virtual Index CompileComponentToTape(ExpressionTape& tape, Index component) const override { return tape.CompileComponent(operand, component); }
 };
 
 class VectorExpressionUnaryMinus: public VectorExpressionBase {
@@ -350,6 +367,7 @@ public:
 	virtual STDstring ToString() const override {
 		return "(-" + operand->ToString() + ")";
 	}
+	virtual Index CompileComponentToTape(ExpressionTape& tape, Index component) const override { return tape.AddOperation(ExpressionTape::Operation::UnaryMinus, tape.CompileComponent(operand, component)); }
 };
 
 
@@ -382,6 +400,7 @@ public:
 	{
 		return left->ToString() + ".MultComponents(" + right->ToString() + ")";
 	}
+	virtual Index CompileComponentToTape(ExpressionTape& tape, Index component) const override { return tape.AddOperation(ExpressionTape::Operation::Mul, tape.CompileComponent(left, component), tape.CompileComponent(right, component)); }
 };
 
 
@@ -418,6 +437,19 @@ public:
 	{
 		return "(" + left->ToString() + " * " + right->ToString() + ")";
 	}
+	//! vector size is taken from current evaluation; components of vectors with variable size cannot be compiled
+	virtual Index CompileToTape(ExpressionTape& tape) const override
+	{
+		Index n = left->Evaluate().NumberOfItems();
+		if (n == 0 || n != right->Evaluate().NumberOfItems()) { return -1; }
+		Index result = tape.AddOperation(ExpressionTape::Operation::Mul, tape.CompileComponent(left, 0), tape.CompileComponent(right, 0));
+		for (Index i = 1; i < n; i++)
+		{
+			result = tape.AddOperation(ExpressionTape::Operation::Plus, result, 
+				tape.AddOperation(ExpressionTape::Operation::Mul, tape.CompileComponent(left, i), tape.CompileComponent(right, i)));
+		}
+		return result;
+	}
 };
 
 class VectorExpressionNormL2: public ExpressionBase
@@ -437,6 +469,19 @@ public:
 	}
 	virtual Real Diff(ExpressionNamedReal* var) const { CHECKandTHROWstring("Symbolic::Vector::NormL2(vector): not implemented"); return 0.; }
 	virtual STDstring ToString() const override { return "NormL2(" + operand->ToString() + ")"; }
+	//! vector size is taken from current evaluation; components of vectors with variable size cannot be compiled
+	virtual Index CompileToTape(ExpressionTape& tape) const override
+	{
+		Index n = operand->Evaluate().NumberOfItems();
+		if (n == 0) { return -1; }
+		Index result = tape.AddOperation(ExpressionTape::Operation::Mul, tape.CompileComponent(operand, 0), tape.CompileComponent(operand, 0));
+		for (Index i = 1; i < n; i++)
+		{
+			result = tape.AddOperation(ExpressionTape::Operation::Plus, result,
+				tape.AddOperation(ExpressionTape::Operation::Mul, tape.CompileComponent(operand, i), tape.CompileComponent(operand, i)));
+		}
+		return tape.AddOperation(ExpressionTape::Operation::Sqrt, result);
+	}
 };
 
 
@@ -468,6 +513,16 @@ public:
 	{
 		return operand->ToString() + "[" + index->ToString() + "]";
 	}
+	//! only constant indices can be compiled
+	virtual Index CompileToTape(ExpressionTape& tape) const override
+	{
+		Index indexRegister = tape.Compile(index);
+		if (indexRegister == -1 || !tape.IsConstant(indexRegister)) { return -1; }
+		Real iReal = tape.GetConstant(indexRegister);
+		Index i = (Index)iReal;
+		if ((Real)i != iReal || i < 0) { return -1; }
+		return tape.CompileComponent(operand, i);
+	}
 };
 
 class VectorExpressionOperatorEQ: public ExpressionBase 
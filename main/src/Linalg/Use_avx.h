@@ -45,6 +45,8 @@
 		#define	_mm_setr_ _mm256_setr_pd
 		#define _mm_setr_zero_ _mm256_setzero_pd
 		#define _mm_store_ _mm256_store_pd
+		#define _mm_store_u _mm256_storeu_pd
+		#define _mm_sqrt_ _mm256_sqrt_pd
 		#define _mm_fmadd_ _mm256_fmadd_pd
 		#define _mm_load_ _mm256_load_pd
 		#define _mm_load_u _mm256_loadu_pd
@@ -62,6 +64,8 @@
 		#define	_mm_setr_ _mm256_setr_ps
 		#define _mm_setr_zero_ _mm256_setzero_ps
 		#define _mm_store_ _mm256_store_ps
+		#define _mm_store_u _mm256_storeu_ps
+		#define _mm_sqrt_ _mm256_sqrt_ps
 		#define _mm_load_ _mm256_load_ps
 		#define _mm_load_u _mm256_loadu_ps
 		#define _mm_fmadd_ _mm256_fmadd_ps
@@ -82,6 +86,8 @@
 		#define	_mm_setr_ _mm512_setr_pd
 		#define _mm_setr_zero_ _mm512_setzero_pd
 		#define _mm_store_ _mm512_store_pd
+		#define _mm_store_u _mm512_storeu_pd
+		#define _mm_sqrt_ _mm512_sqrt_pd
 		#define _mm_load_ _mm512_load_pd
 		#define _mm_load_u _mm512_loadu_pd
 		#define _mm_fmadd_ _mm512_fmadd_pd
@@ -99,6 +105,8 @@
 		#define	_mm_setr_ _mm512_setr_ps
 		#define _mm_setr_zero_ _mm512_setzero_ps
 		#define _mm_store_ _mm512_store_ps
+		#define _mm_store_u _mm512_storeu_ps
+		#define _mm_sqrt_ _mm512_sqrt_ps
 		#define _mm_load_ _mm512_load_ps
 		#define _mm_load_u _mm512_loadu_ps
 		#define _mm_fmadd_ _mm512_fmadd_ps
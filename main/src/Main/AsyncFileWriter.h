@@ -0,0 +1,250 @@
+/** ***********************************************************************************************
+* @class        AsyncFileWriter
+* @brief		buffered binary file output, written to disc by a background I/O thread
+* @details		Details:
+*				- the solver thread copies data into a block per file; full blocks are handed to the I/O thread
+*				- written blocks are recycled (ring of blocks), such that no memory allocation is needed after warm-up
+*				- the number of blocks is limited; if all blocks are pending, the solver thread waits for the I/O thread (back-pressure)
+*				- the I/O thread is started with the first full block or in Finish(), thus not at all if no data is written
+*				- files are not owned by the writer; Finish() must be called before closing the files
+*
+* @date			2026-10-17 (created)
+* @pre			...
+*
+* @copyright    This file is part of Exudyn. Exudyn is free software: you can redistribute it and/or modify it under the terms of the Exudyn license. See 'LICENSE.txt' for more details.
+* @note			Bug reports, support and further information:
+* 				- email: johannes.gerstmayr@uibk.ac.at
+* 				- weblink: https://github.com/jgerstmayr/EXUDYN
+*
+*
+* *** Example code ***
+*
+************************************************************************************************ */
+#ifndef ASYNCFILEWRITER__H
+#define ASYNCFILEWRITER__H
+
+#include <fstream>
+#include <vector>
+#include <deque>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+namespace ExuFile {
+
+	//! writes binary data to a list of files in a background thread
+	class AsyncFileWriter
+	{
+	public:
+		static constexpr size_t blockSize = 1 << 16; //!< bytes of a block; block is handed over to I/O thread if full
+		static constexpr size_t maxPendingBlocks = 64; //!< maximum number of blocks in addition to the current block per file (4MB)
+
+	private:
+		//! chunk of data for one file
+		struct DataBlock
+		{
+			Index fileIndex = 0;
+			std::vector<char> data;
+		};
+
+		std::vector<std::ofstream*> files;	//!< files to write to; not owned by writer
+		std::vector<DataBlock*> currentBlocks;	//!< block per file currently filled by solver thread
+		std::deque<DataBlock*> pendingBlocks;	//!< full blocks waiting for I/O thread
+		std::vector<DataBlock*> freeBlocks;	//!< written blocks, recycled by solver thread
+		std::vector<DataBlock*> allBlocks;		//!< all allocated blocks, for deletion
+		bool flushAfterWrite = false;		//!< if true, I/O thread flushes files after every block
+		bool isStarted = false;				//!< Start() has been called; I/O thread is created when first block is submitted
+
+		std::thread ioThread;
+		std::mutex queueMutex;
+		std::condition_variable queueCondition;	//!< notifies I/O thread about pending blocks
+		std::condition_variable freeCondition;	//!< notifies solver thread about free blocks
+		bool stopThread = false;			//!< signals I/O thread to finish after remaining blocks are written
+		bool writeFailed = false;			//!< set by I/O thread if any file write failed
+
+	public:
+		AsyncFileWriter() {}
+		AsyncFileWriter(const AsyncFileWriter&) = delete;
+		AsyncFileWriter& operator=(const AsyncFileWriter&) = delete;
+		//! move assignment, used for resetting SolverFileData; other writer must not be running
+		AsyncFileWriter& operator=(AsyncFileWriter&& other)
+		{
+			CHECKandTHROW(!other.IsRunning(), "AsyncFileWriter: cannot move running writer");
+			Finish();
+			std::swap(files, other.files);
+			std::swap(currentBlocks, other.currentBlocks);
+			std::swap(freeBlocks, other.freeBlocks);
+			std::swap(allBlocks, other.allBlocks);
+			flushAfterWrite = other.flushAfterWrite;
+			std::swap(isStarted, other.isStarted);
+			return *this;
+		}
+		~AsyncFileWriter()
+		{
+			Finish();
+			for (DataBlock* block : allBlocks) { delete block; }
+		}
+
+		//! return true, if I/O thread is running
+		bool IsRunning() const { return ioThread.joinable(); }
+
+		//! add file, which must be already open in binary mode; returns index of file in writer; only call before Start()
+		Index AddFile(std::ofstream* file)
+		{
+			CHECKandTHROW(!isStarted, "AsyncFileWriter::AddFile: writer already started");
+			files.push_back(file);
+			currentBlocks.push_back(nullptr);
+			return (Index)files.size() - 1;
+		}
+
+		//! start writing; I/O thread is created with first submitted block; if flushAfterWriteInit, every block is flushed to disc after writing
+		void Start(bool flushAfterWriteInit)
+		{
+			CHECKandTHROW(!isStarted, "AsyncFileWriter::Start: writer already started");
+			flushAfterWrite = flushAfterWriteInit;
+			stopThread = false;
+			writeFailed = false;
+			isStarted = true;
+		}
+
+		//! copy numberOfBytes into buffer of file; does not wait for disc I/O
+		void Write(Index fileIndex, const char* bytes, size_t numberOfBytes)
+		{
+			DataBlock*& block = currentBlocks[fileIndex];
+			if (block == nullptr) { block = GetFreeBlock(fileIndex); }
+			block->data.insert(block->data.end(), bytes, bytes + numberOfBytes);
+			if (block->data.size() >= blockSize) { Submit(fileIndex); }
+		}
+
+		//! write Real values in given realSize (4=float, 8=double)
+		void WriteReals(Index fileIndex, const Real* values, Index numberOfValues, Index realSize)
+		{
+			if (realSize == sizeof(Real))
+			{
+				Write(fileIndex, reinterpret_cast<const char*>(values), numberOfValues * sizeof(Real));
+			}
+			else
+			{
+				for (Index i = 0; i < numberOfValues; i++)
+				{
+					float castedValue = (float)values[i];
+					Write(fileIndex, reinterpret_cast<const char*>(&castedValue), sizeof(float));
+				}
+			}
+		}
+
+		//! hand over current (partially filled) blocks of all files to I/O thread
+		void SubmitAll()
+		{
+			for (Index i = 0; i < (Index)files.size(); i++) { Submit(i); }
+		}
+
+		//! write all remaining data, stop I/O thread and remove files; returns false, if any write failed
+		bool Finish()
+		{
+			if (isStarted)
+			{
+				SubmitAll();
+				if (IsRunning())
+				{
+					{
+						std::lock_guard<std::mutex> lock(queueMutex);
+						stopThread = true;
+					}
+					queueCondition.notify_one();
+					ioThread.join();
+				}
+				isStarted = false;
+			}
+			else
+			{
+				for (DataBlock*& block : currentBlocks) //not started: discard data
+				{
+					if (block) { freeBlocks.push_back(block); block = nullptr; }
+				}
+			}
+			files.clear();
+			currentBlocks.clear();
+			return !writeFailed;
+		}
+
+		//! output operator for printing of writer state
+		friend std::ostream& operator<<(std::ostream& os, const AsyncFileWriter& writer)
+		{
+			os << "AsyncFileWriter(files=" << writer.files.size() << ", running=" << writer.IsRunning() << ")";
+			return os;
+		}
+
+	private:
+		//! get recycled or new block; if maximum number of blocks is reached, wait until I/O thread has written a block; called by solver thread
+		DataBlock* GetFreeBlock(Index fileIndex)
+		{
+			DataBlock* block = nullptr;
+			{
+				std::unique_lock<std::mutex> lock(queueMutex);
+				//blocks exceeding the current blocks of files are pending or free, thus waiting always ends
+				if (IsRunning() && freeBlocks.size() == 0 && allBlocks.size() >= files.size() + maxPendingBlocks)
+				{
+					freeCondition.wait(lock, [this] { return freeBlocks.size() != 0; });
+				}
+				if (freeBlocks.size())
+				{
+					block = freeBlocks.back();
+					freeBlocks.pop_back();
+				}
+			}
+			if (block == nullptr) //all blocks in use: allocate new block
+			{
+				block = new DataBlock();
+				block->data.reserve(blockSize + 1024);
+				std::lock_guard<std::mutex> lock(queueMutex);
+				allBlocks.push_back(block);
+			}
+			block->fileIndex = fileIndex;
+			block->data.clear();
+			return block;
+		}
+
+		//! hand over current block of file to I/O thread
+		void Submit(Index fileIndex)
+		{
+			DataBlock*& block = currentBlocks[fileIndex];
+			if (block == nullptr) { return; }
+			{
+				std::lock_guard<std::mutex> lock(queueMutex);
+				pendingBlocks.push_back(block);
+			}
+			block = nullptr;
+			if (isStarted && !IsRunning()) { ioThread = std::thread(&AsyncFileWriter::Loop, this); } //lazy start: only if data is written
+			queueCondition.notify_one();
+		}
+
+		//! I/O thread: write pending blocks until stopThread is set and queue is empty
+		void Loop()
+		{
+			std::unique_lock<std::mutex> lock(queueMutex);
+			while (true)
+			{
+				queueCondition.wait(lock, [this] { return stopThread || pendingBlocks.size() != 0; });
+				if (pendingBlocks.size() == 0) { break; } //stopThread and nothing left to write
+
+				DataBlock* block = pendingBlocks.front();
+				pendingBlocks.pop_front();
+				lock.unlock();
+
+				std::ofstream& file = *files[block->fileIndex];
+				file.write(block->data.data(), block->data.size());
+				if (flushAfterWrite) { file.flush(); }
+				bool failed = file.fail();
+
+				lock.lock();
+				if (failed) { writeFailed = true; }
+				freeBlocks.push_back(block);
+				freeCondition.notify_one();
+			}
+		}
+	};
+
+} //namespace ExuFile
+
+#endif
@@ -0,0 +1,263 @@
+/** ***********************************************************************************************
+* @class        BatchedSpringDampers
+* @brief		structure-of-arrays storage for batched (SIMD) evaluation of homogeneous objects
+* @details		Details:
+*				- objects of same type are registered at Assemble() in a block
+*				- coordinates and parameters are gathered into contiguous arrays before evaluation
+*				- the block is evaluated in one pass (AVX, if available) and scattered into the system vector
+*
+* @date			2026-10-17 (created)
+* @pre			...
+*
+* @copyright    This file is part of Exudyn. Exudyn is free software: you can redistribute it and/or modify it under the terms of the Exudyn license. See 'LICENSE.txt' for more details.
+* @note			Bug reports, support and further information:
+* 				- email: johannes.gerstmayr@uibk.ac.at
+* 				- weblink: https://github.com/jgerstmayr/EXUDYN
+*
+*
+* *** Example code ***
+*
+************************************************************************************************ */
+#ifndef BATCHEDOBJECTS__H
+#define BATCHEDOBJECTS__H
+
+#include "Linalg/Use_avx.h"
+#include <functional>
+
+//! @brief block of ObjectConnectorSpringDamper items (without user function) acting between two NodePoint nodes;
+//! LHS of every item reads [-f, f] for the two nodes; the gathering of coordinates and parameters is done in CSystem
+class BatchedSpringDampers
+{
+public:
+	//data set at Assemble():
+	ResizableArray<Index> objectNumbers;		//!< object numbers of items in block
+	ResizableArray<Index> nodeNumbers0;			//!< node number (NodePoint) of marker 0
+	ResizableArray<Index> nodeNumbers1;			//!< node number (NodePoint) of marker 1
+	ResizableArray<Index> coordinateIndices0;	//!< global ODE2 index of first coordinate of node 0
+	ResizableArray<Index> coordinateIndices1;	//!< global ODE2 index of first coordinate of node 1
+
+	//gathered data (updated at every evaluation):
+	ResizableArray<Real> relPosX, relPosY, relPosZ;	//!< relative position (node 1 - node 0)
+	ResizableArray<Real> relVelX, relVelY, relVelZ;	//!< relative velocity (node 1 - node 0)
+	ResizableArray<Real> stiffness, damping, referenceLength, velocityOffset, force; //!< parameters; stiffness, damping and force are zero for inactive connectors
+
+	//results:
+	ResizableArray<Real> forceX, forceY, forceZ;	//!< force vector acting on node 1; negative force acts on node 0
+
+	//! number of items in block
+	Index NumberOfItems() const { return objectNumbers.NumberOfItems(); }
+
+	//! remove all items and free memory
+	void Reset()
+	{
+		for (ResizableArray<Index>* item : { &objectNumbers, &nodeNumbers0, &nodeNumbers1, &coordinateIndices0, &coordinateIndices1 })
+		{
+			item->Flush();
+		}
+		for (ResizableArray<Real>* item : { &relPosX, &relPosY, &relPosZ, &relVelX, &relVelY, &relVelZ,
+			&stiffness, &damping, &referenceLength, &velocityOffset, &force, &forceX, &forceY, &forceZ })
+		{
+			item->Flush();
+		}
+	}
+
+	//! add item at Assemble(); gathered data is allocated here, such that evaluation needs no memory allocation
+	void Append(Index objectNumber, Index nodeNumber0, Index nodeNumber1, Index coordinateIndex0, Index coordinateIndex1)
+	{
+		objectNumbers.Append(objectNumber);
+		nodeNumbers0.Append(nodeNumber0);
+		nodeNumbers1.Append(nodeNumber1);
+		coordinateIndices0.Append(coordinateIndex0);
+		coordinateIndices1.Append(coordinateIndex1);
+
+		Index n = NumberOfItems();
+		for (ResizableArray<Real>* item : { &relPosX, &relPosY, &relPosZ, &relVelX, &relVelY, &relVelZ,
+			&stiffness, &damping, &referenceLength, &velocityOffset, &force, &forceX, &forceY, &forceZ })
+		{
+			item->SetNumberOfItems(n);
+		}
+	}
+
+	//! compute force of item i with scalar arithmetic, exactly following CObjectConnectorSpringDamper::ComputeConnectorProperties;
+	//! used for remainder of SIMD loop and for zero spring length
+	void ComputeForce(Index i)
+	{
+		Real rx = relPosX[i];
+		Real ry = relPosY[i];
+		Real rz = relPosZ[i];
+		Real vx = relVelX[i];
+		Real vy = relVelY[i];
+		Real vz = relVelZ[i];
+
+		Real springLength = sqrt(rx*rx + ry*ry + rz*rz);
+		Real dx = rx;
+		Real dy = ry;
+		Real dz = rz;
+		if (springLength != 0.)
+		{
+			Real springLengthInv = 1. / springLength;
+			dx *= springLengthInv;
+			dy *= springLengthInv;
+			dz *= springLengthInv;
+		}
+		else
+		{
+			//alternative force direction for zero distance
+			dx = vx;
+			dy = vy;
+			dz = vz;
+			Real relVelNorm = sqrt(vx*vx + vy*vy + vz*vz);
+			if (relVelNorm != 0.)
+			{
+				Real relVelNormInv = 1. / relVelNorm;
+				dx *= relVelNormInv;
+				dy *= relVelNormInv;
+				dz *= relVelNormInv;
+			}
+		}
+
+		Real f = stiffness[i] * (springLength - referenceLength[i]);
+		f += damping[i] * ((vx*dx + vy*dy + vz*dz) - velocityOffset[i]) + force[i];
+
+		forceX[i] = f * dx;
+		forceY[i] = f * dy;
+		forceZ[i] = f * dz;
+	}
+
+	//! compute forces of items in range [start, end) from gathered data; uses AVX in packages of AVXRealSize items, if available
+	void ComputeForces(Index start, Index end)
+	{
+		Index i = start;
+#ifdef useAVX
+		const PReal one = _mm_set1_(1.);
+		for (; i + AVXRealSize <= end; i += AVXRealSize)
+		{
+			PReal rx = _mm_load_u(relPosX.GetDataPointer() + i);
+			PReal ry = _mm_load_u(relPosY.GetDataPointer() + i);
+			PReal rz = _mm_load_u(relPosZ.GetDataPointer() + i);
+			PReal springLength = _mm_sqrt_(rx*rx + ry*ry + rz*rz);
+
+			//zero spring length requires special treatment of force direction, which is rare ==> scalar version
+			alignas(sizeof(PReal)) Real springLengths[AVXRealSize];
+			_mm_store_(springLengths, springLength);
+			bool hasZeroLength = false;
+			for (Index k = 0; k < AVXRealSize; k++)
+			{
+				if (springLengths[k] == 0.) { hasZeroLength = true; }
+			}
+			if (hasZeroLength)
+			{
+				for (Index k = 0; k < AVXRealSize; k++) { ComputeForce(i + k); }
+				continue;
+			}
+
+			PReal springLengthInv = one / springLength;
+			PReal dx = rx * springLengthInv;
+			PReal dy = ry * springLengthInv;
+			PReal dz = rz * springLengthInv;
+
+			PReal vx = _mm_load_u(relVelX.GetDataPointer() + i);
+			PReal vy = _mm_load_u(relVelY.GetDataPointer() + i);
+			PReal vz = _mm_load_u(relVelZ.GetDataPointer() + i);
+
+			PReal f = _mm_load_u(stiffness.GetDataPointer() + i) * (springLength - _mm_load_u(referenceLength.GetDataPointer() + i));
+			f = f + (_mm_load_u(damping.GetDataPointer() + i) * ((vx*dx + vy*dy + vz*dz) - _mm_load_u(velocityOffset.GetDataPointer() + i)) +
+				_mm_load_u(force.GetDataPointer() + i));
+
+			_mm_store_u(forceX.GetDataPointer() + i, f * dx);
+			_mm_store_u(forceY.GetDataPointer() + i, f * dy);
+			_mm_store_u(forceZ.GetDataPointer() + i, f * dz);
+		}
+#endif
+		for (; i < end; i++)
+		{
+			ComputeForce(i);
+		}
+	}
+
+	//! scatter computed forces into system ODE2 RHS (serial, as nodes may be shared)
+	void AddForcesToODE2RHS(Vector& systemODE2Rhs) const
+	{
+		for (Index i = 0; i < NumberOfItems(); i++)
+		{
+			Index c0 = coordinateIndices0[i];
+			Index c1 = coordinateIndices1[i];
+			//LHS = [-f, f] ==> RHS = [f, -f]
+			systemODE2Rhs[c0] += forceX[i];
+			systemODE2Rhs[c0 + 1] += forceY[i];
+			systemODE2Rhs[c0 + 2] += forceZ[i];
+			systemODE2Rhs[c1] -= forceX[i];
+			systemODE2Rhs[c1 + 1] -= forceY[i];
+			systemODE2Rhs[c1 + 2] -= forceZ[i];
+		}
+	}
+};
+
+//! @brief batched Python user function shared by a set of connectors of one type (MainSystem::SetBatchedUserFunction);
+//! in ODE2 RHS and numerical ODE2 Jacobian, inputs of all connectors are recorded in a first pass (several inputs per item for numerical differentiation),
+//! the user function is called once for all recorded inputs and the forces are cached for the following object evaluation; other calls (e.g. output variables) are done per item
+class BatchedUserFunction
+{
+public:
+	Index dimension;							//!< number of force components per item: 1 for scalar connectors, 3 for ObjectConnectorCartesianSpringDamper
+	ResizableArray<Index> objectNumbers;		//!< objects registered for this user function
+	std::function<void(BatchedUserFunction&)> evaluate; //!< calls user function with recorded data and fills forces; set by MainSystem, as it depends on pybind
+
+	//data of one evaluation:
+	Real time;									//!< time of recorded inputs
+	ResizableArray<Index> recordedObjectNumbers;//!< object per recorded input in current evaluation; inputs of one object are contiguous; inactive connectors are not recorded
+	ResizableArray<Real> displacements;			//!< recorded displacements, dimension values per item
+	ResizableArray<Real> velocities;			//!< recorded velocities, dimension values per item
+	ResizableArray<Real> forces;				//!< forces returned by user function, dimension values per item
+	bool isValid;								//!< true, if forces correspond to recorded inputs
+
+	BatchedUserFunction(Index dimensionInit = 1) : dimension(dimensionInit), time(0.), isValid(false) {}
+
+	//! start recording of inputs for new evaluation
+	void ResetRecording()
+	{
+		recordedObjectNumbers.SetNumberOfItems(0);
+		displacements.SetNumberOfItems(0);
+		velocities.SetNumberOfItems(0);
+		isValid = false;
+	}
+
+	//! record inputs of item; returns position in recorded arrays
+	Index Record(Index objectNumber, Real t, const Real* displacement, const Real* velocity)
+	{
+		time = t;
+		recordedObjectNumbers.Append(objectNumber);
+		for (Index k = 0; k < dimension; k++)
+		{
+			displacements.Append(displacement[k]);
+			velocities.Append(velocity[k]);
+		}
+		return recordedObjectNumbers.NumberOfItems() - 1;
+	}
+
+	//! if forces are valid and inputs of item are identical to inputs recorded at firstPosition or following positions of same item, copy force and return true
+	bool GetCachedForce(Index firstPosition, Index objectNumber, Real t, const Real* displacement, const Real* velocity, Real* force) const
+	{
+		if (!isValid || t != time) { return false; }
+		for (Index position = firstPosition; position < recordedObjectNumbers.NumberOfItems() && recordedObjectNumbers[position] == objectNumber; position++)
+		{
+			Index offset = position * dimension;
+			bool isEqual = true;
+			for (Index k = 0; k < dimension; k++)
+			{
+				if (displacements[offset + k] != displacement[k] || velocities[offset + k] != velocity[k]) { isEqual = false; }
+			}
+			if (isEqual)
+			{
+				for (Index k = 0; k < dimension; k++)
+				{
+					force[k] = forces[offset + k];
+				}
+				return true;
+			}
+		}
+		return false;
+	}
+};
+
+#endif
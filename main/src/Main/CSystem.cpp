@@ -31,6 +31,9 @@
 #include "Main/OutputVariable.h" //for GeneralMatrixEXUdense
 #include "Autogenerated/CSensorSuperElement.h" //for sensor integrity checks
 #include "Autogenerated/CSensorUserFunction.h" //for sensor integrity checks
+#include "Autogenerated/CObjectConnectorSpringDamper.h" //for batched objects
+#include "Autogenerated/CMarkerNodePosition.h" //for batched objects
+#include "Autogenerated/CNodePoint.h" //for batched objects
 //#include "Autogenerated/CSensorMarker.h" //for sensor integrity checks
 
 #include "Utilities/TimerStructure.h" //for local CPU time measurement
@@ -42,6 +45,15 @@
 //#include "Utilities/AdvancedMath.h"
 #include "Utilities/Differentiation.h" //include after 
 
+#include "Main/Experimental.h"
+extern PyExperimental pyExperimental; //!this class can be accessed from outside, but also from every other file where this is imported
+
+//! parallel loop over tasks of CostBalancedTasks; every task is one taskmanager task, such that idle threads take next remaining task
+static auto ParallelForTasks = [](Index nTasks, auto g)
+{
+	exuThreading::ParallelFor((NGSsizeType)nTasks, g, (int)nTasks);
+};
+
 
 //! Prepare a newly created System of nodes, objects, loads, ... for computation
 void CSystem::Assemble(const MainSystem& mainSystem)
@@ -834,6 +846,11 @@ void CSystem::PreComputeItemLists()
 	cSystemData.listComputeObjectODE2Lhs.Flush();
 	cSystemData.listComputeObjectODE2LhsUF.Flush();
 	cSystemData.listComputeObjectODE2LhsNoUF.Flush();
+	cSystemData.listComputeObjectODE2LhsNotBatched.Flush();
+	cSystemData.listComputeObjectODE2LhsNoUFNotBatched.Flush();
+	cSystemData.listComputeObjectODE2LhsNoUFColored.Flush();
+	cSystemData.listComputeObjectODE2LhsNoUFColorStart.Flush();
+	cSystemData.batchedSpringDampers.Reset();
 	cSystemData.listComputeObjectODE1Rhs.Flush();
 	cSystemData.listDiscontinuousIteration.Flush();
 	cSystemData.listOfLoadsNoUF.Flush();
@@ -855,6 +872,8 @@ void CSystem::PreComputeItemLists()
 	{
 		//unused
 		CObject* object = cSystemData.GetCObjects()[i];
+		//objects with (Python) user functions must be computed serially; thread safe user functions (compiled symbolic) are computed in parallel
+		bool hasSerialUserFunction = object->HasUserFunction() && !object->HasThreadSafeUserFunction();
 
 		//if (EXUstd::IsOfType(object->GetType(), CObjectType::Connector))
 		//{
@@ -876,7 +895,7 @@ void CSystem::PreComputeItemLists()
 				EXUstd::IsOfType(object->GetType(), CObjectType::Connector))
 			{
 				cSystemData.listComputeObjectODE2Lhs.Append(i); 
-				if (object->HasUserFunction()) { cSystemData.listComputeObjectODE2LhsUF.Append(i); }
+				if (hasSerialUserFunction) { cSystemData.listComputeObjectODE2LhsUF.Append(i); }
 				else { cSystemData.listComputeObjectODE2LhsNoUF.Append(i); }
 			}
 			else 
@@ -898,7 +917,7 @@ void CSystem::PreComputeItemLists()
 			if (cSystemData.GetLocalToGlobalODE2()[i].NumberOfItems() != 0)
 			{
 				cSystemData.objectsBodyWithODE2Coords.Append(i);
-				if (object->HasUserFunction()) { cSystemData.objectsBodyWithODE2CoordsUF.Append(i); }
+				if (hasSerialUserFunction) { cSystemData.objectsBodyWithODE2CoordsUF.Append(i); }
 				else { cSystemData.objectsBodyWithODE2CoordsNoUF.Append(i); }
 			}
 		}
@@ -981,7 +1000,7 @@ void CSystem::PreComputeItemLists()
 	for (Index i = 0; i < cSystemData.GetCLoads().NumberOfItems(); i++)
 	{
 		CLoad* load = cSystemData.GetCLoads()[i];
-		if (load->HasUserFunction())
+		if (load->HasUserFunction() && !load->HasThreadSafeUserFunction())
 		{
 			cSystemData.listOfLoadsUF.Append(i);
 		}
@@ -998,6 +1017,113 @@ void CSystem::PreComputeItemLists()
 	//std::cout << "cSystemData.nodesODE2WithAE = " << cSystemData.nodesODE2WithAE << "\n";
 	//std::cout << "cSystemData.listObjectProjectedReactionForcesODE2 = " << cSystemData.listObjectProjectedReactionForcesODE2 << "\n";
 
+	PreComputeBatchedObjects();
+	ComputeObjectODE2LhsColoring();
+	InvalidateConstantJacobianODE2Cache(); //objects, markers or coordinates may have changed
+	ResetCostBalancedTasks(); //costs refer to positions in item lists
+}
+
+//! put objects of listComputeObjectODE2LhsNoUF, which allow batched evaluation, into structure-of-arrays blocks;
+//! currently only done for ObjectConnectorSpringDamper between two NodePoint nodes, if experimental.batchedObjectEvaluation=True
+void CSystem::PreComputeBatchedObjects()
+{
+	BatchedSpringDampers& batch = cSystemData.batchedSpringDampers;
+
+	for (Index i : cSystemData.listComputeObjectODE2LhsNoUF)
+	{
+		bool isBatched = false;
+		CObjectConnectorSpringDamper* springDamper = dynamic_cast<CObjectConnectorSpringDamper*>(cSystemData.GetCObjects()[i]);
+		if (pyExperimental.batchedObjectEvaluation && springDamper != nullptr && !springDamper->HasUserFunction())
+		{
+			const ArrayIndex& markerNumbers = springDamper->GetMarkerNumbers();
+			const CMarkerNodePosition* marker0 = dynamic_cast<const CMarkerNodePosition*>(cSystemData.GetCMarkers()[markerNumbers[0]]);
+			const CMarkerNodePosition* marker1 = dynamic_cast<const CMarkerNodePosition*>(cSystemData.GetCMarkers()[markerNumbers[1]]);
+			if (marker0 != nullptr && marker1 != nullptr)
+			{
+				Index nodeNumber0 = marker0->GetNodeNumber();
+				Index nodeNumber1 = marker1->GetNodeNumber();
+				const CNodePoint* node0 = dynamic_cast<const CNodePoint*>(cSystemData.GetCNodes()[nodeNumber0]);
+				const CNodePoint* node1 = dynamic_cast<const CNodePoint*>(cSystemData.GetCNodes()[nodeNumber1]);
+				if (node0 != nullptr && node1 != nullptr)
+				{
+					batch.Append(i, nodeNumber0, nodeNumber1, node0->GetGlobalODE2CoordinateIndex(), node1->GetGlobalODE2CoordinateIndex());
+					isBatched = true;
+				}
+			}
+		}
+		if (!isBatched) { cSystemData.listComputeObjectODE2LhsNoUFNotBatched.Append(i); }
+	}
+
+	//objects with batched user functions (MainSystem::SetBatchedUserFunction):
+	Index nObjects = cSystemData.GetCObjects().NumberOfItems();
+	cSystemData.objectBatchedUserFunction.SetNumberOfItems(nObjects);
+	cSystemData.objectBatchedUserFunction.SetAll(EXUstd::InvalidIndex);
+	cSystemData.objectBatchedUserFunctionPosition.SetNumberOfItems(nObjects);
+	cSystemData.objectBatchedUserFunctionPosition.SetAll(EXUstd::InvalidIndex);
+	cSystemData.batchedUserFunctionRecording = false;
+	for (Index k = 0; k < cSystemData.batchedUserFunctions.NumberOfItems(); k++)
+	{
+		for (Index i : cSystemData.batchedUserFunctions[k]->objectNumbers)
+		{
+			if (i < nObjects) { cSystemData.objectBatchedUserFunction[i] = k; }
+		}
+	}
+
+	if (batch.NumberOfItems() == 0)
+	{
+		cSystemData.listComputeObjectODE2LhsNotBatched.CopyFrom(cSystemData.listComputeObjectODE2Lhs);
+	}
+	else
+	{
+		cSystemData.listComputeObjectODE2LhsNotBatched.CopyFrom(cSystemData.listComputeObjectODE2LhsUF);
+		cSystemData.listComputeObjectODE2LhsNotBatched.AppendArray(cSystemData.listComputeObjectODE2LhsNoUFNotBatched);
+	}
+}
+
+//! compute coloring of listComputeObjectODE2LhsNoUFNotBatched, such that objects of same color do not share ODE2 coordinates;
+//! objects of one color can then write their residuals directly (lock-free) into the system vector in multithreaded computation;
+//! greedy coloring is done color by color; objects remaining after maxColors are stored as uncolored objects at the end of the list
+void CSystem::ComputeObjectODE2LhsColoring()
+{
+	const Index maxColors = 64; //limits effort for objects sharing many coordinates (e.g., many connectors attached to one node)
+
+	ResizableArray<Index>& coloredList = cSystemData.listComputeObjectODE2LhsNoUFColored;
+	ResizableArray<Index>& colorStart = cSystemData.listComputeObjectODE2LhsNoUFColorStart;
+	coloredList.SetNumberOfItems(0);
+	colorStart.SetNumberOfItems(0);
+
+	ArrayIndex coordinateColor(cSystemData.GetNumberOfCoordinatesODE2()); //last color assigned to coordinate
+	coordinateColor.SetAll(-1);
+
+	ArrayIndex remainingObjects(cSystemData.listComputeObjectODE2LhsNoUFNotBatched);
+	ArrayIndex conflictingObjects;
+
+	Index color = 0;
+	while (remainingObjects.NumberOfItems() != 0 && color < maxColors)
+	{
+		colorStart.Append(coloredList.NumberOfItems());
+		conflictingObjects.SetNumberOfItems(0);
+		for (Index j : remainingObjects)
+		{
+			const ArrayIndex& ltg = cSystemData.GetLocalToGlobalODE2()[j];
+			bool hasConflict = false;
+			for (Index k : ltg)
+			{
+				if (coordinateColor[k] == color) { hasConflict = true; break; }
+			}
+
+			if (hasConflict) { conflictingObjects.Append(j); }
+			else
+			{
+				for (Index k : ltg) { coordinateColor[k] = color; }
+				coloredList.Append(j);
+			}
+		}
+		remainingObjects.CopyFrom(conflictingObjects);
+		color++;
+	}
+	colorStart.Append(coloredList.NumberOfItems()); //marks end of last color and begin of uncolored objects
+	coloredList.AppendArray(remainingObjects);
 }
 
 //! reset lists for Lie groups when Assemble is called; this should require no memory (e.g. in expl. integrators)
@@ -1387,6 +1513,33 @@ bool CSystem::HasConstantMassMatrix()
 	return isConstant;
 }
 
+//! check if computation needs Python user functions; symbolic user functions, which are compiled, do not need Python
+bool CSystem::HasPythonUserFunctions() const
+{
+	if (!pythonUserFunctions.preStepFunction.IsThreadSafe() || !pythonUserFunctions.postStepFunction.IsThreadSafe() ||
+		!pythonUserFunctions.postNewtonFunction.IsThreadSafe())
+	{
+		return true;
+	}
+	for (const CObject* object : cSystemData.GetCObjects())
+	{
+		if (object->HasUserFunction() && !object->HasThreadSafeUserFunction()) { return true; }
+	}
+	for (const CLoad* load : cSystemData.GetCLoads())
+	{
+		if (load->HasUserFunction() && !load->HasThreadSafeUserFunction()) { return true; }
+	}
+	for (const CSensor* sensor : cSystemData.GetCSensors())
+	{
+		if (sensor->GetType() == SensorType::UserFunction &&
+			!((const CSensorUserFunction*)sensor)->GetParameters().sensorUserFunction.IsThreadSafe())
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
 //Index TScomputeODE2LHSobject;
 //TimerStructureRegistrator TSRcomputeODE2LHSobject("computeODE2LHSobject", TScomputeODE2LHSobject, globalTimers);
 //Index TScomputeODE2LHSconnector;
@@ -1447,6 +1600,16 @@ void CSystem::ComputeSystemODE2RHS(TemporaryComputationDataArray& tempArray, Vec
 {
 	//STARTGLOBALTIMER(TScomputeObjectODE2);
 	systemODE2Rhs.SetAll(0.);
+	cSystemData.excludeConstantJacobianODE2Parts = false; //residual always needs full object equations, also after exception in jacobian computation
+
+	if (cSystemData.batchedUserFunctions.NumberOfItems() != 0)
+	{
+		TemporaryComputationData& temp = tempArray[0];
+		EvaluateBatchedUserFunctions([this, &temp](Index i)
+		{
+			ComputeObjectODE2LHS(temp, cSystemData.GetCObjects()[i], temp.localODE2LHS, i);
+		});
+	}
 
 	int nItems = cSystemData.listComputeObjectODE2LhsNoUF.NumberOfItems();
 	Index nThreads = exuThreading::TaskManager::GetNumThreads();
@@ -1461,26 +1624,93 @@ void CSystem::ComputeSystemODE2RHS(TemporaryComputationDataArray& tempArray, Vec
 			tempArray[i].sparseVector.SetAllZero();
 		}
 
-		//STARTGLOBALTIMER(TScomputeObjectODE2);
-		Index taskSplit = GetTaskSplit(nItems, nThreads);
-		exuThreading::ParallelFor(nItems, [this, &systemODE2Rhs, &tempArray, &nItems](NGSsizeType j) //&temp,&systemODE2Rhs,&cSystemData
+		//objects which are processed with thread-local sparse vectors
+		const ResizableArray<Index>* listSparseVector = &cSystemData.listComputeObjectODE2LhsNoUFNotBatched;
+		Index offsetSparseVector = 0;
+
+		if (solverData.useColoringForResiduals)
 		{
-			Index i = cSystemData.listComputeObjectODE2Lhs[(Index)j];
-			Index threadID = exuThreading::TaskManager::GetThreadId();
+			//objects of one color do not share coordinates and can write directly into system vector
+			const ResizableArray<Index>& coloredList = cSystemData.listComputeObjectODE2LhsNoUFColored;
+			const ResizableArray<Index>& colorStart = cSystemData.listComputeObjectODE2LhsNoUFColorStart;
 
-			TemporaryComputationData& temp = tempArray[threadID];
-			ArrayIndex& ltgODE2 = cSystemData.GetLocalToGlobalODE2()[i];
+			for (Index c = 0; c < colorStart.NumberOfItems() - 1; c++)
+			{
+				Index start = colorStart[c];
+				Index nColorItems = colorStart[c + 1] - start;
+				if (nColorItems >= solverData.multithreadedLLimitResiduals)
+				{
+					Index taskSplit = GetTaskSplit(nColorItems, nThreads);
+					exuThreading::ParallelFor(nColorItems, [this, &systemODE2Rhs, &tempArray, &coloredList, &start](NGSsizeType j)
+					{
+						Index i = coloredList[start + (Index)j];
+						TemporaryComputationData& temp = tempArray[exuThreading::TaskManager::GetThreadId()];
+						ArrayIndex& ltgODE2 = cSystemData.GetLocalToGlobalODE2()[i];
+
+						if (ComputeObjectODE2LHS(temp, cSystemData.GetCObjects()[i], temp.localODE2LHS, i))
+						{
+							for (Index k = 0; k < temp.localODE2LHS.NumberOfItems(); k++)
+							{
+								systemODE2Rhs[ltgODE2[k]] -= temp.localODE2LHS[k]; //no conflicts within one color
+							}
+						}
+					}, taskSplit);
+				}
+				else //for small colors, parallelization does not pay off
+				{
+					TemporaryComputationData& temp = tempArray[0];
+					for (Index j = start; j < start + nColorItems; j++)
+					{
+						Index i = coloredList[j];
+						ArrayIndex& ltgODE2 = cSystemData.GetLocalToGlobalODE2()[i];
 
-			if (ComputeObjectODE2LHS(temp, cSystemData.GetCObjects()[i], temp.localODE2LHS, i))
+						if (ComputeObjectODE2LHS(temp, cSystemData.GetCObjects()[i], temp.localODE2LHS, i))
+						{
+							for (Index k = 0; k < temp.localODE2LHS.NumberOfItems(); k++)
+							{
+								systemODE2Rhs[ltgODE2[k]] -= temp.localODE2LHS[k];
+							}
+						}
+					}
+				}
+			}
+			//uncolored objects are processed with thread-local sparse vectors:
+			listSparseVector = &coloredList;
+			offsetSparseVector = colorStart.Last();
+		}
+
+		//STARTGLOBALTIMER(TScomputeObjectODE2);
+		Index nItemsSparseVector = listSparseVector->NumberOfItems() - offsetSparseVector;
+		if (nItemsSparseVector != 0)
+		{
+			Index taskSplit = GetTaskSplit(nItemsSparseVector, nThreads);
+			auto computeItem = [this, &systemODE2Rhs, &tempArray, &listSparseVector, &offsetSparseVector](NGSsizeType j) //&temp,&systemODE2Rhs,&cSystemData
 			{
-				//now add RHS to system vector
-				for (Index k = 0; k < temp.localODE2LHS.NumberOfItems(); k++)
+				Index i = (*listSparseVector)[offsetSparseVector + (Index)j];
+				Index threadID = exuThreading::TaskManager::GetThreadId();
+
+				TemporaryComputationData& temp = tempArray[threadID];
+				ArrayIndex& ltgODE2 = cSystemData.GetLocalToGlobalODE2()[i];
+
+				if (ComputeObjectODE2LHS(temp, cSystemData.GetCObjects()[i], temp.localODE2LHS, i))
 				{
-					tempArray[threadID].sparseVector.AddIndexAndValue(ltgODE2[k], temp.localODE2LHS[k]);
-					//systemODE2Rhs[ltgODE2[k]] -= temp.localODE2LHS[k]; //negative sign ==> stiffness/damping on LHS of equations
+					//now add RHS to system vector
+					for (Index k = 0; k < temp.localODE2LHS.NumberOfItems(); k++)
+					{
+						tempArray[threadID].sparseVector.AddIndexAndValue(ltgODE2[k], temp.localODE2LHS[k]);
+						//systemODE2Rhs[ltgODE2[k]] -= temp.localODE2LHS[k]; //negative sign ==> stiffness/damping on LHS of equations
+					}
 				}
+			};
+			if (solverData.useCostBalancedTasks)
+			{
+				costBalancedTasksODE2RHS.ParallelFor(nItemsSparseVector, taskSplit, ParallelForTasks, computeItem);
 			}
-		}, taskSplit);
+			else
+			{
+				exuThreading::ParallelFor(nItemsSparseVector, computeItem, taskSplit);
+			}
+		}
 		//STOPGLOBALTIMER(TScomputeObjectODE2);
 		outputBuffer.SetSuspendWriting(false);
 
@@ -1519,7 +1749,7 @@ void CSystem::ComputeSystemODE2RHS(TemporaryComputationDataArray& tempArray, Vec
 		//STARTGLOBALTIMER(TScomputeObjectODE2);
 		//systemODE2Rhs.SetAll(0.);
 
-		for (Index j : cSystemData.listComputeObjectODE2Lhs)
+		for (Index j : cSystemData.listComputeObjectODE2LhsNotBatched)
 		{
 			ArrayIndex& ltgODE2 = cSystemData.GetLocalToGlobalODE2()[j];
 
@@ -1538,6 +1768,13 @@ void CSystem::ComputeSystemODE2RHS(TemporaryComputationDataArray& tempArray, Vec
 	//pout << "systemODE2Rhs=" << systemODE2Rhs << "\n";
 	//STOPGLOBALTIMER(TScomputeObjectODE2);
 
+	if (cSystemData.batchedSpringDampers.NumberOfItems() != 0)
+	{
+		ComputeBatchedODE2RHS(systemODE2Rhs);
+	}
+
+	InvalidateBatchedUserFunctions(); //cached forces are only used within this evaluation
+
 	//this part is anyway done in parallel:
 	for (GeneralContact* gc : generalContacts) //usually only 1
 	{
@@ -1553,6 +1790,113 @@ void CSystem::ComputeSystemODE2RHS(TemporaryComputationDataArray& tempArray, Vec
 
 }
 
+//! record inputs of all connectors with batched user functions by calling recordObject, which evaluates the object with zero user function force;
+//! then call each batched user function once with the recorded inputs; connectors use the cached forces in the following evaluation
+void CSystem::EvaluateBatchedUserFunctions(const std::function<void(Index)>& recordObject)
+{
+	for (BatchedUserFunction* batchedUserFunction : cSystemData.batchedUserFunctions)
+	{
+		batchedUserFunction->ResetRecording();
+		for (Index i : batchedUserFunction->objectNumbers)
+		{
+			if (i < cSystemData.objectBatchedUserFunctionPosition.NumberOfItems()) { cSystemData.objectBatchedUserFunctionPosition[i] = EXUstd::InvalidIndex; }
+		}
+	}
+
+	cSystemData.batchedUserFunctionRecording = true;
+	for (BatchedUserFunction* batchedUserFunction : cSystemData.batchedUserFunctions)
+	{
+		for (Index i : batchedUserFunction->objectNumbers)
+		{
+			if (i < cSystemData.GetCObjects().NumberOfItems())
+			{
+				recordObject(i);
+			}
+		}
+	}
+	cSystemData.batchedUserFunctionRecording = false;
+
+	for (BatchedUserFunction* batchedUserFunction : cSystemData.batchedUserFunctions)
+	{
+		if (batchedUserFunction->recordedObjectNumbers.NumberOfItems() != 0)
+		{
+			batchedUserFunction->evaluate(*batchedUserFunction);
+			batchedUserFunction->isValid = true;
+		}
+	}
+}
+
+//! invalidate cached forces of batched user functions, such that following evaluations call the per-item user function
+void CSystem::InvalidateBatchedUserFunctions()
+{
+	for (BatchedUserFunction* batchedUserFunction : cSystemData.batchedUserFunctions)
+	{
+		batchedUserFunction->isValid = false;
+	}
+}
+
+//! compute ODE2 RHS of objects in structure-of-arrays blocks (batchedSpringDampers):
+//! coordinates and parameters are gathered (multithreaded for large blocks), forces are evaluated in one pass and scattered serially into systemODE2Rhs
+void CSystem::ComputeBatchedODE2RHS(Vector& systemODE2Rhs)
+{
+	BatchedSpringDampers& batch = cSystemData.batchedSpringDampers;
+	Index nItems = batch.NumberOfItems();
+
+	const Vector& q = cSystemData.GetCData().currentState.ODE2Coords;
+	const Vector& q_t = cSystemData.GetCData().currentState.ODE2Coords_t;
+
+	//gather and evaluate items in range [start, end)
+	auto gatherAndCompute = [this, &batch, &q, &q_t](Index start, Index end)
+	{
+		for (Index i = start; i < end; i++)
+		{
+			const CObjectConnectorSpringDamperParameters& parameters = ((const CObjectConnectorSpringDamper*)cSystemData.GetCObjects()[batch.objectNumbers[i]])->GetParameters();
+			const Vector3D& ref0 = ((const CNodePoint*)cSystemData.GetCNodes()[batch.nodeNumbers0[i]])->GetParameters().referenceCoordinates;
+			const Vector3D& ref1 = ((const CNodePoint*)cSystemData.GetCNodes()[batch.nodeNumbers1[i]])->GetParameters().referenceCoordinates;
+			Index c0 = batch.coordinateIndices0[i];
+			Index c1 = batch.coordinateIndices1[i];
+
+			batch.relPosX[i] = (ref1[0] + q[c1]) - (ref0[0] + q[c0]);
+			batch.relPosY[i] = (ref1[1] + q[c1 + 1]) - (ref0[1] + q[c0 + 1]);
+			batch.relPosZ[i] = (ref1[2] + q[c1 + 2]) - (ref0[2] + q[c0 + 2]);
+			batch.relVelX[i] = q_t[c1] - q_t[c0];
+			batch.relVelY[i] = q_t[c1 + 1] - q_t[c0 + 1];
+			batch.relVelZ[i] = q_t[c1 + 2] - q_t[c0 + 2];
+
+			Real activeFactor = parameters.activeConnector ? 1. : 0.;
+			batch.stiffness[i] = activeFactor * parameters.stiffness;
+			batch.damping[i] = activeFactor * parameters.damping;
+			batch.force[i] = activeFactor * parameters.force;
+			batch.referenceLength[i] = parameters.referenceLength;
+			batch.velocityOffset[i] = parameters.velocityOffset;
+		}
+		batch.ComputeForces(start, end);
+	};
+
+	Index nThreads = exuThreading::TaskManager::GetNumThreads();
+	if (nThreads > 1 && nItems >= solverData.multithreadedLLimitResiduals)
+	{
+		//split into tasks with size multiple of AVXRealSize, such that SIMD packages are not split
+		Index nTasks = GetTaskSplit(nItems / AVXRealSize + 1, nThreads);
+		Index itemsPerTask = ((nItems / nTasks) / AVXRealSize + 1) * AVXRealSize;
+		nTasks = (nItems + itemsPerTask - 1) / itemsPerTask;
+
+		outputBuffer.SetSuspendWriting(true); //may not write to python during parallel computation
+		exuThreading::ParallelFor(nTasks, [&gatherAndCompute, &itemsPerTask, &nItems](NGSsizeType k)
+		{
+			Index start = (Index)k * itemsPerTask;
+			gatherAndCompute(start, EXUstd::Minimum(start + itemsPerTask, nItems));
+		}, nTasks);
+		outputBuffer.SetSuspendWriting(false);
+	}
+	else
+	{
+		gatherAndCompute(0, nItems);
+	}
+
+	batch.AddForcesToODE2RHS(systemODE2Rhs);
+}
+
 ////+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
 ////! compute system right-hand-side (RHS) of second order ordinary differential equations (ODE) to 'ode2rhs' for ODE2 part
 //void CSystem::ComputeSystemODE2RHS(TemporaryComputationDataArray& tempArray, Vector& systemODE2Rhs)
@@ -2429,12 +2773,269 @@ void CSystem::PostDiscontinuousIterationStep()
 //                          JACOBIANS
 //++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
 
+//! compute analytic (function-based) ODE2 jacobian of object j into temp.jacobianODE2Container (dense or sparse triplets);
+//! returns false, if no analytic jacobian is available and numerical differentiation is needed
+bool CSystem::ComputeObjectJacobianODE2(Index j, TemporaryComputationData& temp, const NumericalDifferentiationSettings& numDiff,
+	Real factorODE2, Real factorODE2_t)
+{
+	CObject* object = cSystemData.GetCObjects()[j];
+	ArrayIndex& ltgODE2 = cSystemData.GetLocalToGlobalODE2()[j];
+	JacobianType::Type jacType = object->GetAvailableJacobians();
+
+	bool jacobianComputed = false;
+	if (!numDiff.forODE2 && ((jacType & (JacobianType::ODE2_ODE2_function + JacobianType::ODE2_ODE2_t_function/* + JacobianType::ODE2_ODE1_function*/)) != 0))
+	{
+		if (!EXUstd::IsOfType(object->GetType(), CObjectType::Connector))
+		{   // ++++++++++++++ compute object jacobian, e.g., finite element or rigid body
+			jacobianComputed = true;
+
+			//matrix size set inside object
+			object->ComputeJacobianODE2_ODE2(temp.jacobianODE2Container, temp.jacobianTemp,
+				-factorODE2, -factorODE2_t, j, ltgODE2); //minus (-) because in numerical mode, f0-f1 leads to negative sign (RHS ==> LHS)
+			//ODE2_ODE1 missing here!
+		} //if (!EXUstd::IsOfType(object->GetType(), CObjectType::Connector)
+		else if (!numDiff.forODE2connectors)
+		{	// ++++++++++++++ go the lengthier way: compute connector jacobian, e.g., spring-damper
+			CObjectConnector* connector = (CObjectConnector*)object;
+			//pout << "analytic jac connector \n";
+			const ArrayIndex& markerNumbers = connector->GetMarkerNumbers();
+			jacobianComputed = true;
+			bool jacDerivNonZero = false;
+			if (numDiff.jacobianConnectorDerivative) //if ignored, it will not be considered
+			{
+				for (Index k = 0; k < markerNumbers.NumberOfItems(); k++)
+				{
+					jacobianComputed &= ((cSystemData.GetCMarker(markerNumbers[k]).GetType() & Marker::JacobianDerivativeAvailable) != 0);
+					jacDerivNonZero |= ((cSystemData.GetCMarker(markerNumbers[k]).GetType() & Marker::JacobianDerivativeNonZero) != 0);
+				}
+			}
+
+			if (jacobianComputed)
+			{
+				//pout << "  continue\n";
+				//compute MarkerData for connector:
+				const bool computeJacobian = true; //jacobian needed for jacobian computation ...
+				cSystemData.ComputeMarkerDataStructure(connector, computeJacobian, temp.markerDataStructure);
+				//pout << "compute connector " << j << " jacobian \n";
+				if (jacDerivNonZero) //call needed, if one marker has non-zero derivative ==> compute jacobianForce for both cases
+				{
+					Vector6D jacobianForce;
+					connector->ComputeJacobianForce6D(temp.markerDataStructure, j, jacobianForce);
+					//even though that force on marker0 acts with negative sign, 
+					//  the different signs are accounted for in connector->ComputeJacobianODE2_ODE2(...)
+					//  ==> but this could also be done here !
+					//pout << "  jacobian force = " << temp.jacobianForce << " \n";
+					for (Index k = 0; k < markerNumbers.NumberOfItems(); k++)
+					{
+						cSystemData.GetCMarkers()[markerNumbers[k]]->ComputeMarkerDataJacobianDerivative(cSystemData,
+							jacobianForce, temp.markerDataStructure.GetMarkerData(k));
+						//pout << "  compute non-zero jacobian derivative" << k << ": " << temp.markerDataStructure.GetMarkerData(k).jacobianDerivative << " \n";
+					}
+				}
+				else
+				{
+					//clear jacobianDerivative!!!
+					for (Index k = 0; k < markerNumbers.NumberOfItems(); k++)
+					{
+						temp.markerDataStructure.GetMarkerData(k).jacobianDerivative.SetNumberOfRowsAndColumns(0, 0);
+					}
+				}
+
+				connector->ComputeJacobianODE2_ODE2(temp.jacobianODE2Container, temp.jacobianTemp, 
+					-factorODE2, -factorODE2_t, j, ltgODE2, temp.markerDataStructure);
+			}
+		} //if (numDiff.forODE2connectors)
+	}
+	return jacobianComputed;
+}
+
+//! compute numerical ODE2 jacobian (w.r.t. ODE2, ODE2_t and ODE1 coordinates) of object j and ADD it to jacobianGM;
+//! as system coordinates are modified during differentiation, this function must not be called in parallel
+void CSystem::NumDiffObjectJacobianODE2(Index j, TemporaryComputationData& temp, const NumericalDifferentiationSettings& numDiff,
+	GeneralMatrix& jacobianGM, Real factorODE2, Real factorODE2_t, Real factorODE1)
+{
+	ResizableVector& f0 = temp.numericalJacobianf0;
+	ResizableVector& f1 = temp.numericalJacobianf1;
+	ResizableMatrix& localJacobian = temp.localJacobian;
+
+	Index nODE2 = cSystemData.GetNumberOfCoordinatesODE2();
+
+	Vector& x = cSystemData.GetCData().currentState.ODE2Coords;			//current coordinates ==> this is what is differentiated for
+	Vector& xRef = cSystemData.GetCData().referenceState.ODE2Coords;	//reference coordinates; might be important for numerical differentiation
+	Vector& xODE1 = cSystemData.GetCData().currentState.ODE1Coords;			//current coordinates ==> this is what is differentiated for
+	Vector& xRefODE1 = cSystemData.GetCData().referenceState.ODE1Coords;	//reference coordinates; might be important for numerical differentiation
+	Vector& x_t = cSystemData.GetCData().currentState.ODE2Coords_t;		//for diff w.r.t. velocities
+
+	bool diffODE2 = (factorODE2 != 0.);
+	bool diffODE2_t = (factorODE2_t != 0.);
+	bool diffODE1 = (factorODE1 != 0.);
+
+	Vector emptyXRef; //for NumDiff template
+
+	CObject* object = cSystemData.GetCObjects()[j];
+	JacobianType::Type jacType = object->GetAvailableJacobians();
+	ArrayIndex& ltgODE2 = cSystemData.GetLocalToGlobalODE2()[j];
+	ArrayIndex& ltgODE2numDiff = cSystemData.GetLocalToGlobalODE2NumDiff()[j];
+	//pout << "ltgODE2numDiff = " << ltgODE2numDiff << "\n";
+	Index nLocalODE2numDiff = ltgODE2numDiff.NumberOfItems(); //this is a possibly shorter list with no duplicates!
+	Index nLocalODE2 = ltgODE2.NumberOfItems();
+
+	f0.SetNumberOfItems(nLocalODE2); //size also correct for ODE1 derivatives
+	f1.SetNumberOfItems(nLocalODE2);
+	if (ComputeObjectODE2LHS(temp, object, f0, j)) //check if it is active; constraints not included any more in listComputeObjectODE2Lhs
+	{
+		//pout << "f0 = " << f0 << "\n";
+		localJacobian.SetNumberOfRowsAndColumns(nLocalODE2, nLocalODE2numDiff); //needs not to be initialized, because the matrix is fully computed and then added to jacobianGM
+		if (diffODE2)
+		{
+			SetNumDiffObjectLieGroup(numDiff, factorODE2, x, xRef, localJacobian, f0, f1, ltgODE2numDiff, cSystemData,
+				[this, &temp, &object, &f1, &j]
+			{
+				ComputeObjectODE2LHS(temp, object, f1, j);
+			});
+
+		}
+		else { localJacobian.SetAll(0.); }
+
+		if (diffODE2_t && EXUstd::IsOfType(jacType, JacobianType::ODE2_ODE2_t))
+		{
+			AddNumDiffObject(numDiff, factorODE2_t, x_t, emptyXRef, localJacobian, f0, f1, ltgODE2numDiff, 
+				[this, &temp, &object, &f1, &j]
+			{
+				ComputeObjectODE2LHS(temp, object, f1, j);
+			});
+		}
+
+		if (!cSystemData.batchedUserFunctionRecording) //recording pass of batched user functions only records inputs
+		{
+			jacobianGM.AddSubmatrix(localJacobian, 1., ltgODE2, ltgODE2numDiff);
+		}
+		//pout << "jacN" << j << "=np.array(" << localJacobian << ")\n";
+
+		if (diffODE1 && (jacType & JacobianType::ODE2_ODE1))
+		{
+			ArrayIndex& ltgODE1 = cSystemData.GetLocalToGlobalODE1()[j];
+			Index nLocalODE1 = ltgODE1.NumberOfItems(); //here, duplicates would also need to be extracted!
+
+			localJacobian.SetNumberOfRowsAndColumns(nLocalODE2, nLocalODE1); //needs not to be initialized, beause the matrix is fully computed and then added to jacobianGM
+
+			AddNumDiffObject(numDiff, factorODE1, xODE1, xRefODE1, localJacobian, f0, f1, ltgODE1,
+				[this, &temp, &object, &f1, &j]
+			{
+				ComputeObjectODE2LHS(temp, object, f1, j);
+			}, true); //true=set values
+
+			if (!cSystemData.batchedUserFunctionRecording)
+			{
+				jacobianGM.AddSubmatrix(localJacobian, 1., ltgODE2, ltgODE1, 0, nODE2); //fill into ODE2 rows, ODE1 columns
+			}
+		}
+	}
+}
+
+//! append analytic object jacobian computed in temp.jacobianODE2Container by ComputeObjectJacobianODE2(...) to triplets (using ltg mapping in dense mode);
+//! sparse triplets of temp.jacobianODE2Container are cleared
+void CSystem::AppendObjectJacobianODE2Triplets(Index j, TemporaryComputationData& temp, SparseTripletVector& triplets)
+{
+	if (temp.jacobianODE2Container.UseDenseMatrix())
+	{
+		const ArrayIndex& ltgODE2 = cSystemData.GetLocalToGlobalODE2()[j];
+		const ResizableMatrix& localJac = temp.jacobianODE2Container.GetInternalDenseMatrix();
+		for (Index row = 0; row < localJac.NumberOfRows(); row++)
+		{
+			for (Index col = 0; col < localJac.NumberOfColumns(); col++)
+			{
+				Real value = localJac(row, col);
+				if (value != 0.)
+				{
+					triplets.AppendPure(SparseTriplet(ltgODE2[row], ltgODE2[col], value));
+				}
+			}
+		}
+	}
+	else
+	{
+		SparseTripletVector& localTriplets = temp.jacobianODE2Container.GetInternalSparseTripletMatrix().GetTriplets();
+		triplets.AppendArray(localTriplets);
+		localTriplets.SetNumberOfItems(0);
+	}
+}
+
+//! compute constantJacobianODE2Cache for objects with constant ODE2 jacobian (or constant parts of jacobian) for unit factors;
+//! objects with constant jacobian parts (e.g. GenericODE2 with forceUserFunction) only cache the part given by ComputeJacobianODE2_ODE2ConstantPart(...)
+void CSystem::ComputeConstantJacobianODE2Cache(TemporaryComputationData& temp, const NumericalDifferentiationSettings& numDiff)
+{
+	ConstantJacobianODE2Cache& cache = constantJacobianODE2Cache;
+	cache.Invalidate();
+	cache.hasConstantParts = false;
+	cache.forODE2 = numDiff.forODE2;
+	cache.forODE2connectors = numDiff.forODE2connectors;
+	cache.jacobianConnectorDerivative = numDiff.jacobianConnectorDerivative;
+	cache.tripletsODE2.SetNumberOfItems(0);
+	cache.tripletsODE2_t.SetNumberOfItems(0);
+	cache.objectIsCached.SetNumberOfItems(cSystemData.GetCObjects().NumberOfItems());
+	cache.objectIsCached.SetAll(false);
+
+	const Marker::Type constantMarkerType = (Marker::Type)(Marker::Node + Marker::Coordinate + Marker::JacobianDerivativeAvailable);
+	const Marker::Type nonConstantMarkerType = (Marker::Type)(Marker::JacobianDerivativeNonZero + Marker::ODE1);
+
+	for (Index j : cSystemData.listComputeObjectODE2Lhs)
+	{
+		CObject* object = cSystemData.GetCObjects()[j];
+		if (!object->IsActive() || !(object->HasConstantJacobianODE2() || object->HasConstantJacobianODE2Part())) { continue; }
+
+		temp.jacobianODE2Container.ClearAllMatrices();
+		if (object->HasConstantJacobianODE2Part())
+		{
+			//forODE2: object is differentiated numerically as a whole, as in ComputeObjectJacobianODE2(...)
+			if (numDiff.forODE2) { continue; }
+
+			//signs as in ComputeObjectJacobianODE2(...): object computes LHS jacobian
+			object->ComputeJacobianODE2_ODE2ConstantPart(temp.jacobianODE2Container, temp.jacobianTemp, -1., 0., j, cSystemData.GetLocalToGlobalODE2()[j]);
+			AppendObjectJacobianODE2Triplets(j, temp, cache.tripletsODE2);
+			object->ComputeJacobianODE2_ODE2ConstantPart(temp.jacobianODE2Container, temp.jacobianTemp, 0., -1., j, cSystemData.GetLocalToGlobalODE2()[j]);
+			AppendObjectJacobianODE2Triplets(j, temp, cache.tripletsODE2_t);
+
+			cache.objectIsCached[j] = object->HasConstantJacobianODE2();
+			cache.hasConstantParts |= !object->HasConstantJacobianODE2();
+		}
+		else
+		{
+			//connectors have constant jacobian only for markers with constant jacobians (MarkerNodeCoordinate)
+			bool isConstant = true;
+			if (EXUstd::IsOfType(object->GetType(), CObjectType::Connector))
+			{
+				for (Index markerNumber : ((CObjectConnector*)object)->GetMarkerNumbers())
+				{
+					Marker::Type markerType = cSystemData.GetCMarker(markerNumber).GetType();
+					isConstant &= ((markerType & constantMarkerType) == constantMarkerType) && ((markerType & nonConstantMarkerType) == 0);
+				}
+			}
+
+			if (isConstant && ComputeObjectJacobianODE2(j, temp, numDiff, 1., 0.)) //false, if only numerical jacobian available
+			{
+				AppendObjectJacobianODE2Triplets(j, temp, cache.tripletsODE2);
+				ComputeObjectJacobianODE2(j, temp, numDiff, 0., 1.);
+				AppendObjectJacobianODE2Triplets(j, temp, cache.tripletsODE2_t);
+				cache.objectIsCached[j] = true;
+			}
+		}
+	}
+	temp.jacobianODE2Container.ClearAllMatrices();
+	cache.isValid = true;
+}
+
 //! compute numerical differentiation of ODE2RHS w.r.t. ODE2 and ODE2_t quantities; 
 //! multiply (before added to jacobianGM) ODE2 with factorODE2 and ODE2_t with factorODE2_t
 //! the jacobian is ADDed to jacobianGM, which needs to have according size; set entries to zero beforehand in order to obtain only the jacobian
 void CSystem::JacobianODE2RHS(TemporaryComputationDataArray& tempArray, const NumericalDifferentiationSettings& numDiff,
 	GeneralMatrix& jacobianGM, Real factorODE2, Real factorODE2_t, Real factorODE1, Index computeLoadsJacobian)
 {
+	Index nThreads = exuThreading::TaskManager::GetNumThreads();
+	Index nItemsNoUF = cSystemData.listComputeObjectODE2LhsNoUF.NumberOfItems();
+	bool doParallel = (nThreads > 1) && (nItemsNoUF >= solverData.multithreadedLLimitJacobians) && !numDiff.doSystemWideDifferentiation;
+	if (doParallel) { tempArray.SetNumberOfItems(nThreads); } //only affected, if nThreads changed; must be done before linking temp
+
 	TemporaryComputationData& temp = tempArray[0]; //always exists
 	temp.jacobianODE2Container.ClearAllMatrices();
 
@@ -2460,174 +3061,132 @@ void CSystem::JacobianODE2RHS(TemporaryComputationDataArray& tempArray, const Nu
 	bool diffODE2_t = (factorODE2_t != 0.);
 	bool diffODE1 = (factorODE1 != 0.);
 	
-	Vector emptyXRef; //for NumDiff template
-
 	if (!numDiff.doSystemWideDifferentiation)
 	{
-		ResizableMatrix& localJacobian = temp.localJacobian;
+		const JacobianType::Type jacTypeODE2 = (JacobianType::Type)(JacobianType::ODE2_ODE2 + JacobianType::ODE2_ODE2_t + JacobianType::ODE2_ODE1);
 
-		//++++++++++++++++++++++++++++++++++++++++++++++++
-		//for parallelized version add list to distinguish between parallelizable jacs and serial
-		for (Index j : cSystemData.listComputeObjectODE2Lhs)
+		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++
+		//constant parts of jacobian: computed once and only rescaled with current factors
+		if (!constantJacobianODE2Cache.IsValid(numDiff))
 		{
-			CObject* object = cSystemData.GetCObjects()[j];
-			if (object->IsActive())
+			ComputeConstantJacobianODE2Cache(temp, numDiff);
+		}
+		constantJacobianODE2Cache.AddToJacobian(jacobianGM, factorODE2, factorODE2_t);
+		cSystemData.excludeConstantJacobianODE2Parts = constantJacobianODE2Cache.hasConstantParts;
+
+		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++
+		//PARALLEL PART: analytic jacobians of objects without user functions
+		//numerical differentiation modifies system coordinates and is therefore only done in serial part
+		if (doParallel)
+		{
+			outputBuffer.SetSuspendWriting(true); //may not write to python during parallel computation
+
+			for (Index i = 0; i < nThreads; i++)
 			{
-				ArrayIndex& ltgODE2 = cSystemData.GetLocalToGlobalODE2()[j];
-				Index nLocalODE2 = ltgODE2.NumberOfItems();
+				tempArray[i].jacobianODE2Container.ClearAllMatrices();
+				tempArray[i].sparseTriplets.SetNumberOfItems(0);
+				tempArray[i].listNumDiffObjects.SetNumberOfItems(0);
+			}
 
-				JacobianType::Type jacType = object->GetAvailableJacobians();
+			Index taskSplit = GetTaskSplit(nItemsNoUF, nThreads);
+			auto computeItem = [this, &tempArray, &numDiff, &factorODE2, &factorODE2_t, &jacTypeODE2](NGSsizeType i)
+			{
+				Index j = cSystemData.listComputeObjectODE2LhsNoUF[(Index)i];
+				Index threadID = exuThreading::TaskManager::GetThreadId();
+				TemporaryComputationData& tempThread = tempArray[threadID];
 
-				bool jacobianComputed = false;
-				if (jacType & (JacobianType::ODE2_ODE2 + JacobianType::ODE2_ODE2_t + JacobianType::ODE2_ODE1)) //any ODE2 dependency
+				CObject* object = cSystemData.GetCObjects()[j];
+				if (object->IsActive() && (object->GetAvailableJacobians() & jacTypeODE2) //any ODE2 dependency
+					&& !constantJacobianODE2Cache.IsObjectCached(j)) //otherwise already added from cache
 				{
-					//pout << "jacobian object " << j << "\n";
-					if (!numDiff.forODE2 && ((jacType & (JacobianType::ODE2_ODE2_function + JacobianType::ODE2_ODE2_t_function/* + JacobianType::ODE2_ODE1_function*/)) != 0))
+					if (ComputeObjectJacobianODE2(j, tempThread, numDiff, factorODE2, factorODE2_t))
 					{
-						if (!EXUstd::IsOfType(object->GetType(), CObjectType::Connector))
-						{   // ++++++++++++++ compute object jacobian, e.g., finite element or rigid body
-							jacobianComputed = true;
-
-							//matrix size set inside object
-							object->ComputeJacobianODE2_ODE2(temp.jacobianODE2Container, temp.jacobianTemp,
-								-factorODE2, -factorODE2_t, j, ltgODE2); //minus (-) because in numerical mode, f0-f1 leads to negative sign (RHS ==> LHS)
-							//ODE2_ODE1 missing here!
-							if (temp.jacobianODE2Container.UseDenseMatrix())
-							{
-								jacobianGM.AddSubmatrix(temp.jacobianODE2Container.GetInternalDenseMatrix(), 1., ltgODE2, ltgODE2);
-							}
-							else
-							{
-								jacobianGM.AddSparseTriplets(temp.jacobianODE2Container.GetInternalSparseTripletMatrix().GetTriplets());
-								//sparse matrix container cannot be reset in jacobian function for future implementations
-								//==>replace this by directly adding values to jacobianGM sparse triplets in object jacobian
-								temp.jacobianODE2Container.GetInternalSparseTripletMatrix().SetAllZero();
-							}
-						} //if (!EXUstd::IsOfType(object->GetType(), CObjectType::Connector)
-						else if (!numDiff.forODE2connectors)
-						{	// ++++++++++++++ go the lengthier way: compute connector jacobian, e.g., spring-damper
-							CObjectConnector* connector = (CObjectConnector*)object;
-							//pout << "analytic jac connector \n";
-							const ArrayIndex& markerNumbers = connector->GetMarkerNumbers();
-							jacobianComputed = true;
-							bool jacDerivNonZero = false;
-							if (numDiff.jacobianConnectorDerivative) //if ignored, it will not be considered
-							{
-								for (Index k = 0; k < markerNumbers.NumberOfItems(); k++)
-								{
-									jacobianComputed &= ((cSystemData.GetCMarker(markerNumbers[k]).GetType() & Marker::JacobianDerivativeAvailable) != 0);
-									jacDerivNonZero |= ((cSystemData.GetCMarker(markerNumbers[k]).GetType() & Marker::JacobianDerivativeNonZero) != 0);
-								}
-							}
-
-							if (jacobianComputed)
-							{
-								//pout << "  continue\n";
-								//compute MarkerData for connector:
-								const bool computeJacobian = true; //jacobian needed for jacobian computation ...
-								cSystemData.ComputeMarkerDataStructure(connector, computeJacobian, temp.markerDataStructure);
-								//pout << "compute connector " << j << " jacobian \n";
-								if (jacDerivNonZero) //call needed, if one marker has non-zero derivative ==> compute jacobianForce for both cases
-								{
-									Vector6D jacobianForce;
-									connector->ComputeJacobianForce6D(temp.markerDataStructure, j, jacobianForce);
-									//even though that force on marker0 acts with negative sign, 
-									//  the different signs are accounted for in connector->ComputeJacobianODE2_ODE2(...)
-									//  ==> but this could also be done here !
-									//pout << "  jacobian force = " << temp.jacobianForce << " \n";
-									for (Index k = 0; k < markerNumbers.NumberOfItems(); k++)
-									{
-										cSystemData.GetCMarkers()[markerNumbers[k]]->ComputeMarkerDataJacobianDerivative(cSystemData,
-											jacobianForce, temp.markerDataStructure.GetMarkerData(k));
-										//pout << "  compute non-zero jacobian derivative" << k << ": " << temp.markerDataStructure.GetMarkerData(k).jacobianDerivative << " \n";
-									}
-								}
-								else
-								{
-									//clear jacobianDerivative!!!
-									for (Index k = 0; k < markerNumbers.NumberOfItems(); k++)
-									{
-										temp.markerDataStructure.GetMarkerData(k).jacobianDerivative.SetNumberOfRowsAndColumns(0, 0);
-									}
-								}
-
-								connector->ComputeJacobianODE2_ODE2(temp.jacobianODE2Container, temp.jacobianTemp, 
-									-factorODE2, -factorODE2_t, j, ltgODE2, temp.markerDataStructure);
-
-
-								if (temp.jacobianODE2Container.UseDenseMatrix())
-								{
-									jacobianGM.AddSubmatrix(temp.jacobianODE2Container.GetInternalDenseMatrix(), 1., ltgODE2, ltgODE2);
-									//pout << "jacA" << j << "=np.array(" << temp.jacobianODE2Container.GetInternalDenseMatrix() << ")\n";
-								}
-								else
-								{
-									jacobianGM.AddSparseTriplets(temp.jacobianODE2Container.GetInternalSparseTripletMatrix().GetTriplets());
-								}
-							}
-						} //if (numDiff.forODE2connectors)
+						//transfer local jacobian into thread-local triplets:
+						AppendObjectJacobianODE2Triplets(j, tempThread, tempThread.sparseTriplets);
 					}
-
-
-					//++++++++++++++++++++++++++++++++++++++++++++++++++++
-					//no analytic jacobians so far? => do numerical differentiation!
-					if (!jacobianComputed)
+					else
 					{
-						ArrayIndex& ltgODE2numDiff = cSystemData.GetLocalToGlobalODE2NumDiff()[j];
-						//pout << "ltgODE2numDiff = " << ltgODE2numDiff << "\n";
-						//ArrayIndex& ltgODE2numDiff = cSystemData.GetLocalToGlobalODE2()[j];
-						Index nLocalODE2numDiff = ltgODE2numDiff.NumberOfItems(); //this is a possibly shorter list with no duplicates!
-						nLocalODE2 = ltgODE2.NumberOfItems();
-
-						f0.SetNumberOfItems(nLocalODE2); //size also correct for ODE1 derivatives
-						f1.SetNumberOfItems(nLocalODE2);
-						if (ComputeObjectODE2LHS(temp, object, f0, j)) //check if it is active; constraints not included any more in listComputeObjectODE2Lhs
-						{
-							//pout << "f0 = " << f0 << "\n";
-							localJacobian.SetNumberOfRowsAndColumns(nLocalODE2, nLocalODE2numDiff); //needs not to be initialized, because the matrix is fully computed and then added to jacobianGM
-							if (diffODE2)
-							{
-								SetNumDiffObjectLieGroup(numDiff, factorODE2, x, xRef, localJacobian, f0, f1, ltgODE2numDiff, cSystemData,
-									[this, &temp, &object, &f1, &j]
-								{
-									ComputeObjectODE2LHS(temp, object, f1, j);
-								});
-
-							}
-							else { localJacobian.SetAll(0.); }
-
-							if (diffODE2_t && EXUstd::IsOfType(jacType, JacobianType::ODE2_ODE2_t))
-							{
-								AddNumDiffObject(numDiff, factorODE2_t, x_t, emptyXRef, localJacobian, f0, f1, ltgODE2numDiff, 
-									[this, &temp, &object, &f1, &j]
-								{
-									ComputeObjectODE2LHS(temp, object, f1, j);
-								});
-							}
-
-							jacobianGM.AddSubmatrix(localJacobian, 1., ltgODE2, ltgODE2numDiff);
-							//pout << "jacN" << j << "=np.array(" << localJacobian << ")\n";
+						tempThread.listNumDiffObjects.Append(j); //postponed to serial part
+					}
+				}
+			};
+			if (solverData.useCostBalancedTasks)
+			{
+				costBalancedTasksJacobianODE2.ParallelFor(nItemsNoUF, taskSplit, ParallelForTasks, computeItem);
+			}
+			else
+			{
+				exuThreading::ParallelFor(nItemsNoUF, computeItem, taskSplit);
+			}
 
-							if (diffODE1 && (jacType & JacobianType::ODE2_ODE1))
-							{
-								ArrayIndex& ltgODE1 = cSystemData.GetLocalToGlobalODE1()[j];
-								Index nLocalODE1 = ltgODE1.NumberOfItems(); //here, duplicates would also need to be extracted!
+			outputBuffer.SetSuspendWriting(false);
 
-								localJacobian.SetNumberOfRowsAndColumns(nLocalODE2, nLocalODE1); //needs not to be initialized, beause the matrix is fully computed and then added to jacobianGM
+			//serial merge of thread-local triplets into jacobian
+			for (Index i = 0; i < nThreads; i++)
+			{
+				jacobianGM.AddSparseTriplets(tempArray[i].sparseTriplets);
+			}
+		}
 
-								AddNumDiffObject(numDiff, factorODE1, xODE1, xRefODE1, localJacobian, f0, f1, ltgODE1,
-									[this, &temp, &object, &f1, &j]
-								{
-									ComputeObjectODE2LHS(temp, object, f1, j);
-								}, true); //true=set values
+		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++
+		//batched user functions: record all perturbed inputs of numerical differentiation, then evaluate once
+		if (cSystemData.batchedUserFunctions.NumberOfItems() != 0)
+		{
+			EvaluateBatchedUserFunctions([this, &temp, &numDiff, &jacobianGM, &factorODE2, &factorODE2_t, &factorODE1, &jacTypeODE2](Index j)
+			{
+				CObject* object = cSystemData.GetCObjects()[j];
+				if (object->IsActive() && (object->GetAvailableJacobians() & jacTypeODE2))
+				{
+					NumDiffObjectJacobianODE2(j, temp, numDiff, jacobianGM, factorODE2, factorODE2_t, factorODE1); //jacobianGM is not modified during recording
+				}
+			});
+		}
 
-								jacobianGM.AddSubmatrix(localJacobian, 1., ltgODE2, ltgODE1, 0, nODE2); //fill into ODE2 rows, ODE1 columns
-							}
-						}
+		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++
+		//SERIAL PART: all objects in serial mode, objects with user functions in parallel mode:
+		const ArrayIndex& processObjectsSerial = doParallel ? cSystemData.listComputeObjectODE2LhsUF : cSystemData.listComputeObjectODE2Lhs;
+		for (Index j : processObjectsSerial)
+		{
+			CObject* object = cSystemData.GetCObjects()[j];
+			if (object->IsActive() && (object->GetAvailableJacobians() & jacTypeODE2) //any ODE2 dependency
+				&& !constantJacobianODE2Cache.IsObjectCached(j)) //otherwise already added from cache
+			{
+				if (ComputeObjectJacobianODE2(j, temp, numDiff, factorODE2, factorODE2_t))
+				{
+					if (temp.jacobianODE2Container.UseDenseMatrix())
+					{
+						jacobianGM.AddSubmatrix(temp.jacobianODE2Container.GetInternalDenseMatrix(), 1., 
+							cSystemData.GetLocalToGlobalODE2()[j], cSystemData.GetLocalToGlobalODE2()[j]);
+						//pout << "jacA" << j << "=np.array(" << temp.jacobianODE2Container.GetInternalDenseMatrix() << ")\n";
+					}
+					else
+					{
+						jacobianGM.AddSparseTriplets(temp.jacobianODE2Container.GetInternalSparseTripletMatrix().GetTriplets());
+						//sparse matrix container cannot be reset in jacobian function for future implementations
+						//==>replace this by directly adding values to jacobianGM sparse triplets in object jacobian
+						temp.jacobianODE2Container.GetInternalSparseTripletMatrix().SetAllZero();
 					}
 				}
-			}//isActive
-		}//loop over objects
+				else
+				{
+					//no analytic jacobians so far? => do numerical differentiation!
+					NumDiffObjectJacobianODE2(j, temp, numDiff, jacobianGM, factorODE2, factorODE2_t, factorODE1);
+				}
+			}
+		}
+
+		if (doParallel) //numerical differentiation for objects which have been postponed in parallel part
+		{
+			for (Index i = 0; i < nThreads; i++)
+			{
+				for (Index j : tempArray[i].listNumDiffObjects)
+				{
+					NumDiffObjectJacobianODE2(j, temp, numDiff, jacobianGM, factorODE2, factorODE2_t, factorODE1);
+				}
+			}
+		}
+		InvalidateBatchedUserFunctions();
+		cSystemData.excludeConstantJacobianODE2Parts = false;
 	}
 	else
 	{
@@ -3668,6 +4227,89 @@ void CSystem::UpdatePostProcessData(bool recordImage, bool visualizationStateUpd
 	EXUstd::ReleaseSemaphore(postProcessData.accessState); //clear PostProcessData
 }
 
+void CSystem::WriteStateCheckpoint(const CSystemState& state, STDstring& buffer) const
+{
+	if (!IsSystemConsistent()) { PyError("WriteStateCheckpoint: system is inconsistent; call Assemble() first"); }
+	ExuFile::BinaryBufferWriter writer(buffer);
+
+	writer.Write(state.GetTime());
+	writer.Write(state.GetODE2Coords());
+	writer.Write(state.GetODE2Coords_t());
+	writer.Write(state.GetODE2Coords_tt());
+	writer.Write(state.GetODE1Coords());
+	writer.Write(state.GetODE1Coords_t());
+	writer.Write(state.GetAECoords());
+	writer.Write(state.GetDataCoords());
+
+	writer.Write(cSystemData.GetCSensors().NumberOfItems());
+	for (const CSensor* sensor : cSystemData.GetCSensors())
+	{
+		SensorStorageView storage = sensor->GetInternalStorage();
+		writer.Write(storage.NumberOfRows());
+		writer.Write(storage.GetDataPointer(), storage.NumberOfRows() * storage.NumberOfColumns());
+	}
+
+	writer.Write(generalContacts.NumberOfItems());
+	for (const GeneralContact* gc : generalContacts)
+	{
+		gc->WriteStateCheckpoint(writer);
+	}
+}
+
+void CSystem::ReadStateCheckpoint(const char* data, size_t size, CSystemState& state)
+{
+	if (!IsSystemConsistent()) { PyError("ReadStateCheckpoint: system is inconsistent; call Assemble() first"); }
+	ExuFile::BinaryBufferReader reader(data, size);
+
+	//read and check complete checkpoint into temporary data first; system is only changed if checkpoint is valid
+	CSystemState stateRead = state;
+	stateRead.time = reader.ReadReal();
+	reader.Read(stateRead.ODE2Coords, "ODE2 coordinates");
+	reader.Read(stateRead.ODE2Coords_t, "ODE2 velocity coordinates");
+	reader.Read(stateRead.ODE2Coords_tt, "ODE2 acceleration coordinates");
+	reader.Read(stateRead.ODE1Coords, "ODE1 coordinates");
+	reader.Read(stateRead.ODE1Coords_t, "ODE1 velocity coordinates");
+	reader.Read(stateRead.AECoords, "AE coordinates");
+	reader.Read(stateRead.dataCoords, "data coordinates");
+
+	Index nSensors = cSystemData.GetCSensors().NumberOfItems();
+	if (reader.ReadIndex() != nSensors) { PyError("ReadStateCheckpoint: number of sensors does not fit to checkpoint"); }
+	std::vector<ResizableArray<Real>> sensorData(nSensors);
+	ArrayIndex sensorRows(nSensors);
+	for (Index i = 0; i < nSensors; i++)
+	{
+		Index nRows = reader.ReadIndex();
+		Index n = reader.ReadSize(sizeof(Real));
+		if (!(nRows >= 0 && (nRows == 0 ? n == 0 : n % nRows == 0))) { PyError("ReadStateCheckpoint: sensor data corrupted"); }
+		sensorData[i].SetNumberOfItems(n);
+		reader.Read(sensorData[i].GetDataPointer(), n);
+		sensorRows.Append(nRows);
+	}
+
+	Index nContacts = generalContacts.NumberOfItems();
+	if (reader.ReadIndex() != nContacts) { PyError("ReadStateCheckpoint: number of general contacts does not fit to checkpoint"); }
+	std::vector<std::vector<ArrayIndex>> activeContacts(nContacts);
+	std::vector<std::vector<ResizableArray<Vector3D>>> activeContactsVector(nContacts);
+	for (Index i = 0; i < nContacts; i++)
+	{
+		generalContacts[i]->ReadStateCheckpoint(reader, activeContacts[i], activeContactsVector[i]);
+	}
+	if (!reader.IsFinished()) { PyError("ReadStateCheckpoint: checkpoint contains unexpected data"); }
+
+	//checkpoint is valid: set data
+	state = stateRead;
+	for (Index i = 0; i < nSensors; i++)
+	{
+		Index nRows = sensorRows[i];
+		cSystemData.GetCSensors()[i]->GetSensorInternalStorage().SetData(sensorData[i].GetDataPointer(), nRows,
+			nRows == 0 ? 0 : sensorData[i].NumberOfItems() / nRows);
+	}
+	for (Index i = 0; i < nContacts; i++)
+	{
+		generalContacts[i]->SetStateCheckpoint(activeContacts[i], activeContactsVector[i]);
+	}
+}
+
 
 
 
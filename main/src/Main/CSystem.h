@@ -32,6 +32,7 @@
 #include "Pymodules/PythonUserFunctions.h"
 #include "Main/TemporaryComputationData.h"
 #include "System/CContact.h"
+#include "Utilities/CostBalancedTasks.h"
 
 class System;
 
@@ -53,6 +54,8 @@ public:
 	Index multithreadedLLimitResiduals; //! absolute lower lower limit below which, no multithreading will be active
 	Index multithreadedLLimitJacobians; //! absolute lower lower limit below which, no multithreading will be active
 	Index multithreadedLLimitMassMatrix; //! absolute lower lower limit below which, no multithreading will be active
+	bool useColoringForResiduals; //! use precomputed coloring of objects for multithreaded ODE2 RHS computation
+	bool useCostBalancedTasks; //! split multithreaded object loops into tasks of similar measured cost
 
 	SolverData()
 	{
@@ -74,7 +77,75 @@ public:
 		multithreadedLLimitResiduals = 100; //! for ODE2, [ODE1], AE and CqT*lambda; absolute lower lower limit below which, no multithreading will be active
 		multithreadedLLimitJacobians = 100; //! absolute lower lower limit below which, no multithreading will be active
 		multithreadedLLimitMassMatrix = 100; //! absolute lower lower limit below which, no multithreading will be active
+		useColoringForResiduals = false;
+		useCostBalancedTasks = false;
+	}
+};
+
+//! cache for constant parts of the system ODE2 jacobian (e.g., linear stiffness and damping matrices, linear coordinate spring-dampers);
+//! contributions w.r.t. ODE2 and ODE2_t coordinates are computed once for unit factors and stored as sparse triplets;
+//! the scaled triplets are only recomputed if factorODE2 or factorODE2_t changes (e.g., due to new step size in implicit integrators)
+class ConstantJacobianODE2Cache
+{
+public:
+	bool isValid = false;						//!< false: cache is (re)computed at next jacobian computation
+	bool hasConstantParts = false;				//!< true, if some objects are not fully cached and must exclude their constant parts
+	bool forODE2 = false;						//!< numerical differentiation flags for which cache has been computed
+	bool forODE2connectors = false;
+	bool jacobianConnectorDerivative = false;
+	ResizableArray<bool> objectIsCached;		//!< per object: true, if complete ODE2 jacobian is included in cache and object is skipped in jacobian computation
+	SparseTripletVector tripletsODE2;			//!< contribution for factorODE2=1, factorODE2_t=0
+	SparseTripletVector tripletsODE2_t;			//!< contribution for factorODE2=0, factorODE2_t=1
+	SparseTripletVector scaledTriplets;			//!< factorODE2*tripletsODE2 + factorODE2_t*tripletsODE2_t
+	Real scaledFactorODE2 = 0.;					//!< factors used for scaledTriplets
+	Real scaledFactorODE2_t = 0.;
+	bool scaledTripletsValid = false;
+
+	//! reset cache, such that it is recomputed at next jacobian computation
+	void Invalidate()
+	{
+		isValid = false;
+		scaledTripletsValid = false;
+	}
+
+	//! return true, if cache has been computed with same numerical differentiation flags
+	bool IsValid(const NumericalDifferentiationSettings& numDiff) const
+	{
+		return isValid && forODE2 == numDiff.forODE2 && forODE2connectors == numDiff.forODE2connectors &&
+			jacobianConnectorDerivative == numDiff.jacobianConnectorDerivative;
+	}
 
+	//! return true, if object j is fully contained in cache
+	bool IsObjectCached(Index j) const { return j < objectIsCached.NumberOfItems() && objectIsCached[j]; }
+
+	//! add factorODE2*tripletsODE2 + factorODE2_t*tripletsODE2_t to jacobianGM; scaled triplets are reused for same factors
+	void AddToJacobian(GeneralMatrix& jacobianGM, Real factorODE2, Real factorODE2_t)
+	{
+		if (!scaledTripletsValid || factorODE2 != scaledFactorODE2 || factorODE2_t != scaledFactorODE2_t)
+		{
+			scaledTriplets.SetNumberOfItems(0);
+			if (factorODE2 != 0.)
+			{
+				for (const SparseTriplet& item : tripletsODE2)
+				{
+					scaledTriplets.Append(SparseTriplet(item.row(), item.col(), factorODE2*item.value()));
+				}
+			}
+			if (factorODE2_t != 0.)
+			{
+				for (const SparseTriplet& item : tripletsODE2_t)
+				{
+					scaledTriplets.Append(SparseTriplet(item.row(), item.col(), factorODE2_t*item.value()));
+				}
+			}
+			scaledFactorODE2 = factorODE2;
+			scaledFactorODE2_t = factorODE2_t;
+			scaledTripletsValid = true;
+		}
+		if (scaledTriplets.NumberOfItems() != 0)
+		{
+			jacobianGM.AddSparseTriplets(scaledTriplets);
+		}
 	}
 };
 
@@ -92,6 +163,10 @@ protected:
 	bool systemIsConsistent;				//!< variable is set after check of system consistency ==> in order to draw or compute system; usually set after Assemble()
 	ResizableArray<GeneralContact*> generalContacts;	//!< array of general contacts, that are not objects
 
+	CostBalancedTasks costBalancedTasksODE2RHS;			//!< cost estimates and tasks for multithreaded ODE2 RHS of objects
+	CostBalancedTasks costBalancedTasksJacobianODE2;	//!< cost estimates and tasks for multithreaded ODE2 jacobians of objects
+	ConstantJacobianODE2Cache constantJacobianODE2Cache;	//!< constant parts of ODE2 jacobian, computed once after Assemble()
+
 public:
 	~CSystem() 
 	{ 
@@ -133,6 +208,13 @@ public:
 	//! graphicsData.visualizationStateUpdate is updated in case that visualizationStateUpdateAvailable=true
 	void UpdatePostProcessData(bool recordImage = false, bool visualizationStateUpdateAvailable = true);
 
+	//! write binary checkpoint of state (time and all coordinates), internal storage of sensors and active sets of general contacts into buffer;
+	//! checkpoints can only be restored into the same (assembled) system, see StateCheckpoint.h
+	void WriteStateCheckpoint(const CSystemState& state, STDstring& buffer) const;
+
+	//! restore state, internal storage of sensors and active sets of general contacts from binary checkpoint; throws if checkpoint does not fit to system
+	void ReadStateCheckpoint(const char* data, size_t size, CSystemState& state);
+
 	SolverData& GetSolverData() { return solverData; }
 	const SolverData& GetSolverData() const { return solverData; }
 	// ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
@@ -202,6 +284,12 @@ public:
 	//! precompute item lists (special lists for constraints, connectors, etc.)
 	void PreComputeItemLists();
 
+	//! put spring-dampers of listComputeObjectODE2LhsNoUF into structure-of-arrays blocks for batched evaluation (experimental)
+	void PreComputeBatchedObjects();
+
+	//! compute coloring of listComputeObjectODE2LhsNoUFNotBatched, such that objects of same color do not share ODE2 coordinates
+	void ComputeObjectODE2LhsColoring();
+
 	//! reset lists for Lie groups when Assemble is called; this should require no memory (e.g. in expl. integrators)
 	void InitLieGroupLists();
 
@@ -228,6 +316,8 @@ public:
 	void ComputeMassMatrix(TemporaryComputationDataArray& temp, GeneralMatrix& massMatrix, bool computeInverse=false);
 	//! run through all bodies and check if has constant mass matrix; used for solver
 	bool HasConstantMassMatrix();
+	//! return true, if system, objects, loads or sensors have user functions which need Python (GIL) during computation; used by solver to decide if GIL can be released
+	bool HasPythonUserFunctions() const;
 	//void ComputeMassMatrixOLD(TemporaryComputationData& temp, Matrix& massMatrix);
 
 	//! compute left-hand-side (LHS) of second order ordinary differential equations (ODE) for every object (used in numerical differentiation and in LHS computation); return true, if object has localODE2Lhs, false otherwise
@@ -239,6 +329,16 @@ public:
 	//! compute system right-hand-side (RHS) of second order ordinary differential equations (ODE) to 'systemODE2Rhs' for ODE2 part
 	void ComputeSystemODE2RHS(TemporaryComputationDataArray& tempArray, Vector& systemODE2Rhs);
 
+	//! compute ODE2 RHS of batched objects (structure-of-arrays blocks) and add to systemODE2Rhs
+	void ComputeBatchedODE2RHS(Vector& systemODE2Rhs);
+
+	//! record inputs of connectors with batched user functions by calling recordObject(objectNumber) and call every batched user function once;
+	//! forces are cached for the following object evaluation in ODE2 RHS or numerical Jacobian, until InvalidateBatchedUserFunctions() is called
+	void EvaluateBatchedUserFunctions(const std::function<void(Index)>& recordObject);
+
+	//! invalidate cached forces of batched user functions
+	void InvalidateBatchedUserFunctions();
+
 	//! compute system right-hand-side (RHS) of first order ordinary differential equations (ODE) to 'systemODE1Rhs' for ODE1 part
 	void ComputeSystemODE1RHS(TemporaryComputationData& temp, Vector& systemODE1Rhs);
 
@@ -285,6 +385,33 @@ public:
     // Jacobians
     // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
 
+	//! compute analytic (function-based) ODE2 jacobian of object j into temp.jacobianODE2Container (dense or sparse triplets);
+	//! returns false, if no analytic jacobian is available and numerical differentiation is needed; may be called in parallel
+	bool ComputeObjectJacobianODE2(Index j, TemporaryComputationData& temp, const NumericalDifferentiationSettings& numDiff,
+		Real factorODE2, Real factorODE2_t);
+
+	//! append analytic object jacobian computed in temp.jacobianODE2Container by ComputeObjectJacobianODE2(...) to triplets (using ltg mapping in dense mode);
+	//! sparse triplets of temp.jacobianODE2Container are cleared
+	void AppendObjectJacobianODE2Triplets(Index j, TemporaryComputationData& temp, SparseTripletVector& triplets);
+
+	//! compute constantJacobianODE2Cache for objects with constant ODE2 jacobian (or constant parts of jacobian) for unit factors
+	void ComputeConstantJacobianODE2Cache(TemporaryComputationData& temp, const NumericalDifferentiationSettings& numDiff);
+
+	//! invalidate constant ODE2 jacobian cache, e.g., if object parameters have changed
+	void InvalidateConstantJacobianODE2Cache() { constantJacobianODE2Cache.Invalidate(); }
+
+	//! reset measured costs of cost balanced tasks, if item lists processed by tasks have changed
+	void ResetCostBalancedTasks()
+	{
+		costBalancedTasksODE2RHS.Reset();
+		costBalancedTasksJacobianODE2.Reset();
+	}
+
+	//! compute numerical ODE2 jacobian (w.r.t. ODE2, ODE2_t and ODE1 coordinates) of object j and ADD it to jacobianGM;
+	//! as system coordinates are modified during differentiation, this function must not be called in parallel
+	void NumDiffObjectJacobianODE2(Index j, TemporaryComputationData& temp, const NumericalDifferentiationSettings& numDiff,
+		GeneralMatrix& jacobianGM, Real factorODE2, Real factorODE2_t, Real factorODE1);
+
 	//! compute numerical differentiation of ODE2RHS w.r.t. ODE2 and ODE2_t quantities; 
 	//! multiply (before added to jacobianGM) ODE2 with factorODE2 and ODE2_t with factorODE2_t
 	//! the jacobian is ADDed to jacobianGM, which needs to have according size; set entries to zero beforehand in order to obtain only the jacobian
@@ -32,6 +32,7 @@
 #include "System/CLoad.h"				//needs markers
 #include "System/CSensor.h"				//needs sensors
 #include "System/CObjectConnector.h"	//includes OutputVariable.h and CObject.h
+#include "Main/BatchedObjects.h"		//structure-of-arrays blocks for batched evaluation
 
 class CSystemData //
 {
@@ -65,16 +66,27 @@ protected: //
 public:
 	//use lists that are directly accessible for now; performance?
 	ResizableArray<Index> objectsBodyWithODE2Coords;	//!< list of objects that are bodies with ODE2 coordinates (e.g., no ground objects), ALL
-	ResizableArray<Index> objectsBodyWithODE2CoordsUF;	//!< list of objects that are bodies with ODE2 coordinates (e.g., no ground objects), with user function
-	ResizableArray<Index> objectsBodyWithODE2CoordsNoUF;//!< list of objects that are bodies with ODE2 coordinates (e.g., no ground objects), has no user function
+	ResizableArray<Index> objectsBodyWithODE2CoordsUF;	//!< list of objects that are bodies with ODE2 coordinates (e.g., no ground objects), with user function which is not thread safe
+	ResizableArray<Index> objectsBodyWithODE2CoordsNoUF;//!< list of objects that are bodies with ODE2 coordinates (e.g., no ground objects), has no user function or thread safe user functions
 	ResizableArray<Index> listComputeObjectODE2Lhs;		//!< list of objects that need to evaluate ComputeObjectODE2Lhs (ALL)
-	ResizableArray<Index> listComputeObjectODE2LhsUF;	//!< list of objects that need to evaluate ComputeObjectODE2Lhs with user functions
-	ResizableArray<Index> listComputeObjectODE2LhsNoUF;	//!< list of objects that need to evaluate ComputeObjectODE2Lhs, but have no user function
+	ResizableArray<Index> listComputeObjectODE2LhsUF;	//!< list of objects that need to evaluate ComputeObjectODE2Lhs with user functions which are not thread safe (Python functions)
+	ResizableArray<Index> listComputeObjectODE2LhsNoUF;	//!< list of objects that need to evaluate ComputeObjectODE2Lhs, but have no user function or thread safe user functions (compiled symbolic)
+	ResizableArray<Index> listComputeObjectODE2LhsNotBatched;	//!< objects of listComputeObjectODE2Lhs which are not evaluated in batchedSpringDampers; used for ODE2 RHS
+	ResizableArray<Index> listComputeObjectODE2LhsNoUFNotBatched;//!< objects of listComputeObjectODE2LhsNoUF which are not evaluated in batchedSpringDampers; used for ODE2 RHS
+	ResizableArray<Index> listComputeObjectODE2LhsNoUFColored;	//!< objects of listComputeObjectODE2LhsNoUFNotBatched sorted by colors; objects of one color do not share ODE2 coordinates; uncolored objects are at the end
+	ResizableArray<Index> listComputeObjectODE2LhsNoUFColorStart;//!< start index of every color in listComputeObjectODE2LhsNoUFColored; last entry marks begin of uncolored objects
 	ResizableArray<Index> listComputeObjectODE1Rhs;		//!< list of objects that need to evaluate ComputeObjectODE1Rhs
 	ResizableArray<Index> listDiscontinuousIteration;	//!< list of objects that need discontinuous iteration (PostNewtonStep, PostDiscontinuousIteration)
 
-    ResizableArray<Index> listOfLoadsNoUF;				//!< list of loads without user functions (can be processes multithreaded)
-	ResizableArray<Index> listOfLoadsUF;				//!< list of loads WITH user functions (must be processed serially)
+    ResizableArray<Index> listOfLoadsNoUF;				//!< list of loads without user functions or with thread safe user functions (can be processes multithreaded)
+	ResizableArray<Index> listOfLoadsUF;				//!< list of loads WITH user functions which are not thread safe (must be processed serially)
+
+	BatchedSpringDampers batchedSpringDampers;			//!< spring-dampers evaluated in structure-of-arrays block (experimental.batchedObjectEvaluation)
+	ResizableArray<BatchedUserFunction*> batchedUserFunctions;	//!< batched Python user functions of connectors (MainSystem::SetBatchedUserFunction); owned by CSystemData
+	ResizableArray<Index> objectBatchedUserFunction;	//!< per object: index into batchedUserFunctions or EXUstd::InvalidIndex; set at Assemble()
+	ResizableArray<Index> objectBatchedUserFunctionPosition;//!< per object: position of first recorded input in its batched user function in current evaluation
+	bool batchedUserFunctionRecording = false;			//!< true during recording pass of ODE2 RHS: connectors with batched user function only record their inputs
+	bool excludeConstantJacobianODE2Parts = false;		//!< true during ODE2 jacobian computation, if constant jacobian parts are added from cache: objects exclude these parts in ComputeODE2LHS
 
 	ResizableArray<Index> objectsBodyWithAE;			//!< list of objects that are bodies and have AE
 	ResizableArray<Index> nodesODE2WithAE;				//!< list of nodes that have AE (Euler parameters)
@@ -116,6 +128,7 @@ public: //
 		for (auto item : cNodes) { delete item; }
 		for (auto item : cObjects) { delete item; }
 		for (auto item : cSensors) { delete item; }
+		for (auto item : batchedUserFunctions) { delete item; }
 
 		cLoads.Flush();
 		cMarkers.Flush();
@@ -123,6 +136,8 @@ public: //
 		cNodes.Flush();
 		cObjects.Flush();
 		cSensors.Flush();
+		batchedUserFunctions.Flush();
+		objectBatchedUserFunction.Flush();
 
 		numberOfCoordinatesODE2 = 0;
 		numberOfCoordinatesODE1 = 0;
@@ -157,6 +172,24 @@ public: //
 		hasLieGroupDUNodes = false;
 	}
 
+	//! called by connectors with Python user function instead of per-item user function: in recording pass, inputs are recorded and force is zero;
+	//! otherwise, force is taken from last batched evaluation if inputs are identical; returns false if the per-item user function must be called
+	bool GetBatchedUserFunctionForce(Index objectNumber, Real t, const Real* displacement, const Real* velocity, Real* force)
+	{
+		if (objectNumber >= objectBatchedUserFunction.NumberOfItems() || objectBatchedUserFunction[objectNumber] == EXUstd::InvalidIndex) { return false; }
+
+		BatchedUserFunction& batch = *batchedUserFunctions[objectBatchedUserFunction[objectNumber]];
+		if (batchedUserFunctionRecording)
+		{
+			Index position = batch.Record(objectNumber, t, displacement, velocity);
+			if (objectBatchedUserFunctionPosition[objectNumber] == EXUstd::InvalidIndex) { objectBatchedUserFunctionPosition[objectNumber] = position; }
+			for (Index k = 0; k < batch.dimension; k++) { force[k] = 0.; }
+			return true;
+		}
+		Index position = objectBatchedUserFunctionPosition[objectNumber];
+		return position != EXUstd::InvalidIndex && batch.GetCachedForce(position, objectNumber, t, displacement, velocity, force);
+	}
+
 	//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
 	//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
 	//! Write (Reference) access to:computational data for all configurations (current, initial, etc.); this data is available in CNode
@@ -30,6 +30,7 @@ class PyExperimental
 {
 public: 
     Index eigenFullPivotLUsolverDebugLevel; //!< debug: 0=off, 1=print rank and info, 2=print matrices
+    bool batchedObjectEvaluation; //!< True: at Assemble(), ObjectConnectorSpringDamper items between NodePoints are put into structure-of-arrays blocks, evaluated in one pass (AVX, if available) in ODE2 RHS computation
 
     PyExperimental()
     {
@@ -39,6 +40,7 @@ public:
     void Initialize()
     {
         eigenFullPivotLUsolverDebugLevel = 0;
+        batchedObjectEvaluation = false;
     }
 
     //++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
@@ -46,6 +48,7 @@ public:
     virtual void Print(std::ostream& os) const
     {
         os << "  eigenFullPivotLUsolverDebugLevel = " << eigenFullPivotLUsolverDebugLevel << "\n";
+        os << "  batchedObjectEvaluation = " << batchedObjectEvaluation << "\n";
         os << "\n";
     }
 
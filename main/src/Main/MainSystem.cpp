@@ -23,9 +23,15 @@
 
 #include <chrono> //sleep_for()
 #include <thread>
+#include <atomic>
 
 #include "Main/MainSystemData.h"
 #include "Main/MainSystem.h"
+#include "Main/MainSystemContainer.h" //for software renderer
+#include "Main/rendererPythonInterface.h" //for PyCheckSignals
+#include "Solver/CSolverImplicitSecondOrder.h" //for ensembles
+#include "Solver/CSolverExplicit.h"
+#include "Solver/CSolverStatic.h"
 #include "Pymodules/PybindUtilities.h"
 
 #include "Pymodules/PyGeneralContact.h"
@@ -62,6 +68,9 @@ MainSystem::MainSystem()
 //! reset all lists and deallocate memory
 void MainSystem::Reset()
 {
+	//software renderer would access system data during reset
+	if (HasMainSystemContainer()) { GetMainSystemContainer().GetVisualizationSystemContainer().StopSoftwareRenderer(); }
+
 	mainSystemData.Reset(); //
 	GetCSystem().GetSystemData().Reset();
 	GetCSystem().GetPythonUserFunctions().Reset();
@@ -194,6 +203,360 @@ void MainSystem::SetDictionary(const py::dict& d)
 	systemVariables = d["systemVariables"];
 }
 
+//! check configuration for state checkpoints; reference configuration is defined by items and cannot be restored
+void RaiseIfStateCheckpointConfigurationIllegal(const char* functionName, ConfigurationType configuration)
+{
+	if (configuration == ConfigurationType::Reference || configuration == ConfigurationType::_None || configuration == ConfigurationType::EndOfEnumList)
+	{
+		PyError(STDstring(functionName) + ": illegal configuration; use Current, Initial, StartOfStep or Visualization");
+	}
+}
+
+py::bytes MainSystem::PyGetStateCheckpoint(ConfigurationType configuration) const
+{
+	RaiseIfStateCheckpointConfigurationIllegal("GetStateCheckpoint", configuration);
+	STDstring buffer;
+	cSystem.WriteStateCheckpoint(*mainSystemData.GetCSystemState(configuration), buffer);
+	return py::bytes(buffer);
+}
+
+void MainSystem::PySetStateCheckpoint(const py::bytes& checkpoint, ConfigurationType configuration)
+{
+	RaiseIfStateCheckpointConfigurationIllegal("SetStateCheckpoint", configuration);
+	char* data;
+	Py_ssize_t size;
+	PyBytes_AsStringAndSize(checkpoint.ptr(), &data, &size); //no copy of data
+	cSystem.ReadStateCheckpoint(data, (size_t)size, *mainSystemData.GetCSystemState(configuration));
+}
+
+void MainSystem::PyWriteStateCheckpoint(const STDstring& fileName, ConfigurationType configuration) const
+{
+	RaiseIfStateCheckpointConfigurationIllegal("WriteStateCheckpoint", configuration);
+	STDstring buffer;
+	cSystem.WriteStateCheckpoint(*mainSystemData.GetCSystemState(configuration), buffer);
+
+	CheckPathAndCreateDirectories(fileName);
+	std::ofstream file(fileName, std::ofstream::out | std::ofstream::binary);
+	if (!file.is_open()) { PyError("WriteStateCheckpoint: failed to open file '" + fileName + "'"); return; }
+	file.write(buffer.c_str(), buffer.length());
+}
+
+void MainSystem::PyReadStateCheckpoint(const STDstring& fileName, ConfigurationType configuration)
+{
+	RaiseIfStateCheckpointConfigurationIllegal("ReadStateCheckpoint", configuration);
+	std::ifstream file(fileName, std::ifstream::in | std::ifstream::binary);
+	if (!file.is_open()) { PyError("ReadStateCheckpoint: failed to open file '" + fileName + "'"); return; }
+
+	STDstring buffer((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+	cSystem.ReadStateCheckpoint(buffer.c_str(), buffer.length(), *mainSystemData.GetCSystemState(configuration));
+}
+
+//! number of solvers currently running with released GIL; defined in CSolverBase.cpp
+extern std::atomic<Index> numberOfSolversWithReleasedGIL;
+
+//! set parameter of node, object, marker, load or sensor; the type of itemIndex decides on the item list
+void SetEnsembleItemParameter(MainSystem& mainSystem, const py::object& itemIndex, const STDstring& parameterName, const py::object& value)
+{
+	if (py::isinstance<NodeIndex>(itemIndex)) { mainSystem.PySetNodeParameter(itemIndex, parameterName, value); }
+	else if (py::isinstance<ObjectIndex>(itemIndex)) { mainSystem.PySetObjectParameter(itemIndex, parameterName, value); }
+	else if (py::isinstance<MarkerIndex>(itemIndex)) { mainSystem.PySetMarkerParameter(itemIndex, parameterName, value); }
+	else if (py::isinstance<LoadIndex>(itemIndex)) { mainSystem.PySetLoadParameter(itemIndex, parameterName, value); }
+	else if (py::isinstance<SensorIndex>(itemIndex)) { mainSystem.PySetSensorParameter(itemIndex, parameterName, value); }
+	else
+	{
+		PyError(STDstring("SolveEnsemble: parameter override requires NodeIndex, ObjectIndex, MarkerIndex, LoadIndex or SensorIndex, but received '") + EXUstd::ToString(itemIndex) + "'");
+	}
+}
+
+//! solve one ensemble member with serial solver; solver is chosen as in exudyn.SolveDynamic(...) / exudyn.SolveStatic(...)
+bool SolveEnsembleMember(CSystem& computationalSystem, const SimulationSettings& simulationSettings, DynamicSolverType solverType, bool useStaticSolver)
+{
+	if (useStaticSolver)
+	{
+		CSolverStatic solver;
+		return solver.SolveSystem(computationalSystem, simulationSettings);
+	}
+	else if (solverType == DynamicSolverType::GeneralizedAlpha || solverType == DynamicSolverType::TrapezoidalIndex2)
+	{
+		CSolverImplicitSecondOrderTimeInt solver;
+		return solver.SolveSystem(computationalSystem, simulationSettings);
+	}
+	CSolverExplicitTimeInt solver;
+	return solver.SolveSystem(computationalSystem, simulationSettings);
+}
+
+py::dict MainSystem::PySolveEnsemble(const py::list& parameterSets, const py::list& sensorNumbers, const SimulationSettings& simulationSettings,
+	DynamicSolverType solverType, bool useStaticSolver, Index numberOfThreads)
+{
+	if (!cSystem.IsSystemConsistent()) { PyError("SolveEnsemble: system is inconsistent and cannot be copied (call Assemble() and check error messages)"); }
+	if (cSystem.GetGeneralContacts().NumberOfItems() != 0) { PyError("SolveEnsemble: MainSystem contains GeneralContact which cannot be copied"); }
+	//renderer would process user input and graphics of members in solver threads
+	if (HasMainSystemContainer() && GetMainSystemContainer().GetVisualizationSystemContainer().RendererIsRunning())
+	{
+		PyError("SolveEnsemble: cannot be used while renderer is running; call exudyn.StopRenderer() first");
+	}
+
+	ArrayIndex sensors = EPyUtils::GetArraySensorIndexSafely(sensorNumbers);
+	for (Index sensorNumber : sensors)
+	{
+		if (sensorNumber >= mainSystemData.GetMainSensors().NumberOfItems())
+		{
+			PyError(STDstring("SolveEnsemble: invalid sensor number ") + EXUstd::ToString(sensorNumber));
+		}
+	}
+
+	//members must not share files and run serially inside their threads
+	SimulationSettings memberSettings = simulationSettings;
+	memberSettings.solutionSettings.writeSolutionToFile = false;
+	memberSettings.solutionSettings.recordImagesInterval = -1.;
+	memberSettings.timeIntegration.verboseModeFile = 0;
+	memberSettings.staticSolver.verboseModeFile = 0;
+	memberSettings.parallel.numberOfThreads = 1;
+	if (!useStaticSolver)
+	{
+		if (solverType == DynamicSolverType::TrapezoidalIndex2)
+		{
+			memberSettings.timeIntegration.generalizedAlpha.useNewmark = true;
+			memberSettings.timeIntegration.generalizedAlpha.useIndex2Constraints = true;
+		}
+		else if (solverType != DynamicSolverType::GeneralizedAlpha)
+		{
+			memberSettings.timeIntegration.explicitIntegration.dynamicSolverType = solverType;
+		}
+	}
+
+	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+	//create members from dictionary of this system; members are not linked to renderer
+	//copying via dictionary is serial and holds the GIL, but it is cheap compared to solving: measured for a chain of
+	//  1000 mass points and 1000 spring-dampers (EigenSparse, generalized-alpha), GetDictionary() takes 0.05s once,
+	//  SetDictionary(...) + Assemble() 0.09s per member, while a single time step of a member takes 0.12s;
+	//  thus, copying costs less than one time step per member and scales linearly with number of items
+	Index numberOfMembers = (Index)parameterSets.size();
+	py::dict systemDict = GetDictionary();
+	MainSystemContainer ensembleContainer(false);
+	py::list memberObjects; //registered Python objects of members, needed if Python user functions receive member as mbs
+	bool hasPythonUserFunctions = false;
+
+	for (Index i = 0; i < numberOfMembers; i++)
+	{
+		MainSystem& member = ensembleContainer.AddMainSystem();
+		memberObjects.append(py::cast(&member, py::return_value_policy::reference));
+		member.SetDictionary(systemDict);
+		member.SetInteractiveMode(false);
+
+		for (auto item : py::cast<py::list>(parameterSets[i]))
+		{
+			py::tuple parameterOverride = py::cast<py::tuple>(item);
+			if (parameterOverride.size() != 3)
+			{
+				PyError(STDstring("SolveEnsemble: parameterSets[") + EXUstd::ToString(i) + "] must contain tuples (itemIndex, parameterName, value)");
+			}
+			SetEnsembleItemParameter(member, parameterOverride[0], py::cast<STDstring>(parameterOverride[1]), parameterOverride[2]);
+		}
+
+		for (Index j = 0; j < member.GetMainSystemData().GetMainSensors().NumberOfItems(); j++)
+		{
+			member.PySetSensorParameter(py::int_(j), "writeToFile", py::bool_(false));
+		}
+		for (Index sensorNumber : sensors)
+		{
+			member.PySetSensorParameter(py::int_(sensorNumber), "storeInternal", py::bool_(true));
+		}
+
+		member.Assemble();
+		if (!member.GetCSystem().IsSystemConsistent()) { PyError(STDstring("SolveEnsemble: member ") + EXUstd::ToString(i) + " is inconsistent after parameter overrides"); }
+		hasPythonUserFunctions = hasPythonUserFunctions || member.GetCSystem().HasPythonUserFunctions();
+	}
+
+	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+	//solve members; every thread takes next member, until all members are solved
+	std::vector<char> success(numberOfMembers, 0);
+	std::vector<STDstring> errorMessages(numberOfMembers);
+	std::atomic<Index> nextMember(0);
+	std::atomic<Index> finishedThreads(0);
+	std::atomic<bool> stopEnsemble(false);
+
+	auto SolveMembers = [&]()
+	{
+		Index i;
+		while (!stopEnsemble && (i = nextMember++) < numberOfMembers)
+		{
+			try
+			{
+				success[i] = SolveEnsembleMember(ensembleContainer.GetMainSystems()[i]->GetCSystem(), memberSettings, solverType, useStaticSolver);
+			}
+			catch (const py::error_already_set&) //only in serial mode with Python user functions, e.g., CTRL+C
+			{
+				stopEnsemble = true;
+				throw;
+			}
+			catch (const std::exception& ex)
+			{
+				errorMessages[i] = ex.what();
+			}
+		}
+		finishedThreads++;
+	};
+
+	if (numberOfThreads <= 0) { numberOfThreads = (Index)std::thread::hardware_concurrency(); }
+	numberOfThreads = EXUstd::Maximum((Index)1, EXUstd::Minimum(numberOfThreads, numberOfMembers));
+
+	if (hasPythonUserFunctions)
+	{
+		PyWarning("SolveEnsemble: members contain Python user functions, which need the GIL; members are solved one after another");
+		SolveMembers();
+	}
+	else if (numberOfMembers != 0)
+	{
+		bool interrupted = false;
+		{
+			numberOfSolversWithReleasedGIL++; //other solvers do not start task manager in the meantime
+			py::gil_scoped_release releaseGIL;
+
+			std::vector<std::thread> threads;
+			for (Index t = 0; t < numberOfThreads; t++) { threads.emplace_back(SolveMembers); }
+
+			//member threads do not check signals, this is done here
+			while (finishedThreads < numberOfThreads)
+			{
+				std::this_thread::sleep_for(std::chrono::milliseconds(20));
+				if (!interrupted && PyCheckSignals())
+				{
+					interrupted = true;
+					stopEnsemble = true;
+					for (MainSystem* member : ensembleContainer.GetMainSystems()) { member->GetCSystem().GetPostProcessData()->stopSimulation = true; }
+				}
+			}
+			for (std::thread& thread : threads) { thread.join(); }
+			numberOfSolversWithReleasedGIL--;
+		}
+		if (interrupted) { throw py::error_already_set(); } //e.g. KeyboardInterrupt from CTRL+C
+	}
+
+	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+	//collect results
+	py::list successList;
+	py::list sensorData;
+	for (Index i = 0; i < numberOfMembers; i++)
+	{
+		if (errorMessages[i].size() != 0)
+		{
+			PyWarning(STDstring("SolveEnsemble: member ") + EXUstd::ToString(i) + " failed: " + errorMessages[i]);
+		}
+		successList.append((bool)success[i]);
+
+		py::list memberSensorData;
+		for (Index sensorNumber : sensors)
+		{
+			memberSensorData.append(ensembleContainer.GetMainSystem(i).PyGetSensorStoredData(py::int_(sensorNumber)));
+		}
+		sensorData.append(memberSensorData);
+	}
+
+	py::dict results;
+	results["success"] = successList;
+	results["sensorData"] = sensorData;
+	return results;
+}
+
+void MainSystem::PySetBatchedUserFunction(const py::list& objectNumbers, const py::object& batchedUserFunction)
+{
+	if (!py::isinstance<py::function>(batchedUserFunction)) { PyError("SetBatchedUserFunction: batchedUserFunction must be a Python function"); }
+
+	ArrayIndex objects;
+	for (auto item : objectNumbers)
+	{
+		objects.Append(EPyUtils::GetObjectIndexSafely(py::cast<py::object>(item)));
+	}
+	if (objects.NumberOfItems() == 0) { PyError("SetBatchedUserFunction: objectNumbers may not be empty"); }
+
+	STDstring typeName;
+	for (Index i : objects)
+	{
+		if (i >= mainSystemData.GetMainObjects().NumberOfItems()) { PyError(STDstring("SetBatchedUserFunction: invalid object number ") + EXUstd::ToString(i)); }
+		STDstring itemTypeName = mainSystemData.GetMainObjects()[i]->GetTypeName();
+		if (typeName.size() == 0) { typeName = itemTypeName; }
+		else if (itemTypeName != typeName)
+		{
+			PyError("SetBatchedUserFunction: all objects must have same type, but received Object" + typeName + " and Object" + itemTypeName);
+		}
+	}
+
+	Index dimension = 1;
+	if (typeName == "ConnectorCartesianSpringDamper") { dimension = 3; }
+	else if (typeName != "ConnectorCoordinateSpringDamper" && typeName != "ConnectorSpringDamper")
+	{
+		PyError("SetBatchedUserFunction: only available for ObjectConnectorCoordinateSpringDamper, ObjectConnectorSpringDamper and ObjectConnectorCartesianSpringDamper, but received Object" + typeName);
+	}
+
+	//objects can only be part of one batched user function:
+	CSystemData& cSystemData = cSystem.GetSystemData();
+	for (Index k = 0; k < cSystemData.batchedUserFunctions.NumberOfItems(); k++)
+	{
+		ResizableArray<Index>& batchedObjects = cSystemData.batchedUserFunctions[k]->objectNumbers;
+		for (Index j = batchedObjects.NumberOfItems(); j > 0; j--)
+		{
+			if (objects.GetIndexOfItem(batchedObjects[j - 1]) != EXUstd::InvalidIndex) { batchedObjects.Remove(j - 1); }
+		}
+		if (batchedObjects.NumberOfItems() == 0)
+		{
+			delete cSystemData.batchedUserFunctions[k];
+			cSystemData.batchedUserFunctions.Remove(k--);
+		}
+	}
+
+	py::function pyFunction = py::cast<py::function>(batchedUserFunction);
+	BatchedUserFunction* batch = new BatchedUserFunction(dimension);
+	batch->objectNumbers.CopyFrom(objects);
+	batch->evaluate = [pyFunction, this](BatchedUserFunction& data)
+	{
+		Index n = data.recordedObjectNumbers.NumberOfItems();
+		std::vector<py::ssize_t> shape = { (py::ssize_t)n };
+		std::vector<py::ssize_t> strides = { (py::ssize_t)sizeof(Real) };
+		if (data.dimension != 1)
+		{
+			shape.push_back((py::ssize_t)data.dimension);
+			strides = { (py::ssize_t)(data.dimension * sizeof(Real)), (py::ssize_t)sizeof(Real) };
+		}
+
+		py::array_t<Real, py::array::c_style | py::array::forcecast> forces;
+		UserFunctionExceptionHandling([&] //lambda function to add consistent try{..} catch(...) block
+		{
+			py::object result = pyFunction(py::cast(this, py::return_value_policy::reference), data.time,
+				py::array_t<Index>({ (py::ssize_t)n }, { (py::ssize_t)sizeof(Index) }, data.recordedObjectNumbers.GetDataPointer()),
+				py::array_t<Real>(shape, strides, data.displacements.GetDataPointer()),
+				py::array_t<Real>(shape, strides, data.velocities.GetDataPointer()));
+			forces = py::cast<py::array_t<Real, py::array::c_style | py::array::forcecast>>(result);
+		}, "MainSystem::SetBatchedUserFunction::batchedUserFunction");
+
+		if ((Index)forces.size() != n * data.dimension)
+		{
+			PyError("SetBatchedUserFunction: batchedUserFunction must return " + EXUstd::ToString(n * data.dimension) +
+				" forces (one per item and force component), but returned " + EXUstd::ToString(forces.size()));
+		}
+		data.forces.SetNumberOfItems(n * data.dimension);
+		std::copy(forces.data(), forces.data() + forces.size(), data.forces.begin());
+	};
+	cSystemData.batchedUserFunctions.Append(batch);
+
+	//per-item user function, used outside of ODE2 RHS (e.g., numerical Jacobians, output variables); calls batched function with one item
+	py::cpp_function itemUserFunction([pyFunction](const py::object& mbs, Real t, Index itemNumber, const py::object& displacement, const py::object& velocity, const py::args&)
+	{
+		py::module numpy = py::module::import("numpy");
+		py::list itemNumbers, displacements, velocities;
+		itemNumbers.append(itemNumber);
+		displacements.append(displacement);
+		velocities.append(velocity);
+		py::object forces = pyFunction(mbs, t, numpy.attr("array")(itemNumbers), numpy.attr("array")(displacements), numpy.attr("array")(velocities));
+		return py::object(forces[py::int_(0)]);
+	});
+	for (Index i : objects)
+	{
+		PySetObjectParameter(py::cast(ObjectIndex(i)), "springForceUserFunction", itemUserFunction);
+	}
+	SystemHasChanged();
+}
+
 MainSystemContainer& MainSystem::GetMainSystemContainer() 
 {
 	return *mainSystemContainerBacklink; 
@@ -896,6 +1259,8 @@ void MainSystem::PySetObjectParameter(const py::object& itemIndex, const STDstri
 	if (itemNumber < mainSystemData.GetMainObjects().NumberOfItems())
 	{
 		mainSystemData.GetMainObjects().GetItem(itemNumber)->SetParameter(parameterName, value);
+		GetVisualizationSystem().InvalidateCachedBodyGraphics(); //graphicsData of object may have changed
+		GetCSystem().InvalidateConstantJacobianODE2Cache(); //e.g. stiffness may have changed
 	}
 	else
 	{
@@ -1057,6 +1422,7 @@ void MainSystem::PySetMarkerParameter(const py::object& itemIndex, const STDstri
 	if (itemNumber < mainSystemData.GetMainMarkers().NumberOfItems())
 	{
 		mainSystemData.GetMainMarkers().GetItem(itemNumber)->SetParameter(parameterName, value);
+		GetCSystem().InvalidateConstantJacobianODE2Cache(); //marker jacobians of connectors may have changed
 	}
 	else
 	{
@@ -1411,7 +1777,7 @@ py::object MainSystem::PyGetSensorValues(const py::object& itemIndex, Configurat
 }
 
 //! get sensor's stored data (if it exists ...)
-py::array_t<Real> MainSystem::PyGetSensorStoredData(const py::object& itemIndex)
+py::array_t<Real> MainSystem::PyGetSensorStoredData(const py::object& itemIndex, bool copy)
 {
 
 	Index itemNumber = EPyUtils::GetSensorIndexSafely(itemIndex);
@@ -1422,7 +1788,7 @@ py::array_t<Real> MainSystem::PyGetSensorStoredData(const py::object& itemIndex)
 			PyError(STDstring("MainSystem::GetSensorStoredData: sensor number ") + EXUstd::ToString(itemNumber)+" has no internal data as storeInternal==False");
 			return py::int_(EXUstd::InvalidIndex);
 		}
-		return mainSystemData.GetMainSensors().GetItem(itemNumber)->GetInternalStorage();
+		return mainSystemData.GetMainSensors().GetItem(itemNumber)->GetInternalStorage(copy);
 	}
 	else
 	{
@@ -81,6 +81,22 @@ public:
 	//! function for setting all data from dict; for pickling
 	void SetDictionary(const py::dict& d);
 
+	//! return binary checkpoint of state in given configuration, sensor internal storage and contact active sets
+	py::bytes PyGetStateCheckpoint(ConfigurationType configuration = ConfigurationType::Current) const;
+	//! restore state in given configuration, sensor internal storage and contact active sets from binary checkpoint
+	void PySetStateCheckpoint(const py::bytes& checkpoint, ConfigurationType configuration = ConfigurationType::Current);
+	//! write binary checkpoint (see PyGetStateCheckpoint) to file
+	void PyWriteStateCheckpoint(const STDstring& fileName, ConfigurationType configuration = ConfigurationType::Current) const;
+	//! restore from binary checkpoint file written with PyWriteStateCheckpoint
+	void PyReadStateCheckpoint(const STDstring& fileName, ConfigurationType configuration = ConfigurationType::Current);
+
+	//! solve copies (ensemble members) of this assembled system with parameter overrides per member in parallel C++ threads; returns success flags and stored data of given sensors per member
+	py::dict PySolveEnsemble(const py::list& parameterSets, const py::list& sensorNumbers, const SimulationSettings& simulationSettings,
+		DynamicSolverType solverType = DynamicSolverType::GeneralizedAlpha, bool useStaticSolver = false, Index numberOfThreads = 0);
+
+	//! set one Python user function for several connectors of same type, which is called once per ODE2 RHS evaluation with arrays of all item states
+	void PySetBatchedUserFunction(const py::list& objectNumbers, const py::object& batchedUserFunction);
+
 	CSystem& GetCSystem() { return cSystem; }
 	const CSystem& GetCSystem() const { return cSystem; }
 
@@ -343,7 +359,7 @@ public:
 	//! get sensor's values
 	py::object PyGetSensorValues(const py::object& itemIndex, ConfigurationType configuration = ConfigurationType::Current);
 	//! get sensor's values
-	py::array_t<Real> PyGetSensorStoredData(const py::object& itemIndex);
+	py::array_t<Real> PyGetSensorStoredData(const py::object& itemIndex, bool copy = true);
 
 	//! Get (read) parameter 'parameterName' of 'itemNumber' via pybind / pyhton interface instead of obtaining the whole dictionary with GetDictionary
 	virtual py::object PyGetSensorParameter(const py::object& itemIndex, const STDstring& parameterName) const;
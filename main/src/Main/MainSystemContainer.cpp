@@ -356,3 +356,16 @@ void MainSystemContainer::SendRedrawSignal()
 	}
 }
 
+//! update graphics data of all systems in current thread, without renderer; only possible if renderer is not running
+void MainSystemContainer::PyUpdateGraphicsData()
+{
+	if (visualizationSystems.RendererIsRunning())
+	{
+		PyWarning("SystemContainer::UpdateGraphicsData: graphics data is updated by renderer while it is running; call ignored");
+		return;
+	}
+	visualizationSystems.StopSoftwareRenderer(); //graphics data must not be updated by two threads
+	SendRedrawSignal();
+	visualizationSystems.UpdateGraphicsData();
+}
+
@@ -29,9 +29,10 @@ protected:
 	//MainSolverContainer solvers;                      //!< contains a structure with all solver-relevant structures (dynamic, static, etc.)
 
 public:
-	MainSystemContainer()
+	//! attachToRenderEngine=false creates internal containers (e.g. for ensembles), which do not replace the container linked to the renderer
+	MainSystemContainer(bool attachToRenderEngine = true)
 	{
-		AttachToRenderEngineInternal(); //also sets exu.sys['currentRendererSystemContainer']
+		if (attachToRenderEngine) { AttachToRenderEngineInternal(); } //also sets exu.sys['currentRendererSystemContainer']
 	}
 
 	//! delete all systems (otherwise they could do illegal operations)
@@ -145,6 +146,9 @@ public:
 
 	void SendRedrawSignal();
 
+	//! update graphics data of all systems in current thread, without renderer; only possible if renderer is not running
+	void PyUpdateGraphicsData();
+
 	//delete:
 	//virtual void Print(std::ostream& os) const
 	//{
@@ -0,0 +1,157 @@
+/** ***********************************************************************************************
+* @file			StateCheckpoint.h
+* @brief		Helper classes for binary state checkpoints in memory buffers
+* @details		Details:
+* 				- checkpoints contain system state, sensor internal storage and contact active sets, see CSystem::WriteStateCheckpoint
+* 				- data is stored in native binary format (Index, Real, endianness), given in 16 bytes header as in binary solution files
+* 				- checkpoints are intended for fast save/restore of the same system, not for exchange between platforms
+*
+* @date			2026-10-17 (created)
+*
+* @copyright    This file is part of Exudyn. Exudyn is free software: you can redistribute it and/or modify it under the terms of the Exudyn license. See 'LICENSE.txt' for more details.
+* @note			Bug reports, support and further information:
+* 				- email: johannes.gerstmayr@uibk.ac.at
+* 				- weblink: https://github.com/jgerstmayr/EXUDYN
+*
+*
+************************************************************************************************ */
+#ifndef STATECHECKPOINT__H
+#define STATECHECKPOINT__H
+
+#include "Utilities/ReleaseAssert.h"
+#include "Utilities/BasicDefinitions.h"
+#include "Linalg/BasicLinalg.h"
+
+#include <cstring> //memcpy
+#include <sstream>
+#include "Main/WriteBinary.h" //BinaryFileSettings, BinaryWriteHeader
+
+namespace ExuFile {
+
+	const char stateCheckpointIdentifier[] = "EXUCHK";	//!< identifier in header of state checkpoints; 6 characters
+	const Index stateCheckpointHeaderSize = 16;			//!< size of header in bytes, see BinaryWriteHeader
+	const Index stateCheckpointVersion = 1;				//!< increase if format changes
+
+	//! append native binary data to buffer; all sizes are stored as Index, all values as Real
+	class BinaryBufferWriter
+	{
+	private:
+		STDstring& buffer;
+	public:
+		//! buffer is cleared and checkpoint header is written
+		BinaryBufferWriter(STDstring& bufferInit) : buffer(bufferInit)
+		{
+			std::ostringstream header;
+			BinaryWriteHeader(header, BinaryFileSettings(), stateCheckpointIdentifier);
+			buffer = header.str();
+			Write(stateCheckpointVersion);
+		}
+
+		void WriteBytes(const void* data, size_t numberOfBytes) { buffer.append((const char*)data, numberOfBytes); }
+		void Write(Index value) { WriteBytes(&value, sizeof(Index)); }
+		void Write(Real value) { WriteBytes(&value, sizeof(Real)); }
+
+		//! write size and values of vector
+		void Write(const Real* data, Index numberOfItems)
+		{
+			Write(numberOfItems);
+			WriteBytes(data, numberOfItems * sizeof(Real));
+		}
+		void Write(const VectorBase<Real>& vector) { Write(vector.GetDataPointer(), vector.NumberOfItems()); }
+
+		//! write size and items of Index array
+		void Write(const ArrayIndex& array)
+		{
+			Write(array.NumberOfItems());
+			WriteBytes(array.GetDataPointer(), array.NumberOfItems() * sizeof(Index));
+		}
+
+		//! write size and components of Vector3D array
+		void Write(const ResizableArray<Vector3D>& array)
+		{
+			Write(array.NumberOfItems());
+			for (const Vector3D& v : array) { WriteBytes(v.GetDataPointer(), 3 * sizeof(Real)); }
+		}
+	};
+
+	//! read data written by BinaryBufferWriter; raises error (also in fast mode) if data is invalid or ends unexpectedly
+	class BinaryBufferReader
+	{
+	private:
+		const char* data;
+		size_t size;
+		size_t position;
+
+		const char* Advance(size_t numberOfBytes)
+		{
+			if (numberOfBytes > size - position) { PyError("state checkpoint: data incomplete or corrupted"); }
+			const char* current = data + position;
+			position += numberOfBytes;
+			return current;
+		}
+	public:
+		//! checks header and version of checkpoint
+		BinaryBufferReader(const char* dataInit, size_t sizeInit) : data(dataInit), size(sizeInit), position(0)
+		{
+			std::ostringstream header;
+			BinaryWriteHeader(header, BinaryFileSettings(), stateCheckpointIdentifier);
+			if (size < (size_t)stateCheckpointHeaderSize || std::memcmp(data, stateCheckpointIdentifier, 6) != 0)
+			{
+				PyError("state checkpoint: invalid data; checkpoint must be created with GetStateCheckpoint(...) or WriteStateCheckpoint(...)");
+			}
+			if (std::memcmp(data, header.str().c_str(), stateCheckpointHeaderSize) != 0)
+			{
+				PyError("state checkpoint: checkpoint has been created on platform with different binary format (Index, Real or endianness)");
+			}
+			position = stateCheckpointHeaderSize;
+			if (ReadIndex() != stateCheckpointVersion) { PyError("state checkpoint: checkpoint has been created with incompatible version"); }
+		}
+
+		//! true, if all data has been read
+		bool IsFinished() const { return position == size; }
+
+		Index ReadIndex() { Index value; std::memcpy(&value, Advance(sizeof(Index)), sizeof(Index)); return value; }
+		Real ReadReal() { Real value; std::memcpy(&value, Advance(sizeof(Real)), sizeof(Real)); return value; }
+
+		//! read size, which must be non-negative and must fit into remaining data for given size of items
+		Index ReadSize(size_t itemSize)
+		{
+			Index n = ReadIndex();
+			if (n < 0 || (size_t)n * itemSize > size - position) { PyError("state checkpoint: data incomplete or corrupted"); }
+			return n;
+		}
+
+		//! read numberOfItems Reals into data
+		void Read(Real* values, Index numberOfItems) { std::memcpy(values, Advance(numberOfItems * sizeof(Real)), numberOfItems * sizeof(Real)); }
+
+		//! read vector, which must have the same size as the vector in the checkpoint
+		void Read(VectorBase<Real>& vector, const char* vectorName)
+		{
+			Index n = ReadSize(sizeof(Real));
+			if (n != vector.NumberOfItems())
+			{
+				PyError(STDstring("state checkpoint: size of ") + vectorName + " does not fit to system; checkpoint must be created from same (assembled) system");
+			}
+			Read(vector.GetDataPointer(), n);
+		}
+
+		//! read Index array; array is resized
+		void Read(ArrayIndex& array)
+		{
+			Index n = ReadSize(sizeof(Index));
+			array.SetNumberOfItems(n);
+			std::memcpy(array.GetDataPointer(), Advance(n * sizeof(Index)), n * sizeof(Index));
+		}
+
+		//! read Vector3D array; array is resized
+		void Read(ResizableArray<Vector3D>& array)
+		{
+			Index n = ReadSize(3 * sizeof(Real));
+			array.SetNumberOfItems(n);
+			for (Vector3D& v : array) { Read(v.GetDataPointer(), 3); }
+		}
+	};
+
+} //namespace ExuFile
+
+#endif
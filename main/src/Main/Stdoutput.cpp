@@ -112,17 +112,12 @@ bool CheckPathAndCreateDirectories(const STDstring& pathAndFileName)
 
 //+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
 //global variable for timers:
-std::vector<Real>* globalTimersCounters = nullptr; //global scalar variables get initialized with zero, this works on all platforms ... (arrays are not initialized ...)!
-std::vector<const char*>* globalTimersCounterNames = nullptr;
+std::vector<const char*>* globalTimersCounterNames = nullptr; //global scalar variables get initialized with zero, this works on all platforms ... (arrays are not initialized ...)!
 TimerStructure globalTimers(4.5e-08); //offset added to correct measurements (i9: 4.521e-08); may lead to negative timings!
 
 //! initialize timers at first call to RegisterTimer, whatever library is doing that (unordered! depends on compiler / Windows/Linux/...)
 void TimerStructure::Initialize()
 {
-	if (globalTimersCounters == nullptr)
-	{
-		globalTimersCounters = new std::vector<Real>();
-	}
 	if (globalTimersCounterNames == nullptr)
 	{
 		globalTimersCounterNames = new std::vector<const char*>();
@@ -132,9 +127,8 @@ void TimerStructure::Initialize()
 Index TimerStructure::RegisterTimer(const char* name)
 {
 	Initialize(); //called upon every registration; this is needed, because it is unclear, which function is called first!
-	Index n = (Index)globalTimersCounters->size();
-	globalTimersCounters->push_back(0.);
-	globalTimersCounterNames->push_back(name);
+	Index n = (Index)globalTimersCounterNames->size();
+	globalTimersCounterNames->push_back(name); //counters are created per thread, see TimerStructure::Counters()
 	return n;
 }
 //+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
@@ -150,8 +144,11 @@ bool deactivateGlobalPyRuntimeErrorFlag = false; //this flag is set true as soon
 std::atomic_flag outputBufferAtomicFlag = ATOMIC_FLAG_INIT;   //!< flag, which is used to lock access to outputBuffer
 
 //! used to print to python; string is temporary stored and written as soon as '\n' is detected
+//! Python is called after releasing the lock, as the calling thread may need to wait for the GIL (solver with released GIL), 
+//! while another thread holding the GIL waits for the lock
 int OutputBuffer::overflow(int c)
 {
+	STDstring line; //line to be printed to console
 	EXUstd::WaitAndLockSemaphoreIgnore(outputBufferAtomicFlag); //lock outputBuffer
 	if ((char)c != '\n') {
 		buf.push_back((char)c);
@@ -171,33 +168,12 @@ int OutputBuffer::overflow(int c)
 				//visualizationBuffer = "capacity=" + EXUstd::ToString(visualizationBuffer.capacity()) + "\n";
 			}
 
-			if (writeToConsole)
-			{
-				//if python raised already an error, exudyn.Print() will not work, because py::print() still has the exception error_already_set
-				// ==> therefore add try and catch to print, such that subsequent print commands work again
-				try
-				{
-					//py::print(buf);
-					py::print(buf, "end"_a = "");
-				}
-				catch (py::error_already_set &eas) {
-					// Discard the Python error: for future print commands?
-					eas.discard_as_unraisable(__func__); //prints long message ...
-					//py::print(buf); 
-					py::print(buf, "end"_a = "");//try again to print, which should work now
-					//
-					//throw std::runtime_error("Exudyn: print"); //check what happens => still raises an exception (CTRL-C ...) => does not work
-				}
-
-				if (waitMilliSeconds) {
-					std::this_thread::sleep_for(std::chrono::milliseconds(waitMilliSeconds)); //add this to enable Spyder to print messages
-				}
-			}
 			if (writeToFile)
 			{
 				//file << buf << "\n"; //add "\n" as compared to py::print, which already adds end line command
 				file << buf;
 			}
+			if (writeToConsole) { line.swap(buf); }
 			buf.clear();
 		}
 		else
@@ -207,6 +183,30 @@ int OutputBuffer::overflow(int c)
 	}
 	//py::print((char)c); //this would be much slower as each character needs to be processed with py::print
 	EXUstd::ReleaseSemaphore(outputBufferAtomicFlag); //clear outputBuffer
+
+	if (line.size())
+	{
+		py::gil_scoped_acquire acquireGIL; //solver may run with released GIL
+		//if python raised already an error, exudyn.Print() will not work, because py::print() still has the exception error_already_set
+		// ==> therefore add try and catch to print, such that subsequent print commands work again
+		try
+		{
+			//py::print(buf);
+			py::print(line, "end"_a = "");
+		}
+		catch (py::error_already_set &eas) {
+			// Discard the Python error: for future print commands?
+			eas.discard_as_unraisable(__func__); //prints long message ...
+			//py::print(buf); 
+			py::print(line, "end"_a = "");//try again to print, which should work now
+			//
+			//throw std::runtime_error("Exudyn: print"); //check what happens => still raises an exception (CTRL-C ...) => does not work
+		}
+
+		if (waitMilliSeconds) {
+			std::this_thread::sleep_for(std::chrono::milliseconds(waitMilliSeconds)); //add this to enable Spyder to print messages
+		}
+	}
 	return c;
 }
 
@@ -243,6 +243,7 @@ void OutputBuffer::SetWriteToFile(STDstring filename, bool flagWriteToFile, bool
 
 void PyGetCurrentFileInformation(std::string& fileName, Index& lineNumber) //!< retrieve current parsed file information from python (for error/warning messages...)
 {
+	py::gil_scoped_acquire acquireGIL; //may be called by solver with released GIL
 	try
 	{
 		py::module inspect = py::module::import("inspect");
@@ -55,6 +55,7 @@ public:
     ArrayIndex tempIndex2;					//!< for loads jacobians
     ArrayIndex tempIndex3;					//!< for loads jacobians
     EXUmath::SparseVector sparseVector;		//!< used for temporary assembly of ode2RHS, contact, etc.
+    ArrayIndex listNumDiffObjects;			//!< objects postponed to serial numerical differentiation in parallel jacobian computation
 
 	//these sparsetriplets are either filled directly or as a buffer, if the regular section in the global sparse matrix is full
 	SparseTripletVector sparseTriplets;		//!< used for temporary assembly of jacobian, mass matrix, etc.
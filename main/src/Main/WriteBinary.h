@@ -15,6 +15,9 @@
 *
 ************************************************************************************************ */
 
+#ifndef WRITEBINARY__H
+#define WRITEBINARY__H
+
 //#include "Linalg/BasicLinalg.h"
 
 namespace ExuFile {
@@ -80,10 +83,10 @@ namespace ExuFile {
 
 
 
-	//write 16 bytes header, providing information about stored file structure
-	inline void BinaryWriteHeader(std::ofstream& file, const BinaryFileSettings& bSettings)
+	//write 16 bytes header, providing information about stored file structure; identifier must have 6 characters
+	inline void BinaryWriteHeader(std::ostream& file, const BinaryFileSettings& bSettings, const char* identifier = "EXUBIN")
 	{
-		file << "EXUBIN"; //identifier for all formats; add end of line to allow simple reading in ascii mode!
+		file << identifier; //identifier for all formats; add end of line to allow simple reading in ascii mode!
 		file << (char)'\n'; //should be only 1 byte
 		file << (char)bSettings.indexSize;
 		file << (char)bSettings.realSize;
@@ -96,6 +99,27 @@ namespace ExuFile {
 		}
 	}
 
+	//! header of binary sensor file: 16 bytes header with identifier EXUSNS, followed by int32 headerSize (bytes),
+	//! int32 numberOfColumns and the text header (zero-padded to headerSize, which is a multiple of 64);
+	//! rows of numberOfColumns Reals follow the header, such that data can be directly mapped (e.g., numpy.memmap)
+	inline STDstring BinarySensorFileHeader(const STDstring& textHeader, Index numberOfColumns, const BinaryFileSettings& bSettings)
+	{
+		std::ostringstream header;
+		BinaryWriteHeader(header, bSettings, "EXUSNS");
+
+		const Index headerAlignment = 64;
+		Index headerSize = 16 + 2 * sizeof(std::int32_t) + (Index)textHeader.length() + 1; //at least one zero byte after text
+		headerSize = ((headerSize + headerAlignment - 1) / headerAlignment) * headerAlignment;
+
+		std::int32_t values[2] = { (std::int32_t)headerSize, (std::int32_t)numberOfColumns };
+		header.write(reinterpret_cast<const char*>(values), sizeof(values));
+		header << textHeader;
+
+		STDstring str = header.str();
+		str.resize(headerSize, (char)0);
+		return str;
+	}
+
 	//! write Index according to settings; includeSize ignored
 	inline void BinaryWrite(Index value, std::ofstream& file, const BinaryFileSettings& bSettings, bool includeSize = false)
 	{
@@ -203,4 +227,6 @@ namespace ExuFile {
 		}
 	}
 
-};
\ No newline at end of file
+};
+
+#endif
@@ -56,6 +56,7 @@ bool rendererCallbackLock = false;								//!< callbacks deactivated as long as
 bool rendererPythonCommandLock = false;							//!< callbacks deactivated as long as Python dialogs open (avoid crashes)
 bool rendererMultiThreadedDialogs = true;						//!< renderer stays interactive during rendering (immediate apply of changes, e.g., visualizationSettings)
 Index processResult = 0;                                        //!< result of PyProcess (if available)
+std::thread::id pyMainThreadId = std::this_thread::get_id();	//!< thread which loads the module (usually Python main thread); Python handles signals only in main thread
 
 Index PyProcessGetResult() { return processResult; }
 void PyProcessSetResult(Index value) { processResult = value; }
@@ -89,6 +90,17 @@ bool PyGetRendererMultiThreadedDialogs() { return rendererMultiThreadedDialogs;
 //! check CTRL+"C" signals
 bool PyCheckSignals()
 {
+	if (PyGILState_Check()) { return (PyErr_CheckSignals() != 0); }
+
+	//solver runs with released GIL: signals are only handled in main thread, which needs to acquire the GIL;
+	//to avoid waiting for the GIL in every step, this is only done every 0.05 seconds
+	if (std::this_thread::get_id() != pyMainThreadId) { return false; }
+	static Real lastCheckTime = 0; //only used by main thread
+	Real time = EXUstd::GetTimeInSeconds();
+	if (time < lastCheckTime + 0.05) { return false; }
+	lastCheckTime = time;
+
+	py::gil_scoped_acquire acquireGIL;
 	return (PyErr_CheckSignals() != 0);
 }
 
@@ -99,6 +111,7 @@ void PyThrowErrorAlreadySet()
 	if (pySpecial.solver.throwErrorWithCtrlC)
 	{
 		//pout << "raised PyThrowErrorAlreadySet\n" << std::flush;
+		py::gil_scoped_acquire acquireGIL; //error is fetched from Python; solver may run with released GIL
 		throw py::error_already_set();
 	}
 	//else if (pySpecial.solver.throwErrorWithCtrlC == 1)
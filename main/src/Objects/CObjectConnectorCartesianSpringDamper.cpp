@@ -106,9 +106,26 @@ void CObjectConnectorCartesianSpringDamper::ComputeJacobianODE2_ODE2(EXUmath::Ma
 		temp.localJacobian.SetAll(0.);
 		//compute inner jacobian: factorODE2 * d(F)/(dq) + factorODE2_t * d(F)/(dq_t)
 		//Matrix3D K(3, 3, 0.);
-		for (Index i = 0; i < 3; i++)
+		if (!parameters.springForceUserFunction)
+		{
+			for (Index i = 0; i < 3; i++)
+			{
+				temp.localJacobian(i, i) = parameters.stiffness[i] * factorODE2 + parameters.damping[i] * factorODE2_t;
+			}
+		}
+		else
 		{
-			temp.localJacobian(i, i) = parameters.stiffness[i] * factorODE2 + parameters.damping[i] * factorODE2_t;
+			//Jacobian of compiled symbolic user function w.r.t. [t, itemIndex, displacement(3), velocity(3), ...]; temp.matrix0 is overwritten later
+			Vector3D vPos = (markerData.GetMarkerData(1).position - markerData.GetMarkerData(0).position - parameters.offset);
+			Vector3D vVel = (markerData.GetMarkerData(1).velocity - markerData.GetMarkerData(0).velocity);
+			EvaluateUserFunctionForceJacobian(temp.matrix0, cSystemData->GetMainSystemBacklink(), markerData.GetTime(), objectNumber, vPos, vVel);
+			for (Index i = 0; i < 3; i++)
+			{
+				for (Index j = 0; j < 3; j++)
+				{
+					temp.localJacobian(i, j) = temp.matrix0(i, 2 + j) * factorODE2 + temp.matrix0(i, 5 + j) * factorODE2_t;
+				}
+			}
 		}
 	}
 	//compute jacobianODE2 in dense mode; temp.localJacobian is modified!
@@ -120,7 +137,8 @@ void CObjectConnectorCartesianSpringDamper::ComputeJacobianODE2_ODE2(EXUmath::Ma
 //! AUTO:  return the available jacobian dependencies and the jacobians which are available as a function; if jacobian dependencies exist but are not available as a function, it is computed numerically; can be combined with 2^i enum flags
 JacobianType::Type CObjectConnectorCartesianSpringDamper::GetAvailableJacobians() const
 {
-	if (!parameters.springForceUserFunction) {
+	//compiled symbolic user functions provide Jacobian by automatic differentiation
+	if (!parameters.springForceUserFunction || parameters.springForceUserFunction.HasJacobian()) {
 		return (JacobianType::Type)(JacobianType::ODE2_ODE2 + JacobianType::ODE2_ODE2_t + JacobianType::ODE2_ODE2_function + JacobianType::ODE2_ODE2_t_function);
 	}
 	else {
@@ -149,6 +149,18 @@ void CObjectConnectorSpringDamper::ComputeJacobianODE2_ODE2(EXUmath::MatrixConta
 
 		if (L != 0.) { Linv = 1. / L; }
 
+		//derivatives of scalar force w.r.t. deltaL (stiffness) and deltaL_t (damping)
+		Real stiffness = parameters.stiffness;
+		Real damping = parameters.damping;
+		if (parameters.springForceUserFunction)
+		{
+			//Jacobian of compiled symbolic user function w.r.t. [t, itemIndex, deltaL, deltaL_t, ...]; temp.matrix0 is overwritten later
+			EvaluateUserFunctionForceJacobian(temp.matrix0, cSystemData->GetMainSystemBacklink(), markerData.GetTime(), objectNumber,
+				L - parameters.referenceLength, relVel*forceDirection - parameters.velocityOffset);
+			stiffness = temp.matrix0(0, 2);
+			damping = temp.matrix0(0, 3);
+		}
+
 		Matrix3D innerJac;
 
 		Matrix3D IsubVV2;
@@ -162,19 +174,19 @@ void CObjectConnectorSpringDamper::ComputeJacobianODE2_ODE2(EXUmath::MatrixConta
 
 		//derivative of velocity term in force w.r.t. relPos times direction
 		Matrix3D VV1;
-		VV1.SetWithDiadicProduct((factorODE2 * parameters.damping)*forceDirection, relVel);
+		VV1.SetWithDiadicProduct((factorODE2 * damping)*forceDirection, relVel);
 		innerJac += VV1*IsubVV2;
 
 		//derivative of force w.r.t. relPos (k) and relVel (d) times direction
 		Matrix3D VV2;
 		if (L != 0.)
 		{
-			VV2.SetWithDiadicProduct((factorODE2 * parameters.stiffness + factorODE2_t * parameters.damping) * forceDirection, forceDirection);
+			VV2.SetWithDiadicProduct((factorODE2 * stiffness + factorODE2_t * damping) * forceDirection, forceDirection);
 		}
 		else
 		{
 			//behavior like CartesianSpringDamper=> for static problems, first iteration!
-			VV2.SetScalarMatrix(EXUstd::dim3D, factorODE2 * parameters.stiffness + factorODE2_t * parameters.damping ); 
+			VV2.SetScalarMatrix(EXUstd::dim3D, factorODE2 * stiffness + factorODE2_t * damping ); 
 		}
 		innerJac += VV2;
 
@@ -200,7 +212,8 @@ JacobianType::Type CObjectConnectorSpringDamper::GetAvailableJacobians() const
 //#else
 	bool jacAnalytic = true;
 //#endif
-	if (!parameters.springForceUserFunction && jacAnalytic) {
+	//compiled symbolic user functions provide Jacobian by automatic differentiation
+	if ((!parameters.springForceUserFunction || parameters.springForceUserFunction.HasJacobian()) && jacAnalytic) {
 		return (JacobianType::Type)(JacobianType::ODE2_ODE2 + JacobianType::ODE2_ODE2_t + JacobianType::ODE2_ODE2_function + JacobianType::ODE2_ODE2_t_function);
 	}
 	else {
@@ -254,8 +254,11 @@ void CObjectFFRFreducedOrder::ComputeODE2LHS(Vector& ode2Lhs, Index objectNumber
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
 		//K*q and D*q_T put to LHS !!!
+		//in jacobian computation, K and D may be added from constant jacobian cache:
+		bool excludeConstantPart = cSystemData->excludeConstantJacobianODE2Parts;
+
 		//stiffness matrix:
-		if (parameters.stiffnessMatrixReduced.NumberOfRows() != 0)
+		if (parameters.stiffnessMatrixReduced.NumberOfRows() != 0 && !excludeConstantPart)
 		{
 			//EXUmath::MultMatrixVectorAdd(parameters.stiffnessMatrixReduced, coordinatesFF, ode2LhsFF);
 			parameters.stiffnessMatrixReduced.MultMatrixVectorAdd(coordinatesFF, ode2LhsFF);
@@ -264,7 +267,7 @@ void CObjectFFRFreducedOrder::ComputeODE2LHS(Vector& ode2Lhs, Index objectNumber
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
 		//damping matrix:
-		if (parameters.dampingMatrixReduced.NumberOfRows() != 0)
+		if (parameters.dampingMatrixReduced.NumberOfRows() != 0 && !excludeConstantPart)
 		{
 			//EXUmath::MultMatrixVectorAdd(parameters.dampingMatrixReduced, coordinatesFF_t, ode2LhsFF);
 			parameters.dampingMatrixReduced.MultMatrixVectorAdd(coordinatesFF_t, ode2LhsFF);
@@ -468,6 +471,46 @@ void CObjectFFRFreducedOrder::ComputeODE2LHS(Vector& ode2Lhs, Index objectNumber
 }
 
 
+//! compute constant part of jacobian, which is factorODE2*K + factorODE2_t*D for the flexible coordinates; 
+//! triplets are always added in sparse mode, including ltg mapping
+void CObjectFFRFreducedOrder::ComputeJacobianODE2_ODE2ConstantPart(EXUmath::MatrixContainer& jacobianODE2, JacobianTemp& temp,
+	Real factorODE2, Real factorODE2_t, Index objectNumber, const ArrayIndex& ltg) const
+{
+	Index nODE2Rigid = GetCNode(rigidBodyNodeNumber)->GetNumberOfODE2Coordinates(); //offset of flexible coordinates
+
+	jacobianODE2.SetUseDenseMatrix(false);
+	SparseTripletVector& triplets = jacobianODE2.GetInternalSparseTripletMatrix().GetTriplets();
+
+	for (Index k = 0; k < 2; k++)
+	{
+		const PyMatrixContainer& matrix = (k == 0) ? parameters.stiffnessMatrixReduced : parameters.dampingMatrixReduced;
+		Real factor = (k == 0) ? factorODE2 : factorODE2_t;
+		if (matrix.NumberOfRows() == 0 || factor == 0.) { continue; }
+
+		if (matrix.UseDenseMatrix())
+		{
+			const ResizableMatrix& m = matrix.GetInternalDenseMatrix();
+			for (Index i = 0; i < m.NumberOfRows(); i++)
+			{
+				for (Index j = 0; j < m.NumberOfColumns(); j++)
+				{
+					if (m(i, j) != 0.)
+					{
+						triplets.AppendPure(SparseTriplet(ltg[nODE2Rigid + i], ltg[nODE2Rigid + j], factor*m(i, j)));
+					}
+				}
+			}
+		}
+		else
+		{
+			for (const SparseTriplet& item : matrix.GetInternalSparseTripletMatrix().GetTriplets())
+			{
+				triplets.AppendPure(SparseTriplet(ltg[nODE2Rigid + item.row()], ltg[nODE2Rigid + item.col()], factor*item.value()));
+			}
+		}
+	}
+}
+
 //! Flags to determine, which access (forces, moments, connectors, ...) to object are possible
 AccessFunctionType CObjectFFRFreducedOrder::GetAccessFunctionTypes() const
 {
@@ -127,14 +127,16 @@ void CObjectGenericODE2::ComputeODE2LHS(Vector& ode2Lhs, Index objectNumber) con
 	ComputeObjectCoordinates(tempCoordinates, tempCoordinates_t);
 
 	//K*q and D*q_T put to LHS !!!
+	//in jacobian computation, K and D may be added from constant jacobian cache:
+	bool excludeConstantPart = cSystemData->excludeConstantJacobianODE2Parts && HasConstantJacobianODE2Part();
 
-	if (parameters.stiffnessMatrix.NumberOfRows() != 0)
+	if (parameters.stiffnessMatrix.NumberOfRows() != 0 && !excludeConstantPart)
 	{
 		//EXUmath::MultMatrixVectorAdd(parameters.stiffnessMatrix, tempCoordinates, ode2Lhs);
 		parameters.stiffnessMatrix.MultMatrixVectorAdd(tempCoordinates, ode2Lhs);
 	}
 
-	if (parameters.dampingMatrix.NumberOfRows() != 0)
+	if (parameters.dampingMatrix.NumberOfRows() != 0 && !excludeConstantPart)
 	{
 		//EXUmath::MultMatrixVectorAdd(parameters.dampingMatrix, tempCoordinates_t, ode2Lhs);
 		parameters.dampingMatrix.MultMatrixVectorAdd(tempCoordinates_t, ode2Lhs);
@@ -257,6 +259,14 @@ void CObjectGenericODE2::ComputeJacobianODE2_ODE2(EXUmath::MatrixContainer& jaco
 
 }
 
+//! compute constant part of jacobian, which is factorODE2*K + factorODE2_t*D; only called if there is no jacobianUserFunction
+void CObjectGenericODE2::ComputeJacobianODE2_ODE2ConstantPart(EXUmath::MatrixContainer& jacobianODE2, JacobianTemp& temp,
+	Real factorODE2, Real factorODE2_t, Index objectNumber, const ArrayIndex& ltg) const
+{
+	CHECKandTHROW(!parameters.jacobianUserFunction, "CObjectGenericODE2::ComputeJacobianODE2_ODE2ConstantPart: illegal call with jacobianUserFunction");
+	ComputeJacobianODE2_ODE2(jacobianODE2, temp, factorODE2, factorODE2_t, objectNumber, ltg);
+}
+
 //! AUTO:  return the available jacobian dependencies and the jacobians which are available as a function; if jacobian dependencies exist but are not available as a function, it is computed numerically; can be combined with 2^i enum flags
 JacobianType::Type CObjectGenericODE2::GetAvailableJacobians() const
 {
@@ -274,7 +274,7 @@ void VisualizationObjectGround::UpdateGraphics(const VisualizationSettings& visu
 	Matrix3DF Rot3DF;
 	Rot3DF.CopyFrom(cObject->GetRotationMatrix(Vector3D(0.), ConfigurationType::Visualization));
 
-	EXUvis::AddBodyGraphicsData(graphicsData, vSystem->graphicsData, pos3DF, Rot3DF, itemID);
+	vSystem->AddRigidBodyGraphicsData(graphicsData, pos3DF, Rot3DF, itemID);
 
 	if (visualizationSettings.bodies.showNumbers) { EXUvis::DrawItemNumber(pos3DF, vSystem, itemID, "", currentColor); }
 }
@@ -308,7 +308,7 @@ void VisualizationObjectMassPoint::UpdateGraphics(const VisualizationSettings& v
 	}
 	else //fast track
 	{
-		EXUvis::AddBodyGraphicsData(graphicsData, vSystem->graphicsData, pos3DF, EXUmath::unitMatrix3DF, itemID);
+		vSystem->AddRigidBodyGraphicsData(graphicsData, pos3DF, EXUmath::unitMatrix3DF, itemID);
 	}
 
 	if (visualizationSettings.bodies.showNumbers) { EXUvis::DrawItemNumber(pos3DF, vSystem, itemID, "", currentColor); }
@@ -938,7 +938,7 @@ void VisualizationObjectMassPoint2D::UpdateGraphics(const VisualizationSettings&
 	}
 	else //fast track
 	{
-		EXUvis::AddBodyGraphicsData(graphicsData, vSystem->graphicsData, pos3DF, EXUmath::unitMatrix3DF, itemID);
+		vSystem->AddRigidBodyGraphicsData(graphicsData, pos3DF, EXUmath::unitMatrix3DF, itemID);
 	}
 
 	if (visualizationSettings.bodies.showNumbers) { EXUvis::DrawItemNumber(pos3DF, vSystem, itemID, "", currentColor); }
@@ -975,7 +975,7 @@ void VisualizationObjectMass1D::UpdateGraphics(const VisualizationSettings& visu
 	}
 	else //fast track
 	{
-		EXUvis::AddBodyGraphicsData(graphicsData, vSystem->graphicsData, pos3DF, EXUmath::unitMatrix3DF, itemID);
+		vSystem->AddRigidBodyGraphicsData(graphicsData, pos3DF, EXUmath::unitMatrix3DF, itemID);
 	}
 
 	if (visualizationSettings.bodies.showNumbers) { EXUvis::DrawItemNumber(pos3DF, vSystem, itemID, "", currentColor); }
@@ -1016,7 +1016,7 @@ void VisualizationObjectRotationalMass1D::UpdateGraphics(const VisualizationSett
 	}
 	else //fast track
 	{
-		EXUvis::AddBodyGraphicsData(graphicsData, vSystem->graphicsData, pos3DF, Rot3DF, itemID);
+		vSystem->AddRigidBodyGraphicsData(graphicsData, pos3DF, Rot3DF, itemID);
 	}
 
 	if (visualizationSettings.bodies.showNumbers) { EXUvis::DrawItemNumber(pos3DF, vSystem, itemID, "", currentColor); }
@@ -1061,7 +1061,7 @@ void VisualizationObjectRigidBody::UpdateGraphics(const VisualizationSettings& v
 	}
 	else //fast track
 	{
-		EXUvis::AddBodyGraphicsData(graphicsData, vSystem->graphicsData, pos3DF, Rot3DF, itemID);
+		vSystem->AddRigidBodyGraphicsData(graphicsData, pos3DF, Rot3DF, itemID);
 	}
 
 	if (visualizationSettings.bodies.showNumbers) { EXUvis::DrawItemNumber(pos3DF, vSystem, itemID, "", currentColor); }
@@ -1107,7 +1107,7 @@ void VisualizationObjectRigidBody2D::UpdateGraphics(const VisualizationSettings&
 	}
 	else //fast track
 	{
-		EXUvis::AddBodyGraphicsData(graphicsData, vSystem->graphicsData, pos3DF, Rot3DF, itemID);
+		vSystem->AddRigidBodyGraphicsData(graphicsData, pos3DF, Rot3DF, itemID);
 	}
 
 	if (visualizationSettings.bodies.showNumbers) { EXUvis::DrawItemNumber(pos3DF, vSystem, itemID, "", currentColor); }
@@ -1374,7 +1374,7 @@ void VisualizationObjectKinematicTree::UpdateGraphics(const VisualizationSetting
 			rot3DF.CopyFrom(rot3D);
 
 			
-			EXUvis::AddBodyGraphicsData(this->graphicsDataList[i],vSystem->graphicsData, pos3DF, rot3DF, itemID);
+			vSystem->AddRigidBodyGraphicsData(this->graphicsDataList[i], pos3DF, rot3DF, itemID);
 		}
 
 
@@ -45,6 +45,8 @@
 //! call to user function implemented in separate file to avoid including pybind and MainSystem.h at too many places
 void CObjectConnectorCartesianSpringDamper::EvaluateUserFunctionForce(Vector3D& force, const MainSystemBase& mainSystem, Real t, Index itemIndex, Vector3D& vPos, Vector3D& vVel) const
 {
+	if (cSystemData->GetBatchedUserFunctionForce(itemIndex, t, vPos.GetDataPointer(), vVel.GetDataPointer(), force.GetDataPointer())) { return; }
+
 	UserFunctionExceptionHandling([&] //lambda function to add consistent try{..} catch(...) block
 	{
 		force = parameters.springForceUserFunction.userFunction((const MainSystem&)mainSystem, t, itemIndex, vPos, vVel,
@@ -52,6 +54,16 @@ void CObjectConnectorCartesianSpringDamper::EvaluateUserFunctionForce(Vector3D&
 	}, "ObjectConnectorCartesianSpringDamper::springForceUserFunction");
 }
 
+//! call to Jacobian of user function w.r.t. args [t, itemIndex, displacement, velocity, stiffness, damping, offset]; only available for compiled symbolic user function
+void CObjectConnectorCartesianSpringDamper::EvaluateUserFunctionForceJacobian(ResizableMatrix& jacobian, const MainSystemBase& mainSystem, Real t, Index itemIndex, Vector3D& vPos, Vector3D& vVel) const
+{
+	UserFunctionExceptionHandling([&] //lambda function to add consistent try{..} catch(...) block
+	{
+		parameters.springForceUserFunction.userFunctionJacobian(jacobian, (const MainSystem&)mainSystem, t, itemIndex, vPos, vVel,
+			parameters.stiffness, parameters.damping, parameters.offset);
+	}, "ObjectConnectorCartesianSpringDamper::springForceUserFunction (Jacobian)");
+}
+
 //+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
 //! call to user function implemented in separate file to avoid including pybind and MainSystem.h at too many places
 void CObjectConnectorCoordinate::EvaluateUserFunctionOffset(Real& offset, const MainSystemBase& mainSystem, Real t, Index itemIndex) const
@@ -180,6 +192,8 @@ void CObjectConnectorTorsionalSpringDamper::EvaluateUserFunctionForce(Real& torq
 void CObjectConnectorCoordinateSpringDamper::EvaluateUserFunctionForce(Real& force, const MainSystemBase& mainSystem, Real t, Index itemIndex,
     Real relPos, Real relVel) const
 {
+    if (cSystemData->GetBatchedUserFunctionForce(itemIndex, t, &relPos, &relVel, &force)) { return; }
+
     UserFunctionExceptionHandling([&] //lambda function to add consistent try{..} catch(...) block
     {
         //user function args:(deltaL, deltaL_t, Real stiffness, Real damping, Real offset, Real dryFriction, Real dryFrictionProportionalZone)
@@ -232,6 +246,8 @@ void CObjectJointGeneric::EvaluateUserFunctionOffset_t(Vector6D& offset, const M
 //! call to user function implemented in separate file to avoid including pybind and MainSystem.h at too many places
 void CObjectConnectorSpringDamper::EvaluateUserFunctionForce(Real& force, const MainSystemBase& mainSystem, Real t, Index itemIndex, Real deltaL, Real deltaL_t) const
 {
+	if (cSystemData->GetBatchedUserFunctionForce(itemIndex, t, &deltaL, &deltaL_t, &force)) { return; }
+
 	UserFunctionExceptionHandling([&] //lambda function to add consistent try{..} catch(...) block
 	{
 		//user function args:(deltaL, deltaL_t, Real stiffness, Real damping, Real springForce)
@@ -240,6 +256,16 @@ void CObjectConnectorSpringDamper::EvaluateUserFunctionForce(Real& force, const
 	}, "ObjectConnectorSpringDamper::springForceUserFunction");
 }
 
+//! call to Jacobian of user function w.r.t. args [t, itemIndex, deltaL, deltaL_t, stiffness, damping, force]; only available for compiled symbolic user function
+void CObjectConnectorSpringDamper::EvaluateUserFunctionForceJacobian(ResizableMatrix& jacobian, const MainSystemBase& mainSystem, Real t, Index itemIndex, Real deltaL, Real deltaL_t) const
+{
+	UserFunctionExceptionHandling([&] //lambda function to add consistent try{..} catch(...) block
+	{
+		parameters.springForceUserFunction.userFunctionJacobian(jacobian, (const MainSystem&)mainSystem, t, itemIndex,
+			deltaL, deltaL_t, parameters.stiffness, parameters.damping, parameters.force);
+	}, "ObjectConnectorSpringDamper::springForceUserFunction (Jacobian)");
+}
+
 //+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
 //! call to user function implemented in separate file to avoid including pybind and MainSystem.h at too many places
 void CObjectGenericODE2::EvaluateUserFunctionForce(Vector& force, const MainSystemBase& mainSystem, Real t, Index objectNumber, const StdVector& coordinates, const StdVector& coordinates_t) const
@@ -0,0 +1,293 @@
+/** ***********************************************************************************************
+* @brief		implementation for PyBinarySolutionReader and MappedFile
+*
+* @date			2026-10-17 (created)
+* @copyright	This file is part of Exudyn. Exudyn is free software: you can redistribute it and/or modify it under the terms of the Exudyn license. See 'LICENSE.txt' for more details.
+* @note			Bug reports, support and further information:
+* 				- email: johannes.gerstmayr@uibk.ac.at
+* 				- weblink: https://github.com/jgerstmayr/EXUDYN
+*
+*
+************************************************************************************************ */
+
+#include <cstring>
+#include <algorithm>
+
+#ifdef _WIN32
+	#ifndef WIN32_LEAN_AND_MEAN
+		#define WIN32_LEAN_AND_MEAN
+	#endif
+	#ifndef NOMINMAX
+		#define NOMINMAX
+	#endif
+	#include <windows.h>
+#else
+	#include <sys/mman.h>
+	#include <sys/stat.h>
+	#include <fcntl.h>
+	#include <unistd.h>
+#endif
+
+#include "PyBinarySolutionReader.h"
+#include "Main/WriteBinary.h"
+
+
+//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//MappedFile
+#ifdef _WIN32
+MappedFile::MappedFile(const STDstring& fileName)
+{
+	HANDLE file = CreateFileA(fileName.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+	CHECKandTHROW(file != INVALID_HANDLE_VALUE, STDstring("BinarySolutionReader: could not open file '") + fileName + "'");
+	fileHandle = file;
+
+	LARGE_INTEGER fileSize;
+	if (!GetFileSizeEx(file, &fileSize)) { CloseHandle(file); CHECKandTHROWstring(STDstring("BinarySolutionReader: could not read size of file '") + fileName + "'"); }
+	size = (size_t)fileSize.QuadPart;
+	if (size == 0) { return; } //empty files cannot be mapped; header check fails afterwards
+
+	HANDLE mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+	if (mapping == NULL) { CloseHandle(file); CHECKandTHROWstring(STDstring("BinarySolutionReader: could not map file '") + fileName + "'"); }
+	mappingHandle = mapping;
+
+	data = (const char*)MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+	if (data == nullptr) { CloseHandle(mapping); CloseHandle(file); CHECKandTHROWstring(STDstring("BinarySolutionReader: could not map file '") + fileName + "'"); }
+}
+
+MappedFile::~MappedFile()
+{
+	if (data) { UnmapViewOfFile(data); }
+	if (mappingHandle) { CloseHandle((HANDLE)mappingHandle); }
+	if (fileHandle) { CloseHandle((HANDLE)fileHandle); }
+}
+#else
+MappedFile::MappedFile(const STDstring& fileName)
+{
+	int file = open(fileName.c_str(), O_RDONLY);
+	CHECKandTHROW(file != -1, STDstring("BinarySolutionReader: could not open file '") + fileName + "'");
+
+	struct stat fileStat;
+	if (fstat(file, &fileStat) != 0) { close(file); CHECKandTHROWstring(STDstring("BinarySolutionReader: could not read size of file '") + fileName + "'"); }
+	size = (size_t)fileStat.st_size;
+	if (size != 0) //empty files cannot be mapped; header check fails afterwards
+	{
+		void* mapping = mmap(nullptr, size, PROT_READ, MAP_SHARED, file, 0);
+		if (mapping == MAP_FAILED) { close(file); CHECKandTHROWstring(STDstring("BinarySolutionReader: could not map file '") + fileName + "'"); }
+		data = (const char*)mapping;
+	}
+	close(file); //mapping stays valid after closing file descriptor
+}
+
+MappedFile::~MappedFile()
+{
+	if (data) { munmap((void*)data, size); }
+}
+#endif
+
+
+//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//PyBinarySolutionReader
+
+Index PyBinarySolutionReader::ReadIndex(size_t offset) const
+{
+	const char* p = mappedFile->GetData() + offset; //memcpy, as Index in file is not aligned
+	if (indexSize == 4) { std::int32_t value; std::memcpy(&value, p, sizeof(value)); return (Index)value; }
+	else { std::int64_t value; std::memcpy(&value, p, sizeof(value)); return (Index)value; }
+}
+
+Real PyBinarySolutionReader::ReadReal(size_t offset) const
+{
+	const char* p = mappedFile->GetData() + offset;
+	if (realSize == 4) { float value; std::memcpy(&value, p, sizeof(value)); return (Real)value; }
+	else { double value; std::memcpy(&value, p, sizeof(value)); return (Real)value; }
+}
+
+void PyBinarySolutionReader::Open(const STDstring& fileNameInit)
+{
+	Close();
+	std::shared_ptr<MappedFile> file = std::make_shared<MappedFile>(fileNameInit);
+	const char* data = file->GetData();
+	size_t size = file->GetSize();
+
+	//16 bytes header, see ExuFile::BinaryWriteHeader
+	CHECKandTHROW(size >= 16 && std::memcmp(data, "EXUBIN", 6) == 0, STDstring("BinarySolutionReader: no binary header found in file '") + fileNameInit + "'");
+	indexSize = (Index)data[7];
+	realSize = (Index)data[8];
+	bool bigEndian = data[10] != 0;
+	CHECKandTHROW(indexSize == 4 || indexSize == 8, "BinarySolutionReader: invalid Index type size");
+	CHECKandTHROW(realSize == 4 || realSize == 8, "BinarySolutionReader: invalid Real type size");
+	CHECKandTHROW(bigEndian == !ExuFile::SystemIsLittleEndian(), "BinarySolutionReader: endianness of file does not match system");
+
+	mappedFile = file; //needed by ReadIndex
+	fileName = fileNameInit;
+	size_t offset = 16;
+	auto ReadNextIndex = [&]()
+	{
+		CHECKandTHROW(offset + indexSize <= size, "BinarySolutionReader: unexpected end of file in header");
+		Index value = ReadIndex(offset);
+		offset += indexSize;
+		return value;
+	};
+	auto ReadNextString = [&]()
+	{
+		Index length = ReadNextIndex();
+		CHECKandTHROW(length >= 0 && offset + length <= size, "BinarySolutionReader: unexpected end of file in header");
+		STDstring str(data + offset, length);
+		offset += length;
+		return str;
+	};
+	auto ReadNextArrayIndex = [&]()
+	{
+		Index length = ReadNextIndex();
+		CHECKandTHROW(length >= 0, "BinarySolutionReader: invalid array size in header");
+		ArrayIndex array;
+		for (Index i = 0; i < length; i++) { array.Append(ReadNextIndex()); }
+		return array;
+	};
+
+	//header according to CSolverBase::WriteSolutionFileHeader
+	try
+	{
+		version = ReadNextString();
+		ReadNextString(); //mode
+		solverInformation = ReadNextString();
+		dateTime = ReadNextString();
+		systemSizes = ReadNextArrayIndex();
+		columnsExported = ReadNextArrayIndex();
+		Index totalCoordinates = ReadNextIndex();
+		numberOfSteps = ReadNextIndex();
+		solutionInformation = ReadNextString();
+		CHECKandTHROW(ReadNextString() == "EndOfHeader", "BinarySolutionReader: EndOfHeader not found");
+
+		Index sumColumns = 0;
+		for (Index n : columnsExported) { sumColumns += n; }
+		CHECKandTHROW(sumColumns == totalCoordinates, "BinarySolutionReader: inconsistent number of columns in header");
+		numberOfColumns = totalCoordinates + 1; //including time
+		rowStride = indexSize + numberOfColumns * realSize;
+		firstRowOffset = offset + indexSize;
+
+		//rows have constant size: number of rows follows from file size; only the end of the file and the first and last row
+		//  are read, as reading all row sizes would load the whole file into memory
+		numberOfRows = (Index)((size - offset) / rowStride);
+
+		//a finished file ends with -1 and a short footer (see CSolverBase::FinalizeSolver); search -1 at row starts within footer
+		const size_t maxFooterSize = 1024;
+		validEndFound = false;
+		for (Index row = numberOfRows; row >= 0 && size - (offset + row * rowStride) <= maxFooterSize; row--)
+		{
+			size_t rowOffset = offset + row * rowStride;
+			if (rowOffset + indexSize <= size && ReadIndex(rowOffset) == -1)
+			{
+				numberOfRows = row;
+				validEndFound = true;
+				break;
+			}
+		}
+		//otherwise, simulation is still running or was aborted: an incomplete last row is ignored
+
+		if (numberOfRows != 0)
+		{
+			CHECKandTHROW(ReadIndex(offset) == numberOfColumns && ReadIndex(offset + (numberOfRows - 1) * rowStride) == numberOfColumns,
+				"BinarySolutionReader: rows are inconsistent");
+		}
+	}
+	catch (...)
+	{
+		Close();
+		throw;
+	}
+}
+
+void PyBinarySolutionReader::Close()
+{
+	mappedFile = nullptr;
+	fileName.clear();
+	numberOfColumns = 0;
+	numberOfRows = 0;
+	firstRowOffset = 0;
+	rowStride = 0;
+	validEndFound = false;
+}
+
+py::dict PyBinarySolutionReader::GetHeaderInfo() const
+{
+	py::dict d;
+	d["fileName"] = fileName;
+	d["version"] = version;
+	d["solver"] = solverInformation;
+	d["dateTime"] = dateTime;
+	d["solutionInformation"] = solutionInformation;
+	d["systemSizes"] = std::vector<Index>(systemSizes.begin(), systemSizes.end());
+	d["columnsExported"] = GetColumnsExported();
+	d["numberOfSteps"] = numberOfSteps;
+	d["indexSize"] = indexSize;
+	d["realSize"] = realSize;
+	d["validEndFound"] = validEndFound;
+	return d;
+}
+
+py::array PyBinarySolutionReader::CreateView(size_t offset, const std::vector<std::ptrdiff_t>& shape, const std::vector<std::ptrdiff_t>& strides) const
+{
+	//capsule holds mapping, such that view stays valid if reader is closed or deleted
+	auto* owner = new std::shared_ptr<MappedFile>(mappedFile);
+	py::capsule base(owner, [](void* p) { delete reinterpret_cast<std::shared_ptr<MappedFile>*>(p); });
+	py::dtype dtype = (realSize == 4) ? py::dtype::of<float>() : py::dtype::of<double>();
+
+	//rows are not aligned to realSize in general; numpy handles unaligned data
+	py::array view(dtype, shape, strides, (const void*)(mappedFile->GetData() + offset), base);
+	py::detail::array_proxy(view.ptr())->flags &= ~py::detail::npy_api::NPY_ARRAY_WRITEABLE_; //read-only mapping
+	return view;
+}
+
+py::array PyBinarySolutionReader::GetData(Index rowStart, Index rowEnd, Index rowStep, Index columnStart, Index columnEnd) const
+{
+	CHECKandTHROW(IsOpen(), "BinarySolutionReader::GetData: no file opened");
+	if (rowEnd < 0) { rowEnd = numberOfRows; }
+	if (columnEnd < 0) { columnEnd = numberOfColumns; }
+	CHECKandTHROW(rowStart >= 0 && rowStart <= rowEnd && rowEnd <= numberOfRows, "BinarySolutionReader::GetData: invalid row range");
+	CHECKandTHROW(columnStart >= 0 && columnStart <= columnEnd && columnEnd <= numberOfColumns, "BinarySolutionReader::GetData: invalid column range");
+	CHECKandTHROW(rowStep > 0, "BinarySolutionReader::GetData: rowStep must be positive");
+
+	Index nRows = (rowEnd - rowStart + rowStep - 1) / rowStep;
+	return CreateView(firstRowOffset + rowStart * rowStride + columnStart * realSize,
+		{ (std::ptrdiff_t)nRows, (std::ptrdiff_t)(columnEnd - columnStart) },
+		{ (std::ptrdiff_t)(rowStep * rowStride), (std::ptrdiff_t)realSize });
+}
+
+py::array PyBinarySolutionReader::GetRow(Index row) const
+{
+	CHECKandTHROW(IsOpen(), "BinarySolutionReader::GetRow: no file opened");
+	CHECKandTHROW(row >= 0 && row < numberOfRows, "BinarySolutionReader::GetRow: invalid row index");
+	return CreateView(firstRowOffset + row * rowStride, { (std::ptrdiff_t)numberOfColumns }, { (std::ptrdiff_t)realSize });
+}
+
+py::array PyBinarySolutionReader::GetTimes() const
+{
+	CHECKandTHROW(IsOpen(), "BinarySolutionReader::GetTimes: no file opened");
+	return CreateView(firstRowOffset, { (std::ptrdiff_t)numberOfRows }, { (std::ptrdiff_t)rowStride });
+}
+
+std::vector<Index> PyBinarySolutionReader::FindRowRange(Real timeStart, Real timeEnd) const
+{
+	CHECKandTHROW(IsOpen(), "BinarySolutionReader::FindRowRange: no file opened");
+	//first row with t >= timeStart
+	Index low = 0;
+	Index high = numberOfRows;
+	while (low < high)
+	{
+		Index mid = (low + high) / 2;
+		if (GetRowTime(mid) < timeStart) { low = mid + 1; }
+		else { high = mid; }
+	}
+	Index rowStart = low;
+
+	//first row with t > timeEnd
+	high = numberOfRows;
+	while (low < high)
+	{
+		Index mid = (low + high) / 2;
+		if (GetRowTime(mid) <= timeEnd) { low = mid + 1; }
+		else { high = mid; }
+	}
+	return { rowStart, std::max(rowStart, low) };
+}
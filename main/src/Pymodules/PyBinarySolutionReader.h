@@ -0,0 +1,124 @@
+/** ***********************************************************************************************
+* @class		PyBinarySolutionReader
+* @brief		Pybind11 interface for memory-mapped reading of binary solution files
+* @details		Details:
+*				- file written by WriteCoordinatesToFile with solutionSettings.binarySolutionFile=True is mapped into memory
+*				- the header is parsed when opening the file; as rows have constant size, the number of rows follows from the file size
+*				- data is returned as read-only numpy views into the mapped file, without copying;
+*				  views keep the mapping alive, even if the reader is closed or deleted
+*
+* @date			2026-10-17 (created)
+* @copyright	This file is part of Exudyn. Exudyn is free software: you can redistribute it and/or modify it under the terms of the Exudyn license. See 'LICENSE.txt' for more details.
+* @note			Bug reports, support and further information:
+* 				- email: johannes.gerstmayr@uibk.ac.at
+* 				- weblink: https://github.com/jgerstmayr/EXUDYN
+*
+*
+************************************************************************************************ */
+#ifndef PYBINARYSOLUTIONREADER__H
+#define PYBINARYSOLUTIONREADER__H
+
+#include <memory>
+
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+#include <pybind11/numpy.h>       //interface to numpy
+namespace py = pybind11;            //! namespace 'py' used throughout in code
+#include "Pymodules/PybindUtilities.h"
+
+//! read-only memory mapping of a whole file; platform specific implementation in PyBinarySolutionReader.cpp
+class MappedFile
+{
+	const char* data = nullptr;	//!< begin of mapped file
+	size_t size = 0;			//!< size of mapped file in bytes
+#ifdef _WIN32
+	void* fileHandle = nullptr;
+	void* mappingHandle = nullptr;
+#endif
+public:
+	//! map file; throws, if file cannot be opened or mapped
+	MappedFile(const STDstring& fileName);
+	~MappedFile();
+	MappedFile(const MappedFile&) = delete;
+	MappedFile& operator=(const MappedFile&) = delete;
+
+	const char* GetData() const { return data; }
+	size_t GetSize() const { return size; }
+};
+
+//! reader for binary solution files; rows have constant size, such that row i starts at firstRowOffset + i*rowStride
+class PyBinarySolutionReader
+{
+	std::shared_ptr<MappedFile> mappedFile;	//!< shared with numpy views
+	STDstring fileName;
+
+	Index indexSize = 0;				//!< size of Index in file (4 or 8)
+	Index realSize = 0;					//!< size of Real in file (4=float, 8=double)
+	STDstring version;					//!< Exudyn version used to write file
+	STDstring solverInformation;		//!< solver name and type
+	STDstring dateTime;					//!< time when simulation started
+	STDstring solutionInformation;		//!< solutionSettings.solutionInformation
+	ArrayIndex systemSizes;				//!< [nODE2, nODE1, nAlgebraic, nData]
+	ArrayIndex columnsExported;			//!< [nODE2, nVel2, nAcc2, nODE1, nVel1, nAlgebraic, nData]
+	Index numberOfSteps = 0;			//!< number of steps as planned by solver
+
+	Index numberOfColumns = 0;			//!< values per row, including time
+	Index numberOfRows = 0;				//!< number of complete rows
+	size_t firstRowOffset = 0;			//!< byte offset of time (first Real) of first row
+	size_t rowStride = 0;				//!< bytes per row, including Index with row size
+	bool validEndFound = false;			//!< true, if end of data marker (-1) has been found after last row
+
+public:
+	PyBinarySolutionReader() {}
+
+	//! open and map file, parse header and determine number of complete rows from file size; throws, if file is no valid binary solution file
+	void Open(const STDstring& fileNameInit);
+
+	//! release reader's reference to mapping; existing views stay valid
+	void Close();
+
+	bool IsOpen() const { return mappedFile != nullptr; }
+
+	//! number of complete rows (time steps) in file
+	Index NumberOfRows() const { return numberOfRows; }
+
+	//! number of columns per row, including time
+	Index NumberOfColumns() const { return numberOfColumns; }
+
+	//! return exported sizes [nODE2, nVel2, nAcc2, nODE1, nVel1, nAlgebraic, nData]
+	std::vector<Index> GetColumnsExported() const { return std::vector<Index>(columnsExported.begin(), columnsExported.end()); }
+
+	//! return dictionary with header information
+	py::dict GetHeaderInfo() const;
+
+	//! return read-only view of rows [rowStart, rowEnd) with rowStep and columns [columnStart, columnEnd); negative end means last row/column
+	py::array GetData(Index rowStart, Index rowEnd, Index rowStep, Index columnStart, Index columnEnd) const;
+
+	//! return read-only view of one row, including time
+	py::array GetRow(Index row) const;
+
+	//! return read-only view of time column
+	py::array GetTimes() const;
+
+	//! return [rowStart, rowEnd) of rows with timeStart <= t <= timeEnd; uses binary search, as times are non-decreasing
+	std::vector<Index> FindRowRange(Real timeStart, Real timeEnd) const;
+
+	//! return read-only view of rows with timeStart <= t <= timeEnd and columns [columnStart, columnEnd)
+	py::array GetDataInTimeRange(Real timeStart, Real timeEnd, Index columnStart, Index columnEnd) const
+	{
+		std::vector<Index> range = FindRowRange(timeStart, timeEnd);
+		return GetData(range[0], range[1], 1, columnStart, columnEnd);
+	}
+
+private:
+	//! read Index at byte offset of mapped file
+	Index ReadIndex(size_t offset) const;
+	//! read Real at byte offset of mapped file
+	Real ReadReal(size_t offset) const;
+	//! time of row
+	Real GetRowTime(Index row) const { return ReadReal(firstRowOffset + row * rowStride); }
+	//! create read-only numpy view into mapped file, keeping the mapping alive
+	py::array CreateView(size_t offset, const std::vector<std::ptrdiff_t>& shape, const std::vector<std::ptrdiff_t>& strides) const;
+};
+
+#endif
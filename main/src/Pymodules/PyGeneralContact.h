@@ -60,12 +60,40 @@ public:
 	Index GetResetSearchTreeInterval() const { return settings.resetSearchTreeInterval; }
 	void SetResetSearchTreeInterval(Index value) { settings.resetSearchTreeInterval = value; }
 
+	bool GetSearchTreeAdaptive() const { return settings.searchTreeAdaptive; }
+	void SetSearchTreeAdaptive(bool flag) { settings.searchTreeAdaptive = flag; }
+
+	Real GetSearchTreeAdaptiveCellSizeFactor() const { return settings.searchTreeAdaptiveCellSizeFactor; }
+	void SetSearchTreeAdaptiveCellSizeFactor(Real value)
+	{
+		CHECKandTHROW(value > 0, "GeneralContact: searchTreeAdaptiveCellSizeFactor must be > 0");
+		settings.searchTreeAdaptiveCellSizeFactor = value;
+	}
+
+	Index GetSearchTreeAdaptiveMaxCells() const { return settings.searchTreeAdaptiveMaxCells; }
+	void SetSearchTreeAdaptiveMaxCells(Index value)
+	{
+		CHECKandTHROW(value > 0, "GeneralContact: searchTreeAdaptiveMaxCells must be > 0");
+		settings.searchTreeAdaptiveMaxCells = value;
+	}
+
+	bool GetTrianglesBVH() const { return settings.trianglesBVH; }
+	void SetTrianglesBVH(bool flag) { settings.trianglesBVH = flag; trianglesBVHvalid = false; }
+
 	bool GetSphereSphereContact() const { return settings.sphereSphereContact; }
 	void SetSphereSphereContact(bool flag) { settings.sphereSphereContact = flag; }
 
 	bool GetSphereSphereFrictionRecycle() const { return settings.sphereSphereFrictionRecycle; }
 	void SetSphereSphereFrictionRecycle(bool flag) { settings.sphereSphereFrictionRecycle = flag; }
 
+	Real GetSphereSphereNeighborListSkin() const { return settings.sphereSphereNeighborListSkin; }
+	void SetSphereSphereNeighborListSkin(Real value)
+	{
+		CHECKandTHROW(value >= 0, "GeneralContact: sphereSphereNeighborListSkin must be >= 0");
+		settings.sphereSphereNeighborListSkin = value;
+		sphereNeighborsValid = false;
+	}
+
 	Real GetMinRelDistanceSpheresTriangles() const { return settings.minRelDistanceSpheresTriangles; }
 	void SetMinRelDistanceSpheresTriangles(Real value) { settings.minRelDistanceSpheresTriangles = value; }
 
@@ -215,7 +243,7 @@ public:
 		
 		if (contactStiffness >= 0) { data.contactStiffness = contactStiffness; }
 		if (contactDamping >= 0) { data.contactDamping = contactDamping; }
-		if (radius >= 0) { data.radius = radius; }
+		if (radius >= 0) { data.radius = radius; sphereNeighborsValid = false; }
 		if (frictionMaterialIndex >= 0) 
 		{
 			CHECKandTHROW(frictionMaterialIndex < settings.frictionPairings.NumberOfRows(), "SetSphereMarkerBased: frictionMaterialIndex out of valid range");
@@ -264,6 +292,7 @@ public:
 		{
 			data.points[i] = Vector3D(points[i]);
 		}
+		trianglesBVHvalid = false; //hierarchies need to be rebuilt
 	}
 
 	//! measure shortest distance to object along line with start point and direction; return false, if no item found inside given min/max distance
@@ -505,6 +505,8 @@ PYBIND11_MODULE(exudynCPP, m) {
 
 		.def("SendRedrawSignal", &MainSystemContainer::SendRedrawSignal, "This function is used to send a signal to the renderer that all MainSystems (mbs) shall be redrawn")
 
+		.def("UpdateGraphicsData", &MainSystemContainer::PyUpdateGraphicsData, "Update graphics data of all MainSystems (mbs) in the current thread, without rendering; this is done by the renderer otherwise and can only be used if renderer is not running, e.g., to measure the cost of graphics updates")
+
 		.def("GetCurrentMouseCoordinates", &MainSystemContainer::PyGetCurrentMouseCoordinates, "Get current mouse coordinates as list [x, y]; x and y being floats, as returned by GLFW, measured from top left corner of window; use GetCurrentMouseCoordinates(True) to obtain OpenGLcoordinates of projected plane", py::arg("useOpenGLcoordinates") = true)
 
 		.def("Reset", &MainSystemContainer::Reset, "delete all systems and reset SystemContainer (including graphics)") 
@@ -45,6 +45,7 @@ using namespace pybind11::literals; //brings in the '_a' literals; e.g. for shor
 #include "Main/MainSystem.h"
 //
 #include "Pymodules/PyMatrixContainer.h"
+#include "Pymodules/PyBinarySolutionReader.h"
 #include "Pymodules/PyMatrixVector.h"
 #include "Pymodules/PyGeneralContact.h"
 //
@@ -306,6 +307,7 @@ void Init_Pybind_manual_classes(py::module& m) {
 		//+++++++++++++++++++++++++++++++++++++++++++
 		//.def_readwrite("useEigenFullPivotLUsolver", &Experimental::useEigenFullPivotLUsolver)//, "switch to special solver")
 		.def_readwrite("eigenFullPivotLUsolverDebugLevel", &PyExperimental::eigenFullPivotLUsolverDebugLevel)//, "debug level for solver")
+		.def_readwrite("batchedObjectEvaluation", &PyExperimental::batchedObjectEvaluation)//, "batched (SIMD) evaluation of spring-dampers; set before Assemble()")
 
 		//representation:
 		.def("__repr__", [](const PyExperimental& item) {
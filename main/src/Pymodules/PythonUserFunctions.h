@@ -27,6 +27,9 @@ class MainSystem;
 namespace pybind11 {
 	class object;
 };
+namespace Symbolic {
+	class PySymbolicUserFunction;
+};
 
 
 enum class UserFunctionType {
@@ -51,6 +54,23 @@ inline const char* GetUserFunctionTypeString(UserFunctionType var)
 	}
 }
 
+//! type of function computing the Jacobian of user function w.r.t. its (Real and vector) arguments;
+//! jacobian has one row per return value and columns for all Real and vector components of arguments (after MainSystem), in order of arguments
+template <typename UFT>
+struct UserFunctionJacobian
+{
+	typedef std::function<void(ResizableMatrix& jacobian)> Type;
+	static constexpr bool available = false;
+};
+
+//! Jacobians are only available for user functions returning Real or StdVector3D
+template <typename R, typename... Args>
+struct UserFunctionJacobian<std::function<R(Args...)>>
+{
+	typedef std::function<void(ResizableMatrix& jacobian, Args...)> Type;
+	static constexpr bool available = std::is_same<R, Real>::value || std::is_same<R, StdVector3D>::value;
+};
+
 //! class to encapsulate user functions, according to UserFunctionType
 template <typename UFT>
 class PythonUserFunctionBase
@@ -58,8 +78,10 @@ class PythonUserFunctionBase
 private:
 	pybind11::object* pyObject;
 	UserFunctionType ufType;
+	const Symbolic::PySymbolicUserFunction* symbolicUserFunction; //!< linked symbolic user function (kept alive by pyObject); nullptr otherwise
 public:
 	UFT userFunction;
+	typename UserFunctionJacobian<UFT>::Type userFunctionJacobian; //!< Jacobian of userFunction; only set for compiled symbolic user functions (automatic differentiation)
 
 	//! constructor to set empty function
 	PythonUserFunctionBase();
@@ -80,6 +102,12 @@ public:
 	UserFunctionType GetUFtype() { return ufType; }
 	//! return true, if user functions exists
 	bool IsValid() const { return ufType != UserFunctionType::_None; }
+	//! return true, if linked symbolic user function is currently compiled; queried at every call, as Compile() may be called after assignment
+	bool IsCompiledSymbolic() const;
+	//! return true, if user function can be called from worker threads in multithreaded computation (no user function or compiled symbolic user function)
+	bool IsThreadSafe() const { return ufType == UserFunctionType::_None || IsCompiledSymbolic(); }
+	//! return true, if userFunctionJacobian is available, which allows analytic Jacobians of items
+	bool HasJacobian() const { return (bool)userFunctionJacobian && IsCompiledSymbolic(); }
 	void Reset();
 
 	//! comparison operator, just for comparison with 0
@@ -117,6 +145,8 @@ public:
 		Reset(); //pyObject
 		userFunction = uft;
 		ufType = UserFunctionType::Symbolic;
+		symbolicUserFunction = nullptr; //not known
+		userFunctionJacobian = nullptr;
 	}
 
 
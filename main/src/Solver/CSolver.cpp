@@ -118,7 +118,7 @@ void SolverLocalData::CleanUpMemory()
 
 //! function links system matrices to according dense/sparse versions
 void SolverLocalData::SetLinearSolverType(LinearSolverType linearSolverType, bool reuseAnalyzedPattern, 
-    bool ignoreSingularJacobian, Real pivotThreshold)
+    bool ignoreSingularJacobian, Real pivotThreshold, bool reuseSparsityPattern)
 {
 	//std::cout << "SetLinearSolverType" << std::flush;
 	//pout << "linearSolverType=" << linearSolverType << "\n";
@@ -163,6 +163,9 @@ void SolverLocalData::SetLinearSolverType(LinearSolverType linearSolverType, boo
 		systemJacobianSparse.SetReuseAnalyzedPattern(reuseAnalyzedPattern);
 		systemMassMatrixSparse.SetReuseAnalyzedPattern(reuseAnalyzedPattern);
 		jacobianAEsparse.SetReuseAnalyzedPattern(reuseAnalyzedPattern);
+		systemJacobianSparse.SetReuseSparsityPattern(reuseSparsityPattern);
+		systemMassMatrixSparse.SetReuseSparsityPattern(reuseSparsityPattern);
+		jacobianAEsparse.SetReuseSparsityPattern(reuseSparsityPattern);
 	}
 	//std::cout << "SetLinearSolverType4" << std::flush;
 	systemJacobian->PivotThreshold() = pivotThreshold;
@@ -43,6 +43,20 @@ extern PySpecial pySpecial;			//! special features; affects exudyn globally; tre
 namespace py = pybind11;	//for py::object
 
 #include "Utilities/Parallel.h" //include after 
+#include <optional>
+#include <atomic>
+
+//! number of solvers currently running with released GIL; these solvers run serial, as the taskmanager is shared by all solvers
+std::atomic<Index> numberOfSolversWithReleasedGIL(0);
+
+//! release GIL during lifetime and count solvers running with released GIL
+class SolverGILRelease
+{
+	py::gil_scoped_release releaseGIL;
+public:
+	SolverGILRelease() { numberOfSolversWithReleasedGIL++; }
+	~SolverGILRelease() { numberOfSolversWithReleasedGIL--; }
+};
 
 const STDstring CSolverBase::GetErrorString() const
 {
@@ -181,6 +195,7 @@ void CSolverBase::InitializeSolverOutput(CSystem& computationalSystem, const Sim
 	//for every sensor there is an according enty in sensorFileList (may be Null pointer)
 	//files need to be closed at any exit point!!!
 
+    file.sensorsBinaryWriter.Finish(); //in case that previous simulation has not been finalized
     if (solutionSettings.sensorsStoreAndWriteFiles)
     {
         for (auto item : computationalSystem.GetSystemData().GetCSensors())
@@ -190,8 +205,9 @@ void CSolverBase::InitializeSolverOutput(CSystem& computationalSystem, const Sim
             {
                 std::ofstream* sensorFile = new std::ofstream;
                 file.sensorFileList.push_back(sensorFile);
-                auto fileMode = std::ofstream::out;
-                if (solutionSettings.sensorsAppendToFile) { fileMode = std::ofstream::app; }
+                std::ios_base::openmode fileMode = std::ofstream::out;
+                if (solutionSettings.sensorsBinaryFiles) { fileMode = std::ofstream::out | std::ofstream::binary; } //binary files are always replaced
+                else if (solutionSettings.sensorsAppendToFile) { fileMode = std::ofstream::app; }
 
                 CheckPathAndCreateDirectories(item->GetFileName());
                 sensorFile->open(item->GetFileName(), fileMode);
@@ -221,28 +237,37 @@ void CSolverBase::InitializeSolverOutput(CSystem& computationalSystem, const Sim
                     Index stepsPlanned = 100; //allocate at least some space which makes no big problems
                     if (IsStaticSolver())
                     {
-                        stepsPlanned = EXUstd::Maximum(simulationSettings.staticSolver.numberOfLoadSteps, stepsPlanned);
+                        stepsPlanned = EXUstd::Maximum(simulationSettings.staticSolver.numberOfLoadSteps + 1, stepsPlanned);
                     }
                     else
                     {
-                        Real writeSteps = simulationSettings.timeIntegration.endTime - simulationSettings.timeIntegration.startTime;
+                        Real writeSteps = (Real)simulationSettings.timeIntegration.numberOfSteps;
                         if (simulationSettings.solutionSettings.sensorsWritePeriod != 0)
                         {
-                            writeSteps /= simulationSettings.solutionSettings.sensorsWritePeriod;
+                            writeSteps = EXUstd::Minimum(writeSteps, (simulationSettings.timeIntegration.endTime - simulationSettings.timeIntegration.startTime) /
+                                simulationSettings.solutionSettings.sensorsWritePeriod);
                         }
-                        stepsPlanned = EXUstd::Maximum((Index)writeSteps, stepsPlanned);
-                        stepsPlanned = EXUstd::Minimum(10000, stepsPlanned); //not too big, if they are never computed ...!
+                        stepsPlanned = EXUstd::Maximum((Index)writeSteps + 2, stepsPlanned); //initial values + roundoff
                     }
 
-                    //pre-allocate data:
-                    item->GetInternalStorage().SetNumberOfRowsAndColumns(stepsPlanned, 4); //typical size for position sensor; will be less optimal for Coordinates sensor with 100+ coordinates, but only log2(nSteps) memory allocations
-
-                    //this marks that sensor data is reset ...
-                    item->GetInternalStorage().SetNumberOfRowsAndColumns(0, 0);
+                    //this marks that sensor data is reset; memory for planned rows is reserved when first row is stored (size is capped, storage grows in chunks beyond):
+                    item->GetSensorInternalStorage().Reset(stepsPlanned);
 
                 };
             }
         }
+
+        //binary sensor files are written by background thread; indices in writer correspond to sensor numbers
+        if (solutionSettings.sensorsBinaryFiles)
+        {
+            file.sensorsBinaryColumns.SetNumberOfItems(0);
+            for (auto* sensorFile : file.sensorFileList)
+            {
+                file.sensorsBinaryWriter.AddFile(sensorFile);
+                file.sensorsBinaryColumns.Append(0); //set in WriteSensorsFileHeader(...)
+            }
+            file.sensorsBinaryWriter.Start(solutionSettings.flushFilesImmediately);
+        }
     }
 
 	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
@@ -322,7 +347,8 @@ void CSolverBase::InitializeSolverData(CSystem& computationalSystem, const Simul
         )
 	{
 		data.SetLinearSolverType(simulationSettings.linearSolverType, simulationSettings.linearSolverSettings.reuseAnalyzedPattern, 
-            simulationSettings.linearSolverSettings.ignoreSingularJacobian);
+            simulationSettings.linearSolverSettings.ignoreSingularJacobian, 0., //pivotThreshold: default
+            simulationSettings.linearSolverSettings.reuseSparsityPattern);
 	}
 	//else if (simulationSettings.linearSolverType == LinearSolverType::EigenSparse)
 	//{
@@ -342,6 +368,12 @@ void CSolverBase::InitializeSolverData(CSystem& computationalSystem, const Simul
 	computationalSystem.GetSolverData().multithreadedLLimitResiduals = simulationSettings.parallel.multithreadedLLimitResiduals;
 	computationalSystem.GetSolverData().multithreadedLLimitJacobians = simulationSettings.parallel.multithreadedLLimitJacobians;
 	computationalSystem.GetSolverData().multithreadedLLimitMassMatrix = simulationSettings.parallel.multithreadedLLimitMassMatrices;
+	if (computationalSystem.GetSolverData().useColoringForResiduals != simulationSettings.parallel.useColoringForResiduals)
+	{
+		computationalSystem.ResetCostBalancedTasks(); //RHS tasks process different list of objects
+	}
+	computationalSystem.GetSolverData().useColoringForResiduals = simulationSettings.parallel.useColoringForResiduals;
+	computationalSystem.GetSolverData().useCostBalancedTasks = simulationSettings.parallel.useCostBalancedTasks;
 
 	computationalSystem.GetSolverData().taskSplitMinItems = simulationSettings.parallel.taskSplitMinItems;
 	computationalSystem.GetSolverData().taskSplitTasksPerThread = simulationSettings.parallel.taskSplitTasksPerThread;
@@ -405,12 +437,18 @@ void CSolverBase::InitializeSolverData(CSystem& computationalSystem, const Simul
 
 	//Eigen::initParallel(); //with C++11 and eigen 3.3 optional
 	Index nThreads = simulationSettings.parallel.numberOfThreads;
+	if (nThreads > 1 && numberOfSolversWithReleasedGIL > 0)
+	{
+		PyWarning("Initialize Solver: other solvers are running in parallel Python threads; taskmanager cannot be shared and numberOfThreads is set to 1");
+		nThreads = 1;
+	}
 	//pout << "numThreads before init=" << exuThreading::TaskManager::GetNumThreads() << "\n";
 	if (nThreads > 1)
 	{
 		//verboseMode not defined at this point ==> this part needs to move to initialization of solver!
 		//VerboseWrite(1, STDstring("TaskManager::SetNumThreads = ") + EXUstd::ToString(simulationSettings.parallel.numberOfThreads) + "\n");
-		exuThreading::TaskManager::SetNumThreads(simulationSettings.parallel.numberOfThreads);
+		exuThreading::TaskManager::SetNumThreads(nThreads);
+		SetTaskManagerWaitPolicy(simulationSettings.parallel.workerSpinTime, simulationSettings.parallel.pinThreads);
 
 		//for checking where time is lost
 		//TaskManager::SetPajeTrace(true);
@@ -696,8 +734,11 @@ void CSolverBase::FinalizeSolver(CSystem& computationalSystem, const SimulationS
 			{
 				if ((Index)file.sensorFileList.size() > cnt && file.sensorFileList[cnt] != nullptr)
 				{
-					std::ofstream* sFile = file.sensorFileList[cnt];
-					(*sFile) << footer;
+					if (!simulationSettings.solutionSettings.sensorsBinaryFiles) //binary files only contain fixed-width rows after header
+					{
+						std::ofstream* sFile = file.sensorFileList[cnt];
+						(*sFile) << footer;
+					}
 				}
 				else
 				{
@@ -743,6 +784,12 @@ void CSolverBase::StopThreadsAndCloseFiles()
 	if (file.solutionFile.is_open()) { file.solutionFile.close(); }
 	if (file.solverFile.is_open()) { file.solverFile.close(); }
 
+	//write remaining binary sensor data before closing sensor files:
+	if (!file.sensorsBinaryWriter.Finish())
+	{
+		PyWarning("writing of binary sensor files failed; check file system and file names");
+	}
+
 	//close sensor files:
 	for (auto* item : file.sensorFileList)
 	{
@@ -757,11 +804,27 @@ void CSolverBase::StopThreadsAndCloseFiles()
 	//pout << "sensor list length=" << file.sensorFileList.size() << "\n";
 }
 
+//! check conditions for running SolveSteps(...) without GIL; Python is only called for output, warnings and CTRL+C then
+bool CSolverBase::CanReleaseGIL(CSystem& computationalSystem) const
+{
+	return PyGILState_Check() &&	//caller must hold GIL, e.g., not called from other C++ thread
+		output.numberOfThreadsUsed == 1 &&
+		!computationalSystem.GetPostProcessData()->VisualizationIsRunning() &&
+		!computationalSystem.GetPostProcessData()->UseSoftwareRenderer() &&
+		!HasSolverUserFunctions() &&
+		!computationalSystem.HasPythonUserFunctions();
+}
+
 //! main solver part: calls multiple InitializeStep(...)/PerformStep(...); do step reduction if necessary; return true if success, false else
 bool CSolverBase::SolveSteps(CSystem& computationalSystem, const SimulationSettings& simulationSettings)
 {
 	if (IsVerbose(2)) { Verbose(2, "\nStart steps solving loop\n"); }
 
+	//release GIL, such that other Python threads (e.g., independent simulations) can run in parallel
+	output.releasedGIL = CanReleaseGIL(computationalSystem);
+	std::optional<SolverGILRelease> releaseGIL;
+	if (output.releasedGIL) { releaseGIL.emplace(); }
+
 	if (it.automaticStepSize) { it.currentStepSize = it.initialStepSize; }
 	else { it.currentStepSize = it.maxStepSize; }//initial value for step size
 
@@ -1111,6 +1174,11 @@ void CSolverBase::FinishStep(CSystem& computationalSystem, const SimulationSetti
 	{
 		computationalSystem.UpdatePostProcessData(recordImage);
 	}
+	else if (recordImage && computationalSystem.GetPostProcessData()->UseSoftwareRenderer())
+	{
+		//frame is rendered and saved by software renderer thread, while simulation continues
+		computationalSystem.UpdatePostProcessData(recordImage);
+	}
 
 	if (simulationSettings.pauseAfterEachStep) { computationalSystem.GetPostProcessData()->WaitForUserToContinue(output.verboseMode > 0); }
 	STOPTIMER(timer.visualization);
@@ -1897,14 +1965,19 @@ void CSolverBase::WriteCoordinatesToFile(const CSystem& computationalSystem, con
 //! write unique sensor file header, depending on static/dynamic simulation
 void CSolverBase::WriteSensorsFileHeader(CSystem& computationalSystem, const SimulationSettings& simulationSettings)
 {
-	if (!simulationSettings.solutionSettings.sensorsWriteFileHeader || !simulationSettings.solutionSettings.sensorsStoreAndWriteFiles) { return; }
+	const SolutionSettings& solutionSettings = simulationSettings.solutionSettings;
+	bool isBinary = solutionSettings.sensorsBinaryFiles; //binary files always need header for number of columns
+	if ((!solutionSettings.sensorsWriteFileHeader && !isBinary) || !solutionSettings.sensorsStoreAndWriteFiles) { return; }
 
 	Index cnt = 0;
 	for (auto item : computationalSystem.GetSystemData().GetCSensors())
 	{
 		if ((Index)file.sensorFileList.size() > cnt && file.sensorFileList[cnt] != nullptr)
 		{
-			std::ofstream* sFile = file.sensorFileList[cnt];
+			std::ostringstream binaryTextHeader; //for binary files, text header is stored in fixed-size binary header
+			std::ostream* sFile = file.sensorFileList[cnt];
+			if (isBinary) { sFile = &binaryTextHeader; }
+
 			(*sFile) << "#Exudyn " << GetSolverName() << " ";
 			if (IsStaticSolver()) { (*sFile) << "static "; }
 			(*sFile) << "sensor output file\n";
@@ -1921,7 +1994,8 @@ void CSolverBase::WriteSensorsFileHeader(CSystem& computationalSystem, const Sim
 			(*sFile) << "#OutputVariableType = " << GetOutputVariableTypeString(item->GetOutputVariableType()) << "\n";
 
 			(*sFile) << "#simulation started = " << EXUstd::GetDateTimeString() << "\n";
-			(*sFile) << "#columns contain: time, comma separated sensor values (e.g, x,y,z position coordinates)\n";
+			if (!isBinary) { (*sFile) << "#columns contain: time, comma separated sensor values (e.g, x,y,z position coordinates)\n"; }
+			else { (*sFile) << "#columns contain: time, sensor values (e.g, x,y,z position coordinates); binary rows\n"; }
 
 			item->GetSensorValues(computationalSystem.GetSystemData(), output.sensorValuesTemp, ConfigurationType::Current); //only for checking size of sensor output, computed values not used
 
@@ -1929,6 +2003,14 @@ void CSolverBase::WriteSensorsFileHeader(CSystem& computationalSystem, const Sim
 			//(*sFile) << "#Exudyn version = " << EXUstd::exudynVersion << "\n";
 			(*sFile) << "#Exudyn version = " << GetExudynBuildVersionString(true) << "\n";
 			(*sFile) << "#\n";
+
+			if (isBinary)
+			{
+				Index nColumns = output.sensorValuesTemp.NumberOfItems() + 1;
+				file.sensorsBinaryColumns[cnt] = nColumns;
+				STDstring header = ExuFile::BinarySensorFileHeader(binaryTextHeader.str(), nColumns, file.binaryFileSettings);
+				file.sensorsBinaryWriter.Write(cnt, header.c_str(), header.length());
+			}
 		}
 		else
 		{
@@ -1958,7 +2040,26 @@ void CSolverBase::WriteSensorsToFile(const CSystem& computationalSystem, const S
 		for (auto item : computationalSystem.GetSystemData().GetCSensors())
 		{
 			bool sensorValuesCalled = false;
-			if ((Index)file.sensorFileList.size() > cnt && file.sensorFileList[cnt] != nullptr)
+			if ((Index)file.sensorFileList.size() > cnt && file.sensorFileList[cnt] != nullptr && solutionSettings.sensorsBinaryFiles)
+			{
+				//copy row into buffer of background writer; no formatting and no waiting for file I/O
+				item->GetSensorValues(computationalSystem.GetSystemData(), output.sensorValuesTemp, ConfigurationType::Current);
+				Index n = output.sensorValuesTemp.NumberOfItems();
+				if (n + 1 != file.sensorsBinaryColumns[cnt])
+				{
+					STDstring msg = "CSolverBase::WriteSensorsToFile: sensorsBinaryFiles == True : number of output values of sensor (sensor number ";
+					msg += EXUstd::ToString(cnt) + ") changed, which is not possible for binary sensor files; consider sensorsBinaryFiles == False";
+					PyError(msg, file.solverFile);
+				}
+				else
+				{
+					Index realSize = file.binaryFileSettings.realSize;
+					file.sensorsBinaryWriter.WriteReals(cnt, &t, 1, realSize);
+					file.sensorsBinaryWriter.WriteReals(cnt, output.sensorValuesTemp.GetDataPointer(), n, realSize);
+				}
+				sensorValuesCalled = true;
+			}
+			else if ((Index)file.sensorFileList.size() > cnt && file.sensorFileList[cnt] != nullptr)
 			{
 				std::ofstream* sFile = file.sensorFileList[cnt];
 
@@ -1984,24 +2085,18 @@ void CSolverBase::WriteSensorsToFile(const CSystem& computationalSystem, const S
 					item->GetSensorValues(computationalSystem.GetSystemData(), output.sensorValuesTemp, ConfigurationType::Current);
 				}
 				Index n = output.sensorValuesTemp.NumberOfItems();
-				output.sensorValuesTemp2.SetNumberOfItems(n + 1);
-				output.sensorValuesTemp2[0] = t;
-				for (Index i = 0; i < n; i++)
-				{
-					output.sensorValuesTemp2[i + 1] = output.sensorValuesTemp[i];
-				}
 				
 				//this marks that new data is stored ...
-				if (item->GetInternalStorage().NumberOfRows() != 0)
+				if (item->GetInternalStorage().NumberOfRows() != 0 && n + 1 != item->GetInternalStorage().NumberOfColumns())
 				{
-					if (output.sensorValuesTemp2.NumberOfItems() != item->GetInternalStorage().NumberOfColumns())
-					{
-						STDstring msg = "CSolverBase::WriteSensorsToFile: storeInternal == True : seems that number of output values of sensor (sensor number ";
-						msg += EXUstd::ToString(cnt) + ") changed; consider storeInternal == False for this sensor and write to file";
-						PyError(msg, file.solverFile);
-					}
+					STDstring msg = "CSolverBase::WriteSensorsToFile: storeInternal == True : seems that number of output values of sensor (sensor number ";
+					msg += EXUstd::ToString(cnt) + ") changed; consider storeInternal == False for this sensor and write to file";
+					PyError(msg, file.solverFile);
+				}
+				else
+				{
+					item->GetSensorInternalStorage().AppendRow(t, output.sensorValuesTemp); //no memory allocation except for growing in chunks
 				}
-				item->GetInternalStorage().AppendRow(output.sensorValuesTemp2);
 				sensorValuesCalled = true;
 
 			}
@@ -2012,6 +2107,10 @@ void CSolverBase::WriteSensorsToFile(const CSystem& computationalSystem, const S
 			}
 			cnt++;
 		}
+		if (solutionSettings.sensorsBinaryFiles && solutionSettings.flushFilesImmediately)
+		{
+			file.sensorsBinaryWriter.SubmitAll(); //I/O thread writes and flushes data
+		}
 	}
 }
 
@@ -2021,6 +2120,14 @@ void CSolverBase::WriteSensorsToFile(const CSystem& computationalSystem, const S
 
 void CSolverBase::DoIdleOperations(CSystem& computationalSystem)
 {
+	//solver running with released GIL: idle operations are only needed if renderer has been started in the meantime
+	std::optional<py::gil_scoped_acquire> acquireGIL;
+	if (!PyGILState_Check())
+	{
+		if (!computationalSystem.GetPostProcessData()->VisualizationIsRunning()) { return; }
+		acquireGIL.emplace();
+	}
+
     if (computationalSystem.GetPostProcessData()->simulationPaused)
     {
         computationalSystem.GetPostProcessData()->WaitForUserToContinue(output.verboseMode>0);
@@ -31,6 +31,7 @@
 
 #include "Linalg/LinearSolver.h" //for GeneralMatrixEXUdense
 #include "Main/WriteBinary.h"
+#include "Main/AsyncFileWriter.h"
 #include "Solver/CSolver.h"
 
 class CSystem;
@@ -209,6 +210,12 @@ public:
 	//! do some idle operations for update of waiting Python queues (multithreaded) or for graphics update (single-threaded)
 	virtual void DoIdleOperations(CSystem& computationalSystem);
 
+	//! return true, if solver has Python user functions (e.g., overriding Newton()); used to decide if GIL can be released
+	virtual bool HasSolverUserFunctions() const { return false; }
+
+	//! return true, if Python GIL can be released during SolveSteps(...): requires serial computation, no renderer and no Python user functions
+	virtual bool CanReleaseGIL(CSystem& computationalSystem) const;
+
 	//! return true, if file or console output is at or above the given level
 	virtual bool IsVerboseCheck(Index level) const
 	{ 
@@ -150,6 +150,15 @@ public:
 		mainSystem = nullptr;
 	}
 
+	//! return true, if any user function is set, which overrides solver functions
+	virtual bool HasSolverUserFunctions() const override
+	{
+		return userFunctionPreInitializeSolverSpecific || userFunctionInitializeSolverInitialConditions || userFunctionPostInitializeSolverSpecific ||
+			userFunctionUpdateCurrentTime || userFunctionInitializeStep || userFunctionFinishStep || userFunctionDiscontinuousIteration ||
+			userFunctionNewton || userFunctionComputeNewtonUpdate || userFunctionComputeNewtonResidual || userFunctionComputeNewtonJacobian ||
+			userFunctionPostNewton;
+	}
+
 	virtual void SetUserFunctionUpdateCurrentTime(MainSolverImplicitSecondOrder* mainSolverInit, MainSystem* mainSystemInit, const MainSolverImplicitSecondOrderUserFunction& uf)
 	{
 		mainSolver = mainSolverInit; mainSystem = mainSystemInit; userFunctionUpdateCurrentTime = uf;
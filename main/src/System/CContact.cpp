@@ -165,6 +165,7 @@ void VisuGeneralContact::DrawContacts(const GeneralContact& gContact, const Visu
 		Float4 color = visualizationSettings.contact.colorBoundingBoxes;
 		for (const Box3D& box : gContact.GetAllBoundingBoxes())
 		{
+			if (box.Empty()) { continue; } //triangles in case of trianglesBVH
 			//std::cout << "draw=" << box.Center() << "\n";
 			EXUvis::DrawOrthoCube(box.Center(), box.PMax() - box.PMin(), color,
 				vSystem->graphicsData, 0, false, true);
@@ -189,6 +190,7 @@ void GeneralContact::SetNumberOfThreads(Index nThreads)
 			delete foundTrianglesRigidBodyBased[i];
 			delete foundPlanesTrianglesRigidBodyBased[i];
 			delete foundEdgesTrianglesRigidBodyBased[i];
+			delete foundRigidBodiesTrianglesBVH[i];
 		}
 
 		addedObjects.SetNumberOfItems(nThreads);
@@ -196,6 +198,7 @@ void GeneralContact::SetNumberOfThreads(Index nThreads)
 		foundTrianglesRigidBodyBased.SetNumberOfItems(nThreads);
 		foundPlanesTrianglesRigidBodyBased.SetNumberOfItems(nThreads);
 		foundEdgesTrianglesRigidBodyBased.SetNumberOfItems(nThreads);
+		foundRigidBodiesTrianglesBVH.SetNumberOfItems(nThreads);
 
 		for (Index i = 0; i < addedObjects.NumberOfItems(); i++)
 		{
@@ -205,6 +208,7 @@ void GeneralContact::SetNumberOfThreads(Index nThreads)
 			foundTrianglesRigidBodyBased[i] = new ResizableArray<ContactTrianglesRigidBodyBasedTemp>();
 			foundPlanesTrianglesRigidBodyBased[i] = new ArrayIndex();
 			foundEdgesTrianglesRigidBodyBased[i] = new ArrayIndex();
+			foundRigidBodiesTrianglesBVH[i] = new ArrayIndex();
 
 			addedObjects[i]->SetNumberOfItems(0);
 			addedObjectsFlags[i]->SetNumberOfItems(TotalContactObjects());
@@ -221,6 +225,8 @@ void GeneralContact::Reset(bool freeMemory)
 	verboseMode = 0;
 	initializeData = true;
 	searchTreeUpdateCounter = 0;
+	trianglesBVHvalid = false;
+	DeleteSphereNeighbors();
 
 	contactIsFinalized = false;
 
@@ -228,6 +234,9 @@ void GeneralContact::Reset(bool freeMemory)
 	{
 
 		searchTree.Flush();
+		trianglesBVH.clear();
+		trianglesBVHstart.Flush();
+		trianglesBVHtrigs.Flush();
 		allBoundingBoxes.Flush();
 		globalContactIndexOffsets.Flush();
 
@@ -285,6 +294,46 @@ void GeneralContact::Reset(bool freeMemory)
 
 }
 
+void GeneralContact::WriteStateCheckpoint(ExuFile::BinaryBufferWriter& writer) const
+{
+	writer.Write(allActiveContacts.NumberOfItems());
+	for (Index gi = 0; gi < allActiveContacts.NumberOfItems(); gi++)
+	{
+		writer.Write(*allActiveContacts[gi]);
+		writer.Write(*allActiveContactsVector[gi]);
+	}
+}
+
+void GeneralContact::ReadStateCheckpoint(ExuFile::BinaryBufferReader& reader, std::vector<ArrayIndex>& activeContacts,
+	std::vector<ResizableArray<Vector3D>>& activeContactsVector) const
+{
+	Index n = reader.ReadIndex();
+	if (n != allActiveContacts.NumberOfItems()) { PyError("state checkpoint: number of contact objects in GeneralContact does not fit to checkpoint; checkpoint must be created from same (assembled) system"); }
+	Index nContactObjects = (n != 0) ? TotalContactObjects() : 0;
+	activeContacts.resize(n);
+	activeContactsVector.resize(n);
+	for (Index gi = 0; gi < n; gi++)
+	{
+		reader.Read(activeContacts[gi]);
+		reader.Read(activeContactsVector[gi]);
+		//active contacts are signed global contact indices; friction data is only stored together with active contacts
+		for (Index gj : activeContacts[gi])
+		{
+			if (gj <= -nContactObjects || gj >= nContactObjects) { PyError("state checkpoint: invalid contact index in GeneralContact; checkpoint must be created from same (assembled) system"); }
+		}
+		if (activeContactsVector[gi].NumberOfItems() > activeContacts[gi].NumberOfItems()) { PyError("state checkpoint: contact data in GeneralContact corrupted"); }
+	}
+}
+
+void GeneralContact::SetStateCheckpoint(const std::vector<ArrayIndex>& activeContacts, const std::vector<ResizableArray<Vector3D>>& activeContactsVector)
+{
+	for (Index gi = 0; gi < allActiveContacts.NumberOfItems(); gi++)
+	{
+		allActiveContacts[gi]->CopyFrom(activeContacts[gi]);
+		allActiveContactsVector[gi]->CopyFrom(activeContactsVector[gi]);
+	}
+}
+
 Index TSboundingBoxes;
 TimerStructureRegistrator TSRboundingBoxes("Contact:BoundingBoxes", TSboundingBoxes, globalTimers, true);
 
@@ -439,6 +488,8 @@ void GeneralContact::FinalizeContact(const CSystem& cSystem)//, Index3 searchTre
 	}
 
 	searchTreeUpdateCounter = 0;
+	trianglesBVHvalid = false; //hierarchies are built at first computation of bounding boxes
+	sphereNeighborsValid = false;
 	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
 	//create relation between local and global contact indices
 	globalContactIndexOffsets.Flush();
@@ -630,7 +681,19 @@ void GeneralContact::ComputeContactDataAndBoundingBoxes(const CSystem& cSystem,
 
 	STOPGLOBALTIMERmain(TSboundingBoxes);
 
-	if (updateBoundingBoxes && addToSearchTree)
+	//neighbor lists: search tree is only needed for other contact objects or if lists need to be rebuilt
+	bool useSphereNeighbors = settings.sphereSphereNeighborListSkin > 0. && settings.sphereSphereContact;
+	bool updateSphereNeighbors = false;
+	bool updateSearchTree = true;
+	if (!useSphereNeighbors) { sphereNeighborsValid = false; }
+	else if (updateBoundingBoxes && addToSearchTree)
+	{
+		updateSphereNeighbors = SphereNeighborsNeedUpdate();
+		//boxes in search tree still contain spheres, as they are enlarged by half of skin:
+		updateSearchTree = updateSphereNeighbors || ancfCable2D.NumberOfItems() || trigsRigidBodyBased.NumberOfItems();
+	}
+
+	if (updateBoundingBoxes && addToSearchTree && updateSearchTree)
 	{
 		STARTGLOBALTIMERmain(TSsearchTree);
 		searchTreeUpdateCounter++;
@@ -639,12 +702,17 @@ void GeneralContact::ComputeContactDataAndBoundingBoxes(const CSystem& cSystem,
 			searchTree.FlushCells(); //keeps search tree in general, but flushes sub-cell memory
 			searchTreeUpdateCounter = 0;
 		}
-		searchTree.ClearItems();
-		Index gi = 0;
-		for (const auto& box : allBoundingBoxes)
+		if (settings.searchTreeAdaptive && allBoundingBoxes.NumberOfItems() != 0)
 		{
-			searchTree.AddItem(box, gi++);
+			searchTree.ResetSearchTreeAdaptive(allBoundingBoxes, settings.searchTreeAdaptiveCellSizeFactor, settings.searchTreeAdaptiveMaxCells);
 		}
+		//parallel, allocation-free build into flat cell array; same item order in cells as serial AddItem(...)
+		searchTree.BuildItems(allBoundingBoxes, [nThreads](Index n, auto f)
+		{
+			Index taskSplit = nThreads;
+			if (n > 400 * nThreads) { taskSplit = 100 * nThreads; }
+			exuThreading::ParallelFor((NGSsizeType)n, f, taskSplit);
+		}, nThreads > 1);
 		if (verboseMode >= 2)
 		{
 			Index gi = 0;
@@ -653,11 +721,70 @@ void GeneralContact::ComputeContactDataAndBoundingBoxes(const CSystem& cSystem,
 				pout << "bounding box " << gi++ << ": " << box << "\n";
 			}
 		}
+		if (updateSphereNeighbors)
+		{
+			BuildSphereNeighbors(nThreads);
+		}
 		STOPGLOBALTIMERmain(TSsearchTree);
 	}
 	initializeData = false; //initialized in FinalizeContact
 }
 
+//! return true, if sphere neighbor lists are invalid or any sphere moved more than half of sphereSphereNeighborListSkin since last build
+bool GeneralContact::SphereNeighborsNeedUpdate() const
+{
+	if (!sphereNeighborsValid || sphereNeighborsPositions.NumberOfItems() != spheresMarkerBased.NumberOfItems()) { return true; }
+
+	Real maxDistanceSquared = EXUstd::Square(0.5*settings.sphereSphereNeighborListSkin);
+	for (Index i = 0; i < spheresMarkerBased.NumberOfItems(); i++)
+	{
+		if ((spheresMarkerBased[i].position - sphereNeighborsPositions[i]).GetL2NormSquared() >= maxDistanceSquared) { return true; }
+	}
+	return false;
+}
+
+//! build neighbor lists of spheres from search tree, using current (enlarged) bounding boxes
+void GeneralContact::BuildSphereNeighbors(Index nThreads)
+{
+	Index nSpheres = spheresMarkerBased.NumberOfItems();
+	if (sphereNeighbors.NumberOfItems() != nSpheres)
+	{
+		DeleteSphereNeighbors();
+		sphereNeighbors.SetNumberOfItems(nSpheres);
+		for (Index i = 0; i < nSpheres; i++)
+		{
+			sphereNeighbors[i] = new ArrayIndex();
+		}
+	}
+	sphereNeighborsPositions.SetNumberOfItems(nSpheres);
+
+	Index taskSplit = nThreads;
+	if (nSpheres > 400 * nThreads) { taskSplit = 100 * nThreads; }
+
+	exuThreading::ParallelFor((NGSsizeType)nSpheres, [this](NGSsizeType i)
+	{
+		Index threadID = exuThreading::TaskManager::GetThreadId();
+		Index gi = (Index)i + globalContactIndexOffsets[spheresMarkerBasedIndex];
+		//same search as in ComputeContactMarkerBasedSpheres, but with boxes enlarged by skin:
+		searchTree.GetSingleItemsInBoxMaxMinIndex(allBoundingBoxes[gi], *sphereNeighbors[(Index)i], *addedObjectsFlags[threadID], allBoundingBoxes,
+			globalContactIndexOffsets[spheresMarkerBasedIndex + 1], gi);
+		sphereNeighborsPositions[(Index)i] = spheresMarkerBased[(Index)i].position;
+	}, taskSplit);
+	sphereNeighborsValid = true;
+}
+
+//! delete neighbor lists of spheres
+void GeneralContact::DeleteSphereNeighbors()
+{
+	for (Index i = 0; i < sphereNeighbors.NumberOfItems(); i++)
+	{
+		delete sphereNeighbors[i];
+	}
+	sphereNeighbors.Flush();
+	sphereNeighborsPositions.Flush();
+	sphereNeighborsValid = false;
+}
+
 void GeneralContact::ComputeDataAndBBmarkerBasedSpheres(const CSystemData& systemData, TemporaryComputationDataArray& tempArray,
 	Index nThreads, bool updateBoundingBoxes)
 {
@@ -705,8 +832,10 @@ void GeneralContact::ComputeDataAndBBmarkerBasedSpheres(const CSystemData& syste
 
 		if (updateBoundingBoxes)
 		{
-			//bounding box:
-			Vector3D vr({ item.radius, item.radius, item.radius });
+			//bounding box; enlarged in case of neighbor lists, such that spheres stay inside boxes until lists are rebuilt:
+			Real r = item.radius;
+			if (settings.sphereSphereNeighborListSkin > 0.) { r += 0.5*settings.sphereSphereNeighborListSkin; }
+			Vector3D vr({ r, r, r });
 			//pout << "update=" << item.position << "\n";
 			this->allBoundingBoxes[gi].SetPMin(item.position - vr);
 			this->allBoundingBoxes[gi].SetPMax(item.position + vr);
@@ -813,9 +942,24 @@ void GeneralContact::ComputeDataAndBBtrigsRigidBodyBased(const CSystemData& syst
 
 	}
 
+	if (updateBoundingBoxes && settings.trianglesBVH)
+	{
+		//triangles are not added to search tree, only one box per rigid body (stored at representative triangle)
+		if (!trianglesBVHvalid) { BuildTrianglesBVH(); }
+		for (Index j = 0; j < rigidBodyMarkerBased.NumberOfItems(); j++)
+		{
+			if (trianglesBVHstart[j + 1] != trianglesBVHstart[j])
+			{
+				const ContactRigidBodyMarkerBased& rigidMarker = rigidBodyMarkerBased[j];
+				Index gi = trianglesBVHtrigs[trianglesBVHstart[j]] + globalContactIndexOffsets[trigsRigidBodyBasedIndex];
+				this->allBoundingBoxes[gi] = ContactHelper::TransformedBox(trianglesBVH[j].GetBox(), rigidMarker.orientation, rigidMarker.position);
+			}
+		}
+	}
 	//bounding boxes computed in parallel:
-	if (updateBoundingBoxes)
+	else if (updateBoundingBoxes)
 	{
+		trianglesBVHvalid = false; //bounding boxes of triangles are overwritten
 		NGSsizeType nItems = (NGSsizeType)trigsRigidBodyBased.NumberOfItems();
 		Index taskSplit = nThreads; //shall be multiple of number of treads (Default=nThreads), but better 8*nThreads or larger for large problems
 		if ((Index)nItems > 400 * nThreads) { taskSplit = 100 * nThreads; }
@@ -843,6 +987,114 @@ void GeneralContact::ComputeDataAndBBtrigsRigidBodyBased(const CSystemData& syst
 
 
 
+//! build bounding volume hierarchies of triangles per rigid body in body coordinates and clear bounding boxes of triangles
+void GeneralContact::BuildTrianglesBVH()
+{
+	Index nRigid = rigidBodyMarkerBased.NumberOfItems();
+	Index nTrigs = trigsRigidBodyBased.NumberOfItems();
+
+	//sort triangles by rigid bodies (counting sort, keeps order of triangles):
+	trianglesBVHstart.SetNumberOfItems(nRigid + 1);
+	trianglesBVHstart.SetAll(0);
+	for (const ContactTriangleRigidBodyBased& trig : trigsRigidBodyBased)
+	{
+		trianglesBVHstart[trig.contactRigidBodyIndex + 1]++;
+	}
+	for (Index j = 0; j < nRigid; j++)
+	{
+		trianglesBVHstart[j + 1] += trianglesBVHstart[j];
+	}
+	trianglesBVHtrigs.SetNumberOfItems(nTrigs);
+	ArrayIndex counters;
+	counters.CopyFrom(trianglesBVHstart);
+	for (Index i = 0; i < nTrigs; i++)
+	{
+		trianglesBVHtrigs[counters[trigsRigidBodyBased[i].contactRigidBodyIndex]++] = i;
+	}
+
+	//build hierarchies with boxes in body coordinates:
+	trianglesBVH.resize(nRigid);
+	ResizableArray<Box3D> boxes;
+	for (Index j = 0; j < nRigid; j++)
+	{
+		boxes.SetNumberOfItems(0);
+		for (Index k = trianglesBVHstart[j]; k < trianglesBVHstart[j + 1]; k++)
+		{
+			Box3D box;
+			for (const Vector3D& p : trigsRigidBodyBased[trianglesBVHtrigs[k]].points)
+			{
+				box.Add(p);
+			}
+			boxes.Append(box);
+		}
+		trianglesBVH[j].Build(boxes);
+	}
+
+	//triangles are not added to searchTree, except for representative triangle:
+	for (Index i = 0; i < nTrigs; i++)
+	{
+		this->allBoundingBoxes[i + globalContactIndexOffsets[trigsRigidBodyBasedIndex]] = Box3D();
+	}
+	trianglesBVHvalid = true;
+}
+
+//! add local triangle indices plus indexOffset of rigid body, for which triangle bounding boxes intersect with box given in body coordinates
+void GeneralContact::AddTrianglesInBoxBVH(Index rigidIndex, const Box3D& localBox, ArrayIndex& items, Index indexOffset) const
+{
+	Index n0 = items.NumberOfItems();
+	trianglesBVH[rigidIndex].AddItemsInBox(localBox, items);
+
+	//convert indices of hierarchy into triangle indices:
+	const Index* trigs = trianglesBVHtrigs.GetDataPointer() + trianglesBVHstart[rigidIndex];
+	for (Index i = n0; i < items.NumberOfItems(); i++)
+	{
+		items[i] = trigs[items[i]] + indexOffset;
+	}
+}
+
+//! add local triangle indices of rigid body, for which triangle bounding boxes are hit by line p + t*dir, t in [tMin, tMax], given in body coordinates
+void GeneralContact::AddTrianglesAlongLineBVH(Index rigidIndex, const Vector3D& p, const Vector3D& dir, Real tMin, Real tMax, ArrayIndex& items) const
+{
+	Index n0 = items.NumberOfItems();
+	trianglesBVH[rigidIndex].AddItemsAlongLine(p, dir, tMin, tMax, items);
+
+	const Index* trigs = trianglesBVHtrigs.GetDataPointer() + trianglesBVHstart[rigidIndex];
+	for (Index i = n0; i < items.NumberOfItems(); i++)
+	{
+		items[i] = trigs[items[i]];
+	}
+}
+
+//! replace representative triangles (global index) in items by triangles of rigid body intersecting global box; only for settings.trianglesBVH
+void GeneralContact::ReplaceRepresentativeTrianglesBVH(const Box3D& box, ArrayIndex& items) const
+{
+	Index minIndex = globalContactIndexOffsets[trigsRigidBodyBasedIndex];
+	Index maxIndex = globalContactIndexOffsets[trigsRigidBodyBasedIndex + 1];
+
+	//remove representative triangles and store their rigid bodies:
+	ArrayIndex rigidBodiesFound;
+	Index n = 0;
+	for (Index gi : items)
+	{
+		if (gi >= minIndex && gi < maxIndex)
+		{
+			rigidBodiesFound.Append(trigsRigidBodyBased[gi - minIndex].contactRigidBodyIndex);
+		}
+		else
+		{
+			items[n++] = gi;
+		}
+	}
+	items.SetNumberOfItems(n);
+
+	for (Index rigidIndex : rigidBodiesFound)
+	{
+		const ContactRigidBodyMarkerBased& rigid = rigidBodyMarkerBased[rigidIndex];
+		Matrix3D AT = rigid.orientation.GetTransposed();
+		AddTrianglesInBoxBVH(rigidIndex, ContactHelper::TransformedBox(box, AT, -(AT * rigid.position)), items, minIndex);
+	}
+}
+
 //+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
 //+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
 //+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
@@ -955,6 +1207,11 @@ void GeneralContact::ComputeContactMarkerBasedSpheres(TemporaryComputationDataAr
 		{
 			contactObjects = allActiveContacts[gi];
 		}
+		else if (sphereNeighborsValid)
+		{
+			//candidates from neighbor lists, valid as long as spheres moved less than half of skin:
+			contactObjects = sphereNeighbors[(Index)i];
+		}
 		else
 		{
 			contactObjects = addedObjects[threadID];
@@ -1396,9 +1653,28 @@ void GeneralContact::ComputeContactTrigsRigidBodyBased(TemporaryComputationDataA
 		{
 			//CASE 2: compute new contact objects
 			contactObjects = addedObjects[threadID];
-			//determine potential contacts using bounding boxes, only finding triangles!:
-			searchTree.GetSingleItemsInBoxMaxMinIndex(allBoundingBoxes[gi], *contactObjects, *addedObjectsFlags[threadID],
-				allBoundingBoxes, maxIndex, minIndex);
+			if (!settings.trianglesBVH)
+			{
+				//determine potential contacts using bounding boxes, only finding triangles!:
+				searchTree.GetSingleItemsInBoxMaxMinIndex(allBoundingBoxes[gi], *contactObjects, *addedObjectsFlags[threadID],
+					allBoundingBoxes, maxIndex, minIndex);
+			}
+			else
+			{
+				//search tree only contains rigid bodies; find triangles in body coordinates:
+				ArrayIndex& rigidBodiesFound = *foundRigidBodiesTrianglesBVH[threadID];
+				searchTree.GetSingleItemsInBoxMaxMinIndex(allBoundingBoxes[gi], rigidBodiesFound, *addedObjectsFlags[threadID],
+					allBoundingBoxes, maxIndex, minIndex);
+				contactObjects->SetNumberOfItems(0);
+				for (Index gj : rigidBodiesFound)
+				{
+					Index rigidIndex = trigsRigidBodyBased[gj - minIndex].contactRigidBodyIndex;
+					const ContactRigidBodyMarkerBased& rigid = rigidBodyMarkerBased[rigidIndex];
+					Matrix3D AT = rigid.orientation.GetTransposed();
+					Box3D localBox = ContactHelper::TransformedBox(allBoundingBoxes[gi], AT, -(AT * rigid.position));
+					AddTrianglesInBoxBVH(rigidIndex, localBox, *contactObjects, minIndex);
+				}
+			}
 
 			foundTrianglesRigidBodyBased[threadID]->SetNumberOfItems(0);          //stored data of found triangles
 			foundPlanesTrianglesRigidBodyBased[threadID]->SetNumberOfItems(0);    //local index in foundTrianglesRigidBodyBased
@@ -2454,6 +2730,7 @@ Index GeneralContact::GetItemsInBox(const Box3D& box,
 	ResizableArray<bool>& tempIndexFlags = *(addedObjectsFlags[0]); //thread 0 always exists
 
 	searchTree.GetSingleItemsInBox(box, tempArray, tempIndexFlags);
+	if (settings.trianglesBVH) { ReplaceRepresentativeTrianglesBVH(box, tempArray); }
 
 	ArrayIndex* listArrays[(Index)Contact::IndexEndOfEnumList];
 	listArrays[Contact::IndexSpheresMarkerBased] = &arrayMarkerBasedSpheres;
@@ -2557,6 +2834,59 @@ bool GeneralContact::ShortestDistanceAlongLine(const Vector3D& pStart, const Vec
 	//Vector2D pStartDir2D({ pStartDir[0], pStartDir[1] });
 	Vector2D dir2D0({ dir0[0], dir0[1] });
 
+	//exact test of line with triangle; updates found values if closer intersection is found
+	auto TestTriangleAlongLine = [&](Index localIndex)
+	{
+		std::array<Vector3D, 3> trigPoints; //global triangle points
+
+		const ContactTriangleRigidBodyBased& trigJ = trigsRigidBodyBased[localIndex];
+		const ContactRigidBodyMarkerBased& rigid = rigidBodyMarkerBased[trigJ.contactRigidBodyIndex];
+
+		//compute global points
+		for (Index k = 0; k < (Index)trigPoints.size(); k++)
+		{
+			trigPoints[k] = rigid.orientation * trigJ.points[k] + rigid.position;
+		}
+
+		Vector3D nPlane = HGeometry::ComputeTriangleNormal(trigPoints);
+		Real relativeDistance; //this is the distance from pStart to cutting point
+		bool rv = HGeometry::LinePlaneIntersection(trigPoints[0], nPlane, pStart, dir0, relativeDistance);
+		Vector3D pp = pStart + relativeDistance * dir0; //point in plane
+		//pout << "index=" << localIndex << ", pp=" << pp << ", dist=" << relativeDistance 
+		//	<< ", fd=" << foundDistance
+		//	<< ", min=" << minDistance
+		//	<< ", max=" << maxDistance
+		//	<< "\n";
+
+		if (rv && relativeDistance >= minDistance && relativeDistance < foundDistance) //only if not parallel
+		{
+			Vector3D pp = pStart + relativeDistance * dir0; //point in plane
+			Real lam1, lam2; //relative triangle coordinates
+			Vector3D e1 = trigPoints[1] - trigPoints[0];
+			Vector3D e2 = trigPoints[2] - trigPoints[0];
+
+			HGeometry::LocalTriangleCoordinates(e1, e2, pp - trigPoints[0], lam1, lam2);
+			//check if pp is inside triangle or on edges
+			const Real& TOL = settings.tolEquivalentPoints;
+			bool inside = (lam1 >= -TOL) && (lam2 >= -TOL) && (lam1 + lam2 <= (1. + TOL));
+			//pout << "index=" << localIndex << ", dist=" << relativeDistance << "  lam1=" << lam1 << ", lam2=" << lam2
+			//	<< ", in=" << inside << "\n";
+
+			if (inside)
+			{
+				foundLocalIndex = localIndex;
+				foundTypeIndex = Contact::IndexTrigsRigidBodyBased;
+				foundDistance = relativeDistance;
+
+				Vector3D relPos = (trigPoints[0] + lam1 * e1 + lam2 * e2) - rigid.position;
+				Vector3D velocity = rigid.velocity + (rigid.orientation * rigid.angularVelocity).CrossProduct(relPos);
+				foundVelocityAlongLine = dir0 * velocity;
+			}
+
+		}
+	};
+	ArrayIndex rigidBodiesDoneBVH; //in case of trianglesBVH, each rigid body is only searched once
+
 	for (Index i = 0; i <= nSteps; i++) 
 	{
 		Vector3D p0 = pStart + dir0 * (minDistCells+(Real)(startIndex+i)*stepSize*(1. + 1e-7)); //enlarge slightly
@@ -2613,54 +2943,27 @@ bool GeneralContact::ShortestDistanceAlongLine(const Vector3D& pStart, const Vec
 			}
 			else if (typeIndex == Contact::IndexTrigsRigidBodyBased &&
 				(selectedTypeIndex == Contact::IndexEndOfEnumList || selectedTypeIndex == Contact::IndexTrigsRigidBodyBased)) 
-
 			{
-				std::array<Vector3D, 3> trigPoints; //global triangle points
-
-				const ContactTriangleRigidBodyBased& trigJ = trigsRigidBodyBased[localIndex];
-				const ContactRigidBodyMarkerBased& rigid = rigidBodyMarkerBased[trigJ.contactRigidBodyIndex];
-
-				//compute global points
-				for (Index k = 0; k < (Index)trigPoints.size(); k++)
+				if (!settings.trianglesBVH)
 				{
-					trigPoints[k] = rigid.orientation * trigJ.points[k] + rigid.position;
+					TestTriangleAlongLine(localIndex);
 				}
-
-				Vector3D nPlane = HGeometry::ComputeTriangleNormal(trigPoints);
-				Real relativeDistance; //this is the distance from pStart to cutting point
-				bool rv = HGeometry::LinePlaneIntersection(trigPoints[0], nPlane, pStart, dir0, relativeDistance);
-				Vector3D pp = pStart + relativeDistance * dir0; //point in plane
-				//pout << "index=" << localIndex << ", pp=" << pp << ", dist=" << relativeDistance 
-				//	<< ", fd=" << foundDistance
-				//	<< ", min=" << minDistance
-				//	<< ", max=" << maxDistance
-				//	<< "\n";
-
-				if (rv && relativeDistance >= minDistance && relativeDistance < foundDistance) //only if not parallel
+				else if (IsRepresentativeTriangleBVH(localIndex)) //box of whole rigid body; search triangles in body coordinates
 				{
-					Vector3D pp = pStart + relativeDistance * dir0; //point in plane
-					Real lam1, lam2; //relative triangle coordinates
-					Vector3D e1 = trigPoints[1] - trigPoints[0];
-					Vector3D e2 = trigPoints[2] - trigPoints[0];
-
-					HGeometry::LocalTriangleCoordinates(e1, e2, pp - trigPoints[0], lam1, lam2);
-					//check if pp is inside triangle or on edges
-					const Real& TOL = settings.tolEquivalentPoints;
-					bool inside = (lam1 >= -TOL) && (lam2 >= -TOL) && (lam1 + lam2 <= (1. + TOL));
-					//pout << "index=" << localIndex << ", dist=" << relativeDistance << "  lam1=" << lam1 << ", lam2=" << lam2
-					//	<< ", in=" << inside << "\n";
-
-					if (inside)
+					Index rigidIndex = trigsRigidBodyBased[localIndex].contactRigidBodyIndex;
+					if (rigidBodiesDoneBVH.GetIndexOfItem(rigidIndex) == EXUstd::InvalidIndex)
 					{
-						foundLocalIndex = localIndex;
-						foundTypeIndex = typeIndex;
-						foundDistance = relativeDistance;
-
-						Vector3D relPos = (trigPoints[0] + lam1 * e1 + lam2 * e2) - rigid.position;
-						Vector3D velocity = rigid.velocity + (rigid.orientation * rigid.angularVelocity).CrossProduct(relPos);
-						foundVelocityAlongLine = dir0 * velocity;
+						rigidBodiesDoneBVH.Append(rigidIndex);
+						const ContactRigidBodyMarkerBased& rigid = rigidBodyMarkerBased[rigidIndex];
+						Vector3D localStart;
+						Vector3D localDir;
+						EXUmath::MultMatrixTransposedVectorTemplate(rigid.orientation, pStart - rigid.position, localStart);
+						EXUmath::MultMatrixTransposedVectorTemplate(rigid.orientation, dir0, localDir);
+
+						ArrayIndex trianglesFound;
+						AddTrianglesAlongLineBVH(rigidIndex, localStart, localDir, minDistance, foundDistance, trianglesFound);
+						for (Index j : trianglesFound) { TestTriangleAlongLine(j); }
 					}
-
 				}
 			}
 			else if (typeIndex == Contact::IndexANCFCable2D && 
@@ -25,7 +25,9 @@
 
 #include "Linalg/BasicLinalg.h"		//includes basic classes, all basic arrays and vectors
 #include "Linalg/SearchTree.h"
+#include "Linalg/BoundingVolumeHierarchy.h"
 #include "Main/TemporaryComputationData.h"
+#include "Main/StateCheckpoint.h"
 
 #include "Objects/CObjectANCFCable2DBase.h"
 
@@ -227,9 +229,14 @@ public:
 	Vector3D searchTreeBoxMinInit;					//!< initialization for searchTree box
 	Vector3D searchTreeBoxMaxInit;					//!< initialization for searchTree box
 	Index resetSearchTreeInterval;					//!< number of iterations after which the search tree is re-created
+	bool searchTreeAdaptive;						//!< if true, search tree box and cells are adapted to bounding boxes at every search tree update; searchTreeSizeInit and searchTreeBox are then only used initially
+	Real searchTreeAdaptiveCellSizeFactor;			//!< in adaptive mode, cell size is this factor times median size of bounding boxes
+	Index searchTreeAdaptiveMaxCells;				//!< in adaptive mode, cell size is increased such that total number of cells does not exceed this value
+	bool trianglesBVH;								//!< if true, triangles of every rigid body are searched in a bounding volume hierarchy in body coordinates, and only one box per rigid body is added to searchTree
 
 	bool sphereSphereContact;						//!< if false, contact between spheres is deactivated
 	bool sphereSphereFrictionRecycle;				//!< if true, static friction force is recycled from previous PostNewton step, which greatly improves convergence but may behave unphysically
+	Real sphereSphereNeighborListSkin;				//!< if > 0, candidate sphere-sphere pairs are stored in neighbor lists using sphere bounding boxes enlarged by half of this distance; lists are only rebuilt if a sphere moved more than half of this distance
 	Real frictionProportionalZone;					//!< regularization for friction (m/s); global for all contacts
 	Real frictionVelocityPenalty;					//!< regularization for friction (N/(m^2*m/s) ); global for all contacts
 	Real minRelDistanceSpheresTriangles;			//!< minimum relative distance between spheres and triangles, below that there is no contact computation
@@ -255,9 +262,14 @@ public:
 		searchTreeBoxMinInit = Vector3D(EXUstd::MAXREAL);
 		searchTreeBoxMaxInit = Vector3D(EXUstd::LOWESTREAL);
 		resetSearchTreeInterval = 10000;
+		searchTreeAdaptive = false;
+		searchTreeAdaptiveCellSizeFactor = 1.;
+		searchTreeAdaptiveMaxCells = 1000000;
+		trianglesBVH = false;
 
 		sphereSphereContact = true;
 		sphereSphereFrictionRecycle = false;
+		sphereSphereNeighborListSkin = 0.;
 		frictionProportionalZone = 0.001;
 		frictionVelocityPenalty = 1e3;
 
@@ -340,6 +352,17 @@ protected:
 	SearchTree searchTree;											//!< search tree containing all contact objects
 	Index searchTreeUpdateCounter;									//!< number of search tree updates; used to reset tree after specific number of updates
 
+	//! only used if settings.trianglesBVH=true:
+	std::vector<BoundingVolumeHierarchy> trianglesBVH;				//!< per rigidBodyMarkerBased: hierarchy of triangle boxes in body coordinates; items are local indices in trianglesBVHtrigs range of rigid body
+	ArrayIndex trianglesBVHstart;									//!< triangles of rigid body i are trianglesBVHtrigs[trianglesBVHstart[i]] ... trianglesBVHtrigs[trianglesBVHstart[i+1]-1]
+	ArrayIndex trianglesBVHtrigs;									//!< local indices of trigsRigidBodyBased, sorted by rigid bodies; first triangle of each rigid body represents the rigid body in searchTree
+	bool trianglesBVHvalid;											//!< false, if hierarchies need to be rebuilt, e.g., after FinalizeContact or changed triangles
+
+	//! only used if settings.sphereSphereNeighborListSkin > 0:
+	ResizableArray<ArrayIndex*> sphereNeighbors;					//!< per sphere: global indices of candidate spheres (including own index and larger indices), found with enlarged bounding boxes
+	ResizableArray<Vector3D> sphereNeighborsPositions;				//!< sphere positions at last build of sphereNeighbors
+	bool sphereNeighborsValid;										//!< false, if neighbor lists need to be rebuilt, e.g., after FinalizeContact or changed spheres
+
 	ArrayIndex globalContactIndexOffsets;							//!< offsets corresponding to contact lists (allBoundingBoxes;allActiveContacts)
 	//the followoing lists follow the globalContactIndices:
 	ResizableArray<Box3D> allBoundingBoxes;							//!< contains all bounding boxes, with global contact object index
@@ -359,6 +382,7 @@ protected:
 	ResizableArray<ResizableArray<ContactTrianglesRigidBodyBasedTemp>*> foundTrianglesRigidBodyBased; //!< array used to classify found triangles
 	ResizableArray<ArrayIndex*> foundPlanesTrianglesRigidBodyBased;			//!< indices of plane triangles; used to exclude edges coinciding with planes
 	ResizableArray<ArrayIndex*> foundEdgesTrianglesRigidBodyBased;			//!< indices of edge triangles; used to exclude edges with same projected points
+	ResizableArray<ArrayIndex*> foundRigidBodiesTrianglesBVH;				//!< representative triangles found in searchTree, if settings.trianglesBVH=true
 	//
 
     //used by functions called directly via Python interface
@@ -421,6 +445,16 @@ public:
 	//! get total number of jacobians; only available after FinalizeContact!
 	Index TotalJacobians() const { return globalJacobianIndexOffsets.Last(); }
 
+	//! write contact active sets (active contacts and according friction data) into state checkpoint
+	void WriteStateCheckpoint(ExuFile::BinaryBufferWriter& writer) const;
+
+	//! read contact active sets from state checkpoint into temporary arrays and check number of contact objects and contact indices; does not change contact
+	void ReadStateCheckpoint(ExuFile::BinaryBufferReader& reader, std::vector<ArrayIndex>& activeContacts,
+		std::vector<ResizableArray<Vector3D>>& activeContactsVector) const;
+
+	//! set contact active sets read with ReadStateCheckpoint
+	void SetStateCheckpoint(const std::vector<ArrayIndex>& activeContacts, const std::vector<ResizableArray<Vector3D>>& activeContactsVector);
+
 	//**ICI individual contact implementation
 	const ResizableArray<ContactSpheresMarkerBased>& GetSpheresMarkerBased() const { return spheresMarkerBased; }
 	const ResizableArray<ContactANCFCable2D>& GetANCFCable2D() const { return ancfCable2D; }
@@ -478,6 +512,34 @@ public:
 	void ComputeDataAndBBtrigsRigidBodyBased(const CSystemData& systemData, TemporaryComputationDataArray& tempArray,
 		Index nThreads, bool updateBoundingBoxes);
 
+	//! return true, if sphere neighbor lists are invalid or any sphere moved more than half of sphereSphereNeighborListSkin since last build
+	bool SphereNeighborsNeedUpdate() const;
+
+	//! build neighbor lists of spheres from search tree, using current (enlarged) bounding boxes
+	void BuildSphereNeighbors(Index nThreads);
+
+	//! delete neighbor lists of spheres
+	void DeleteSphereNeighbors();
+
+	//! build bounding volume hierarchies of triangles per rigid body in body coordinates and clear bounding boxes of triangles
+	void BuildTrianglesBVH();
+
+	//! return true, if local triangle index represents rigid body in searchTree in case of settings.trianglesBVH
+	bool IsRepresentativeTriangleBVH(Index localIndex) const
+	{
+		Index rigidIndex = trigsRigidBodyBased[localIndex].contactRigidBodyIndex;
+		return trianglesBVHtrigs[trianglesBVHstart[rigidIndex]] == localIndex;
+	}
+
+	//! add local triangle indices plus indexOffset of rigid body, for which triangle bounding boxes intersect with box given in body coordinates
+	void AddTrianglesInBoxBVH(Index rigidIndex, const Box3D& localBox, ArrayIndex& items, Index indexOffset) const;
+
+	//! add local triangle indices of rigid body, for which triangle bounding boxes are hit by line p + t*dir, t in [tMin, tMax], given in body coordinates
+	void AddTrianglesAlongLineBVH(Index rigidIndex, const Vector3D& p, const Vector3D& dir, Real tMin, Real tMax, ArrayIndex& items) const;
+
+	//! replace representative triangles (global index) in items by triangles of rigid body intersecting global box; only for settings.trianglesBVH
+	void ReplaceRepresentativeTrianglesBVH(const Box3D& box, ArrayIndex& items) const;
+
 	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
 
 	enum ComputeContactMode { CCactiveSets = 1 << 0, CCode2rhsFull = 1 << 1, CCode2rhsFromActiveSets = 1 << 2 };
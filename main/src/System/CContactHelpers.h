@@ -98,6 +98,20 @@ namespace ContactHelper
 		return false;
 	}
 
+	//! compute axis aligned box containing box b transformed by x -> A*x + p, e.g., from body to global coordinates
+	inline Box3D TransformedBox(const Box3D& b, const Matrix3D& A, const Vector3D& p)
+	{
+		if (b.Empty()) { return Box3D(); }
+		Vector3D center = A * b.Center() + p;
+		Vector3D halfSize = 0.5*(b.PMax() - b.PMin());
+		Vector3D newHalfSize;
+		for (Index i = 0; i < 3; i++)
+		{
+			newHalfSize[i] = fabs(A(i, 0))*halfSize[0] + fabs(A(i, 1))*halfSize[1] + fabs(A(i, 2))*halfSize[2];
+		}
+		return Box3D(center - newHalfSize, center + newHalfSize);
+	}
+
 	//! compute approximate contact segments for ANCF cable element
 	void ComputeContactSegmentsANCFcableCircleContactApprox(const ConstSizeVector<DANCFmaxCoordinates>& q, Real L, Real halfHeight,
 		const Vector2D& circlePos, Real r, 
@@ -58,6 +58,9 @@ public: //
   //! determine if load has user function, used for Static computations, avoiding to conflict between load user function and loadFactor
   virtual bool HasUserFunction() const { CHECKandTHROWstring("ERROR: illegal call to CLoad::IsVector"); return false; }
 
+  //! function to be overwritten, if load user function may be evaluated in multithreaded computation (e.g., compiled symbolic user function)
+  virtual bool HasThreadSafeUserFunction() const { return false; }
+
   //! Read (Reference) access to: general load vector (e.g. force or torque) as a function of time; used if LoadType::IsVector = 1
   virtual Vector3D GetLoadVector(const MainSystemBase& mbs, Real t) const { CHECKandTHROWstring("ERROR: illegal call to CLoad::GetLoadVector(Real t) const"); Vector3D* v = new Vector3D(0.); return *v;
   }
@@ -119,6 +119,9 @@ public:
 	//! function to be overwritten, if object has user function
 	virtual bool HasUserFunction() const { return false; }
 
+	//! function to be overwritten, if all computation user functions of object may be evaluated in multithreaded computation (e.g., compiled symbolic user functions)
+	virtual bool HasThreadSafeUserFunction() const { return false; }
+
     // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
     // SYSTEM FUNCTIONS
     // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
@@ -183,6 +186,18 @@ public:
 	virtual void ComputeJacobianODE2_ODE2(EXUmath::MatrixContainer& jacobianODE2, JacobianTemp& temp, Real factorODE2, Real factorODE2_t,
 		Index objectNumber, const ArrayIndex& ltg) const {CHECKandTHROWstring("ERROR: illegal call to CObject::ComputeJacobianODE2_ODE2");}
 
+	//! return true, if the complete ODE2 jacobian (w.r.t. ODE2 and ODE2_t) is constant; then it is computed once and cached by CSystem;
+	//! for connectors, CSystem additionally requires markers with constant jacobians (MarkerNodeCoordinate)
+	virtual bool HasConstantJacobianODE2() const { return false; }
+
+	//! return true, if object has constant parts in its ODE2 jacobian, which are provided by ComputeJacobianODE2_ODE2ConstantPart(...);
+	//! while cSystemData->excludeConstantJacobianODE2Parts is set (during jacobian computation), ComputeODE2LHS(...) must exclude these parts
+	virtual bool HasConstantJacobianODE2Part() const { return false; }
+
+	//! compute constant part of ODE2 jacobian, using the same conventions as ComputeJacobianODE2_ODE2(...)
+	virtual void ComputeJacobianODE2_ODE2ConstantPart(EXUmath::MatrixContainer& jacobianODE2, JacobianTemp& temp, Real factorODE2, Real factorODE2_t,
+		Index objectNumber, const ArrayIndex& ltg) const { CHECKandTHROWstring("ERROR: illegal call to CObject::ComputeJacobianODE2_ODE2ConstantPart"); }
+
     //! compute derivative of algebraic equations w.r.t. ODE2 in jacobian_ODE2 [and w.r.t. ODE2_t coordinates in jacobian_ODE2_t if flag ODE2_t_AE_function is set] [and w.r.t. ODE1 coordinates in jacobian_ODE1 if flag ODE1_AE_function is set] [and w.r.t. AE coordinates if flag AE_AE_function is set in GetAvailableJacobians()]; jacobian[_t] has dimension GetAlgebraicEquationsSize() x GetODE2Size(); q are the system coordinates
     virtual void ComputeJacobianAE(ResizableMatrix& jacobian_ODE2, ResizableMatrix& jacobian_ODE2_t, ResizableMatrix& jacobian_ODE1, ResizableMatrix& jacobian_AE) const { CHECKandTHROWstring("ERROR: illegal call to CObject::ComputeJacobianAE"); }
 
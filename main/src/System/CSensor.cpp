@@ -53,9 +53,24 @@ py::object MainSensor::GetSensorValues(const CSystemData& cSystemData, Configura
 
 }
 
-py::array_t<Real> MainSensor::GetInternalStorage()
+py::array_t<Real> MainSensor::GetInternalStorage(bool copy)
 {
-	return EPyUtils::Matrix2NumPy(GetCSensor()->GetInternalStorage());
+	SensorStorageView view = GetCSensor()->GetSensorInternalStorage().GetView(); //consistent snapshot, also if solver runs in other thread
+	if (copy || view.NumberOfRows() == 0)
+	{
+		return EPyUtils::Matrix2NumPy(view.GetMatrix());
+	}
+
+	//zero-copy view: capsule holds shared buffer, such that data stays valid if storage grows, is reset or sensor is deleted;
+	//stored rows are never modified by the solver; further rows are not visible in this view
+	auto* owner = new std::shared_ptr<const ResizableMatrix>(view.GetBuffer());
+	py::capsule base(owner, [](void* p) { delete reinterpret_cast<std::shared_ptr<const ResizableMatrix>*>(p); });
+	Index nColumns = view.NumberOfColumns();
+	py::array_t<Real> pyView(std::vector<std::ptrdiff_t>{ (std::ptrdiff_t)view.NumberOfRows(), (std::ptrdiff_t)nColumns },
+		std::vector<std::ptrdiff_t>{ (std::ptrdiff_t)(nColumns * sizeof(Real)), (std::ptrdiff_t)sizeof(Real) },
+		view.GetDataPointer(), base);
+	py::detail::array_proxy(pyView.ptr())->flags &= ~py::detail::npy_api::NPY_ARRAY_WRITEABLE_; //read-only, as data is shared
+	return pyView;
 }
 
 
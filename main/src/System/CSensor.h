@@ -22,12 +22,138 @@
 #include "Linalg/BasicLinalg.h"
 
 #include "Main/OutputVariable.h"
+#include <memory> //for shared_ptr
+#include <atomic>
+#include <mutex>
 
+//! consistent read-only snapshot of rows stored in SensorInternalStorage; keeps the buffer alive,
+//! such that it can be used in any thread (e.g. Python or visualization thread while the solver appends rows)
+class SensorStorageView
+{
+	std::shared_ptr<const ResizableMatrix> buffer; //!< buffer containing at least numberOfRows valid rows
+	Index numberOfRows;
+public:
+	SensorStorageView(const std::shared_ptr<const ResizableMatrix>& bufferInit, Index numberOfRowsInit) :
+		buffer(bufferInit), numberOfRows(numberOfRowsInit) {}
+
+	Index NumberOfRows() const { return numberOfRows; }
+	Index NumberOfColumns() const { return buffer->NumberOfColumns(); }
+	const Real* GetDataPointer() const { return buffer->GetDataPointer(); }
+	Real operator()(Index row, Index column) const { return (*buffer)(row, column); }
+	//! stored rows as matrix; only valid as long as this view exists
+	LinkedDataMatrix GetMatrix() const { return LinkedDataMatrix(buffer->GetDataPointer(), numberOfRows, NumberOfColumns()); }
+	//! buffer for zero-copy views, which must keep the buffer alive
+	const std::shared_ptr<const ResizableMatrix>& GetBuffer() const { return buffer; }
+};
+
+//! internal storage of sensor values in rows (time, sensor values); memory is reserved in advance and grows in chunks;
+//! rows are appended by the solver thread, while other threads (Python thread of a solver running without GIL, visualization)
+//! may read consistent snapshots (GetView) at any time:
+//! - rows are written into a buffer with fixed capacity, which is never resized; the row count is published afterwards (release/acquire)
+//! - if the storage grows, is reset while views exist or is replaced, a new buffer is swapped in under a mutex; views keep the previous one alive
+class SensorInternalStorage
+{
+public:
+	static constexpr Index minChunkRows = 1024; //!< minimum number of rows added if storage grows
+	static constexpr Index maxReservedSize = 1 << 20; //!< maximum number of Reals reserved in advance (8MB); storage grows in chunks beyond
+private:
+	std::shared_ptr<ResizableMatrix> buffer;	//!< rows x columns = capacity; only first numberOfRows rows are valid; never nullptr; swapped under bufferMutex
+	std::atomic<Index> numberOfRows;			//!< number of valid rows, published after row is written
+	Index numberOfRowsPlanned = 0;				//!< rows reserved at first AppendRow, when the number of columns is known
+	mutable std::mutex bufferMutex;				//!< protects pair (buffer, numberOfRows) when buffer is swapped or read by GetView()
+
+	//! swap in new buffer with nRows valid rows
+	void SetBuffer(const std::shared_ptr<ResizableMatrix>& newBuffer, Index nRows)
+	{
+		std::lock_guard<std::mutex> lock(bufferMutex);
+		buffer = newBuffer;
+		numberOfRows.store(nRows, std::memory_order_release);
+	}
+
+	//! create buffer with capacity rows and copy first nRows rows of given data
+	static std::shared_ptr<ResizableMatrix> NewBuffer(Index capacity, Index nColumns, const Real* data, Index nRows)
+	{
+		std::shared_ptr<ResizableMatrix> newBuffer = std::make_shared<ResizableMatrix>(capacity, nColumns);
+		Real* newData = newBuffer->GetDataPointer();
+		for (Index i = 0; i < nRows * nColumns; i++)
+		{
+			newData[i] = data[i];
+		}
+		return newBuffer;
+	}
+public:
+	SensorInternalStorage() : buffer(std::make_shared<ResizableMatrix>()), numberOfRows(0) {}
+	//! copy creates independent storage
+	SensorInternalStorage(const SensorInternalStorage& other) : numberOfRows(0) { *this = other; }
+	SensorInternalStorage& operator=(const SensorInternalStorage& other)
+	{
+		if (this == &other) { return *this; }
+		SensorStorageView view = other.GetView();
+		numberOfRowsPlanned = other.numberOfRowsPlanned;
+		SetBuffer(NewBuffer(view.NumberOfRows(), view.NumberOfColumns(), view.GetDataPointer(), view.NumberOfRows()), view.NumberOfRows());
+		return *this;
+	}
+
+	//! consistent snapshot of stored rows; can be called from any thread
+	SensorStorageView GetView() const
+	{
+		std::lock_guard<std::mutex> lock(bufferMutex);
+		return SensorStorageView(buffer, numberOfRows.load(std::memory_order_acquire));
+	}
+
+	//! number of stored rows; can be called from any thread
+	Index NumberOfRows() const { return numberOfRows.load(std::memory_order_acquire); }
+
+	//! remove all rows; memory for numberOfRowsPlannedInit rows is reserved with the first row
+	void Reset(Index numberOfRowsPlannedInit)
+	{
+		numberOfRowsPlanned = numberOfRowsPlannedInit;
+		std::lock_guard<std::mutex> lock(bufferMutex);
+		if (buffer.use_count() > 1) //views must not see overwritten data
+		{
+			buffer = std::make_shared<ResizableMatrix>();
+		}
+		numberOfRows.store(0, std::memory_order_release);
+	}
+
+	//! replace stored rows by copy of data (nRows x nColumns), e.g., to restore data from state checkpoint
+	void SetData(const Real* data, Index nRows, Index nColumns)
+	{
+		SetBuffer(NewBuffer(nRows, nColumns, data, nRows), nRows);
+	}
+
+	//! append row containing time and sensor values; number of values must not change; only called by the thread running the solver
+	void AppendRow(Real time, const Vector& values)
+	{
+		Index nColumns = values.NumberOfItems() + 1;
+		Index nRows = numberOfRows.load(std::memory_order_relaxed); //only changed by this thread
+		CHECKandTHROW(nRows == 0 || buffer->NumberOfColumns() == nColumns, "SensorInternalStorage::AppendRow: number of sensor values changed");
+		if (nRows == buffer->NumberOfRows() || buffer->NumberOfColumns() != nColumns)
+		{
+			//grow by at least minChunkRows, doubling the size for large storage; old data is copied only once per chunk
+			Index capacity = (nRows == 0) ? 0 : buffer->NumberOfRows();
+			Index newCapacity = capacity + EXUstd::Maximum(capacity, minChunkRows);
+			if (nRows == 0)
+			{
+				std::int64_t reservedRows = EXUstd::Minimum((std::int64_t)numberOfRowsPlanned, (std::int64_t)(maxReservedSize / nColumns));
+				newCapacity = EXUstd::Maximum(newCapacity, (Index)reservedRows);
+			}
+			SetBuffer(NewBuffer(newCapacity, nColumns, buffer->GetDataPointer(), nRows), nRows); //old buffer is deleted, if no views exist
+		}
+		Real* row = buffer->GetDataPointer() + nRows * nColumns;
+		row[0] = time;
+		for (Index i = 1; i < nColumns; i++)
+		{
+			row[i] = values[i - 1];
+		}
+		numberOfRows.store(nRows + 1, std::memory_order_release); //publish row
+	}
+};
 
 class CSensor
 {
 protected: 
-	ResizableMatrix internalStorage; //!< resizable matrix for internal storage of sensor values; automatically resized by solver
+	SensorInternalStorage internalStorage; //!< internal storage of sensor values; automatically resized by solver
 public: 
 	virtual ~CSensor() {} //added for correct deletion of derived classes
 
@@ -118,11 +244,14 @@ public:
 		return false;
 	}
 
-	//! read access to internal storage
-	virtual const ResizableMatrix& GetInternalStorage() const { return internalStorage; }
+	//! read access to internal storage; consistent snapshot, which may be used in any thread
+	virtual SensorStorageView GetInternalStorage() const { return internalStorage.GetView(); }
 
 	//! write access to internal storage
-	virtual ResizableMatrix& GetInternalStorage() { return internalStorage; }
+	virtual SensorInternalStorage& GetSensorInternalStorage() { return internalStorage; }
+
+	//! shared access to internal storage, for zero-copy views
+	virtual const SensorInternalStorage& GetSensorInternalStorage() const { return internalStorage; }
 
 	//! directory and file name for sensor file output
 	virtual STDstring GetFileName() const {
@@ -61,8 +61,9 @@ public:
 	//! GetSensorOutput with configuration; copies values==>slow!; can be scalar or vector-valued! maps to CSensor GetSensorValues(...)
 	virtual py::object GetSensorValues(const CSystemData& cSystemData, ConfigurationType configuration = ConfigurationType::Current) const;
 
-	//! get stored internal sensor data (Matrix containing time and sensor values in rows)
-	virtual py::array_t<Real>  GetInternalStorage();
+	//! get stored internal sensor data (Matrix containing time and sensor values in rows);
+	//! if copy=false, a read-only numpy view of the currently stored rows is returned, which keeps the data alive (no copy)
+	virtual py::array_t<Real>  GetInternalStorage(bool copy = true);
 
 	//! Get (read) parameter 'parameterName' via pybind / pyhton interface instead of obtaining the whole dictionary with GetDictionary
 	virtual py::object GetParameter(const STDstring& parameterName) const { SysError("Invalid call to MainSensor::GetParameter"); return py::object(); }
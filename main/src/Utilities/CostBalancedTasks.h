@@ -0,0 +1,125 @@
+/** ***********************************************************************************************
+* @file			CostBalancedTasks.h
+* @brief		This file contains a helper class for multithreaded loops over items with heterogeneous costs
+* @details		Details:
+* 				- items (e.g. objects) are grouped into tasks (contiguous ranges of items) of similar estimated cost
+* 				- costs per item are measured with timestamps in the first call and periodically in later calls
+* 				- tasks are processed by the taskmanager in order, idle threads take the next remaining task
+*
+* @date			2026-10-17 (created)
+* @copyright	This file is part of Exudyn. Exudyn is free software: you can redistribute it and/or modify it under the terms of the Exudyn license. See 'LICENSE.txt' for more details.
+* @note			Bug reports, support and further information:
+* 				- email: johannes.gerstmayr@uibk.ac.at
+* 				- weblink: https://github.com/jgerstmayr/EXUDYN
+*
+*
+************************************************************************************************ */
+#ifndef COSTBALANCEDTASKS__H
+#define COSTBALANCEDTASKS__H
+
+#include "Utilities/BasicFunctions.h" //GetTimeInSeconds
+#include "Utilities/ResizableArray.h"
+
+//! split loop over items 0 ... nItems-1 into tasks of similar estimated cost; costs are estimated from previous calls
+class CostBalancedTasks
+{
+public:
+	static constexpr Index measurementPeriod = 20;	//!< costs are measured in first call and then every measurementPeriod calls
+	static constexpr Real averagingFactor = 0.5;	//!< weight of new measurement in exponential averaging of costs
+	static constexpr Real minimumItemCost = 1e-9;	//!< lower limit for item costs, avoids empty tasks for cheap items
+
+private:
+	ResizableArray<Real> itemCosts;		//!< estimated cost (computation time in seconds) per item; negative: not yet measured
+	ArrayIndex taskStart;				//!< task k processes items taskStart[k] ... taskStart[k+1]-1
+	Index callCounter;					//!< number of calls since last reset
+
+public:
+	CostBalancedTasks() : callCounter(0) {}
+
+	//! reset costs and tasks, e.g., after item lists have been rebuilt; costs are measured again in next call
+	void Reset()
+	{
+		itemCosts.SetNumberOfItems(0);
+		taskStart.SetNumberOfItems(0);
+		callCounter = 0;
+	}
+
+	//! number of tasks of last call
+	Index NumberOfTasks() const { return EXUstd::Maximum(taskStart.NumberOfItems() - 1, 0); }
+
+	//! estimated cost of item i
+	Real GetItemCost(Index i) const { return itemCosts[i]; }
+
+	//! run f(i) for all items i in 0 ... nItems-1, grouped into nTasks tasks of similar estimated cost;
+	//! parallelFor(n, g) must call g(k) for all tasks k in 0 ... n-1, possibly in parallel;
+	//! if nItems or nTasks changed, costs are measured again; Reset() must be called if items change without change of nItems
+	template<class TParallelFor, class TFunction>
+	void ParallelFor(Index nItems, Index nTasks, TParallelFor parallelFor, TFunction f)
+	{
+		nTasks = EXUstd::Maximum(1, EXUstd::Minimum(nTasks, nItems));
+		if (itemCosts.NumberOfItems() != nItems || taskStart.NumberOfItems() != nTasks + 1)
+		{
+			itemCosts.SetNumberOfItems(nItems);
+			for (Real& cost : itemCosts) { cost = -1.; }
+			taskStart.SetNumberOfItems(nTasks + 1);
+			for (Index k = 0; k <= nTasks; k++) { taskStart[k] = (Index)(((int64_t)nItems * k) / nTasks); } //equal split
+			callCounter = 0;
+		}
+
+		if (callCounter++ % measurementPeriod == 0)
+		{
+			//one timestamp per item; items are only written by the task processing them
+			parallelFor(nTasks, [this, &f](auto k)
+			{
+				Real t0 = EXUstd::GetTimeInSeconds();
+				for (Index i = taskStart[(Index)k]; i < taskStart[(Index)k + 1]; i++)
+				{
+					f(i);
+					Real t1 = EXUstd::GetTimeInSeconds();
+					Real cost = EXUstd::Maximum(t1 - t0, minimumItemCost);
+					itemCosts[i] = (itemCosts[i] < 0.) ? cost : (1. - averagingFactor) * itemCosts[i] + averagingFactor * cost;
+					t0 = t1;
+				}
+			});
+			ComputeTaskStart();
+		}
+		else
+		{
+			parallelFor(nTasks, [this, &f](auto k)
+			{
+				for (Index i = taskStart[(Index)k]; i < taskStart[(Index)k + 1]; i++)
+				{
+					f(i);
+				}
+			});
+		}
+	}
+
+private:
+	//! compute task ranges such that accumulated costs of items in every task are similar
+	void ComputeTaskStart()
+	{
+		Index nItems = itemCosts.NumberOfItems();
+		Index nTasks = taskStart.NumberOfItems() - 1;
+		Real totalCost = 0.;
+		for (Real cost : itemCosts) { totalCost += cost; }
+
+		Real sum = 0.;
+		Index i = 0;
+		taskStart[0] = 0;
+		for (Index k = 1; k < nTasks; k++)
+		{
+			Real costLimit = totalCost * (Real)k / (Real)nTasks;
+			//item is added to task k-1 if more than half of its cost is below limit
+			while (i < nItems && sum + 0.5 * itemCosts[i] <= costLimit)
+			{
+				sum += itemCosts[i];
+				i++;
+			}
+			taskStart[k] = i;
+		}
+		taskStart[nTasks] = nItems;
+	}
+};
+
+#endif
@@ -51,6 +51,7 @@ namespace ngstd {
 		static int GetThreadId() { return 0; }
 		static void SuspendWorkers(Index asleep_usecs = 1000) {}
 		static void ResumeWorkers() {} // { sleep = false; }
+		static void SetWaitPolicy(Real spinTime, void (*threadStartFunction)(int) = nullptr) {}
 	};
 	typedef Index SizeType;
 	typedef SizeType TotalCosts;
@@ -67,5 +68,17 @@ namespace exuThreading = MicroThreading; //this works better for smaller systems
 namespace exuThreading = ngstd; //NGsolve; this works better for larger systems; much better for contact!
 #endif
 
+//! set time (seconds) that idle workers spin before they are parked (negative: never park) and if workers are pinned to cores;
+//! NGsolve taskmanager receives pinning as thread start function; no effect (NGsolve) or exception (MicroThreading) if workers are running
+inline void SetTaskManagerWaitPolicy(Real spinTime, bool pinThreads)
+{
+#ifdef USE_MICROTHREADING
+	MicroThreading::TaskManager::SetWaitPolicy(spinTime, pinThreads);
+#else
+	void (*pinThread)(int) = [](int threadID) { MicroThreading::SetCurrentThreadAffinity(threadID); };
+	ngstd::TaskManager::SetWaitPolicy(spinTime, pinThreads ? pinThread : nullptr);
+#endif
+}
+
 #endif //PARALLEL__H
 
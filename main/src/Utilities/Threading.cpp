@@ -21,6 +21,20 @@
 #include "Utilities/Parallel.h"
 
 #include <thread> //needed on MacOS, automatic elsewhere
+#include <chrono>
+
+#if defined(__linux__)
+	#include <pthread.h>
+	#include <sched.h>
+#elif defined(_WIN32)
+	#ifndef WIN32_LEAN_AND_MEAN
+		#define WIN32_LEAN_AND_MEAN
+	#endif
+	#ifndef NOMINMAX
+		#define NOMINMAX
+	#endif
+	#include <windows.h>
+#endif
 
 
 #define MEMORY_ORDER_SYNCLOAD std::memory_order_relaxed //on intel same as memory_order_seq_cst?
@@ -43,6 +57,8 @@ namespace MicroThreading
 
 	//bool TaskManager::isRunning = false;
 	thread_local int TaskManager::thread_id;
+	Real TaskManager::spinTime = -1;
+	bool TaskManager::pinThreads = false;
 
 	const std::function<void(TaskInfo&)> * TaskManager::func;
 
@@ -55,6 +71,24 @@ namespace MicroThreading
 //! a very slim and efficient multithreading approach for small loops
 namespace MicroThreading
 {
+	bool SetCurrentThreadAffinity(Index core)
+	{
+		Index nCores = (Index)std::thread::hardware_concurrency();
+		if (nCores <= 0) { return false; }
+		core = core % nCores;
+#if defined(__linux__)
+		cpu_set_t cpuSet;
+		CPU_ZERO(&cpuSet);
+		CPU_SET(core, &cpuSet);
+		return pthread_setaffinity_np(pthread_self(), sizeof(cpu_set_t), &cpuSet) == 0;
+#elif defined(_WIN32)
+		if (core >= 8 * (Index)sizeof(DWORD_PTR)) { return false; } //only first processor group
+		return SetThreadAffinityMask(GetCurrentThread(), (DWORD_PTR)1 << core) != 0;
+#else
+		return false; //e.g. MacOS does not support pinning of threads
+#endif
+	}
+
 	inline Exception::Exception(const std::string & s)
 		: m_what(s)
 	{
@@ -99,6 +133,7 @@ namespace MicroThreading
 		{
 			sync[i]->store(0, MEMORY_ORDER_SYNCSTORE);//sync==0 means that job is ready to be computed
 		}
+		WakeParkedWorkers();
 #endif
 
 #ifdef PRINTDEBUGINFORMATION
@@ -212,7 +247,11 @@ namespace MicroThreading
 
 	inline void TaskManager::StopWorkers()
 	{
-		isRunning = false;
+		{
+			std::lock_guard<std::mutex> lock(parkMutex); //parked workers check isRunning under lock
+			isRunning = false;
+		}
+		parkCondition.notify_all();
 
 		//wait for other threads to stop
 		while (active_workers) { ; }
@@ -224,12 +263,51 @@ namespace MicroThreading
 		}
 	}
 
+	//! notify parked workers after new job or stop
+	inline void TaskManager::WakeParkedWorkers()
+	{
+		//seq_cst: either worker sees new sync value before parking, or main thread sees parked worker
+		if (parkedWorkers.load(std::memory_order_seq_cst))
+		{
+			{
+				std::lock_guard<std::mutex> lock(parkMutex); //worker is either not yet checking or already waiting
+			}
+			parkCondition.notify_all();
+		}
+	}
+
+	//! wait until main thread provides new job or workers are stopped; spins for spinTime, then parks thread
+	inline void TaskManager::WaitForJob(Index threadID)
+	{
+		std::atomic_int& syncThread = *sync[threadID];
+		if (spinTime < 0) //HOT WAIT, lowest latency, but occupies cores also in serial sections
+		{
+			while (syncThread.load(MEMORY_ORDER_SYNCLOAD) && isRunning) { ; }
+			return;
+		}
+
+		auto spinEnd = std::chrono::steady_clock::now() + std::chrono::duration<Real>(spinTime);
+		Index cnt = 0;
+		while (syncThread.load(MEMORY_ORDER_SYNCLOAD) && isRunning)
+		{
+			//check time only occasionally, as it is much slower than checking sync
+			if ((++cnt & 1023) == 0 && std::chrono::steady_clock::now() > spinEnd)
+			{
+				std::unique_lock<std::mutex> lock(parkMutex);
+				parkedWorkers.fetch_add(1, std::memory_order_seq_cst);
+				parkCondition.wait(lock, [&syncThread]() { return !syncThread.load(std::memory_order_seq_cst) || !isRunning; });
+				parkedWorkers.fetch_sub(1, std::memory_order_seq_cst);
+			}
+		}
+	}
+
 	//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
 	//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
 	//this is run on every thread
 	inline void TaskManager::Loop(Index threadID)
 	{
 		thread_id = threadID;
+		if (pinThreads) { SetCurrentThreadAffinity(threadID); }
 #ifdef PRINTDEBUGINFORMATION
 		std::cout << "  start Loop in thread" << thread_id << "\n";
 #endif
@@ -251,12 +329,13 @@ namespace MicroThreading
 			//wait until main thread switches sync to 0, then job is available
 #ifdef USE_FETCHADD
 			while (!syncStart && !stop)
-#else
-			while (sync[thread_id]->load(MEMORY_ORDER_SYNCLOAD) && !stop)
-#endif
 			{
 				stop = !isRunning;// .load(std::memory_order_relaxed); //this is not urgent, as it is only performed at end of many computations
 			}
+#else
+			WaitForJob(thread_id); //spin, then park
+			stop = !isRunning;
+#endif
 #ifdef USE_FETCHADD
 			//int syncOld = syncStart.fetch_sub(1, MEMORY_ORDER_SYNCSTORE); //returns previous sync
 			--syncStart;
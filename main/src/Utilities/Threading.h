@@ -23,6 +23,7 @@
 #include <exception>
 #include <atomic>
 #include <mutex>
+#include <condition_variable>
 #include "Utilities/BasicDefinitions.h"
 #include "Utilities/ResizableArray.h"
 
@@ -31,6 +32,9 @@ namespace MicroThreading {
 	typedef SizeType TotalCosts;
 	extern class TaskManager * task_manager;
 
+	//! pin calling thread to CPU core (modulo number of hardware threads); returns false, if not supported on this platform
+	bool SetCurrentThreadAffinity(Index core);
+
 	class Exception : public std::exception
 	{
 		/// a verbal description of the exception
@@ -179,6 +183,12 @@ namespace MicroThreading {
 		std::atomic_int syncEnd;
 #endif
 
+		static Real spinTime;					//!< time in seconds that idle workers spin for new job before they are parked; negative: never park
+		static bool pinThreads;					//!< if true, worker thread i is pinned to CPU core i
+		std::mutex parkMutex;					//!< mutex for parked workers
+		std::condition_variable parkCondition;	//!< parked workers wait for this condition
+		std::atomic<Index> parkedWorkers;		//!< number of parked workers; main thread only notifies if > 0
+
 	public:
 
 		TaskManager()
@@ -190,7 +200,7 @@ namespace MicroThreading {
 			active_workers = 0;
 			newJob = false;
 			restartLoops = false;
-
+			parkedWorkers = 0;
 		}
 		~TaskManager() 
 		{ 
@@ -209,6 +219,13 @@ namespace MicroThreading {
 			CHECKandTHROW(!isRunning, "SetNumThreads: may only be called if threads are not running");
 			num_threads = numThreadsInit;
 		}
+		//! set time (seconds) that idle workers spin before they are parked (negative: never park) and if workers are pinned to cores
+		static void SetWaitPolicy(Real spinTimeInit, bool pinThreadsInit)
+		{
+			CHECKandTHROW(!isRunning, "SetWaitPolicy: may only be called if threads are not running");
+			spinTime = spinTimeInit;
+			pinThreads = pinThreadsInit;
+		}
 		static Index GetNumThreads() { return num_threads; }
 
 		static Index GetThreadId() { return task_manager ? task_manager->thread_id : 0; }
@@ -218,6 +235,11 @@ namespace MicroThreading {
 
 		void Loop(Index threadID);
 
+	private:
+		//! wait until main thread provides new job or workers are stopped; spins for spinTime, then parks thread
+		void WaitForJob(Index threadID);
+		//! notify parked workers after new job or stop
+		void WakeParkedWorkers();
 	};
 
 	Index EnterTaskManager();
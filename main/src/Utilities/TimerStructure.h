@@ -48,11 +48,11 @@
 
 class TimerStructure;
 extern TimerStructure globalTimers;
-extern std::vector<Real>* globalTimersCounters;
 extern std::vector<const char*>* globalTimersCounterNames;
 
 //!special timer structure to measure time spent at certain parts of code
 //! put a global variable of this class somewhere to allow micro-timing of functions at any place
+//! timer names are registered globally, while counters are stored per thread, such that solvers can run in parallel Python threads
 class TimerStructure
 {
 private:
@@ -60,6 +60,15 @@ private:
 	//std::vector<Real> counters;
 	//std::vector<const char*> counterNames;
 	Real offsetSecondsPerCall;
+
+	//! counters of current thread (solver); resized after registration of timers
+	static std::vector<Real>& Counters()
+	{
+		static thread_local std::vector<Real> counters;
+		size_t numberOfTimers = (globalTimersCounterNames != nullptr) ? globalTimersCounterNames->size() : 0;
+		if (counters.size() != numberOfTimers) { counters.resize(numberOfTimers, 0.); }
+		return counters;
+	}
 public:
 	//! default constructor; DO NOT call Initialize, as TimerStructure may be initialized LATER than first timer is registered!
 	TimerStructure() { offsetSecondsPerCall = 0; };
@@ -75,50 +84,51 @@ public:
 	Index RegisterTimer(const char* name);
 
 	//!get current value of a timer
-	Real GetTiming(Index counterIndex) const { return (*globalTimersCounters)[counterIndex]; }
+	Real GetTiming(Index counterIndex) const { return Counters()[counterIndex]; }
 
 	//!get current value of a timer
 	const char* GetTimerName(Index counterIndex) const { return (*globalTimersCounterNames)[counterIndex]; }
 
 	//!get current value of a timer
-	Index NumberOfTimers() const { return (Index)globalTimersCounters->size(); }
+	Index NumberOfTimers() const { return (Index)Counters().size(); }
 
 	//!reset timers( e.g. before starting simulation):
 	void Reset()
 	{
-		for (auto& item : (*globalTimersCounters)) { item = 0; }
+		for (auto& item : Counters()) { item = 0; }
 	}
 
 	//! set counter to specific value
-	void SetCounter(Index counterIndex, Real value) { (*globalTimersCounters)[counterIndex] = value; }
+	void SetCounter(Index counterIndex, Real value) { Counters()[counterIndex] = value; }
 
 	//! get counter value
-	Real GetCounter(Index counterIndex) { return (*globalTimersCounters)[counterIndex]; }
+	Real GetCounter(Index counterIndex) { return Counters()[counterIndex]; }
 
 	//! start measurement
 	void StartTimer(Index counterIndex)
 	{
-		(*globalTimersCounters)[counterIndex] -= EXUstd::GetTimeInSeconds();
+		Counters()[counterIndex] -= EXUstd::GetTimeInSeconds();
 	}
 
 	//! stop measurement
 	void StopTimer(Index counterIndex)
 	{
-		(*globalTimersCounters)[counterIndex] += EXUstd::GetTimeInSeconds() - offsetSecondsPerCall;
+		Counters()[counterIndex] += EXUstd::GetTimeInSeconds() - offsetSecondsPerCall;
 	}
 
 	//! print current timers into string
 	STDstring ToString() const 
 	{
-		if (!globalTimersCounters->size()) { return ""; }
+		const std::vector<Real>& counters = Counters();
+		if (!counters.size()) { return ""; }
 
 		std::ostringstream ostr;
 		ostr.precision(5); //reduced precision for nicer output...
-		for (Index i = 0; i < (Index)globalTimersCounters->size(); i++)
+		for (Index i = 0; i < (Index)counters.size(); i++)
 		{
-			if ((*globalTimersCounters)[i] != 0.) //exclude timers that are exactly zero:
+			if (counters[i] != 0.) //exclude timers that are exactly zero:
 			{
-				ostr << "  " << (*globalTimersCounterNames)[i] << " = " << (*globalTimersCounters)[i] << "s\n";
+				ostr << "  " << (*globalTimersCounterNames)[i] << " = " << counters[i] << "s\n";
 			}
 		}
 		return ostr.str();
@@ -949,6 +949,11 @@ plr.DefPyFunctionAccess(cClass=classStr, pyName='SendRedrawSignal', cName='SendR
                         returnType='None',
                         )
 
+plr.DefPyFunctionAccess(cClass=classStr, pyName='UpdateGraphicsData', cName='PyUpdateGraphicsData', 
+                        description="Update graphics data of all MainSystems (mbs) in the current thread, without rendering; this is done by the renderer otherwise and can only be used if renderer is not running, e.g., to measure the cost of graphics updates",
+                        returnType='None',
+                        )
+
 plr.DefPyFunctionAccess(cClass=classStr, pyName='GetCurrentMouseCoordinates', cName='PyGetCurrentMouseCoordinates', 
                         description="Get current mouse coordinates as list [x, y]; x and y being floats, as returned by GLFW, measured from top left corner of window; use GetCurrentMouseCoordinates(useOpenGLcoordinates=True) to obtain OpenGLcoordinates of projected plane",
                         argList=['useOpenGLcoordinates'],
@@ -1155,6 +1160,48 @@ plr.DefPyFunctionAccess(cClass=classStr, pyName='SetDictionary', cName='SetDicti
                         returnType='None',
                         )
 
+plr.DefPyFunctionAccess(cClass=classStr, pyName='GetStateCheckpoint', cName='PyGetStateCheckpoint', 
+                        description="return binary checkpoint of the system state in given configuration (coordinates, data coordinates and time), the internal storage of sensors and the active contact sets of GeneralContact; the checkpoint can only be restored into the same assembled system on the same platform; save and restore only copy memory and are therefore much faster than SetSystemState(...) or restart files, e.g., for repeated resets of a model in optimization or reinforcement learning",
+                        example = 'checkpoint = mbs.GetStateCheckpoint()\\\\#... simulate\\\\mbs.SetStateCheckpoint(checkpoint) #restore state',
+                        argList=['configuration'],
+                        defaultArgs=['exu.ConfigurationType::Current'],
+                        argTypes=['ConfigurationType'],
+                        returnType='bytes',
+                        )
+
+plr.DefPyFunctionAccess(cClass=classStr, pyName='SetStateCheckpoint', cName='PySetStateCheckpoint', 
+                        description="restore system state in given configuration, internal storage of sensors and active contact sets of GeneralContact from binary checkpoint created with GetStateCheckpoint(...); raises error if checkpoint does not fit to system",
+                        argList=['checkpoint', 'configuration'],
+                        defaultArgs=['', 'exu.ConfigurationType::Current'],
+                        argTypes=['bytes', 'ConfigurationType'],
+                        returnType='None',
+                        )
+
+plr.DefPyFunctionAccess(cClass=classStr, pyName='WriteStateCheckpoint', cName='PyWriteStateCheckpoint', 
+                        description="write binary checkpoint, see GetStateCheckpoint(...), to file; directories are created if necessary",
+                        argList=['fileName', 'configuration'],
+                        defaultArgs=['', 'exu.ConfigurationType::Current'],
+                        argTypes=['str', 'ConfigurationType'],
+                        returnType='None',
+                        )
+
+plr.DefPyFunctionAccess(cClass=classStr, pyName='ReadStateCheckpoint', cName='PyReadStateCheckpoint', 
+                        description="restore from binary checkpoint file written with WriteStateCheckpoint(...), see SetStateCheckpoint(...)",
+                        argList=['fileName', 'configuration'],
+                        defaultArgs=['', 'exu.ConfigurationType::Current'],
+                        argTypes=['str', 'ConfigurationType'],
+                        returnType='None',
+                        )
+
+plr.DefPyFunctionAccess(cClass=classStr, pyName='SolveEnsemble', cName='PySolveEnsemble', 
+                        description="solve an ensemble (e.g. parameter variation) of copies of this assembled system in parallel C++ threads, without rebuilding the model in Python; every member is created from the dictionary of the system (like pickling), parameters are overridden with parameterSets[i], which is a list of tuples (itemIndex, parameterName, value) using typed indices (NodeIndex, ObjectIndex, MarkerIndex, LoadIndex, SensorIndex) as in SetObjectParameter(...), and then assembled; members start from initial values and do not write solution, sensor or solver information files; the internal storage of sensors in sensorNumbers is returned for every member; solverType selects the dynamic solver as in exudyn.SolveDynamic(...), useStaticSolver=True uses the static solver; numberOfThreads=0 uses all available hardware threads; members with Python user functions are solved one after another, as they need the GIL; GeneralContact is not supported; returns dictionary with list 'success' and list 'sensorData' containing a list of numpy arrays per member",
+                        example = "res = mbs.SolveEnsemble([[(oMass, 'physicsMass', m)] for m in [1,2,3]], \\\\  sensorNumbers=[sPos], simulationSettings=simulationSettings)\\\\data = res['sensorData'][2][0] #sensor data of sPos, member 2",
+                        argList=['parameterSets', 'sensorNumbers', 'simulationSettings', 'solverType', 'useStaticSolver', 'numberOfThreads'],
+                        defaultArgs=['', '', 'exu.SimulationSettings()', 'exu.DynamicSolverType::GeneralizedAlpha', 'False', '0'],
+                        argTypes=['List[List[Tuple[Any,str,Any]]]', 'List[SensorIndex]', 'SimulationSettings', 'DynamicSolverType', 'bool', 'int'],
+                        returnType='dict',
+                        )
+
 plr.sPy += pickleDictTemplateNew.replace('{ClassName}', classStr)
 #in C++:
         # .def(py::pickle(
@@ -1487,6 +1534,14 @@ plr.DefPyFunctionAccess(cClass=classStr, pyName='SetObjectParameter', cName='PyS
                                 returnType='None',
                                 )
 
+plr.DefPyFunctionAccess(cClass=classStr, pyName='SetBatchedUserFunction', cName='PySetBatchedUserFunction', 
+                                description="set one Python user function for all objects in objectNumbers, which must be all of type ObjectConnectorCoordinateSpringDamper, ObjectConnectorSpringDamper or ObjectConnectorCartesianSpringDamper; instead of one Python call per item, batchedUserFunction(mbs, t, itemNumbers, displacements, velocities) is called once per evaluation of the system ODE2 right-hand-side and once per numerical ODE2 Jacobian (with all perturbed inputs) with numpy arrays of all (active) items and must return a numpy array of forces; for ObjectConnectorCartesianSpringDamper, displacements, velocities and returned forces have shape (n,3), otherwise shape (n); displacements and velocities have the same meaning as in the per-item springForceUserFunction of the object (e.g., deltaL and deltaL_t for ObjectConnectorSpringDamper); stiffness, damping or offset are not passed and must be accessed via mbs if needed; the springForceUserFunction of every object is replaced by a function calling batchedUserFunction with one item, which is used for all other evaluations such as output variables; requires Assemble() afterwards",
+                                argList=['objectNumbers', 'batchedUserFunction'],
+                                example = "def UFbatched(mbs, t, itemNumbers, u, v):\\  return k*u + d*v\\mbs.SetBatchedUserFunction(objectNumbers=[oSD0, oSD1], batchedUserFunction=UFbatched)",
+                                argTypes=['List[ObjectIndex]','Any'],
+                                returnType='None',
+                                )
+
 plr.DefLatexFinishTable()
 
 #++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
@@ -1739,10 +1794,10 @@ plr.DefPyFunctionAccess(cClass=classStr, pyName='GetSensorValues', cName='PyGetS
                                 )
 
 plr.DefPyFunctionAccess(cClass=classStr, pyName='GetSensorStoredData', cName='PyGetSensorStoredData',
-                                description="get sensors's internally stored data as matrix (all time points stored); rows are containing time and sensor values as obtained by sensor (e.g., time, and x, y, and z value of position)",
-                                defaultArgs=[''],
-                                argList=['sensorNumber'],
-                                argTypes=['SensorIndex'],
+                                description="get sensors's internally stored data as matrix (all time points stored); rows are containing time and sensor values as obtained by sensor (e.g., time, and x, y, and z value of position); if copy=False, a read-only numpy view of the rows stored up to now is returned without copying data, which may also be used during simulation (e.g., in user functions); the view keeps its data valid, even if storage is extended or reset",
+                                defaultArgs=['','True'],
+                                argList=['sensorNumber','copy'],
+                                argTypes=['SensorIndex','bool'],
                                 returnType='ArrayLike',
                                 )
 
@@ -2961,6 +3016,16 @@ plrsym.DefPyFunctionAccess(cClass=classStr, pyName='SetUserFunctionFromDict', cN
                         returnType='None',
                         )
 
+plrsym.DefPyFunctionAccess(cClass=classStr, pyName='Compile', cName='', 
+                        description="Compile symbolic function into flat tape of instructions (registers, constant folding, common subexpression elimination), which is evaluated instead of expression trees; returns False if function cannot be compiled (e.g., matrix expressions), in which case expression trees are evaluated",
+                        returnType='bool',
+                        )
+
+plrsym.DefPyFunctionAccess(cClass=classStr, pyName='IsCompiled', cName='', 
+                        description="Return True, if symbolic function has been compiled into tape with Compile()",
+                        returnType='bool',
+                        )
+
 # not needed any more (use userFunction directly, same as Python function)
 # plrsym.DefPyFunctionAccess(cClass=classStr, pyName='TransferUserFunction2Item', cName='', 
 #                         description="Transfer the std::function to a given object, load or other; this needs to be done purely in C++ to avoid Pybind overheads.",
@@ -3065,6 +3130,26 @@ plr.DefLatexDataAccess('resetSearchTreeInterval','(default=10000) number of sear
                        dataType='int',
                        )
 
+plr.sPy +=  '        .def_property("searchTreeAdaptive", &PyGeneralContact::GetSearchTreeAdaptive, &PyGeneralContact::SetSearchTreeAdaptive)\n' 
+plr.DefLatexDataAccess('searchTreeAdaptive','(default=False) if True, box and number of cells of search tree are adapted to the bounding boxes of all contact objects at every search tree update; this avoids that objects leaving the search tree box are collected in boundary cells, e.g., for spreading granular flows; SetSearchTreeBox and SetSearchTreeCellSize are then only used initially ',
+                       dataType='bool',
+                       )
+
+plr.sPy +=  '        .def_property("searchTreeAdaptiveCellSizeFactor", &PyGeneralContact::GetSearchTreeAdaptiveCellSizeFactor, &PyGeneralContact::SetSearchTreeAdaptiveCellSizeFactor)\n' 
+plr.DefLatexDataAccess('searchTreeAdaptiveCellSizeFactor','(default=1) for searchTreeAdaptive=True: edge length of cubic search tree cells is this factor times the median size of bounding boxes of contact objects ',
+                       dataType='float',
+                       )
+
+plr.sPy +=  '        .def_property("searchTreeAdaptiveMaxCells", &PyGeneralContact::GetSearchTreeAdaptiveMaxCells, &PyGeneralContact::SetSearchTreeAdaptiveMaxCells)\n' 
+plr.DefLatexDataAccess('searchTreeAdaptiveMaxCells','(default=1000000) for searchTreeAdaptive=True: maximum total number of search tree cells, additionally limited to 8 cells per contact object; cell size is increased if needed, which limits memory in case of widely spread contact objects ',
+                       dataType='int',
+                       )
+
+plr.sPy +=  '        .def_property("trianglesBVH", &PyGeneralContact::GetTrianglesBVH, &PyGeneralContact::SetTrianglesBVH)\n' 
+plr.DefLatexDataAccess('trianglesBVH','(default=False) if True, a bounding volume hierarchy of triangles is built per rigid body in body coordinates; only one box per rigid body is updated in the search tree and spheres are searched in body coordinates, such that cost is nearly independent of number of triangles; hierarchies are rebuilt after changing triangles ',
+                       dataType='bool',
+                       )
+
 plr.sPy +=  '        .def_property("sphereSphereContact", &PyGeneralContact::GetSphereSphereContact, &PyGeneralContact::SetSphereSphereContact)\n' 
 plr.DefLatexDataAccess('sphereSphereContact','activate/deactivate contact between spheres ',
                        dataType='bool',
@@ -3075,6 +3160,11 @@ plr.DefLatexDataAccess('sphereSphereFrictionRecycle','False: compute static fric
                        dataType='bool',
                        )
 
+plr.sPy +=  '        .def_property("sphereSphereNeighborListSkin", &PyGeneralContact::GetSphereSphereNeighborListSkin, &PyGeneralContact::SetSphereSphereNeighborListSkin)\n' 
+plr.DefLatexDataAccess('sphereSphereNeighborListSkin','(default=0) if > 0, candidate pairs of spheres are stored in neighbor (Verlet) lists, using sphere bounding boxes enlarged by half of this distance; lists are only rebuilt if any sphere moved more than half of this distance since the last build, which avoids the search in most time steps and stages; the search tree is only updated at rebuilds if there are no other contact objects; larger values give longer lists but fewer rebuilds ',
+                       dataType='float',
+                       )
+
 plr.sPy +=  '        .def_property("minRelDistanceSpheresTriangles", &PyGeneralContact::GetMinRelDistanceSpheresTriangles, &PyGeneralContact::SetMinRelDistanceSpheresTriangles)\n' 
 plr.DefLatexDataAccess('minRelDistanceSpheresTriangles','(default=1e-10) tolerance (relative to sphere radiues) below which the contact between triangles and spheres is ignored; used for spheres directly attached to triangles ',
                        dataType='float',
@@ -3394,6 +3484,109 @@ plr.DefPyFunctionAccess(cClass=classStr, pyName='__repr__', cName='[](const PyMa
 plr.DefPyFinishClass('MatrixContainer')
 
 
+#%%++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+#++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+#documentation and pybindings for BinarySolutionReader
+classStr = 'PyBinarySolutionReader'
+pyClassStr = 'BinarySolutionReader'
+
+plr.DefPyStartClass(classStr, pyClassStr, 'The BinarySolutionReader memory-maps a binary solution file, written with solutionSettings.binarySolutionFile=True. The header is parsed and rows are indexed once when opening the file; afterwards, rows, columns and time ranges are returned as read-only numpy views into the file without copying or loading the file. Views stay valid after the reader is closed or deleted; use numpy.array(view) to obtain a writable copy. On Windows, the file cannot be overwritten as long as views exist.',
+                    subSection=True)
+
+plr.AddDocuCodeBlock(code="""
+from exudyn import BinarySolutionReader
+reader = BinarySolutionReader('solution/coordinatesSolution.sol')
+print(reader.NumberOfRows(), reader.NumberOfColumns())
+t = reader.GetTimes()                  #view on time column
+u = reader.GetData(columnStart=1, columnEnd=4) #view on first 3 coordinates
+u2 = reader.GetDataInTimeRange(0.5, 1.) #view on rows with 0.5 <= t <= 1
+""")
+
+plr.DefLatexStartTable(pyClassStr)
+
+plr.sPy += '        .def(py::init([](const STDstring& fileName) { PyBinarySolutionReader reader; reader.Open(fileName); return reader; }), py::arg("fileName"))\n' #constructor with file name
+
+plr.DefPyFunctionAccess(cClass=classStr, pyName='Open', cName='Open',
+                        argList=['fileName'],
+                        description="open and memory-map binary solution file, parse header and determine number of complete rows from file size; raises exception, if file is not a valid binary solution file; an incomplete last row (e.g., simulation still running) is ignored",
+                        argTypes=['str'],
+                        returnType='None',
+                        )
+
+plr.DefPyFunctionAccess(cClass=classStr, pyName='Close', cName='Close',
+                        description="release reader's reference to the file mapping; existing views remain valid",
+                        returnType='None',
+                        )
+
+plr.DefPyFunctionAccess(cClass=classStr, pyName='IsOpen', cName='IsOpen',
+                        description="return True, if a file is opened",
+                        returnType='bool',
+                        )
+
+plr.DefPyFunctionAccess(cClass=classStr, pyName='NumberOfRows', cName='NumberOfRows',
+                        description="return number of complete rows (stored time steps) in file",
+                        returnType='int',
+                        )
+
+plr.DefPyFunctionAccess(cClass=classStr, pyName='NumberOfColumns', cName='NumberOfColumns',
+                        description="return number of columns per row, including time column",
+                        returnType='int',
+                        )
+
+plr.DefPyFunctionAccess(cClass=classStr, pyName='GetColumnsExported', cName='GetColumnsExported',
+                        description="return list of exported sizes [nODE2, nVel2, nAcc2, nODE1, nVel1, nAlgebraic, nData], as in LoadSolutionFile",
+                        returnType='List[int]',
+                        )
+
+plr.DefPyFunctionAccess(cClass=classStr, pyName='GetHeaderInfo', cName='GetHeaderInfo',
+                        description="return dictionary with header information of file: version, solver, dateTime, solutionInformation, systemSizes, columnsExported, numberOfSteps, indexSize, realSize and validEndFound (False if simulation has not been finished or file is incomplete)",
+                        returnType='dict',
+                        )
+
+plr.DefPyFunctionAccess(cClass=classStr, pyName='GetData', cName='GetData',
+                        argList=['rowStart','rowEnd','rowStep','columnStart','columnEnd'],
+                        defaultArgs=['0','-1','1','0','-1'],
+                        description="return read-only numpy view (matrix) of rows in range [rowStart, rowEnd) with increment rowStep and columns in range [columnStart, columnEnd); column 0 is time; rowEnd=-1 and columnEnd=-1 represent number of rows and columns; dtype is float32 or float64 according to file",
+                        argTypes=['int','int','int','int','int'],
+                        returnType='ArrayLike',
+                        )
+
+plr.DefPyFunctionAccess(cClass=classStr, pyName='GetRow', cName='GetRow',
+                        argList=['row'],
+                        description="return read-only numpy view of row, including time",
+                        argTypes=['int'],
+                        returnType='ArrayLike',
+                        )
+
+plr.DefPyFunctionAccess(cClass=classStr, pyName='GetTimes', cName='GetTimes',
+                        description="return read-only numpy view of time column",
+                        returnType='ArrayLike',
+                        )
+
+plr.DefPyFunctionAccess(cClass=classStr, pyName='FindRowRange', cName='FindRowRange',
+                        argList=['timeStart','timeEnd'],
+                        description="return list [rowStart, rowEnd] with rows rowStart <= i < rowEnd having times timeStart <= t <= timeEnd; uses binary search, as times are non-decreasing",
+                        argTypes=['float','float'],
+                        returnType='List[int]',
+                        )
+
+plr.DefPyFunctionAccess(cClass=classStr, pyName='GetDataInTimeRange', cName='GetDataInTimeRange',
+                        argList=['timeStart','timeEnd','columnStart','columnEnd'],
+                        defaultArgs=['','','0','-1'],
+                        description="return read-only numpy view of rows with timeStart <= t <= timeEnd and columns in range [columnStart, columnEnd)",
+                        argTypes=['float','float','int','int'],
+                        returnType='ArrayLike',
+                        )
+
+plr.DefPyFunctionAccess(cClass=classStr, pyName='__repr__', cName='[](const PyBinarySolutionReader &item) {\n            return STDstring("BinarySolutionReader(rows=") + EXUstd::ToString(item.NumberOfRows()) + ", columns=" + EXUstd::ToString(item.NumberOfColumns()) + ")"; }',
+                        description="return the string representation of the BinarySolutionReader",
+                        isLambdaFunction = True,
+                        )
+
+#++++++++++++++++
+plr.DefPyFinishClass('BinarySolutionReader')
+
+
 #%%++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
 #++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
 #documentation and pybindings for PyVector3DList
@@ -14,8 +14,13 @@ class GeneralContact:
     verboseMode:int
     visualization:VisuGeneralContact
     resetSearchTreeInterval:int
+    searchTreeAdaptive:bool
+    searchTreeAdaptiveCellSizeFactor:float
+    searchTreeAdaptiveMaxCells:int
+    trianglesBVH:bool
     sphereSphereContact:bool
     sphereSphereFrictionRecycle:bool
+    sphereSphereNeighborListSkin:float
     minRelDistanceSpheresTriangles:float
     frictionProportionalZone:float
     frictionVelocityPenalty:float
@@ -191,6 +196,16 @@ class MainSystem:
     def GetDictionary(self) -> dict: ...
     @overload
     def SetDictionary(self, systemDict: dict) -> None: ...
+    @overload
+    def GetStateCheckpoint(self, configuration: ConfigurationType) -> bytes: ...
+    @overload
+    def SetStateCheckpoint(self, checkpoint: bytes, configuration: ConfigurationType) -> None: ...
+    @overload
+    def WriteStateCheckpoint(self, fileName: str, configuration: ConfigurationType) -> None: ...
+    @overload
+    def ReadStateCheckpoint(self, fileName: str, configuration: ConfigurationType) -> None: ...
+    @overload
+    def SolveEnsemble(self, parameterSets: List[List[Tuple[Any,str,Any]]], sensorNumbers: List[SensorIndex], simulationSettings: SimulationSettings, solverType: DynamicSolverType, useStaticSolver: bool, numberOfThreads: int) -> dict: ...
     systemIsConsistent:bool
     interactiveMode:bool
     variables:dict
@@ -240,6 +255,8 @@ class MainSystem:
     @overload
     def SetObjectParameter(self, objectNumber: ObjectIndex, parameterName: str, value: Any) -> None: ...
     @overload
+    def SetBatchedUserFunction(self, objectNumbers: List[ObjectIndex], batchedUserFunction: Any) -> None: ...
+    @overload
     def AddMarker(self, pyObject: dict) -> MarkerIndex: ...
     @overload
     def GetMarkerNumber(self, markerName: str) -> MarkerIndex: ...
@@ -284,7 +301,7 @@ class MainSystem:
     @overload
     def GetSensorValues(self, sensorNumber: SensorIndex, configuration: ConfigurationType) -> List[float]: ...
     @overload
-    def GetSensorStoredData(self, sensorNumber: SensorIndex) -> ArrayLike: ...
+    def GetSensorStoredData(self, sensorNumber: SensorIndex, copy: bool) -> ArrayLike: ...
     @overload
     def GetSensorParameter(self, sensorNumber: SensorIndex, parameterName: str) -> Any: ...
     @overload
@@ -324,6 +341,8 @@ class SystemContainer:
     @overload
     def SendRedrawSignal(self) -> None: ...
     @overload
+    def UpdateGraphicsData(self) -> None: ...
+    @overload
     def GetCurrentMouseCoordinates(self, useOpenGLcoordinates=False) -> [float,float]: ...
 
 #stub information for exudyn module functions
@@ -140,6 +140,33 @@ class MatrixContainer:
     @overload
     def UseDenseMatrix(self) -> bool: ...
 
+#stub information for class BinarySolutionReader functions
+class BinarySolutionReader:
+    @overload
+    def Open(self, fileName: str) -> None: ...
+    @overload
+    def Close(self) -> None: ...
+    @overload
+    def IsOpen(self) -> bool: ...
+    @overload
+    def NumberOfRows(self) -> int: ...
+    @overload
+    def NumberOfColumns(self) -> int: ...
+    @overload
+    def GetColumnsExported(self) -> List[int]: ...
+    @overload
+    def GetHeaderInfo(self) -> dict: ...
+    @overload
+    def GetData(self, rowStart: int, rowEnd: int, rowStep: int, columnStart: int, columnEnd: int) -> ArrayLike: ...
+    @overload
+    def GetRow(self, row: int) -> ArrayLike: ...
+    @overload
+    def GetTimes(self) -> ArrayLike: ...
+    @overload
+    def FindRowRange(self, timeStart: float, timeEnd: float) -> List[int]: ...
+    @overload
+    def GetDataInTimeRange(self, timeStart: float, timeEnd: float, columnStart: int, columnEnd: int) -> ArrayLike: ...
+
 #stub information for class Vector3DList functions
 class Vector3DList:
     @overload
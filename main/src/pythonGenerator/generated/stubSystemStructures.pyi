@@ -34,6 +34,7 @@ class SolutionSettings:
     restartFileName: str
     restartWritePeriod: float
     sensorsAppendToFile: bool
+    sensorsBinaryFiles: bool
     sensorsStoreAndWriteFiles: bool
     sensorsWriteFileFooter: bool
     sensorsWriteFileHeader: bool
@@ -158,6 +159,7 @@ class LinearSolverSettings:
     ignoreSingularJacobian: bool
     pivotThreshold: float
     reuseAnalyzedPattern: bool
+    reuseSparsityPattern: bool
     showCausingItems: bool
 
 #information for Parallel
@@ -167,8 +169,12 @@ class Parallel:
     multithreadedLLimitMassMatrices: int
     multithreadedLLimitResiduals: int
     numberOfThreads: int
+    pinThreads: bool
     taskSplitMinItems: int
     taskSplitTasksPerThread: int
+    useColoringForResiduals: bool
+    useCostBalancedTasks: bool
+    workerSpinTime: float
 
 #information for SimulationSettings
 class SimulationSettings:
@@ -197,6 +203,7 @@ class VSettingsGeneral:
     drawCoordinateSystem: bool
     drawWorldBasis: bool
     graphicsUpdateInterval: float
+    graphicsUpdateThreads: int
     linuxDisplayScaleFactor: float
     minSceneSize: float
     pointSize: float
@@ -270,6 +277,7 @@ class VSettingsKinematicTree:
 class VSettingsBodies:
     beams: VSettingsBeams
     kinematicTree: VSettingsKinematicTree
+    cacheRigidBodyGraphics: bool
     defaultColor: Tuple[float,float,float,float]
     defaultSize: Tuple[float,float,float]
     deformationScaleFactor: float
@@ -439,6 +447,7 @@ class VSettingsExportImages:
     saveImageFormat: str
     saveImageSingleFile: bool
     saveImageTimeOut: int
+    useSoftwareRenderer: bool
     widthAlignment: int
 
 #information for VSettingsOpenVR
@@ -587,6 +596,7 @@ class SolverOutputData:
     lastVerboseStepIndex: int
     multiThreadingMode: int
     numberOfThreadsUsed: int
+    releasedGIL: bool
     stepInformation: int
     verboseMode: int
     verboseModeFile: int
@@ -2027,11 +2027,15 @@ V,      C,      tempCoordinates,                ,               ,       NumpyVec
 V,      C,      tempCoordinates_t,              ,               ,       NumpyVector,"Vector()",                 ,       IUR,    "$\dot \cv_{temp} \in \Rcal^{n}$temporary vector containing velocity coordinates"
 V,      C,      tempCoordinates_tt,             ,               ,       NumpyVector,"Vector()",                 ,       IUR,    "$\ddot \cv_{temp} \in \Rcal^{n}$temporary vector containing acceleration coordinates"
 Fv,     C,      HasUserFunction,                ,               ,       Bool,         "return (parameters.forceUserFunction!=0) || (parameters.massMatrixUserFunction!=0) || (parameters.jacobianUserFunction!=0);", "", CI,  "return true, if object has a computation user function"  
+Fv,     C,      HasThreadSafeUserFunction,      ,               ,       Bool,         "return parameters.forceUserFunction.IsThreadSafe() && parameters.massMatrixUserFunction.IsThreadSafe() && parameters.jacobianUserFunction.IsThreadSafe();", "", CI,  "return true, if computation user functions can be evaluated in multithreaded computation (compiled symbolic user functions)"  
 Fv,     C,      ComputeMassMatrix,              ,               ,       void,       ,                           "EXUmath::MatrixContainer& massMatrixC, const ArrayIndex& ltg, Index objectNumber, bool computeInverse=false",       CDI,    "Computational function: compute mass matrix"
 Fv,     C,      ComputeODE2LHS,                 ,               ,       void,       ,                           "Vector& ode2Lhs, Index objectNumber",          CDI,    "Computational function: compute left-hand-side (LHS) of second order ordinary differential equations (ODE) to 'ode2Lhs'" 
 Fv,     C,      ComputeJacobianODE2_ODE2,       ,               ,       void,       ,                           "EXUmath::MatrixContainer& jacobianODE2, JacobianTemp& temp, Real factorODE2, Real factorODE2_t, Index objectNumber, const ArrayIndex& ltg",       CDI,    "Computational function: compute jacobian (dense or sparse mode, see parent CObject function)" 
 #
 #Fv,     C,      GetAvailableJacobians,          ,               ,       JacobianType::Type, "return (JacobianType::Type)(JacobianType::ODE2_ODE2 + JacobianType::ODE2_ODE2_t);",                    ,          CI, "return the available jacobian dependencies and the jacobians which are available as a function; if jacobian dependencies exist but are not available as a function, it is computed numerically; can be combined with 2^i enum flags"
+Fv,     C,      HasConstantJacobianODE2,        ,               ,       Bool,       "return (parameters.jacobianUserFunction==0) && (parameters.forceUserFunction==0);", , CI, "return true, if ODE2 jacobian is constant (stiffness and damping matrix only); it is then computed once and cached"
+Fv,     C,      HasConstantJacobianODE2Part,    ,               ,       Bool,       "return (parameters.jacobianUserFunction==0);", , CI, "return true, if stiffness and damping matrix jacobian can be cached as constant part of ODE2 jacobian"
+Fv,     C,      ComputeJacobianODE2_ODE2ConstantPart, ,         ,       void,       ,                           "EXUmath::MatrixContainer& jacobianODE2, JacobianTemp& temp, Real factorODE2, Real factorODE2_t, Index objectNumber, const ArrayIndex& ltg",       CDI,    "compute constant part of jacobian due to stiffness and damping matrix (dense or sparse mode, see parent CObject function)" 
 Fv,     C,      GetAvailableJacobians,          ,               ,       JacobianType::Type,  ,                  ,          CDI, "return the available jacobian dependencies and the jacobians which are available as a function; if jacobian dependencies exist but are not available as a function, it is computed numerically; can be combined with 2^i enum flags"
 Fv,     C,      GetAccessFunctionTypes,         ,               ,       AccessFunctionType,,                    ,          CDI, "Flags to determine, which access (forces, moments, connectors, ...) to object are possible" 
 Fv,     C,      GetAccessFunctionBody,          ,               ,       void,       ,                           "AccessFunctionType accessType, const Vector3D& localPosition, Matrix& value",          DC, "provide Jacobian at localPosition in 'value' according to object access" 
@@ -3349,6 +3353,8 @@ Fv,     C,      ComputeODE2LHS,                 ,               ,       void,
 #Fv,     C,      ComputeAlgebraicEquations,      ,               ,       void,       ,                           "Vector& algebraicEquations, bool useIndex2 = false",          CDI,    "Compute algebraic equations part of rigid body" 
 #Fv,     C,      ComputeJacobianAE,              ,               ,       void,       ,                           "ResizableMatrix& jacobian_ODE2, ResizableMatrix& jacobian_ODE2_t, ResizableMatrix& jacobian_ODE1, ResizableMatrix& jacobian_AE",          CDI,    "Compute jacobians of algebraic equations part of rigid body w.r.t. \hac{ODE2}, \hac{ODE2t}, \hac{ODE1}, \hac{AE}" 
 #Fv,     C,      GetAvailableJacobians,          ,               ,       JacobianType::Type, ,                   ,       CDI, "return the available jacobian dependencies and the jacobians which are available as a function; if jacobian dependencies exist but are not available as a function, it is computed numerically; can be combined with 2^i enum flags"
+Fv,     C,      HasConstantJacobianODE2Part,    ,               ,       Bool,       "return parameters.computeFFRFterms;", , CI, "return true, if jacobian of reduced stiffness and damping matrix can be cached as constant part of ODE2 jacobian"
+Fv,     C,      ComputeJacobianODE2_ODE2ConstantPart, ,         ,       void,       ,                           "EXUmath::MatrixContainer& jacobianODE2, JacobianTemp& temp, Real factorODE2, Real factorODE2_t, Index objectNumber, const ArrayIndex& ltg",       CDI,    "compute constant part of jacobian due to reduced stiffness and damping matrix as sparse triplets" 
 Fv,     C,      GetAvailableJacobians,          ,               ,       JacobianType::Type, "return (JacobianType::Type)(JacobianType::ODE2_ODE2 + JacobianType::ODE2_ODE2_t);",                    ,          CI, "return the available jacobian dependencies and the jacobians which are available as a function; if jacobian dependencies exist but are not available as a function, it is computed numerically; can be combined with 2^i enum flags"
 Fv,     C,      GetAccessFunctionTypes,         ,               ,       AccessFunctionType,,                    ,       CDI, "Flags to determine, which access (forces, moments, connectors, ...) to object are possible" 
 Fv,     C,      GetAccessFunctionBody,          ,               ,       void,       ,                           "AccessFunctionType accessType, const Vector3D& localPosition, Matrix& value",          DC, "provide Jacobian at localPosition in 'value' according to object access" 
@@ -4610,6 +4616,7 @@ V,      CP,     activeConnector,                ,               ,       Bool,
 V,      CP,     springForceUserFunction,        ,               ,       PyFunctionMbsScalarIndexScalar5, 0,                     ,       IO,     "$\mathrm{UF} \in \Rcal$A Python function which defines the spring force with parameters; the Python function will only be evaluated, if activeConnector is true, otherwise the SpringDamper is inactive; see description below"
 #
 Fv,     C,      HasUserFunction,                ,               ,       Bool,         "return (parameters.springForceUserFunction!=0);", "", CI,  "return true, if object has a computation user function"  
+Fv,     C,      HasThreadSafeUserFunction,      ,               ,       Bool,         "return parameters.springForceUserFunction.IsThreadSafe();", "", CI,  "return true, if computation user functions can be evaluated in multithreaded computation (compiled symbolic user functions)"  
 Fv,     C,      GetMarkerNumbers,               ,               ,       "const ArrayIndex&", "return parameters.markerNumbers;",,CI,     "default function to return Marker numbers" 
 Fv,     C,      IsPenaltyConnector,             ,               ,       Bool,       "return true;",             ,       CI,     "connector uses penalty formulation" 
 Fv,     C,      ComputeODE2LHS,                 ,               ,       void,       ,                           "Vector& ode2Lhs, const MarkerDataStructure& markerData, Index objectNumber",          CDI,     "Computational function: compute left-hand-side (LHS) of second order ordinary differential equations (ODE) to 'ode2Lhs'" 
@@ -4623,6 +4630,7 @@ Fv,     M,      GetTypeName,                    ,               ,       const ch
 Fv,     C,      IsActive,                       ,               ,       Bool,       "return parameters.activeConnector;", , CI,    "return if connector is active-->speeds up computation" 
 F,      C,      ComputeConnectorProperties,     ,               ,       void,       , "const MarkerDataStructure& markerData, Index itemIndex, Vector3D& relPos, Vector3D& relVel, Real& force, Vector3D& forceDirection", CDI,  "compute connector force and further properties (relative position, etc.) for unique functionality and output"
 F,      C,      EvaluateUserFunctionForce,      ,               ,       void,       , "Real& force, const MainSystemBase& mainSystem, Real t, Index itemIndex, Real deltaL, Real deltaL_t", CDI,  "call to user function implemented in separate file to avoid including pybind and MainSystem.h at too many places"
+F,      C,      EvaluateUserFunctionForceJacobian, ,            ,       void,       , "ResizableMatrix& jacobian, const MainSystemBase& mainSystem, Real t, Index itemIndex, Real deltaL, Real deltaL_t", CDI,  "call to Jacobian of user function w.r.t. its Real args (only available for compiled symbolic user function)"
 #VISUALIZATION:
 Fv,     V,      UpdateGraphics,                 ,               ,       void,        ";",                        "const VisualizationSettings& visualizationSettings, VisualizationSystem* vSystem, Index itemNumber", DI,  "Update visualizationSystem -> graphicsData for item; index shows item Number in CData" 
 Vp,     V,      show,                           ,               ,       Bool,   "true",                          ,       IO,    "set true, if item is shown in visualization and false if it is not shown"
@@ -4798,6 +4806,7 @@ V,      CP,     springForceUserFunction,        ,               ,       PyFuncti
 V,      CP,     activeConnector,                ,               ,       Bool,       "true",                      ,       IO,      "flag, which determines, if the connector is active; used to deactivate (temporarily) a connector or constraint"
 #
 Fv,     C,      HasUserFunction,                ,               ,       Bool,         "return (parameters.springForceUserFunction!=0);", "", CI,  "return true, if object has a computation user function"  
+Fv,     C,      HasThreadSafeUserFunction,      ,               ,       Bool,         "return parameters.springForceUserFunction.IsThreadSafe();", "", CI,  "return true, if computation user functions can be evaluated in multithreaded computation (compiled symbolic user functions)"  
 Fv,     C,      GetMarkerNumbers,               ,               ,       "const ArrayIndex&", "return parameters.markerNumbers;",,CI,     "default function to return Marker numbers" 
 Fv,     C,      IsPenaltyConnector,             ,               ,       Bool,       "return true;",             ,       CI,     "connector uses penalty formulation" 
 Fv,     C,      ComputeODE2LHS,                 ,               ,       void,       ,                           "Vector& ode2Lhs, const MarkerDataStructure& markerData, Index objectNumber",          CDI,     "Computational function: compute left-hand-side (LHS) of second order ordinary differential equations (ODE) to 'ode2Lhs'" 
@@ -4811,6 +4820,7 @@ Fv,     C,      GetRequestedMarkerType,         ,               ,       Marker::
 Fv,     C,      GetType,                        ,               ,       CObjectType,"return CObjectType::Connector;", , CI,    "return object type (for node treatment in computation)" 
 F,      C,      ComputeSpringForce,             ,               ,       void,       , "const MarkerDataStructure& markerData, Index itemIndex, Vector3D& vPos, Vector3D& vVel, Vector3D& fVec", CDI,    "compute spring damper force helper function" 
 F,      C,      EvaluateUserFunctionForce,      ,               ,       void,       , "Vector3D& force, const MainSystemBase& mainSystem, Real t, Index itemIndex, Vector3D& vPos, Vector3D& vVel", CDI,  "call to user function implemented in separate file to avoid including pybind and MainSystem.h at too many places"
+F,      C,      EvaluateUserFunctionForceJacobian, ,            ,       void,       , "ResizableMatrix& jacobian, const MainSystemBase& mainSystem, Real t, Index itemIndex, Vector3D& vPos, Vector3D& vVel", CDI,  "call to Jacobian of user function w.r.t. its Real and vector args (only available for compiled symbolic user function)"
 #Fv,     C,      GetODE2Size,                    ,               ,       Index,      ,                           ,       CDI,    "NEEDED? should be done during preprocessing ==> written in global list; number of \hac{ODE2} coordinates the connector is related to; depends on coordinates of marker objects/nodes" 
 Fv,     M,      GetTypeName,                    ,               ,       const char*,"return 'ConnectorCartesianSpringDamper';", , CI,     "Get type name of node (without keyword 'Object'...!); could also be realized via a string -> type conversion?" 
 Fv,     C,      IsActive,                       ,               ,       Bool,       "return parameters.activeConnector;", , CI,    "return if connector is active-->speeds up computation" 
@@ -4997,6 +5007,7 @@ Fv,     M,      GetRequestedNodeType,           ,               ,       Node::Ty
 #unused: Fv,     C,      GetDataVariablesSize,           ,               ,       Index,      "return parameters.numberOfContactSegments;",                 ,       CI,     "Needs a data variable for every contact segment (tells if this segment is in contact or not)" 
 #++++++++++++++
 Fv,     C,      HasUserFunction,                ,               ,       Bool,         "return (parameters.springForceTorqueUserFunction!=0);", "", CI,  "return true, if object has a computation user function"  
+Fv,     C,      HasThreadSafeUserFunction,      ,               ,       Bool,         "return parameters.springForceTorqueUserFunction.IsThreadSafe();", "", CI,  "return true, if computation user functions can be evaluated in multithreaded computation (compiled symbolic user functions)"  
 Fv,     C,      IsPenaltyConnector,             ,               ,       Bool,       "return true;",             ,       CI,     "connector uses penalty formulation" 
 Fv,     C,      ComputeODE2LHS,                 ,               ,       void,       ,                           "Vector& ode2Lhs, const MarkerDataStructure& markerData, Index objectNumber",          CDI,     "Computational function: compute left-hand-side (LHS) of second order ordinary differential equations (ODE) to 'ode2Lhs'" 
 #Fv,     C,      ComputeJacobianODE2_ODE2,       ,               ,       void,       ,                           "ResizableMatrix& jacobian, ResizableMatrix& jacobian_ODE2_t, const MarkerDataStructure& markerData",              CDI,      "Computational function: compute Jacobian of \hac{ODE2} LHS equations w.r.t. ODE coordinates (jacobian) and if JacobianType::ODE2_ODE2_t flag is set in GetAvailableJacobians() compute jacobian w.r.t. ODE_t coordinates"
@@ -5149,6 +5160,7 @@ V,      CP,     springForceUserFunction,        ,               ,       PyFuncti
 #
 #++++++++++++++ for discontinuities:
 Fv,     C,      HasUserFunction,                ,               ,       Bool,         "return (parameters.springForceUserFunction!=0);", "", CI,  "return true, if object has a computation user function"  
+Fv,     C,      HasThreadSafeUserFunction,      ,               ,       Bool,         "return parameters.springForceUserFunction.IsThreadSafe();", "", CI,  "return true, if computation user functions can be evaluated in multithreaded computation (compiled symbolic user functions)"  
 Fv,     C,      GetMarkerNumbers,               ,               ,       "const ArrayIndex&", "return parameters.markerNumbers;",,CI,     "default function to return Marker numbers" 
 #++++++++++++++
 Fv,     C,      IsPenaltyConnector,             ,               ,       Bool,       "return true;",             ,       CI,     "connector uses penalty formulation" 
@@ -5309,6 +5321,7 @@ V,      CP,     springTorqueUserFunction,       ,               ,       PyFuncti
 #
 #++++++++++++++ for discontinuities:
 Fv,     C,      HasUserFunction,                ,               ,       Bool,         "return (parameters.springTorqueUserFunction!=0);", "", CI,  "return true, if object has a computation user function"  
+Fv,     C,      HasThreadSafeUserFunction,      ,               ,       Bool,         "return parameters.springTorqueUserFunction.IsThreadSafe();", "", CI,  "return true, if computation user functions can be evaluated in multithreaded computation (compiled symbolic user functions)"  
 Fv,     C,      GetMarkerNumbers,               ,               ,       "const ArrayIndex&", "return parameters.markerNumbers;",,CI,     "default function to return Marker numbers" 
 Fv,     C,      GetNodeNumber,                  ,               ,       Index,      "CHECKandTHROW(localIndex == 0, __EXUDYN_invalid_local_node);\n        return parameters.nodeNumber;",       "Index localIndex",       CI,     "Get global node number (with local node index); needed for every object ==> does local mapping" 
 Fv,     C,      GetNumberOfNodes,               ,               ,       Index,      "return (Index)(parameters.nodeNumber != EXUstd::InvalidIndex);",                ,       CI,     "number of nodes; needed for every object" 
@@ -5466,10 +5479,12 @@ V,      CP,     activeConnector,                ,               ,       Bool,
 V,      CP,     springForceUserFunction,        ,               ,       PyFunctionMbsScalarIndexScalar5, 0,,       IO,     "$\mathrm{UF} \in \Rcal$A Python function which defines the spring force with 8 parameters, see equations section / see description below"
 #
 Fv,     C,      HasUserFunction,                ,               ,       Bool,         "return (parameters.springForceUserFunction!=0);", "", CI,  "return true, if object has a computation user function"  
+Fv,     C,      HasThreadSafeUserFunction,      ,               ,       Bool,         "return parameters.springForceUserFunction.IsThreadSafe();", "", CI,  "return true, if computation user functions can be evaluated in multithreaded computation (compiled symbolic user functions)"  
 Fv,     C,      GetMarkerNumbers,               ,               ,       "const ArrayIndex&", "return parameters.markerNumbers;",,CI,     "default function to return Marker numbers" 
 Fv,     C,      IsPenaltyConnector,            ,               ,        Bool,       "return true;",             ,       CI,     "connector uses penalty formulation" 
 Fv,     C,      ComputeODE2LHS,                 ,               ,       void,       ,                           "Vector& ode2Lhs, const MarkerDataStructure& markerData, Index objectNumber",          CDI,     "Computational function: compute left-hand-side (LHS) of second order ordinary differential equations (ODE) to 'ode2Lhs'" 
 Fv,     C,      GetAvailableJacobians,          ,               ,       JacobianType::Type, ,                    ,          CDI, "return the available jacobian dependencies and the jacobians which are available as a function; if jacobian dependencies exist but are not available as a function, it is computed numerically; can be combined with 2^i enum flags"
+Fv,     C,      HasConstantJacobianODE2,        ,               ,       Bool,       "return (parameters.springForceUserFunction==0);", , CI, "return true, if ODE2 jacobian is constant, which is the case without user function (dry friction is not considered in jacobian)"
 Fv,     C,      ComputeJacobianODE2_ODE2,       ,               ,       void,       ,                           "EXUmath::MatrixContainer& jacobianODE2, JacobianTemp& temp, Real factorODE2, Real factorODE2_t, Index objectNumber, const ArrayIndex& ltg, const MarkerDataStructure& markerData",              CDI,      "Computational function: compute Jacobian of \hac{ODE2} \ac{LHS} equations w.r.t. ODE2 coordinates and ODE2 velocities; write either dense local jacobian into dense matrix of MatrixContainer or ADD sparse triplets INCLUDING ltg mapping to sparse matrix of MatrixContainer"
 #needed if MarkerNodeRotationCoordinate has jacDerivative: 
 Fv,     C,      ComputeJacobianForce6D,         ,               ,       void,       ,                           "const MarkerDataStructure& markerData, Index objectNumber, Vector6D& force6D",          CDI,     "compute global 6D force and torque which is used for computation of derivative of jacobian; used only in combination with ComputeJacobianODE2_ODE2" 
@@ -5696,6 +5711,7 @@ Fv,     C,      GetDataVariablesSize,           ,               ,       Index,
 Fv,     M,      CheckPreAssembleConsistency,    ,               ,       Bool,       ,                           "const MainSystem& mainSystem, STDstring& errorString", CDI,     "Check consistency prior to CSystem::Assemble(); needs to find all possible violations such that Assemble() would fail" 
 #
 Fv,     C,      HasUserFunction,                ,               ,       Bool,         "return (parameters.springForceUserFunction!=0);", "", CI,  "return true, if object has a computation user function"  
+Fv,     C,      HasThreadSafeUserFunction,      ,               ,       Bool,         "return parameters.springForceUserFunction.IsThreadSafe();", "", CI,  "return true, if computation user functions can be evaluated in multithreaded computation (compiled symbolic user functions)"  
 Fv,     C,      GetMarkerNumbers,               ,               ,       "const ArrayIndex&", "return parameters.markerNumbers;",,CI,     "default function to return Marker numbers" 
 Fv,     C,      IsPenaltyConnector,            ,               ,        Bool,       "return true;",             ,       CI,     "connector uses penalty formulation" 
 Fv,     C,      ComputeODE2LHS,                 ,               ,       void,       ,                           "Vector& ode2Lhs, const MarkerDataStructure& markerData, Index objectNumber",          CDI,     "Computational function: compute left-hand-side (LHS) of second order ordinary differential equations (ODE) to 'ode2Lhs'" 
@@ -9819,6 +9835,7 @@ Fv,     C,      IsVector,                       ,               ,       Bool,
 Fv,     C,      GetLoadVector,                  ,               ,       Vector3D,   , "const MainSystemBase& mbs, Real t", CDI, "read access for force vector; returns user function result in case it is defined" 
 Fv,     C,      IsBodyFixed,                    ,               ,       Bool,       "return parameters.bodyFixed;",             ,       CI,     "per default, forces/torques/... are applied in global coordinates; if IsBodyFixed()=true, the marker needs to provide a rotation (orientation) and forces/torques/... are applied in the local coordinate system" 
 Fv,     C,      HasUserFunction,                ,               ,       Bool,       "return parameters.loadVectorUserFunction != 0;",             ,       CI,     "tells system if loadFactor is used in static computation or if load is time dependent (assumed for any load user function)" 
+Fv,     C,      HasThreadSafeUserFunction,      ,               ,       Bool,       "return parameters.loadVectorUserFunction.IsThreadSafe();",             ,       CI,     "return true, if load user function can be evaluated in multithreaded computation (compiled symbolic user function)" 
 Fv,     M,      GetTypeName,                    ,               ,       const char*,"return 'ForceVector';",    ,       CI,     "Get type name of load (without keyword 'Load'...!); could also be realized via a string -> type conversion?" 
 #Fv,     M,      CheckPreAssembleConsistency,    ,               ,       Bool,       ,                           "const MainSystem& mainSystem, STDstring& errorString", CDI,     "Check consistency prior to CSystem::Assemble(); needs to find all possible violations such that Assemble() would fail" 
 #VISUALIZATION:
@@ -9879,6 +9896,7 @@ Fv,     C,      IsVector,                       ,               ,       Bool,
 Fv,     C,      GetLoadVector,                  ,               ,       Vector3D,   , "const MainSystemBase& mbs, Real t", CDI, "read access for load vector" 
 Fv,     C,      IsBodyFixed,                    ,               ,       Bool,       "return parameters.bodyFixed;",             ,       CI,     "per default, forces/torques/... are applied in global coordinates; if IsBodyFixed()=true, the marker needs to provide a rotation (orientation) and forces/torques/... are applied in the local coordinate system" 
 Fv,     C,      HasUserFunction,                ,               ,       Bool,       "return parameters.loadVectorUserFunction != 0;",             ,       CI,     "tells system if loadFactor is used in static computation or if load is time dependent (assumed for any load user function)" 
+Fv,     C,      HasThreadSafeUserFunction,      ,               ,       Bool,       "return parameters.loadVectorUserFunction.IsThreadSafe();",             ,       CI,     "return true, if load user function can be evaluated in multithreaded computation (compiled symbolic user function)" 
 Fv,     M,      GetTypeName,                    ,               ,       const char* ,"return 'TorqueVector';",    ,       CI,     "Get type name of load (without keyword 'Load'...!); could also be realized via a string -> type conversion?" 
 #VISUALIZATION:
 Vp,     V,      show,                           ,               ,      Bool,   "true",                          ,       IO,      "set true, if item is shown in visualization and false if it is not shown"
@@ -9944,6 +9962,7 @@ Fv,     C,      GetRequestedMarkerType,         ,               ,       Marker::
 Fv,     C,      GetType,                        ,               ,       LoadType,   "return (LoadType)((Index)LoadType::ForcePerMass);",  ,       CI,     "return load type" 
 Fv,     C,      IsVector,                       ,               ,       Bool,       "return true;",             ,       CI,     "true = load is of vector type" 
 Fv,     C,      HasUserFunction,                ,               ,       Bool,       "return parameters.loadVectorUserFunction != 0;",             ,       CI,     "tells system if loadFactor is used in static computation or if load is time dependent (assumed for any load user function)" 
+Fv,     C,      HasThreadSafeUserFunction,      ,               ,       Bool,       "return parameters.loadVectorUserFunction.IsThreadSafe();",             ,       CI,     "return true, if load user function can be evaluated in multithreaded computation (compiled symbolic user function)" 
 Fv,     C,      GetLoadVector,                  ,               ,       Vector3D,   , "const MainSystemBase& mbs, Real t", CDI, "read access for force vector" 
 Fv,     M,      GetTypeName,                    ,               ,       const char*,"return 'MassProportional';",    ,       CI,     "Get type name of load (without keyword 'Load'...!); could also be realized via a string -> type conversion?" 
 #VISUALIZATION:
@@ -10007,6 +10026,7 @@ Fv,     C,      GetRequestedMarkerType,         ,               ,       Marker::
 Fv,     C,      GetType,                        ,               ,       LoadType,   "return (LoadType)((Index)LoadType::Coordinate);",  ,       CI,     "return load type" 
 Fv,     C,      IsVector,                       ,               ,       Bool,       "return false;",             ,      CI,     "true = load is of vector type" 
 Fv,     C,      HasUserFunction,                ,               ,       Bool,       "return parameters.loadUserFunction != 0;",             ,       CI,     "tells system if loadFactor is used in static computation or if load is time dependent (assumed for any load user function)" 
+Fv,     C,      HasThreadSafeUserFunction,      ,               ,       Bool,       "return parameters.loadUserFunction.IsThreadSafe();",             ,       CI,     "return true, if load user function can be evaluated in multithreaded computation (compiled symbolic user function)" 
 Fv,     C,      GetLoadValue,                   ,               ,       Real,       , "const MainSystemBase& mbs, Real t", CDI,     "read access for load value (IsVector=false)" 
 Fv,     M,      GetTypeName,                    ,               ,       const char* ,"return 'Coordinate';",     ,       CI,     "Get type name of load (without keyword 'Load'...!); could also be realized via a string -> type conversion?" 
 #VISUALIZATION:
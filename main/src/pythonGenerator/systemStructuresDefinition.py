@@ -114,6 +114,7 @@ V,  sensorsAppendToFile,                ,       , bool,                     fals
 V,  sensorsWriteFileHeader,             ,       , bool,                     true,       ,       P   , "flag (true/false); if true, file header is written for sensor output (turn off, e.g. for multiple runs of time integration)"
 V,  sensorsWriteFileFooter,             ,       , bool,                     false,      ,       P   , "flag (true/false); if true, file footer is written for sensor output (turn off, e.g. for multiple runs of time integration)"
 V,  sensorsWritePeriod,                 ,       , UReal,                    0.01,       ,       P   , "time span (period), determines how often the sensor output is written to file or internal storage during a simulation"
+V,  sensorsBinaryFiles,                 ,       , bool,                     false,      ,       P   , "if true, sensor files are written in binary format with fixed-width rows (time and sensor values), which can be loaded in Python with LoadBinarySensorFile(...) as numpy memmap; data is buffered and written to disc by a background thread, such that the solver does not wait for file output; setting outputPrecision >= 8 uses double (8 bytes), otherwise float (4 bytes) is used; sensorsAppendToFile and sensorsWriteFileFooter are ineffective for binary sensor files and files are always replaced"
 V,  sensorsStoreAndWriteFiles,          ,       , bool,                     true,       ,       P   , "flag (true/false); if false, no sensor files will be created and no sensor data will be stored; this may be advantageous for benchmarking as well as for special solvers which should not overwrite existing results (e.g. ComputeODE2Eigenvalues); settings this value to False may cause problems if sensors are required to perform operations which are needed e.g. in UserSensors as input of loads, etc."
 #   
 V,  solutionInformation,                ,       , String,                   "",         ,       P   , "special information added to header of solution file (e.g. parameters and settings, modes, ...); character encoding my be UTF-8, restricted to characters in \refSection{sec:utf8}, but for compatibility, it is recommended to use ASCII characters only (95 characters, see wiki)"
@@ -303,6 +304,7 @@ V,  pivotThreshold,                 ,               , UReal,                0,
 #V,  ignoreRedundantConstraints,     ,               , bool,                 false,,P    , "[ONLY implemented for dense matrices] False: standard way, fails if redundant equations or singular matrices occur; True: if redundant constraints appear, the solver tries to resolve them by setting according Lagrange multipliers to zero; in case of redundant constraints, this may help, but it may lead to erroneous behaviour"
 V,  ignoreSingularJacobian,         ,               , bool,                 false,,P    , "[ONLY implemented for dense, Eigen matrix mode] False: standard way, fails if jacobian is singular; True: use Eigen's FullPivLU (thus only works with LinearSolverType.EigenDense) which handles over- and underdetermined systems; can often resolve redundant constraints, but MAY ALSO LEAD TO ERRONEOUS RESULTS!"
 V,  reuseAnalyzedPattern,           ,               , bool,                 false,,P    , "[ONLY available for sparse matrices] True: the Eigen SparseLU solver offers the possibility to reuse an analyzed pattern of a previous factorization; this may reduce total factorization time by a factor of 2 or 3, depending on the matrix type; however, if the matrix patterns heavily change between computations, this may even slow down performance; this flag is set for SparseMatrices in InitializeSolverData(...) and should be handled with care!"
+V,  reuseSparsityPattern,           ,               , bool,                 false,,P    , "[ONLY available for sparse matrices] True: the sparsity pattern of the first built sparse matrix is stored together with a map from triplets to matrix entries; in subsequent computations, matrix values are directly added into the stored compressed matrix, avoiding the sorting of triplets; the matrix is automatically rebuilt, if the pattern changes (e.g., due to contact); in combination with reuseAnalyzedPattern, also the pattern analysis of the Eigen SparseLU solver is skipped as long as the pattern does not change"
 V,  showCausingItems,               ,               , bool,                 true,, P    , "False: no output, if solver fails; True: if redundant equations appear, they are resolved such that according solution variables are set to zero; in case of redundant constraints, this may help, but it may lead to erroneous behaviour; for static problems, this may suppress static motion or resolve problems in case of instabilities, but should in general be considered with care!"
 #
 writeFile=SimulationSettings.h
@@ -322,8 +324,12 @@ V,  multithreadedLLimitLoads,       ,                 , PInt,                 20
 V,  multithreadedLLimitResiduals,   ,                 , PInt,                 20, ,P  , "compute RHS vectors, AE, and reaction forces multi-threaded; this is the limit number of objects from which on parallelization is used; flag is copied into MainSystem internal flag at InitializeSolverData(...)"
 V,  multithreadedLLimitJacobians,   ,                 , PInt,                 20, ,P  , "compute jacobians (ODE2, AE, ...) multi-threaded; this is the limit number of according objects from which on parallelization is used; flag is copied into MainSystem internal flag at InitializeSolverData(...)"
 V,  multithreadedLLimitMassMatrices,,                 , PInt,                 20, ,P  , "compute bodies mass matrices multi-threaded; this is the limit number of bodies from which on parallelization is used; flag is copied into MainSystem internal flag at InitializeSolverData(...)"
+V,  useColoringForResiduals,        ,                 , bool,                 false, ,P , "True: for multithreaded computation of ODE2 RHS, objects are grouped by a graph coloring computed at Assemble(), such that objects of one color do not share ODE2 coordinates and directly add their residuals into the system vector without a serial merge step; objects which cannot be colored within a limited number of colors (e.g., many connectors attached to one node) are still processed with thread-local vectors; False: all objects are processed with thread-local vectors which are merged serially"
+V,  useCostBalancedTasks,          ,                 , bool,                 false, ,P , "True: multithreaded computation of ODE2 RHS (of objects processed with thread-local vectors) and ODE2 jacobians of objects is split into tasks of similar computational cost, estimated with timestamps in the first and every 20th evaluation; improves load balance for models mixing cheap and expensive objects (e.g., mass points and ObjectFFRFreducedOrder); idle threads take the next remaining task; False: tasks have equal number of objects"
 V,  taskSplitMinItems,              ,                 , PInt,                 50,  ,P  , "number of items from which on the tasks are split into subtasks (which slightly increases threading performance; this may be critical for smaller number of objects, should be roughly between 50 and 5000; flag is copied into MainSystem internal flag at InitializeSolverData(...)"
 V,  taskSplitTasksPerThread,        ,                 , PInt,                 16,  ,P  , "this is the number of subtasks that every thread receives; minimum is 1, the maximum should not be larger than 100; this factor is 1 as long as the taskSplitMinItems is not reached; flag is copied into MainSystem internal flag at InitializeSolverData(...)"
+V,  workerSpinTime,                 ,                 , Real,                 -1, ,P  , "time in seconds that idle worker threads spin (busy wait) for a new parallel job before they are parked (suspended) until the next job; parking reduces CPU load of workers during serial sections (e.g., factorization, Python user functions, graphics), but adds wake-up latency to the next parallel job; negative value (default): pure busy waiting with lowest latency; positive values (e.g., 1e-3) are advantageous if more threads than free cores are used"
+V,  pinThreads,                     ,                 , bool,                 false, ,P , "True: worker thread i is pinned to CPU core i (Linux and Windows, ignored on MacOS), which avoids migration of threads between cores and may improve cache usage; main thread is not pinned"
 #
 writeFile=SimulationSettings.h
 
@@ -341,7 +347,7 @@ V,  parallel,                        ,                  , Parallel,
 V,  solutionSettings,               ,                  , SolutionSettings,              , , PS   , "settings for solution files"
 V,  staticSolver,                    ,                  , StaticSolverSettings,          , , PS       , "static solver parameters"
 V,  timeIntegration,                ,                  , TimeIntegrationSettings,         , , PS        , "time integration parameters"
-V,  linearSolverType,                ,                  , LinearSolverType,    "LinearSolverType::EXUdense", , P       , "selection of numerical linear solver: exu.LinearSolverType.EXUdense (dense matrix inverse), exu.LinearSolverType.EigenSparse (sparse matrix LU-factorization), ... (enumeration type)"
+V,  linearSolverType,                ,                  , LinearSolverType,    "LinearSolverType::EXUdense", , P       , "selection of numerical linear solver: exu.LinearSolverType.EXUdense (dense LU factorization with partial pivoting), exu.LinearSolverType.EigenSparse (sparse matrix LU-factorization), ... (enumeration type)"
 V,  cleanUpMemory,                  ,                 , bool,                false    , , P        , "True: solvers will free memory at exit (recommended for large systems); False: keep allocated memory for repeated computations to increase performance"
 V,  displayComputationTime,         ,                 , bool,                false    , , P        , "display computation time statistics at end of solving"
 V,  displayGlobalTimers,            ,                 , bool,                true     , , P        , "display global timer statistics at end of solving (e.g., for contact, but also for internal timings during development)"
@@ -404,6 +410,7 @@ V,      sphereTiling,                   ,                  ,     PInt,         "
 V,      axesTiling,                     ,                  ,     PInt,         "12",                   , P,      "global number of segments for drawing axes cylinders and cones (reduce this number, e.g. to 4, if many axes are drawn)"
 V,      threadSafeGraphicsUpdate,       ,                  ,     bool,         true,                   , P,      "true = updating of visualization is threadsafe, but slower for complicated models; deactivate this to speed up computation, but activate for generation of animations; may be improved in future by adding a safe visualizationUpdate state"
 V,      useMultiThreadedRendering,      ,                  ,     bool,         true,                   , P,      "true = rendering is done in separate thread; false = no separate thread, which may be more stable but has lagging interaction for large models (do not interact with models during simulation); set this parameter before call to exudyn.StartRenderer(); MAC OS: uses always false, because MAC OS does not support multi threaded GLFW"
+V,      graphicsUpdateThreads,          ,                  ,     PInt,         1,                      , P,      "number of threads for creating the graphics data of nodes, objects, markers and sensors in every graphics update; the items are split into contiguous ranges, which are drawn in parallel into per-thread buffers and concatenated in the original order; connectors and bodies are drawn in one thread if any object has a Python user function, bodies also if bodies.cacheRigidBodyGraphics is True"
 #
 writeFile=VisualizationSettings.h
 
@@ -496,6 +503,7 @@ V,      showNumbers,                ,                  ,     bool,         false
 V,      defaultSize,                ,                  3,    Float3,       "Float3({1.f,1.f,1.f})",    , P,    "global body size of xyz-cube"
 V,      defaultColor,               ,                  4,    Float4,       "Float4({0.3f,0.3f,1.f,1.f})",, P,  "default RGBA color for bodies; 4th value is "
 V,      deformationScaleFactor,     ,                  ,     float,        "1",                        , P,    "global deformation scale factor; also applies to nodes, if drawn; used for scaled drawing of (linear) finite elements, beams, etc."
+V,      cacheRigidBodyGraphics,     ,                  ,     bool,         false,                      , P,    "if True, graphics of rigid bodies (e.g. STL meshes in graphicsData) are copied only once and afterwards only transformed with the body motion in every graphics update, which strongly reduces the update time for scenes with many triangles; changes of body graphics without changes of the system, such as with ModifyObject or SetObjectParameter, are detected; contour plots and user functions are not cached"
 V,      beams,                      ,                  ,     VSettingsBeams,   ,                       , PS,   "visualization settings for beams (e.g. ANCFCable or other beam elements)"
 V,      kinematicTree,              ,                  ,     VSettingsKinematicTree,   ,               , PS,   "visualization settings for kinematic tree"
 #
@@ -754,6 +762,7 @@ V,      saveImageAsTextTriangles,       ,                  ,     bool,         f
 V,      saveImageAsTextTexts,           ,                  ,     bool,         false,                  , P,      "export text in save image (only in TXT format)"
 V,      widthAlignment,                 ,                  ,     PInt,         4,                      , P,      "alignment of exported image width; using a value of 4 helps to reduce problems with video conversion (additional vertical lines are lost)"
 V,      heightAlignment,                ,                  ,     PInt,         2,                      , P,      "alignment of exported image height; using a value of 2 helps to reduce problems with video conversion (additional horizontal lines are lost)"
+V,      useSoftwareRenderer,            ,                  ,     bool,         false,                  , P,      "if True and no OpenGL renderer is running, images requested by RedrawAndSaveImage() or SolutionSettings.recordImagesInterval are rendered by a CPU software rasterizer in a separate thread and saved as PNG or TGA, while the simulation continues; works without window, display or graphics card, e.g., on cluster computers; image size is given by window.renderWindowSize, view by openGL.initial... settings and general.autoFitScene; texts are drawn with a simple line font, shadows and highlighting are not drawn"
 #
 writeFile=VisualizationSettings.h
 
@@ -932,7 +941,7 @@ Vp,     jacobianAEsparse,           ,                  ,     GeneralMatrixEigenS
 #
 #now done with addConstructor flag; F,      SolverLocalData,            ,                ,     ,             "SetLinearSolverType(LinearSolverType::EXUdense);", ,   P,  "for safety, data is linked immediately to dense matrices"
 F,      CleanUpMemory,              ,                ,     void,         ,                       ,    DP,  "if desired, temporary data is cleaned up to safe memory"
-F,      SetLinearSolverType,        ,                ,     void,         ,                       "LinearSolverType linearSolverType, bool reuseAnalyzedPattern=false, bool ignoreSingularJacobian=false, Real pivotThreshold=0.",   DP,  "set linear solver type and matrix version: links system matrices to according dense/sparse versions and with option for singular jacobian (redundant constraints)"
+F,      SetLinearSolverType,        ,                ,     void,         ,                       "LinearSolverType linearSolverType, bool reuseAnalyzedPattern=false, bool ignoreSingularJacobian=false, Real pivotThreshold=0., bool reuseSparsityPattern=false",   DP,  "set linear solver type and matrix version: links system matrices to according dense/sparse versions and with option for singular jacobian (redundant constraints)"
 F,      GetLinearSolverType,        ,                ,     LinearSolverType, "return linearSolverType;", ,   CPV,  "return current linear solver type (dense/sparse)"
 #
 writeFile=CSolverStructures.h
@@ -1031,6 +1040,7 @@ V,      lastDiscontinuousIterationsCount, ,            ,     Index,        0,
 #for parallel
 V,      numberOfThreadsUsed,        ,                  ,     Index,        1,                      ,   P,    "number of threads that have been used in simulation"
 V,      multiThreadingMode,         ,                  ,     Index,        0,                      ,   P,    "multithreading mode that has been used: 0=None (serial), 1=NGsolve taskmanager, 2=MicroThreading (Exudyn)"
+V,      releasedGIL,                ,                  ,     bool,         false,                  ,   P,    "true, if Python GIL has been released during SolveSteps(...), such that other Python threads can run in parallel; GIL is only released for numberOfThreads=1 without renderer and without Python user functions"
 #
 F,      InitializeData,             ,                ,     void,         "*this = SolverOutputData();",,P, "initialize SolverOutputData by assigning default values"
 #
@@ -1045,6 +1055,8 @@ V,      solutionFile,               ,                  ,     std::ofstream,,
 V,      solverFile,                 ,                  ,     std::ofstream,,                       ,    ,    "file with detailed solver information"
 V,      sensorFileList,             ,                  ,     std::vector<std::ofstream*>,,         ,    ,    "files for sensor output; the ofstream list corresponds exactly to the sensors in the computationalSystem (i.e., sensorFileList[0] is the ofstream for sensor 0, etc.); file lists need to be closed and deleted at end of simulation!"
 V,      binaryFileSettings,         ,                  ,     ExuFile::BinaryFileSettings,,         ,    ,    "settings for binary file write mode"
+V,      sensorsBinaryWriter,        ,                  ,     ExuFile::AsyncFileWriter,,            ,    ,    "background writer for binary sensor files (sensorsBinaryFiles=True); writes to the files in sensorFileList and must be finished before these files are closed"
+V,      sensorsBinaryColumns,       ,                  ,     ArrayIndex,,                          ,    ,    "number of columns (time + sensor values) per sensor in binary sensor files, as written to file header; used to check that the number of sensor values does not change"
 #
 #F,      InitializeData,             ,                ,     void,         "*this = SolverOutputData();",,P, "initialize SolverOutputData by assigning default values"
 #